@@ -0,0 +1,60 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+namespace vsag {
+
+class CancellationToken;
+using CancellationTokenPtr = std::shared_ptr<CancellationToken>;
+
+/**
+ * @brief Lets a caller abort searches that are already running.
+ *
+ * Share one token between the caller and any number of SearchRequest objects; after Cancel()
+ * every search holding the token stops at its next check and returns the results found so far,
+ * with "is_cancelled" set in the result statistics. A token cannot be reset.
+ */
+class CancellationToken {
+public:
+    CancellationToken() = default;
+
+    CancellationToken(const CancellationToken&) = delete;
+    CancellationToken&
+    operator=(const CancellationToken&) = delete;
+
+    /**
+     * @brief Requests cancellation, safe to call from any thread and more than once.
+     */
+    void
+    Cancel() noexcept {
+        cancelled_.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief Whether Cancel() has been called.
+     */
+    [[nodiscard]] bool
+    IsCancelled() const noexcept {
+        return cancelled_.load(std::memory_order_acquire);
+    }
+
+private:
+    std::atomic<bool> cancelled_{false};
+};
+
+}  // namespace vsag
@@ -74,6 +74,7 @@ extern const char* const REPR_DENSE;
 extern const char* const REPR_SPARSE;
 extern const char* const REPR_MULTI_VECTOR;
 extern const char* const PARAMETER_USE_OLD_SERIAL_FORMAT;
+extern const char* const PARAMETER_MEMORY_LIMIT;
 
 extern const char* const ODESCENT_PARAMETER_ALPHA;
 extern const char* const ODESCENT_PARAMETER_GRAPH_ITER_TURN;
@@ -203,6 +204,7 @@ extern const char* const HGRAPH_PRECISE_FILE_PATH;
 extern const char* const HGRAPH_PRECISE_DIRECT_READ;
 extern const char* const HGRAPH_PARAMETER_EF_RUNTIME;
 extern const char* const HGRAPH_PARAMETER_HOPS_LIMIT;
+extern const char* const HGRAPH_PARAMETER_EARLY_STOP_PATIENCE;
 extern const char* const HGRAPH_PARAMETER_RABITQ_ONE_BIT_SEARCH;
 extern const char* const HGRAPH_PARAMETER_BRUTE_FORCE_THRESHOLD;
 extern const char* const HGRAPH_PARAMETER_SKIP_RATIO;
@@ -226,6 +228,18 @@ extern const char* const STORE_RAW_VECTOR;
 extern const char* const RAW_VECTOR_IO_TYPE;
 extern const char* const RAW_VECTOR_FILE_PATH;
 extern const char* const HGRAPH_PERSIST_SOURCE_ID;
+extern const char* const HGRAPH_MERGE_MODE;
+extern const char* const HGRAPH_MERGE_MODE_REBUILD;
+extern const char* const HGRAPH_MERGE_MODE_INCREMENTAL;
+extern const char* const HGRAPH_NUMA_REPLICAS;
+extern const char* const HGRAPH_PARTITION_BUILD_COUNT;
+extern const char* const HGRAPH_PARTITION_BUILD_MEMORY_BUDGET;
+extern const char* const HGRAPH_BASE_IO_NUMA_INTERLEAVE;
+extern const char* const HGRAPH_GRAPH_IO_NUMA_INTERLEAVE;
+extern const char* const HGRAPH_BASE_IO_HUGE_PAGE;
+extern const char* const HGRAPH_PRECISE_IO_HUGE_PAGE;
+extern const char* const HGRAPH_PRECISE_HOT_CODES_SIZE;
+extern const char* const HGRAPH_GRAPH_IO_HUGE_PAGE;
 extern const char* const PYRAMID_PERSIST_SOURCE_ID;
 
 extern const char* const BRUTE_FORCE_BASE_QUANTIZATION_TYPE;
@@ -237,10 +251,13 @@ extern const char* const BRUTE_FORCE_PRECISE_IO_TYPE;
 extern const char* const BRUTE_FORCE_PRECISE_FILE_PATH;
 extern const char* const BRUTE_FORCE_THREAD_COUNT;
 extern const char* const BRUTE_FORCE_USE_RESIDUAL;
+extern const char* const WARP_RESIDUAL_CENTROIDS;
 
 extern const char* const IVF_USE_RESIDUAL;
 extern const char* const IVF_USE_REORDER;
 extern const char* const IVF_TRAIN_TYPE;
+extern const char* const IVF_KMEANS_ALGORITHM;
+extern const char* const IVF_KMEANS_MINI_BATCH_SIZE;
 extern const char* const IVF_BUCKETS_COUNT;
 extern const char* const IVF_BASE_QUANTIZATION_TYPE;
 extern const char* const IVF_BASE_IO_TYPE;
@@ -256,6 +273,9 @@ extern const char* const IVF_PRECISE_FILE_PATH;
 extern const char* const IVF_PRECISE_CODES_LAYOUT;
 extern const char* const IVF_PRECISE_CODES_LAYOUT_FLAT;
 extern const char* const IVF_PRECISE_CODES_LAYOUT_BUCKET;
+extern const char* const IVF_PRECISE_HOT_CODES_SIZE;
+extern const char* const IVF_REBALANCE_SPLIT_RATIO;
+extern const char* const IVF_REBALANCE_MERGE_RATIO;
 extern const char* const USE_ATTRIBUTE_FILTER;
 extern const char* const IVF_THREAD_COUNT;
 
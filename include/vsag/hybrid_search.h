@@ -0,0 +1,113 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "vsag/dataset.h"
+#include "vsag/errors.h"
+#include "vsag/expected.hpp"
+#include "vsag/index.h"
+#include "vsag/search_request.h"
+#include "vsag/thread_pool.h"
+
+namespace vsag {
+
+/**
+ * @brief How HybridSearch merges the candidate lists of its two indexes.
+ */
+enum class HybridFusionType {
+    /// min-max normalized similarities combined with dense_weight_ and sparse_weight_
+    WEIGHTED_SUM = 1,
+    /// reciprocal rank fusion, weight / (rrf_k_ + rank) summed over both lists
+    RRF = 2,
+};
+
+/**
+ * @brief One hybrid query over a dense and a sparse index sharing the same labels.
+ */
+class HybridSearchRequest {
+public:
+    /**
+     * @brief KNN request sent to the dense index as-is
+     * @details query_ holds the dense vector, topk_ is the number of candidates fetched from
+     *          the dense side. Filters, params_str_ and deadlines apply to this side only.
+     */
+    SearchRequest dense_request_{};
+
+    /**
+     * @brief KNN request sent to the sparse index as-is
+     * @details query_ holds the sparse vector, topk_ is the number of candidates fetched from
+     *          the sparse side.
+     */
+    SearchRequest sparse_request_{};
+
+    /**
+     * @brief Number of results returned after fusion and rerank
+     */
+    int64_t topk_{10};
+
+    HybridFusionType fusion_type_{HybridFusionType::WEIGHTED_SUM};
+
+    /**
+     * @brief Weights of the two sides, used by both fusion types and by the rerank
+     */
+    float dense_weight_{0.5F};
+    float sparse_weight_{0.5F};
+
+    /**
+     * @brief Rank offset of reciprocal rank fusion, only used by HybridFusionType::RRF
+     */
+    uint32_t rrf_k_{60};
+
+    /**
+     * @brief Rerank the fused union with exact distances from both indexes
+     * @details When true, CalcDistancesById computes the exact distance of every candidate on
+     *          both indexes. Each side is min-max normalized over the candidates like
+     *          HybridFusionType::WEIGHTED_SUM, combined with dense_weight_ and sparse_weight_,
+     *          and the topk_ best are returned with the negated score as distance. Candidates
+     *          missing from either index are dropped. When false, the fused ranking is returned
+     *          with the negated fusion score as distance.
+     */
+    bool enable_rerank_{true};
+
+    /**
+     * @brief Pool running the sparse search while the caller runs the dense one
+     * @details Pass the pool given to the indexes' Resource. When nullptr, the two searches
+     *          run one after the other on the calling thread. When no worker has started the
+     *          sparse search by the time the dense one finishes, the caller runs it itself, so
+     *          the caller may be a worker of this pool.
+     */
+    ThreadPool* thread_pool_{nullptr};
+};
+
+/**
+ * @brief Searches a dense and a sparse index with one request and returns one fused top-k.
+ *
+ * Both indexes must store the same documents under the same labels, e.g. HGraph over dense
+ * embeddings and SINDI over SPLADE vectors. The result statistics hold the statistics of each
+ * side under "dense" and "sparse".
+ *
+ * @param dense_index index searched with request.dense_request_
+ * @param sparse_index index searched with request.sparse_request_
+ * @param request the hybrid query
+ * @return result with one query, ids and distances of up to request.topk_ entries, ascending
+ */
+tl::expected<DatasetPtr, Error>
+HybridSearch(const IndexPtr& dense_index,
+             const IndexPtr& sparse_index,
+             const HybridSearchRequest& request);
+
+}  // namespace vsag
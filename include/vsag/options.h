@@ -131,6 +131,33 @@ public:
     void
     set_direct_IO_object_align_bit(uint64_t align_bit);
 
+    /**
+     * @brief Gets whether workers of the default thread pool are pinned to NUMA nodes.
+     *
+     * This function retrieves the NUMA thread affinity switch.
+     * It is thread-safe, using memory order acquire operations.
+     *
+     * @return bool True if each worker is pinned to the cpus of one NUMA node.
+     */
+    [[nodiscard]] inline bool
+    numa_thread_affinity() const {
+        return numa_thread_affinity_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Sets whether workers of the default thread pool are pinned to NUMA nodes.
+     *
+     * Workers are spread round-robin over the online nodes and restricted to the cpus of their
+     * node, so memory they first touch and per-node index replicas stay local. It only affects
+     * thread pools created after the call and is a no-op on single node hosts.
+     *
+     * @param enable Whether to pin the workers.
+     */
+    inline void
+    set_numa_thread_affinity(bool enable) {
+        numa_thread_affinity_.store(enable, std::memory_order_release);
+    }
+
     /**
      * @brief Gets the current logger instance.
      *
@@ -179,6 +206,9 @@ private:
     ///< A flag to ensure that the set_direct_IO_object_align_bit() is called only once.
     std::atomic<bool> direct_IO_object_align_bit_flag{false};
 
+    ///< Whether default thread pool workers are pinned to NUMA nodes (default is false).
+    std::atomic<bool> numa_thread_affinity_{false};
+
     ///< Pointer to the logger instance.
     Logger* logger_ = nullptr;
 };
@@ -16,12 +16,16 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 #include "vsag/allocator.h"
 #include "vsag/thread_pool.h"
 
 namespace vsag {
 
+class MemoryBudget;
+
 /**
  * @class Resource
  * @brief A class for managing resources, primarily focused on memory allocation.
@@ -96,12 +100,55 @@ public:
         return this->thread_pool_;
     }
 
+    /**
+     * @brief Retrieves the memory budget shared by the indexes created on this resource.
+     *
+     * @return std::shared_ptr<MemoryBudget> The memory budget, never null.
+     */
+    [[nodiscard]] virtual std::shared_ptr<MemoryBudget>
+    GetMemoryBudget() const {
+        return this->memory_budget_;
+    }
+
+    /**
+     * @brief Sets the global memory limit of all indexes created on this resource.
+     *
+     * After the first call, every index created on this resource charges its allocations
+     * (index data, visited lists, search-time buffers and read caches) to the budget. An
+     * allocation that would exceed the limit first shrinks the read caches, then fails with
+     * NO_ENOUGH_MEMORY, so Build/Add return an error instead of the process running out of
+     * memory.
+     * Indexes created before the first call are not accounted; pass 0 to only account usage.
+     *
+     * @param limit The limit in bytes, 0 means unlimited.
+     */
+    void
+    SetMemoryLimit(uint64_t limit);
+
+    /**
+     * @brief Retrieves the global memory limit, 0 means unlimited.
+     */
+    [[nodiscard]] uint64_t
+    GetMemoryLimit() const;
+
+    /**
+     * @brief Retrieves the accounted memory usage of all indexes on this resource.
+     *
+     * @return The bytes per category ("index", "visited_list", "search", "io_cache") plus
+     *         "total", "limit" and "index_count".
+     */
+    [[nodiscard]] std::unordered_map<std::string, uint64_t>
+    GetMemoryUsageDetail() const;
+
 private:
     ///< Shared pointer to the allocator associated with this resource.
     std::shared_ptr<Allocator> allocator_ = nullptr;
 
     ///< Shared pointer to the thread pool associated with this resource.
     std::shared_ptr<ThreadPool> thread_pool_ = nullptr;
+
+    ///< Shared pointer to the memory budget of the indexes created on this resource.
+    std::shared_ptr<MemoryBudget> memory_budget_ = nullptr;
 };
 
 }  // namespace vsag
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include <optional>
@@ -22,6 +23,7 @@
 
 #include "vsag/allocator.h"
 #include "vsag/bitset.h"
+#include "vsag/cancellation_token.h"
 #include "vsag/dataset.h"
 #include "vsag/filter.h"
 #include "vsag/iterator_context.h"
@@ -225,6 +227,25 @@ public:
      *          the specified buckets. Empty means "use default bucket routing".
      */
     std::vector<std::vector<int64_t>> bucket_ids_{};
+
+    // for early termination
+    /**
+     * @brief Optional token to abort the search while it is running
+     * @details The search polls the token cooperatively in its traversal, scan and reorder
+     *          loops. Once cancelled, it stops and returns the results found so far; the result
+     *          statistics report "is_cancelled" and "is_partial" as true and "terminated_phase"
+     *          as the phase that was running. Default is nullptr (not cancellable).
+     */
+    CancellationTokenPtr cancellation_token_{nullptr};
+
+    /**
+     * @brief Optional absolute deadline for the search
+     * @details Checked at the same points as cancellation_token_. When both this and the
+     *          "timeout_ms" search parameter are set, whichever expires first applies. An
+     *          expired search returns its partial results with "is_timeout" and "is_partial"
+     *          set in the result statistics. Default is unset (no deadline).
+     */
+    std::optional<std::chrono::steady_clock::time_point> deadline_{std::nullopt};
 };
 
 }  // namespace vsag
@@ -40,12 +40,14 @@ init();
 #include "vsag/attribute.h"
 #include "vsag/binaryset.h"
 #include "vsag/bitset.h"
+#include "vsag/cancellation_token.h"
 #include "vsag/constants.h"
 #include "vsag/dataset.h"
 #include "vsag/engine.h"
 #include "vsag/errors.h"
 #include "vsag/expected.hpp"
 #include "vsag/factory.h"
+#include "vsag/hybrid_search.h"
 #include "vsag/index.h"
 #include "vsag/index_detail_info.h"
 #include "vsag/index_features.h"
@@ -40,6 +40,8 @@ typedef struct Error {
 
 typedef void* vsag_index_t; /** The vsag index handle. */
 
+typedef void* vsag_bitset_t; /** The vsag bitset handle, a set bit excludes the id from search. */
+
 typedef bool (*FilterFunc_t)(int64_t id);
 typedef struct SearchResult {
     float* dists;       /** The distances of the results. */
@@ -48,6 +50,9 @@ typedef struct SearchResult {
     void* other_result; /** The other result of the search. */
 } SearchResult_t;       /** The search result. */
 
+/** Completion callback of the asynchronous searches, called once from a worker thread. */
+typedef void (*SearchCallback_t)(Error_t error, void* user_data);
+
 /** Opt in to statistics for the next search writing @p search_result. */
 Error_t
 vsag_search_result_enable_statistics(SearchResult_t* search_result);
@@ -215,6 +220,149 @@ vsag_index_range_search_with_filter(vsag_index_t index,
                                     FilterFunc_t filter,
                                     SearchResult_t* search_result);
 
+/**
+ * @brief Create an empty bitset.
+ *
+ * @return vsag_bitset_t The vsag bitset handle, NULL on failure.
+ */
+vsag_bitset_t
+vsag_bitset_create();
+
+/**
+ * @brief Destroy the bitset. Searches already scheduled with it are not affected.
+ *
+ * @param bitset The vsag bitset handle.
+ * @return Error_t The error code.
+ */
+Error_t
+vsag_bitset_destroy(vsag_bitset_t bitset);
+
+/**
+ * @brief Set or clear the bits of a batch of ids.
+ *
+ * @param bitset The vsag bitset handle.
+ * @param ids The ids to update.
+ * @param count The count of the ids.
+ * @param value True to exclude the ids from search, false to include them again.
+ * @return Error_t The error code.
+ */
+Error_t
+vsag_bitset_set(vsag_bitset_t bitset, const int64_t* ids, uint64_t count, bool value);
+
+/**
+ * @brief Test the bit of an id.
+ *
+ * @param bitset The vsag bitset handle.
+ * @param id The id to test.
+ * @return bool Whether the id is excluded, false for a NULL bitset.
+ */
+bool
+vsag_bitset_test(const vsag_bitset_t bitset, int64_t id);
+
+/**
+ * @brief Knn Search a batch of queries, writing into caller-provided buffers.
+ *
+ * The result of query i occupies ids[i * k, (i + 1) * k) and dists[i * k, (i + 1) * k);
+ * slots beyond counts[i] hold id -1 and an infinite distance.
+ *
+ * @param index The vsag index handle.
+ * @param queries The query data, query_count * dim floats, row major.
+ * @param dim The dimension of the query data.
+ * @param query_count The count of the queries.
+ * @param k The top k results.
+ * @param parameters The parameters of the search.
+ * @param invalid The ids excluded from the results, may be NULL.
+ * @param ids The output ids, query_count * k.
+ * @param dists The output distances, query_count * k.
+ * @param counts The output result counts, query_count.
+ * @return Error_t The error code of the first failed query.
+ */
+Error_t
+vsag_index_knn_search_batch(vsag_index_t index,
+                            const float* queries,
+                            uint64_t dim,
+                            uint64_t query_count,
+                            int64_t k,
+                            const char* parameters,
+                            const vsag_bitset_t invalid,
+                            int64_t* ids,
+                            float* dists,
+                            int64_t* counts);
+
+/**
+ * @brief Range Search a batch of queries, writing into caller-provided buffers.
+ *
+ * Same layout as vsag_index_knn_search_batch, k caps the results of each query.
+ *
+ * @param index The vsag index handle.
+ * @param queries The query data, query_count * dim floats, row major.
+ * @param dim The dimension of the query data.
+ * @param query_count The count of the queries.
+ * @param radius The radius of the search.
+ * @param k The maximum number of results per query (must be >= 1).
+ * @param parameters The parameters of the search.
+ * @param invalid The ids excluded from the results, may be NULL.
+ * @param ids The output ids, query_count * k.
+ * @param dists The output distances, query_count * k.
+ * @param counts The output result counts, query_count.
+ * @return Error_t The error code of the first failed query.
+ */
+Error_t
+vsag_index_range_search_batch(vsag_index_t index,
+                              const float* queries,
+                              uint64_t dim,
+                              uint64_t query_count,
+                              float radius,
+                              int64_t k,
+                              const char* parameters,
+                              const vsag_bitset_t invalid,
+                              int64_t* ids,
+                              float* dists,
+                              int64_t* counts);
+
+/**
+ * @brief Asynchronous vsag_index_knn_search_batch on the shared search thread pool.
+ *
+ * The queries and the output buffers must stay valid until the callback runs; the index and
+ * the bitset may be destroyed earlier. The callback is invoked exactly once if, and only if,
+ * the call returns VSAG_SUCCESS.
+ *
+ * @param callback The completion callback, receives the error of the first failed query.
+ * @param user_data Passed through to the callback.
+ * @return Error_t The error code of scheduling the search.
+ */
+Error_t
+vsag_index_knn_search_batch_async(vsag_index_t index,
+                                  const float* queries,
+                                  uint64_t dim,
+                                  uint64_t query_count,
+                                  int64_t k,
+                                  const char* parameters,
+                                  const vsag_bitset_t invalid,
+                                  int64_t* ids,
+                                  float* dists,
+                                  int64_t* counts,
+                                  SearchCallback_t callback,
+                                  void* user_data);
+
+/**
+ * @brief Asynchronous vsag_index_range_search_batch, see vsag_index_knn_search_batch_async.
+ */
+Error_t
+vsag_index_range_search_batch_async(vsag_index_t index,
+                                    const float* queries,
+                                    uint64_t dim,
+                                    uint64_t query_count,
+                                    float radius,
+                                    int64_t k,
+                                    const char* parameters,
+                                    const vsag_bitset_t invalid,
+                                    int64_t* ids,
+                                    float* dists,
+                                    int64_t* counts,
+                                    SearchCallback_t callback,
+                                    void* user_data);
+
 /**
  * @brief Clone the index.
  *
@@ -47,6 +47,9 @@ namespace {
 
 constexpr const char* WARP_MODE_MARKER = "_warp_mode";
 
+// how many vectors a scan worker compares between two deadline checks
+constexpr InnerIdType STOP_CHECK_INTERVAL = 1024;
+
 void
 require_string_member(const JsonType& json, const std::string& key) {
     CHECK_ARGUMENT(json[key].IsString(),
@@ -417,6 +420,8 @@ BruteForce::SearchWithRequest(const SearchRequest& request) const {
     Filter* attr_filter = nullptr;
 
     auto brute_force_params = BruteForceSearchParameters::FromJson(request.params_str_);
+    const auto deadline = SearchDeadline::Make(brute_force_params.timeout_ms, &request);
+    query_context.deadline = deadline.get();
     FilterPtr ft =
         this->create_search_filter(request.filter_, brute_force_params.use_extra_info_filter);
 
@@ -516,6 +521,9 @@ BruteForce::SearchWithRequest(const SearchRequest& request) const {
         // legacy IO counters, but suppress only the datacell's per-call distance aggregation.
         local_query_context.track_distance_evaluations = false;
         for (InnerIdType i = start; i < end; ++i) {
+            if ((i - start) % STOP_CHECK_INTERVAL == 0 and local_query_context.ShouldStop()) {
+                break;
+            }
             if (attr_filter != nullptr and not attr_filter->CheckValid(i)) {
                 if (reasoning != nullptr) {
                     reasoning->RecordFilterReject(i);
@@ -1082,7 +1090,8 @@ BruteForce::InitFeatures() {
         }
     } else {
         if (name != QUANTIZATION_TYPE_VALUE_FP32 and name != QUANTIZATION_TYPE_VALUE_BF16 and
-            name != QUANTIZATION_TYPE_VALUE_FP16) {
+            name != QUANTIZATION_TYPE_VALUE_FP16 and name != QUANTIZATION_TYPE_VALUE_FP8_E4M3 and
+            name != QUANTIZATION_TYPE_VALUE_FP8_E5M2) {
             this->index_feature_list_->SetFeature(IndexFeature::NEED_TRAIN);
         } else {
             this->index_feature_list_->SetFeatures(
@@ -1254,6 +1263,13 @@ BruteForce::CheckAndMappingExternalParam(const JsonType& external_param,
                     IO_FILE_PATH_KEY,
                 },
             },
+            {
+                WARP_RESIDUAL_CENTROIDS,
+                {
+                    BASE_CODES_KEY,
+                    MULTI_VECTOR_RESIDUAL_CENTROIDS_KEY,
+                },
+            },
         };
 
         if (common_param.data_type_ == DataTypes::DATA_TYPE_INT8) {
@@ -77,6 +77,11 @@ HGraph::HGraph(const HGraphParameterPtr& hgraph_param, const vsag::IndexCommonPa
                             "HGraph deduplicate_storage only supports nsw graph");
     }
     this->persist_source_id_ = hgraph_param->persist_source_id;
+    this->incremental_merge_ = hgraph_param->merge_mode == HGRAPH_MERGE_MODE_INCREMENTAL;
+    this->numa_replicas_ = hgraph_param->numa_replicas;
+    this->partition_build_count_ = hgraph_param->partition_build_count;
+    this->partition_build_memory_budget_ = hgraph_param->partition_build_memory_budget;
+    this->precise_hot_codes_size_ = hgraph_param->precise_hot_codes_size;
     if (this->using_dedup_storage()) {
         this->code_slot_map_ = std::make_shared<CodeSlotMap>(allocator_);
     }
@@ -127,6 +132,7 @@ HGraph::HGraph(const HGraphParameterPtr& hgraph_param, const vsag::IndexCommonPa
                 this->raw_vector_, this->code_slot_map_, allocator_, &this->total_count_);
         }
     }
+    this->searcher_->BindSpecializedKernel(this->bottom_graph_, this->basic_flatten_codes_);
     resize(bottom_graph_->max_capacity_);
 }
 
@@ -306,6 +312,7 @@ HGraph::Tune(const std::string& parameters, bool disable_future_tuning) {
             check_and_init_raw_vector(param->raw_vector_param, common_param, false);
         }
         init_resize_bit_and_reorder();
+        this->searcher_->BindSpecializedKernel(this->bottom_graph_, this->basic_flatten_codes_);
 
         // set status
         if (disable_future_tuning) {
@@ -498,6 +505,13 @@ HGraph::Merge(const std::vector<MergeUnit>& merge_units) {
     if (max_capacity_ < total_count) {
         this->resize(total_count);
     }
+    std::vector<MergeShard> shards;
+    if (this->total_count_ > 0) {
+        shards.push_back(MergeShard{0,
+                                    static_cast<InnerIdType>(this->total_count_),
+                                    this->entry_point_id_,
+                                    this->route_graphs_.size()});
+    }
     for (const auto& merge_unit : merge_units) {
         const auto other_index = std::dynamic_pointer_cast<HGraph>(
             std::dynamic_pointer_cast<IndexImpl<HGraph>>(merge_unit.index)->GetInnerIndex());
@@ -516,14 +530,28 @@ HGraph::Merge(const std::vector<MergeUnit>& merge_units) {
             high_precise_codes_->MergeOther(other_index->high_precise_codes_, logical_bias);
         }
         bottom_graph_->MergeOther(other_index->bottom_graph_, logical_bias);
-        if (route_graphs_.size() < other_index->route_graphs_.size()) {
+        while (route_graphs_.size() < other_index->route_graphs_.size()) {
             route_graphs_.push_back(this->generate_one_route_graph());
         }
-        for (int j = 0; j < std::min(other_index->route_graphs_.size(), route_graphs_.size());
-             ++j) {
+        for (int j = 0; j < other_index->route_graphs_.size(); ++j) {
             route_graphs_[j]->MergeOther(other_index->route_graphs_[j], logical_bias);
         }
         this->total_count_ += other_index->GetNumElements();
+        if (other_index->GetNumElements() > 0 and
+            other_index->entry_point_id_ != INVALID_ENTRY_POINT) {
+            shards.push_back(
+                MergeShard{static_cast<InnerIdType>(logical_bias),
+                           static_cast<InnerIdType>(this->total_count_),
+                           static_cast<InnerIdType>(other_index->entry_point_id_ + logical_bias),
+                           other_index->route_graphs_.size()});
+        }
+    }
+    if (this->incremental_merge_) {
+        this->merge_incremental(shards);
+        if (this->mci_parameters_.enabled) {
+            this->build_mci_clique_index();
+        }
+        return;
     }
     if (this->odescent_param_ == nullptr) {
         odescent_param_ = std::make_shared<ODescentParameter>();
@@ -589,6 +617,9 @@ HGraph::SetImmutable() {
     this->searcher_->SetMutexArray(empty_mutex);
     this->parallel_searcher_->SetMutexArray(empty_mutex);
     this->neighbors_mutex_ = empty_mutex;
+    if (this->numa_replicas_) {
+        this->build_numa_replicas();
+    }
     this->immutable_.store(true, std::memory_order_release);
 }
 
@@ -660,14 +691,29 @@ HGraph::GetStats() const {
         stats["mci_memory_usage"].SetInt(
             static_cast<int64_t>(this->mci_cliques_->GetMemoryUsage()));
     }
+    if (this->tiered_precise_codes_ != nullptr) {
+        const auto& tier = this->tiered_precise_codes_;
+        stats["precise_hot_codes_count"].SetUint64(tier->GetHotCount());
+        stats["precise_hot_codes_capacity"].SetUint64(tier->GetCapacity());
+        stats["precise_hot_codes_memory_usage"].SetUint64(tier->GetMemoryUsage());
+        stats["reorder_memory_fetch_count"].SetUint64(tier->GetMemoryFetchCount());
+        stats["reorder_disk_fetch_count"].SetUint64(tier->GetDiskFetchCount());
+    }
     return stats.Dump(4);
 }
 
 void
 HGraph::init_resize_bit_and_reorder() {
+    this->tiered_precise_codes_ = nullptr;
     if (use_reorder_) {
         auto reorder_codes = this->get_reorder_codes();
-        reorder_ = std::make_shared<FlattenReorder>(reorder_codes, allocator_);
+        if (this->precise_hot_codes_size_ > 0 and has_precise_reorder() and
+            TieredPreciseCodes::Supports(reorder_codes)) {
+            this->tiered_precise_codes_ = std::make_shared<TieredPreciseCodes>(
+                reorder_codes, this->precise_hot_codes_size_, allocator_);
+        }
+        reorder_ = std::make_shared<FlattenReorder>(
+            reorder_codes, allocator_, this->tiered_precise_codes_);
     }
 }
 
@@ -793,6 +839,9 @@ HGraph::UpdateVector(int64_t id, const DatasetPtr& new_base, bool force_update)
     bool update_status = basic_flatten_codes_->UpdateVector(new_base_vec, inner_id);
     if (has_precise_reorder()) {
         update_status = update_status && high_precise_codes_->UpdateVector(new_base_vec, inner_id);
+        if (tiered_precise_codes_ != nullptr) {
+            tiered_precise_codes_->Invalidate(inner_id);
+        }
     }
     return update_status;
 }
@@ -828,6 +877,9 @@ HGraph::cal_memory_usage() {
     if (has_precise_reorder()) {
         memory += this->high_precise_codes_->GetMemoryUsage();
     }
+    if (this->tiered_precise_codes_ != nullptr) {
+        memory += this->tiered_precise_codes_->GetMemoryUsage();
+    }
 
     if (this->extra_infos_ != nullptr and this->extra_info_size_ > 0) {
         memory += this->extra_infos_->GetMemoryUsage();
@@ -839,6 +891,12 @@ HGraph::cal_memory_usage() {
     if (this->mci_cliques_ != nullptr) {
         memory += this->mci_cliques_->GetMemoryUsage();
     }
+    for (const auto& replica : this->numa_replica_list_) {
+        if (replica.bottom_graph != nullptr and replica.bottom_graph != this->bottom_graph_) {
+            memory += replica.bottom_graph->GetMemoryUsage();
+            memory += replica.basic_flatten_codes->GetMemoryUsage();
+        }
+    }
 
     std::unique_lock lock(this->memory_usage_mutex_);
     this->current_memory_usage_.store(memory);
@@ -24,6 +24,7 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "../inner_index_interface.h"
 #include "algorithm/build_cache.h"
@@ -325,6 +326,30 @@ public:
     std::vector<int64_t>
     build_by_odescent(const DatasetPtr& data);
 
+    [[nodiscard]] bool
+    use_partition_build() const {
+        return this->partition_build_count_ > 0 or this->partition_build_memory_budget_ > 0;
+    }
+
+    /// Build the bottom graph partition by partition and merge the overlapping partition graphs.
+    /// Only the graph construction is bounded, data and the persistent codes stay in memory.
+    std::vector<int64_t>
+    build_by_partitions(const DatasetPtr& data);
+
+    /// Cluster the rows of data and return, per partition, the positions assigned to it.
+    Vector<Vector<uint32_t>>
+    assign_build_partitions(const DatasetPtr& data, const Vector<int64_t>& valid_indices) const;
+
+    /// Build one partition graph on temporary codes and merge it into bottom_graph_.
+    void
+    build_partition_graph(const DatasetPtr& data,
+                          const Vector<int64_t>& valid_indices,
+                          const Vector<InnerIdType>& inner_ids,
+                          const Vector<uint32_t>& members,
+                          const FlattenInterfacePtr& graph_data,
+                          const ODescentParameterPtr& odescent_param,
+                          Vector<uint8_t>& merged);
+
     /// Write codes for inner_id into the persistent flatten storage.
     void
     insert_persistent_codes(const void* data, InnerIdType inner_id);
@@ -790,6 +815,86 @@ private:
                            const FlattenInterfacePtr& flatten_codes,
                            const std::unordered_map<InnerIdType, uint32_t>& inner_id_to_input_idx);
 
+    /// One index appended by Merge: its inner id range, entry point and number of route levels.
+    struct MergeShard {
+        InnerIdType begin{0};
+        InnerIdType end{0};
+        InnerIdType entry_point{INVALID_ENTRY_POINT};
+        uint64_t route_levels{0};
+    };
+
+    /// Neighbor list picked for one merged node, written once every node of its pass picked.
+    struct MergedNodeEdges {
+        bool selected{false};
+        std::vector<InnerIdType> neighbors;
+        std::vector<InnerIdType> cross_neighbors;  // neighbors in another shard, get reverse edges
+    };
+
+    /// Connect merged shards by cross-shard search, keeping their intra-shard edges.
+    void
+    merge_incremental(const std::vector<MergeShard>& shards);
+
+    /// Move the unseen, not removed ids of results into candidates.
+    void
+    push_merge_candidates(const DistHeapPtr& results,
+                          const DistHeapPtr& candidates,
+                          std::unordered_set<InnerIdType>& seen) const;
+
+    /// Search every other shard for the neighbors of one bottom-graph node and pick its list.
+    void
+    repair_cross_shard_edges(InnerIdType inner_id,
+                             const std::vector<MergeShard>& shards,
+                             const FlattenInterfacePtr& build_data,
+                             MergedNodeEdges& edges);
+
+    /// Pick the list of one route-level node of a non-anchor shard in route_graphs_[level].
+    void
+    stitch_route_node(InnerIdType inner_id,
+                      uint64_t level,
+                      const std::vector<MergeShard>& shards,
+                      const FlattenInterfacePtr& build_data,
+                      MergedNodeEdges& edges);
+
+    /// Greedy descent from entry_point through route levels [lowest_route_level, route_levels),
+    /// then an ef_construct search on target_graph.
+    DistHeapPtr
+    search_merged_levels(const DistanceProviderForGraph& distance_provider,
+                         const VisitedListPtr& visited_list,
+                         InnerIdType entry_point,
+                         int64_t route_levels,
+                         const GraphInterfacePtr& target_graph,
+                         int64_t lowest_route_level = 0) const;
+
+    /// Prune the node's current list and candidates into edges, without touching graph.
+    void
+    select_merged_edges(InnerIdType inner_id,
+                        const DistHeapPtr& candidates,
+                        const GraphInterfacePtr& graph,
+                        const std::vector<MergeShard>& shards,
+                        const FlattenInterfacePtr& build_data,
+                        MergedNodeEdges& edges) const;
+
+    /// Write the picked lists, then add the reverse cross-shard edges grouped by target.
+    void
+    apply_merged_edges(const std::vector<InnerIdType>& ids,
+                       const std::vector<MergedNodeEdges>& edges,
+                       const GraphInterfacePtr& graph,
+                       const FlattenInterfacePtr& build_data);
+
+    /// Bottom graph and base codes resident on one NUMA node, the originals on their home node.
+    struct NumaReplica {
+        GraphInterfacePtr bottom_graph{nullptr};
+        FlattenInterfacePtr basic_flatten_codes{nullptr};
+    };
+
+    /// Copy the bottom graph and base codes to every other NUMA node; called once by SetImmutable.
+    void
+    build_numa_replicas();
+
+    /// The bottom graph and base codes local to the calling thread's NUMA node.
+    void
+    select_numa_replica(GraphInterfacePtr& bottom_graph, FlattenInterfacePtr& codes) const;
+
     struct MCIHybridSearchResult {
         MCIHybridSearchResult(const HGraphSearchParameters& params, const FilterPtr& filter);
 
@@ -893,6 +998,9 @@ private:
 
     ReorderInterfacePtr reorder_{nullptr};  // reorder helper
 
+    uint64_t precise_hot_codes_size_{0};  // bytes of hot precise codes kept in memory, 0 = off
+    TieredPreciseCodesPtr tiered_precise_codes_{nullptr};  // hot tier in front of precise codes
+
     bool use_old_serial_format_{false};  // true when deserialized from legacy format
 
     bool support_duplicate_{false};             // allow duplicate external ids
@@ -902,6 +1010,14 @@ private:
 
     bool persist_source_id_{false};  // whether to persist source_id in serialization
 
+    bool incremental_merge_{false};  // Merge repairs cross-shard edges instead of rebuilding
+
+    uint64_t partition_build_count_{0};          // partitions of Build, 0 = derived from budget
+    uint64_t partition_build_memory_budget_{0};  // bytes of one partition graph, 0 = unbounded
+
+    bool numa_replicas_{false};                   // replicate per NUMA node on SetImmutable
+    std::vector<NumaReplica> numa_replica_list_;  // indexed by node, empty when not replicated
+
     std::unique_ptr<BuildCache> cache_{nullptr};  // neighbor cache for warm-start build
 
     float build_cache_hit_rate_{-1.0F};     // cache hit rate from last cache-based build
@@ -17,6 +17,7 @@
 #include <chrono>
 #include <future>
 #include <initializer_list>
+#include <random>
 #include <sstream>
 #include <string>
 #include <thread>
@@ -902,6 +903,201 @@ TEST_CASE("HGraph deduplicate_storage rejects Merge", "[ut][hgraph][duplicate][m
     REQUIRE(target->GetNumElements() == 1);
 }
 
+TEST_CASE("HGraph incremental merge connects shards", "[ut][hgraph][merge]") {
+    constexpr int64_t dim = 8;
+    constexpr int64_t shard_count = 3;
+    constexpr int64_t shard_size = 120;
+    // one removed node of the target shard must not be picked as a cross-shard neighbor
+    constexpr int64_t removed_id = 7;
+    auto common_param = MakeCommonParam(dim, 4);
+    auto hgraph_json = MakeFp32HGraphJson(false, 4);
+    hgraph_json["merge_mode"].SetString("incremental");
+
+    // every shard covers the whole space, so most true neighbors of a node live in other shards
+    std::mt19937 rng(47);
+    std::uniform_real_distribution<float> value_dist(0.0F, 1.0F);
+    std::vector<std::vector<float>> shard_vectors(shard_count);
+    std::vector<std::vector<int64_t>> shard_ids(shard_count);
+    for (int64_t s = 0; s < shard_count; ++s) {
+        shard_vectors[s].resize(dim * shard_size);
+        for (auto& value : shard_vectors[s]) {
+            value = value_dist(rng);
+        }
+        shard_ids[s].resize(shard_size);
+        for (int64_t i = 0; i < shard_size; ++i) {
+            shard_ids[s][i] = s * shard_size + i;
+        }
+    }
+
+    vsag::IdMapFunction id_map = [](int64_t id) -> std::tuple<bool, int64_t> {
+        return std::make_tuple(true, id);
+    };
+    auto merge_shards = [&]() {
+        std::vector<std::shared_ptr<vsag::IndexImpl<vsag::HGraph>>> shards;
+        for (int64_t s = 0; s < shard_count; ++s) {
+            auto shard = MakeHGraphIndex(hgraph_json, common_param);
+            REQUIRE(shard->Build(MakeFloatDataset(shard_vectors[s], shard_ids[s], dim, shard_size))
+                        .has_value());
+            shards.emplace_back(shard);
+        }
+        REQUIRE(shards[0]->Remove(std::vector<int64_t>{removed_id}).has_value());
+        std::vector<vsag::MergeUnit> merge_units;
+        for (int64_t s = 1; s < shard_count; ++s) {
+            merge_units.emplace_back(vsag::MergeUnit{shards[s], id_map});
+        }
+        REQUIRE(shards[0]->Merge(merge_units).has_value());
+        return shards[0];
+    };
+    auto target = merge_shards();
+    REQUIRE(target->GetNumElements() == shard_count * shard_size - 1);
+
+    // search enters through one shard only, so the other shards are reached via cross edges
+    auto search_all = [&](const std::shared_ptr<vsag::IndexImpl<vsag::HGraph>>& index,
+                          int64_t topk,
+                          const std::string& search_param) {
+        std::vector<int64_t> results;
+        for (int64_t s = 0; s < shard_count; ++s) {
+            for (int64_t i = 0; i < shard_size; ++i) {
+                std::vector<float> query_vector(shard_vectors[s].begin() + i * dim,
+                                                shard_vectors[s].begin() + (i + 1) * dim);
+                auto result =
+                    index->KnnSearch(MakeFloatQuery(query_vector, dim), topk, search_param);
+                REQUIRE(result.has_value());
+                const auto* ids = result.value()->GetIds();
+                for (int64_t j = 0; j < topk; ++j) {
+                    results.emplace_back(j < result.value()->GetDim() ? ids[j] : -1);
+                }
+            }
+        }
+        return results;
+    };
+    auto results = search_all(target, 1, R"({"hgraph": {"ef_search": 64}})");
+    int64_t found = 0;
+    for (int64_t id = 0; id < shard_count * shard_size; ++id) {
+        if (results[id] == id) {
+            ++found;
+        }
+    }
+    REQUIRE(found >= shard_count * shard_size * 95 / 100);
+
+    // the edges are picked in parallel but written in a fixed order, so a second merge matches
+    // even where a narrow search follows the exact neighbor lists
+    constexpr const char* narrow_param = R"({"hgraph": {"ef_search": 8}})";
+    REQUIRE(search_all(merge_shards(), 8, narrow_param) == search_all(target, 8, narrow_param));
+}
+
+TEST_CASE("HGraph numa replicas keep search results", "[ut][hgraph][numa]") {
+    constexpr int64_t dim = 8;
+    constexpr int64_t count = 200;
+    auto common_param = MakeCommonParam(dim);
+    auto hgraph_json = MakeFp32HGraphJson(false);
+    hgraph_json["support_duplicate"].SetBool(false);
+    hgraph_json["numa_replicas"].SetBool(true);
+
+    std::mt19937 rng(53);
+    std::uniform_real_distribution<float> value_dist(0.0F, 1.0F);
+    std::vector<float> vectors(dim * count);
+    for (auto& value : vectors) {
+        value = value_dist(rng);
+    }
+    std::vector<int64_t> ids(count);
+    for (int64_t i = 0; i < count; ++i) {
+        ids[i] = i;
+    }
+    auto index = MakeHGraphIndex(hgraph_json, common_param);
+    REQUIRE(index->Build(MakeFloatDataset(vectors, ids, dim, count)).has_value());
+
+    auto search_all = [&]() {
+        std::vector<int64_t> results;
+        for (int64_t i = 0; i < count; ++i) {
+            std::vector<float> query_vector(vectors.begin() + i * dim,
+                                            vectors.begin() + (i + 1) * dim);
+            auto result = index->KnnSearch(
+                MakeFloatQuery(query_vector, dim), 1, R"({"hgraph": {"ef_search": 32}})");
+            REQUIRE(result.has_value());
+            REQUIRE(result.value()->GetDim() == 1);
+            results.emplace_back(result.value()->GetIds()[0]);
+        }
+        return results;
+    };
+    auto before = search_all();
+    // on a multi-node host the searches below run on the per-node copies
+    REQUIRE(index->SetImmutable().has_value());
+    REQUIRE(search_all() == before);
+}
+
+TEST_CASE("HGraph partitioned build writes a searchable disk graph", "[ut][hgraph][build]") {
+    constexpr int64_t dim = 16;
+    constexpr int64_t count = 2000;
+    auto common_param = MakeCommonParam(dim, 4);
+    std::mt19937 rng(48);
+    std::uniform_real_distribution<float> value_dist(0.0F, 1.0F);
+    std::vector<float> vectors(dim * count);
+    for (auto& value : vectors) {
+        value = value_dist(rng);
+    }
+    std::vector<int64_t> ids(count);
+    for (int64_t i = 0; i < count; ++i) {
+        ids[i] = i;
+    }
+
+    fixtures::TempDir temp_dir("hgraph_partition_build");
+    auto hgraph_json = MakeFp32HGraphJson(false, 4);
+    hgraph_json["support_duplicate"].SetBool(false);
+    hgraph_json["max_degree"].SetInt(16);
+    hgraph_json["graph_io_type"].SetString("buffer_io");
+    hgraph_json["graph_file_path"].SetString(temp_dir.GenerateRandomFile());
+    SECTION("fixed partition count") {
+        hgraph_json["partition_build_count"].SetUint64(4);
+    }
+    SECTION("partitions derived from the memory budget") {
+        hgraph_json["partition_build_memory_budget"].SetUint64(256 * 1024);
+    }
+    auto index = MakeHGraphIndex(hgraph_json, common_param);
+    auto build_result = index->Build(MakeFloatDataset(vectors, ids, dim, count));
+    REQUIRE(build_result.has_value());
+    REQUIRE(build_result.value().empty());
+    REQUIRE(index->GetNumElements() == count);
+
+    auto search_all = [&](const std::shared_ptr<vsag::IndexImpl<vsag::HGraph>>& target) {
+        std::vector<int64_t> results;
+        for (int64_t i = 0; i < count; ++i) {
+            std::vector<float> query_vector(vectors.begin() + i * dim,
+                                            vectors.begin() + (i + 1) * dim);
+            auto result = target->KnnSearch(
+                MakeFloatQuery(query_vector, dim), 1, R"({"hgraph": {"ef_search": 64}})");
+            REQUIRE(result.has_value());
+            results.emplace_back(result.value()->GetDim() == 1 ? result.value()->GetIds()[0]
+                                                               : -1);
+        }
+        return results;
+    };
+    auto results = search_all(index);
+    int64_t hit_count = 0;
+    for (int64_t i = 0; i < count; ++i) {
+        hit_count += static_cast<int64_t>(results[i] == i);
+    }
+    REQUIRE(hit_count >= count * 95 / 100);
+
+    auto binary = index->Serialize();
+    REQUIRE(binary.has_value());
+    hgraph_json["graph_file_path"].SetString(temp_dir.GenerateRandomFile());
+    auto restored = MakeHGraphIndex(hgraph_json, common_param);
+    REQUIRE(restored->Deserialize(binary.value()).has_value());
+    REQUIRE(search_all(restored) == results);
+}
+
+TEST_CASE("HGraph partitioned build rejects support_duplicate", "[ut][hgraph][build]") {
+    constexpr int64_t dim = 4;
+    auto common_param = MakeCommonParam(dim);
+    auto hgraph_json = MakeFp32HGraphJson(false);
+    hgraph_json["partition_build_count"].SetUint64(2);
+    auto index = MakeHGraphIndex(hgraph_json, common_param);
+    std::vector<float> vectors(dim * 4, 1.0F);
+    std::vector<int64_t> ids = {0, 1, 2, 3};
+    REQUIRE_FALSE(index->Build(MakeFloatDataset(vectors, ids, dim, 4)).has_value());
+}
+
 TEST_CASE("HGraph deduplicate_storage ExportModel keeps an empty reusable model",
           "[ut][hgraph][duplicate][export_model]") {
     constexpr int64_t dim = 2;
@@ -14,19 +14,25 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <functional>
 #include <future>
 #include <limits>
+#include <numeric>
 #include <unordered_map>
 #include <unordered_set>
 
 #include "datacell/flatten_datacell_parameter.h"
+#include "datacell/graph_datacell_parameter.h"
 #include "dataset_impl.h"
 #include "hgraph.h"  // IWYU pragma: keep
 #include "hgraph_fast_build.h"
+#include "impl/cluster/kmeans_cluster.h"
 #include "impl/heap/standard_heap.h"
 #include "impl/logger/logger.h"
 #include "impl/odescent/odescent_graph_builder.h"
@@ -34,6 +40,7 @@
 #include "impl/searcher/basic_searcher.h"
 #include "io/memory_io/memory_io_parameter.h"
 #include "quantization/scalar_quantization/scalar_quantizer_parameter.h"
+#include "simd/fp32_simd.h"
 #include "storage/stream_reader.h"
 #include "storage/stream_writer.h"
 #include "utils/util_functions.h"
@@ -112,6 +119,38 @@ wait_all_futures(std::vector<std::future<void>>& futures) {
     }
 }
 
+// every point of a partitioned build lands in its two nearest partitions
+static constexpr uint64_t PARTITION_BUILD_OVERLAP = 2;
+static constexpr uint64_t PARTITION_BUILD_SAMPLES_PER_CENTER = 256;
+static constexpr uint64_t PARTITION_BUILD_BLOCK_SIZE = 4096;
+
+// Bytes one point holds while its partition is built: the gathered fp32 vector and its sq8
+// code, the ODescent neighbor list and candidate sets, and the temporary graph line.
+static uint64_t
+partition_build_bytes_per_point(int64_t dim, uint64_t max_degree) {
+    constexpr uint64_t hash_set_entry_size = 3 * sizeof(void*);
+    const auto dim_size = static_cast<uint64_t>(dim);
+    return dim_size * sizeof(float) + dim_size + sizeof(Linklist) + sizeof(std::mutex) +
+           sizeof(uint32_t) +
+           max_degree * (sizeof(Node) + 2 * hash_set_entry_size + sizeof(InnerIdType));
+}
+
+static void
+run_in_blocks(const std::shared_ptr<SafeThreadPool>& thread_pool,
+              uint64_t count,
+              const std::function<void(uint64_t, uint64_t)>& func) {
+    if (thread_pool == nullptr or count <= PARTITION_BUILD_BLOCK_SIZE) {
+        func(0, count);
+        return;
+    }
+    std::vector<std::future<void>> futures;
+    for (uint64_t begin = 0; begin < count; begin += PARTITION_BUILD_BLOCK_SIZE) {
+        futures.emplace_back(thread_pool->GeneralEnqueue(
+            func, begin, std::min(begin + PARTITION_BUILD_BLOCK_SIZE, count)));
+    }
+    wait_all_futures(futures);
+}
+
 void
 HGraph::Train(const DatasetPtr& base) {
     this->train_codes_with_dataset(this->sample_train_dataset(base));
@@ -154,6 +193,8 @@ HGraph::Build(const DatasetPtr& data) {
         // Take the accelerated build path that warm-starts neighbours from
         // the cache and refines them, instead of building from scratch.
         ret = this->build_with_cache(data);
+    } else if (this->use_partition_build()) {
+        ret = this->build_by_partitions(data);
     } else {
         auto optimized_result = this->try_optimized_build(data);
         if (optimized_result.has_value()) {
@@ -168,7 +209,8 @@ HGraph::Build(const DatasetPtr& data) {
         elp_optimize();
     }
     if (this->mci_parameters_.enabled and
-        (using_build_cache or graph_type_ != GRAPH_TYPE_VALUE_NSW)) {
+        (using_build_cache or this->use_partition_build() or
+         graph_type_ != GRAPH_TYPE_VALUE_NSW)) {
         this->build_mci_clique_index(ret.empty() ? this->get_data(data) : nullptr);
     }
     return ret;
@@ -286,6 +328,266 @@ HGraph::build_by_odescent(const DatasetPtr& data) {
     return failed_ids;
 }
 
+std::vector<int64_t>
+HGraph::build_by_partitions(const DatasetPtr& data) {
+    CHECK_ARGUMENT(not this->support_duplicate_,
+                   "HGraph partitioned build does not support support_duplicate");
+    CHECK_ARGUMENT(this->data_type_ == DataTypes::DATA_TYPE_FLOAT,
+                   "HGraph partitioned build only supports float vectors");
+    const bool need_sq8_build_data =
+        need_temporary_sq8_build_data(this->basic_flatten_codes_, this->has_precise_reorder());
+    CHECK_ARGUMENT(not need_sq8_build_data or raw_vector_ != nullptr,
+                   "HGraph partitioned build of RaBitQ codes needs precise codes or raw vectors");
+
+    std::vector<int64_t> failed_ids;
+    auto total = data->GetNumElements();
+    const auto* labels = data->GetIds();
+    const auto* source_id = data->GetSourceID();
+    Vector<int64_t> valid_indices(allocator_);
+    UnorderedSet<LabelType> seen_labels(allocator_);
+    for (int64_t i = 0; i < total; ++i) {
+        auto label = labels[i];
+        if (this->label_table_->CheckLabel(label) or seen_labels.find(label) != seen_labels.end()) {
+            failed_ids.emplace_back(label);
+            continue;
+        }
+        seen_labels.insert(label);
+        valid_indices.emplace_back(i);
+    }
+    if (valid_indices.empty()) {
+        return failed_ids;
+    }
+    auto inner_ids = this->get_unique_inner_ids(static_cast<InnerIdType>(valid_indices.size()));
+    this->resize(total_count_.load() + inner_ids.size());
+    this->total_count_ += inner_ids.size();
+
+    // persistent codes go straight to their configured io, only the graph build is partitioned
+    this->Train(data);
+    Vector<Vector<InnerIdType>> route_graph_ids(allocator_);
+    for (uint64_t position = 0; position < valid_indices.size(); ++position) {
+        auto i = valid_indices[position];
+        InnerIdType inner_id = inner_ids[position];
+        this->label_table_->Insert(inner_id, labels[i]);
+        if (source_id != nullptr && not source_id[i].empty()) {
+            this->label_table_->InsertSourceId(inner_id, source_id[i]);
+        }
+        this->insert_persistent_codes(get_data(data, i), inner_id);
+        auto level = this->get_random_level() - 1;
+        if (level >= 0) {
+            if (level >= static_cast<int>(route_graph_ids.size()) || route_graph_ids.empty()) {
+                for (auto k = static_cast<int>(route_graph_ids.size()); k <= level; ++k) {
+                    route_graph_ids.emplace_back(allocator_);
+                }
+                entry_point_id_ = inner_id;
+            }
+            for (int j = 0; j <= level; ++j) {
+                route_graph_ids[j].emplace_back(inner_id);
+            }
+        }
+    }
+
+    FlattenInterfacePtr graph_data = (has_precise_reorder() and not build_by_base_)
+                                         ? this->high_precise_codes_
+                                         : this->basic_flatten_codes_;
+    if (need_sq8_build_data) {
+        graph_data = raw_vector_;
+    }
+    auto odescent_param = odescent_param_ != nullptr
+                              ? std::make_shared<ODescentParameter>(*odescent_param_)
+                              : std::make_shared<ODescentParameter>();
+    odescent_param->max_degree = static_cast<int64_t>(bottom_graph_->MaximumDegree());
+
+    auto partitions = this->assign_build_partitions(data, valid_indices);
+    Vector<uint8_t> merged(valid_indices.size(), 0, allocator_);
+    for (uint64_t partition = 0; partition < partitions.size(); ++partition) {
+        logger::info("hgraph partitioned build: partition {}/{} with {} points",
+                     partition + 1,
+                     partitions.size(),
+                     partitions[partition].size());
+        this->build_partition_graph(data,
+                                    valid_indices,
+                                    inner_ids,
+                                    partitions[partition],
+                                    graph_data,
+                                    odescent_param,
+                                    merged);
+        Vector<uint32_t>(allocator_).swap(partitions[partition]);
+    }
+
+    for (auto& route_graph_id : route_graph_ids) {
+        odescent_param->max_degree = static_cast<int64_t>(bottom_graph_->MaximumDegree() / 2);
+        ODescent sparse_odescent_builder(
+            odescent_param, graph_data, allocator_, this->thread_pool_.get());
+        auto graph = this->generate_one_route_graph();
+        sparse_odescent_builder.Build(route_graph_id);
+        sparse_odescent_builder.SaveGraph(graph);
+        this->route_graphs_.emplace_back(graph);
+    }
+    return failed_ids;
+}
+
+Vector<Vector<uint32_t>>
+HGraph::assign_build_partitions(const DatasetPtr& data,
+                                const Vector<int64_t>& valid_indices) const {
+    const uint64_t point_count = valid_indices.size();
+    uint64_t partition_count = this->partition_build_count_;
+    if (partition_count == 0) {
+        const auto point_size =
+            partition_build_bytes_per_point(this->dim_, this->bottom_graph_->MaximumDegree());
+        const auto budget_points =
+            std::max<uint64_t>(this->partition_build_memory_budget_ / point_size, 1);
+        partition_count =
+            (PARTITION_BUILD_OVERLAP * point_count + budget_points - 1) / budget_points;
+    }
+    partition_count = std::clamp<uint64_t>(partition_count, 1, point_count);
+
+    Vector<Vector<uint32_t>> partitions(allocator_);
+    partitions.reserve(partition_count);
+    for (uint64_t partition = 0; partition < partition_count; ++partition) {
+        partitions.emplace_back(allocator_);
+    }
+    if (partition_count == 1) {
+        partitions[0].resize(point_count);
+        std::iota(partitions[0].begin(), partitions[0].end(), 0);
+        return partitions;
+    }
+
+    const auto sample_count =
+        std::min(static_cast<uint64_t>(data->GetNumElements()),
+                 partition_count * PARTITION_BUILD_SAMPLES_PER_CENTER);
+    auto sample = sample_train_data(data,
+                                    data->GetNumElements(),
+                                    this->dim_,
+                                    static_cast<int64_t>(sample_count),
+                                    allocator_);
+    KMeansCluster cluster(static_cast<int32_t>(this->dim_), allocator_, this->thread_pool_);
+    cluster.Run(static_cast<uint32_t>(partition_count),
+                static_cast<const float*>(get_data(sample)),
+                sample->GetNumElements());
+
+    Vector<uint32_t> nearest(point_count * PARTITION_BUILD_OVERLAP, allocator_);
+    run_in_blocks(this->thread_pool_, point_count, [&](uint64_t begin, uint64_t end) {
+        for (auto position = begin; position < end; ++position) {
+            const auto* vector =
+                static_cast<const float*>(get_data(data, valid_indices[position]));
+            uint32_t first = 0;
+            uint32_t second = 0;
+            float first_dist = std::numeric_limits<float>::max();
+            float second_dist = std::numeric_limits<float>::max();
+            for (uint32_t center = 0; center < partition_count; ++center) {
+                const auto dist = FP32ComputeL2Sqr(
+                    vector, cluster.k_centroids_ + center * this->dim_, this->dim_);
+                if (dist < first_dist) {
+                    second = first;
+                    second_dist = first_dist;
+                    first = center;
+                    first_dist = dist;
+                } else if (dist < second_dist) {
+                    second = center;
+                    second_dist = dist;
+                }
+            }
+            nearest[position * PARTITION_BUILD_OVERLAP] = first;
+            nearest[position * PARTITION_BUILD_OVERLAP + 1] = second;
+        }
+    });
+    for (uint32_t position = 0; position < point_count; ++position) {
+        for (uint64_t k = 0; k < PARTITION_BUILD_OVERLAP; ++k) {
+            partitions[nearest[position * PARTITION_BUILD_OVERLAP + k]].push_back(position);
+        }
+    }
+    return partitions;
+}
+
+void
+HGraph::build_partition_graph(const DatasetPtr& data,
+                              const Vector<int64_t>& valid_indices,
+                              const Vector<InnerIdType>& inner_ids,
+                              const Vector<uint32_t>& members,
+                              const FlattenInterfacePtr& graph_data,
+                              const ODescentParameterPtr& odescent_param,
+                              Vector<uint8_t>& merged) {
+    const auto member_count = static_cast<InnerIdType>(members.size());
+    if (member_count == 0) {
+        return;
+    }
+    if (member_count == 1) {
+        // a lone member takes its edges from its other partition
+        if (merged[members[0]] == 0) {
+            this->bottom_graph_->InsertNeighborsById(inner_ids[members[0]],
+                                                     Vector<InnerIdType>(allocator_));
+            merged[members[0]] = 1;
+        }
+        return;
+    }
+
+    // the partition graph is built on temporary sq8 codes of its members only
+    auto partition_codes = make_temporary_sq8_flatten(this->metric_,
+                                                      this->data_type_,
+                                                      this->dim_,
+                                                      static_cast<int64_t>(this->extra_info_size_),
+                                                      this->thread_pool_,
+                                                      this->allocator_);
+    {
+        Vector<float> vectors(static_cast<uint64_t>(member_count) * this->dim_, allocator_);
+        for (InnerIdType local_id = 0; local_id < member_count; ++local_id) {
+            std::memcpy(vectors.data() + static_cast<uint64_t>(local_id) * this->dim_,
+                        get_data(data, valid_indices[members[local_id]]),
+                        this->dim_ * sizeof(float));
+        }
+        partition_codes->Train(vectors.data(), member_count);
+        partition_codes->BatchInsertVector(vectors.data(), member_count);
+    }
+
+    auto graph_param = std::make_shared<GraphDataCellParameter>();
+    graph_param->io_parameter_ = std::make_shared<MemoryIOParameter>();
+    graph_param->max_degree_ = this->bottom_graph_->MaximumDegree();
+    graph_param->init_max_capacity_ = member_count;
+    IndexCommonParam common_param;
+    common_param.metric_ = this->metric_;
+    common_param.data_type_ = this->data_type_;
+    common_param.dim_ = this->dim_;
+    common_param.thread_pool_ = this->thread_pool_;
+    common_param.allocator_ = std::shared_ptr<Allocator>(this->allocator_, [](Allocator*) {});
+    auto partition_graph = GraphInterface::MakeInstance(graph_param, common_param);
+    partition_graph->Resize(member_count);
+    {
+        ODescent odescent_builder(
+            odescent_param, partition_codes, allocator_, this->thread_pool_.get());
+        odescent_builder.Build();
+        odescent_builder.SaveGraph(partition_graph);
+    }
+    partition_codes.reset();
+
+    // members are distinct, so blocks merge disjoint neighbor lists of the bottom graph
+    const auto max_degree = this->bottom_graph_->MaximumDegree();
+    run_in_blocks(this->thread_pool_, member_count, [&](uint64_t begin, uint64_t end) {
+        Vector<InnerIdType> local_neighbors(allocator_);
+        Vector<InnerIdType> neighbors(allocator_);
+        for (auto local_id = begin; local_id < end; ++local_id) {
+            const auto position = members[local_id];
+            const auto inner_id = inner_ids[position];
+            neighbors.clear();
+            if (merged[position] != 0) {
+                this->bottom_graph_->GetNeighbors(inner_id, neighbors);
+            }
+            partition_graph->GetNeighbors(static_cast<InnerIdType>(local_id), local_neighbors);
+            for (auto local_neighbor : local_neighbors) {
+                const auto neighbor = inner_ids[members[local_neighbor]];
+                if (std::find(neighbors.begin(), neighbors.end(), neighbor) == neighbors.end()) {
+                    neighbors.push_back(neighbor);
+                }
+            }
+            if (neighbors.size() > max_degree) {
+                select_edges_by_heuristic(
+                    neighbors, inner_id, max_degree, graph_data, allocator_, alpha_);
+            }
+            this->bottom_graph_->InsertNeighborsById(inner_id, neighbors);
+            merged[position] = 1;
+        }
+    });
+}
+
 std::vector<int64_t>
 HGraph::Add(const DatasetPtr& data) {
     std::unique_lock<std::mutex> mci_add_lock(this->mci_add_mutex_, std::defer_lock);
@@ -526,6 +828,9 @@ HGraph::insert_persistent_codes_unlocked(const void* data, InnerIdType inner_id)
     this->basic_flatten_codes_->InsertVector(data, inner_id);
     if (has_precise_reorder()) {
         this->high_precise_codes_->InsertVector(data, inner_id);
+        if (this->tiered_precise_codes_ != nullptr) {
+            this->tiered_precise_codes_->Invalidate(inner_id);
+        }
     }
     if (create_new_raw_vector_) {
         raw_vector_->InsertVector(data, inner_id);
@@ -942,7 +1247,8 @@ HGraph::InitFeatures() {
     auto name = this->basic_flatten_codes_->GetQuantizerName();
 
     if (name != QUANTIZATION_TYPE_VALUE_FP32 and name != QUANTIZATION_TYPE_VALUE_BF16 and
-        name != QUANTIZATION_TYPE_VALUE_FP16) {
+        name != QUANTIZATION_TYPE_VALUE_FP16 and name != QUANTIZATION_TYPE_VALUE_FP8_E4M3 and
+        name != QUANTIZATION_TYPE_VALUE_FP8_E5M2) {
         this->index_feature_list_->SetFeature(IndexFeature::NEED_TRAIN);
     } else {
         this->index_feature_list_->SetFeatures({
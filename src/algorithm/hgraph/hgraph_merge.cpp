@@ -0,0 +1,367 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <unordered_set>
+
+#include "hgraph.h"  // IWYU pragma: keep
+#include "impl/distance_provider_for_graph.h"
+#include "impl/heap/standard_heap.h"
+#include "impl/logger/logger.h"
+#include "impl/pruning_strategy.h"
+#include "impl/searcher/basic_searcher.h"
+
+namespace vsag {
+
+static void
+wait_all_futures(std::vector<std::future<void>>& futures) {
+    std::exception_ptr first_exception = nullptr;
+    for (auto& future : futures) {
+        if (not future.valid()) {
+            continue;
+        }
+        try {
+            future.get();
+        } catch (...) {
+            if (not first_exception) {
+                first_exception = std::current_exception();
+            }
+        }
+    }
+    if (first_exception) {
+        std::rethrow_exception(first_exception);
+    }
+}
+
+template <typename ShardTmpl>
+static uint64_t
+find_shard(const std::vector<ShardTmpl>& shards, InnerIdType inner_id) {
+    // shards are appended in id order, so the first shard ending after inner_id owns it
+    for (uint64_t i = 0; i < shards.size(); ++i) {
+        if (inner_id < shards[i].end) {
+            return i;
+        }
+    }
+    return shards.size();
+}
+
+template <typename Task>
+static void
+run_merge_tasks(const SafeThreadPoolPtr& thread_pool,
+                bool use_parallel,
+                uint64_t count,
+                const Task& task) {
+    if (not use_parallel or thread_pool == nullptr or count <= 1) {
+        for (uint64_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+    constexpr uint64_t block_size = 128;
+    std::vector<std::future<void>> futures;
+    futures.reserve((count + block_size - 1) / block_size);
+    for (uint64_t i = 0; i < count; i += block_size) {
+        const auto end = std::min<uint64_t>(i + block_size, count);
+        futures.emplace_back(thread_pool->GeneralEnqueue([&task, i, end]() {
+            for (uint64_t idx = i; idx < end; ++idx) {
+                task(idx);
+            }
+        }));
+    }
+    wait_all_futures(futures);
+}
+
+void
+HGraph::merge_incremental(const std::vector<MergeShard>& shards) {
+    if (shards.empty()) {
+        return;
+    }
+    // the shard with the most route levels keeps its hierarchy; the others are stitched below it
+    uint64_t anchor = 0;
+    for (uint64_t i = 1; i < shards.size(); ++i) {
+        if (shards[i].route_levels > shards[anchor].route_levels) {
+            anchor = i;
+        }
+    }
+    this->entry_point_id_ = shards[anchor].entry_point;
+    if (shards.size() == 1) {
+        return;
+    }
+
+    auto build_data = (this->has_precise_reorder() and not this->build_by_base_)
+                          ? this->high_precise_codes_
+                          : this->basic_flatten_codes_;
+    const auto begin = std::chrono::steady_clock::now();
+    const bool use_parallel = this->build_thread_count_ > 1;
+
+    // bottom graph: every node looks for its nearest neighbors inside each other shard
+    std::vector<InnerIdType> bottom_ids;
+    bottom_ids.reserve(shards.back().end - shards.front().begin);
+    for (const auto& shard : shards) {
+        for (InnerIdType inner_id = shard.begin; inner_id < shard.end; ++inner_id) {
+            bottom_ids.emplace_back(inner_id);
+        }
+    }
+    std::vector<MergedNodeEdges> bottom_edges(bottom_ids.size());
+    run_merge_tasks(this->thread_pool_, use_parallel, bottom_ids.size(), [&](uint64_t i) {
+        this->repair_cross_shard_edges(bottom_ids[i], shards, build_data, bottom_edges[i]);
+    });
+    this->apply_merged_edges(bottom_ids, bottom_edges, this->bottom_graph_, build_data);
+
+    // route graphs: top-down, so a node always descends through already stitched levels
+    for (auto level = static_cast<int64_t>(this->route_graphs_.size()) - 1; level >= 0; --level) {
+        std::vector<InnerIdType> level_ids;
+        for (const auto inner_id : this->route_graphs_[level]->GetIds()) {
+            if (find_shard(shards, inner_id) != anchor) {
+                level_ids.emplace_back(inner_id);
+            }
+        }
+        std::vector<MergedNodeEdges> level_edges(level_ids.size());
+        run_merge_tasks(this->thread_pool_, use_parallel, level_ids.size(), [&](uint64_t i) {
+            this->stitch_route_node(level_ids[i], level, shards, build_data, level_edges[i]);
+        });
+        this->apply_merged_edges(level_ids, level_edges, this->route_graphs_[level], build_data);
+    }
+
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin);
+    logger::info("[hgraph_merge] incremental merge of {} shards ({} nodes) finished in {:.3f}s",
+                 shards.size(),
+                 bottom_ids.size(),
+                 elapsed.count());
+}
+
+void
+HGraph::push_merge_candidates(const DistHeapPtr& results,
+                              const DistHeapPtr& candidates,
+                              std::unordered_set<InnerIdType>& seen) const {
+    while (not results->Empty()) {
+        const auto& [dist, id] = results->Top();
+        // removed nodes stay in the graph for routing but gain no edges from the merge
+        if (seen.emplace(id).second and not this->label_table_->IsRemoved(id)) {
+            candidates->Push(dist, id);
+        }
+        results->Pop();
+    }
+}
+
+void
+HGraph::repair_cross_shard_edges(InnerIdType inner_id,
+                                 const std::vector<MergeShard>& shards,
+                                 const FlattenInterfacePtr& build_data,
+                                 MergedNodeEdges& edges) {
+    if (this->label_table_->IsRemoved(inner_id)) {
+        return;
+    }
+    FlattenIdDistanceProvider distance_provider(build_data, inner_id);
+    const auto own_shard = find_shard(shards, inner_id);
+    auto candidates = std::make_shared<StandardHeap<true, false>>(allocator_, -1);
+    std::unordered_set<InnerIdType> seen{inner_id};
+
+    auto visited_list = this->pool_->TakeOne();
+    try {
+        for (uint64_t i = 0; i < shards.size(); ++i) {
+            if (i == own_shard) {
+                continue;
+            }
+            // the other shard still has its own hierarchy, so descend it from its entry point
+            auto result = this->search_merged_levels(distance_provider,
+                                                     visited_list,
+                                                     shards[i].entry_point,
+                                                     static_cast<int64_t>(shards[i].route_levels),
+                                                     this->bottom_graph_);
+            this->push_merge_candidates(result, candidates, seen);
+        }
+    } catch (...) {
+        this->pool_->ReturnOne(visited_list);
+        throw;
+    }
+    this->pool_->ReturnOne(visited_list);
+    if (candidates->Empty()) {
+        return;
+    }
+    this->select_merged_edges(inner_id, candidates, this->bottom_graph_, shards, build_data, edges);
+}
+
+void
+HGraph::stitch_route_node(InnerIdType inner_id,
+                          uint64_t level,
+                          const std::vector<MergeShard>& shards,
+                          const FlattenInterfacePtr& build_data,
+                          MergedNodeEdges& edges) {
+    if (this->label_table_->IsRemoved(inner_id)) {
+        return;
+    }
+    FlattenIdDistanceProvider distance_provider(build_data, inner_id);
+    auto candidates = std::make_shared<StandardHeap<true, false>>(allocator_, -1);
+    std::unordered_set<InnerIdType> seen{inner_id};
+
+    auto visited_list = this->pool_->TakeOne();
+    try {
+        auto result = this->search_merged_levels(distance_provider,
+                                                 visited_list,
+                                                 this->entry_point_id_,
+                                                 static_cast<int64_t>(this->route_graphs_.size()),
+                                                 this->route_graphs_[level],
+                                                 static_cast<int64_t>(level) + 1);
+        this->push_merge_candidates(result, candidates, seen);
+    } catch (...) {
+        this->pool_->ReturnOne(visited_list);
+        throw;
+    }
+    this->pool_->ReturnOne(visited_list);
+    if (candidates->Empty()) {
+        return;
+    }
+    this->select_merged_edges(
+        inner_id, candidates, this->route_graphs_[level], shards, build_data, edges);
+}
+
+DistHeapPtr
+HGraph::search_merged_levels(const DistanceProviderForGraph& distance_provider,
+                             const VisitedListPtr& visited_list,
+                             InnerIdType entry_point,
+                             int64_t route_levels,
+                             const GraphInterfacePtr& target_graph,
+                             int64_t lowest_route_level) const {
+    InnerSearchParam param;
+    param.ep = entry_point;
+    param.ef = 1;
+    param.topk = 1;
+    for (auto level = route_levels - 1; level >= lowest_route_level; --level) {
+        visited_list->Reset();
+        auto result = this->searcher_->Search(
+            this->route_graphs_[level], distance_provider, visited_list, param, nullptr, nullptr);
+        if (not result->Empty()) {
+            param.ep = result->Top().second;
+        }
+    }
+    param.ef = this->ef_construct_;
+    param.topk = static_cast<int64_t>(this->ef_construct_);
+    visited_list->Reset();
+    return this->searcher_->Search(
+        target_graph, distance_provider, visited_list, param, nullptr, nullptr);
+}
+
+void
+HGraph::select_merged_edges(InnerIdType inner_id,
+                            const DistHeapPtr& candidates,
+                            const GraphInterfacePtr& graph,
+                            const std::vector<MergeShard>& shards,
+                            const FlattenInterfacePtr& build_data,
+                            MergedNodeEdges& edges) const {
+    const uint64_t max_degree = graph->MaximumDegree();
+    const auto own_shard = find_shard(shards, inner_id);
+
+    // every list is read before any is written, so the intra-shard neighbors are as built
+    Vector<InnerIdType> existing_neighbors(allocator_);
+    {
+        LockGuard cur_lock(neighbors_mutex_, inner_id);
+        graph->GetNeighbors(inner_id, existing_neighbors);
+    }
+    std::unordered_set<InnerIdType> seen{inner_id};
+    auto merged = std::make_shared<StandardHeap<true, false>>(allocator_, -1);
+    for (auto nid : existing_neighbors) {
+        if (seen.emplace(nid).second) {
+            merged->Push(build_data->ComputePairVectors(nid, inner_id), nid);
+        }
+    }
+    while (not candidates->Empty()) {
+        const auto& [dist, nid] = candidates->Top();
+        if (seen.emplace(nid).second) {
+            merged->Push(dist, nid);
+        }
+        candidates->Pop();
+    }
+    select_edges_by_heuristic(merged, max_degree, build_data, allocator_, this->alpha_);
+    edges.neighbors.reserve(merged->Size());
+    while (not merged->Empty()) {
+        const auto nid = merged->Top().second;
+        edges.neighbors.emplace_back(nid);
+        if (find_shard(shards, nid) != own_shard) {
+            edges.cross_neighbors.emplace_back(nid);
+        }
+        merged->Pop();
+    }
+    edges.selected = true;
+}
+
+void
+HGraph::apply_merged_edges(const std::vector<InnerIdType>& ids,
+                           const std::vector<MergedNodeEdges>& edges,
+                           const GraphInterfacePtr& graph,
+                           const FlattenInterfacePtr& build_data) {
+    const bool use_parallel = this->build_thread_count_ > 1;
+    const uint64_t max_degree = graph->MaximumDegree();
+    run_merge_tasks(this->thread_pool_, use_parallel, ids.size(), [&](uint64_t i) {
+        if (edges[i].selected) {
+            Vector<InnerIdType> neighbors(
+                edges[i].neighbors.begin(), edges[i].neighbors.end(), allocator_);
+            LockGuard cur_lock(neighbors_mutex_, ids[i]);
+            graph->InsertNeighborsById(ids[i], neighbors);
+        }
+    });
+
+    // only cross-shard edges get a reverse link, intra-shard lists are left as they were built;
+    // grouping them by target in (target, source) order makes the result independent of threads
+    std::vector<std::pair<InnerIdType, InnerIdType>> reverse_edges;
+    for (uint64_t i = 0; i < ids.size(); ++i) {
+        for (auto neighbor_id : edges[i].cross_neighbors) {
+            reverse_edges.emplace_back(neighbor_id, ids[i]);
+        }
+    }
+    std::sort(reverse_edges.begin(), reverse_edges.end());
+    std::vector<uint64_t> group_begins;
+    for (uint64_t i = 0; i < reverse_edges.size(); ++i) {
+        if (i == 0 or reverse_edges[i].first != reverse_edges[i - 1].first) {
+            group_begins.emplace_back(i);
+        }
+    }
+    group_begins.emplace_back(reverse_edges.size());
+
+    run_merge_tasks(this->thread_pool_, use_parallel, group_begins.size() - 1, [&](uint64_t g) {
+        const auto target = reverse_edges[group_begins[g]].first;
+        LockGuard target_lock(neighbors_mutex_, target);
+        Vector<InnerIdType> neighbors(allocator_);
+        graph->GetNeighbors(target, neighbors);
+        const auto original_size = neighbors.size();
+        for (auto i = group_begins[g]; i < group_begins[g + 1]; ++i) {
+            const auto source = reverse_edges[i].second;
+            if (std::find(neighbors.begin(), neighbors.begin() + original_size, source) ==
+                neighbors.begin() + original_size) {
+                neighbors.emplace_back(source);
+            }
+        }
+        if (neighbors.size() == original_size) {
+            return;
+        }
+        if (neighbors.size() > max_degree) {
+            auto edge_candidates = std::make_shared<StandardHeap<true, false>>(allocator_, -1);
+            for (auto nid : neighbors) {
+                edge_candidates->Push(build_data->ComputePairVectors(nid, target), nid);
+            }
+            select_edges_by_heuristic(
+                edge_candidates, max_degree, build_data, allocator_, this->alpha_);
+            neighbors.clear();
+            while (not edge_candidates->Empty()) {
+                neighbors.emplace_back(edge_candidates->Top().second);
+                edge_candidates->Pop();
+            }
+        }
+        graph->InsertNeighborsById(target, neighbors);
+    });
+}
+
+}  // namespace vsag
@@ -147,6 +147,10 @@ HGraph::move_id(InnerIdType from, InnerIdType to) {
     if (high_precise_codes_) {
         high_precise_codes_->Move(from, to);
     }
+    if (tiered_precise_codes_ != nullptr) {
+        tiered_precise_codes_->Invalidate(from);
+        tiered_precise_codes_->Invalidate(to);
+    }
 
     if (extra_infos_) {
         extra_infos_->Move(from, to);
@@ -0,0 +1,114 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+
+#include "hgraph.h"  // IWYU pragma: keep
+#include "impl/logger/logger.h"
+#include "utils/numa.h"
+
+namespace vsag {
+
+void
+HGraph::build_numa_replicas() {
+    const auto& nodes = NumaOnlineNodes();
+    if (nodes.size() <= 1) {
+        return;
+    }
+    // deduplicated storage and duplicate tracking keep side tables bound to the original cells,
+    // and disk resident cells gain nothing from a per-node copy
+    if (this->using_dedup_storage() or this->support_duplicate_ or
+        not this->basic_flatten_codes_->InMemory() or not this->bottom_graph_->InMemory()) {
+        logger::warn("[hgraph_numa] numa_replicas is ignored for this storage configuration");
+        return;
+    }
+    auto param = std::dynamic_pointer_cast<HGraphParameter>(this->create_param_ptr_);
+    if (param == nullptr or this->basic_flatten_codes_->TotalCount() == 0) {
+        return;
+    }
+
+    const auto begin = std::chrono::steady_clock::now();
+    // the originals already live on the node that first touched them and serve that node, only
+    // the remaining nodes get a copy
+    bool need_release = false;
+    const auto* probe = this->basic_flatten_codes_->GetCodesById(0, need_release);
+    auto home = NumaNodeOfAddress(probe);
+    if (need_release) {
+        this->basic_flatten_codes_->Release(probe);
+    }
+    if (home < 0) {
+        home = NumaCurrentNode();
+    }
+    try {
+        auto common_param = this->basic_flatten_codes_->ExportCommonParam();
+        UnorderedMap<std::string, float> runtime_param(allocator_);
+        runtime_param.insert(
+            {PREFETCH_DEPTH_CODE, (this->basic_flatten_codes_->code_size_ + 63.0) / 64.0});
+
+        const auto total_count = this->basic_flatten_codes_->TotalCount();
+        std::vector<NumaReplica> replicas(*std::max_element(nodes.begin(), nodes.end()) + 1);
+        for (auto node : nodes) {
+            auto& replica = replicas[node];
+            if (node == home) {
+                replica.basic_flatten_codes = this->basic_flatten_codes_;
+                replica.bottom_graph = this->bottom_graph_;
+                continue;
+            }
+            // every page of the copy is first touched while the thread prefers the target node
+            ScopedNumaPreferredNode preferred(node);
+
+            replica.basic_flatten_codes =
+                FlattenInterface::MakeInstance(param->base_codes_param, common_param);
+            this->basic_flatten_codes_->ExportModel(replica.basic_flatten_codes);
+            replica.basic_flatten_codes->Resize(total_count);
+            replica.basic_flatten_codes->MergeOther(this->basic_flatten_codes_, 0);
+            replica.basic_flatten_codes->SetRuntimeParameters(runtime_param);
+
+            replica.bottom_graph =
+                GraphInterface::MakeInstance(param->bottom_graph_param, common_param);
+            replica.bottom_graph->Resize(this->bottom_graph_->TotalCount());
+            replica.bottom_graph->MergeOther(this->bottom_graph_, 0);
+        }
+        this->numa_replica_list_ = std::move(replicas);
+    } catch (const std::exception& e) {
+        // replicas are only a locality optimization, searching the originals stays correct
+        logger::warn("[hgraph_numa] failed to build numa replicas: {}", e.what());
+        return;
+    }
+    this->cal_memory_usage();
+
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin);
+    logger::info("[hgraph_numa] replicated bottom graph and base codes to {} nodes in {:.3f}s",
+                 nodes.size() - 1,
+                 elapsed.count());
+}
+
+void
+HGraph::select_numa_replica(GraphInterfacePtr& bottom_graph, FlattenInterfacePtr& codes) const {
+    if (this->numa_replica_list_.empty()) {
+        return;
+    }
+    const auto node = NumaCurrentNode();
+    if (node < 0 or static_cast<uint64_t>(node) >= this->numa_replica_list_.size()) {
+        return;
+    }
+    const auto& replica = this->numa_replica_list_[node];
+    if (replica.bottom_graph != nullptr) {
+        bottom_graph = replica.bottom_graph;
+        codes = replica.basic_flatten_codes;
+    }
+}
+
+}  // namespace vsag
@@ -472,6 +472,76 @@ HGraph::map_hgraph_param(const JsonType& hgraph_json) {
                 HGRAPH_PERSIST_SOURCE_ID_KEY,
             },
         },
+        {
+            HGRAPH_MERGE_MODE,
+            {
+                HGRAPH_MERGE_MODE,
+            },
+        },
+        {
+            HGRAPH_NUMA_REPLICAS,
+            {
+                HGRAPH_NUMA_REPLICAS,
+            },
+        },
+        {
+            HGRAPH_PARTITION_BUILD_COUNT,
+            {
+                HGRAPH_PARTITION_BUILD_COUNT,
+            },
+        },
+        {
+            HGRAPH_PARTITION_BUILD_MEMORY_BUDGET,
+            {
+                HGRAPH_PARTITION_BUILD_MEMORY_BUDGET,
+            },
+        },
+        {
+            HGRAPH_BASE_IO_NUMA_INTERLEAVE,
+            {
+                BASE_CODES_KEY,
+                IO_PARAMS_KEY,
+                BLOCK_IO_NUMA_INTERLEAVE_KEY,
+            },
+        },
+        {
+            HGRAPH_GRAPH_IO_NUMA_INTERLEAVE,
+            {
+                GRAPH_KEY,
+                IO_PARAMS_KEY,
+                BLOCK_IO_NUMA_INTERLEAVE_KEY,
+            },
+        },
+        {
+            HGRAPH_BASE_IO_HUGE_PAGE,
+            {
+                BASE_CODES_KEY,
+                IO_PARAMS_KEY,
+                BLOCK_IO_HUGE_PAGE_KEY,
+            },
+        },
+        {
+            HGRAPH_PRECISE_IO_HUGE_PAGE,
+            {
+                PRECISE_CODES_KEY,
+                IO_PARAMS_KEY,
+                BLOCK_IO_HUGE_PAGE_KEY,
+            },
+        },
+        {
+            HGRAPH_GRAPH_IO_HUGE_PAGE,
+            {
+                GRAPH_KEY,
+                IO_PARAMS_KEY,
+                BLOCK_IO_HUGE_PAGE_KEY,
+            },
+        },
+        {
+            HGRAPH_PRECISE_HOT_CODES_SIZE,
+            {
+                PRECISE_HOT_CODES_SIZE_KEY,
+            },
+        },
         {
             HGRAPH_LABEL_REMAP_TYPE,
             {
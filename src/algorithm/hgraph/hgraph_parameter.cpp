@@ -169,6 +169,30 @@ HGraphParameter::FromJson(const JsonType& json) {
     if (json.Contains(HGRAPH_PERSIST_SOURCE_ID_KEY)) {
         this->persist_source_id = json[HGRAPH_PERSIST_SOURCE_ID_KEY].GetBool();
     }
+    if (json.Contains(HGRAPH_MERGE_MODE)) {
+        this->merge_mode = json[HGRAPH_MERGE_MODE].GetString();
+        CHECK_ARGUMENT(this->merge_mode == HGRAPH_MERGE_MODE_REBUILD or
+                           this->merge_mode == HGRAPH_MERGE_MODE_INCREMENTAL,
+                       fmt::format("hgraph merge_mode must be '{}' or '{}'",
+                                   HGRAPH_MERGE_MODE_REBUILD,
+                                   HGRAPH_MERGE_MODE_INCREMENTAL));
+    }
+    if (json.Contains(HGRAPH_NUMA_REPLICAS)) {
+        CHECK_ARGUMENT(json[HGRAPH_NUMA_REPLICAS].IsBool(),
+                       "hgraph numa_replicas must be a boolean");
+        this->numa_replicas = json[HGRAPH_NUMA_REPLICAS].GetBool();
+    }
+    if (json.Contains(HGRAPH_PARTITION_BUILD_COUNT)) {
+        CHECK_ARGUMENT(json[HGRAPH_PARTITION_BUILD_COUNT].IsNumberUnsigned(),
+                       "hgraph partition_build_count must be a non-negative integer");
+        this->partition_build_count = json[HGRAPH_PARTITION_BUILD_COUNT].GetUint64();
+    }
+    if (json.Contains(HGRAPH_PARTITION_BUILD_MEMORY_BUDGET)) {
+        CHECK_ARGUMENT(json[HGRAPH_PARTITION_BUILD_MEMORY_BUDGET].IsNumberUnsigned(),
+                       "hgraph partition_build_memory_budget must be a non-negative integer");
+        this->partition_build_memory_budget =
+            json[HGRAPH_PARTITION_BUILD_MEMORY_BUDGET].GetUint64();
+    }
     const bool has_mci_parameter =
         json.Contains(HGRAPH_MCI_MCS) or json.Contains(HGRAPH_MCI_CLIQUE_MAX) or
         json.Contains(HGRAPH_MCI_ALPHA) or json.Contains(HGRAPH_MCI_KNNG_SOURCE) or
@@ -255,6 +279,10 @@ HGraphParameter::ToJson() const {
     json[DUPLICATE_DISTANCE_THRESHOLD].SetFloat(this->duplicate_distance_threshold);
     json[SUPPORT_FORCE_REMOVE].SetBool(this->support_force_remove);
     json[HGRAPH_PERSIST_SOURCE_ID_KEY].SetBool(this->persist_source_id);
+    json[HGRAPH_MERGE_MODE].SetString(this->merge_mode);
+    json[HGRAPH_NUMA_REPLICAS].SetBool(this->numa_replicas);
+    json[HGRAPH_PARTITION_BUILD_COUNT].SetUint64(this->partition_build_count);
+    json[HGRAPH_PARTITION_BUILD_MEMORY_BUDGET].SetUint64(this->partition_build_memory_budget);
     if (this->mci_parameters.enabled) {
         json[HGRAPH_USE_MCI].SetBool(true);
         json[HGRAPH_MCI_MCS].SetInt(static_cast<int64_t>(this->mci_parameters.mcs));
@@ -342,6 +370,14 @@ HGraphSearchParameters::FromJson(const std::string& json_string) {
     if (params[INDEX_TYPE_HGRAPH].Contains(HGRAPH_PARAMETER_HOPS_LIMIT)) {
         obj.hops_limit = params[INDEX_TYPE_HGRAPH][HGRAPH_PARAMETER_HOPS_LIMIT].GetInt();
     }
+    if (params[INDEX_TYPE_HGRAPH].Contains(HGRAPH_PARAMETER_EARLY_STOP_PATIENCE)) {
+        const auto& patience_json = params[INDEX_TYPE_HGRAPH][HGRAPH_PARAMETER_EARLY_STOP_PATIENCE];
+        CHECK_ARGUMENT(patience_json.IsNumberUnsigned() and
+                           patience_json.GetUint64() <= std::numeric_limits<uint32_t>::max(),
+                       fmt::format("{} must be a non-negative 32-bit integer",
+                                   HGRAPH_PARAMETER_EARLY_STOP_PATIENCE));
+        obj.early_stop_patience = static_cast<uint32_t>(patience_json.GetUint64());
+    }
     if (params[INDEX_TYPE_HGRAPH].Contains(HGRAPH_USE_EXTRA_INFO_FILTER)) {
         obj.use_extra_info_filter =
             params[INDEX_TYPE_HGRAPH][HGRAPH_USE_EXTRA_INFO_FILTER].GetBool();
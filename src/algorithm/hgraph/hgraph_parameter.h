@@ -83,6 +83,14 @@ public:
 
     bool persist_source_id{false};
 
+    std::string merge_mode{HGRAPH_MERGE_MODE_REBUILD};
+
+    bool numa_replicas{false};
+
+    // Build partitions the data and merges the partition graphs when either is positive.
+    uint64_t partition_build_count{0};
+    uint64_t partition_build_memory_budget{0};
+
     HGraphMCIParameters mci_parameters{};
 
     DataTypes data_type{DataTypes::DATA_TYPE_FLOAT};
@@ -98,6 +106,9 @@ public:
 public:
     int64_t ef_search{30};
     uint32_t hops_limit{std::numeric_limits<uint32_t>::max()};
+    // If > 0, a KNN search stops once its best k results have not improved for this many
+    // consecutive hops, trading a little recall on easy queries for fewer hops.
+    uint32_t early_stop_patience{0};
     bool use_reorder{false};
     bool use_extra_info_filter{false};
     bool rabitq_one_bit_search{false};
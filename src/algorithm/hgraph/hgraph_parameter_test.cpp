@@ -255,6 +255,116 @@ TEST_CASE("HGraph maps resize increase count bit", "[ut][HGraphParameter]") {
         vsag::JsonType::Parse(R"({"resize_increase_count_bit": -1})"), common_param));
 }
 
+TEST_CASE("HGraph maps merge mode", "[ut][HGraphParameter]") {
+    vsag::IndexCommonParam common_param;
+    common_param.dim_ = 128;
+    common_param.data_type_ = vsag::DataTypes::DATA_TYPE_FLOAT;
+
+    auto default_param = std::dynamic_pointer_cast<vsag::HGraphParameter>(
+        vsag::HGraph::CheckAndMappingExternalParam(vsag::JsonType::Parse("{}"), common_param));
+    REQUIRE(default_param != nullptr);
+    REQUIRE(default_param->merge_mode == vsag::HGRAPH_MERGE_MODE_REBUILD);
+
+    auto configured_param =
+        std::dynamic_pointer_cast<vsag::HGraphParameter>(vsag::HGraph::CheckAndMappingExternalParam(
+            vsag::JsonType::Parse(R"({"merge_mode": "incremental"})"), common_param));
+    REQUIRE(configured_param != nullptr);
+    REQUIRE(configured_param->merge_mode == vsag::HGRAPH_MERGE_MODE_INCREMENTAL);
+    REQUIRE(configured_param->ToJson()[vsag::HGRAPH_MERGE_MODE].GetString() ==
+            vsag::HGRAPH_MERGE_MODE_INCREMENTAL);
+
+    REQUIRE_THROWS(vsag::HGraph::CheckAndMappingExternalParam(
+        vsag::JsonType::Parse(R"({"merge_mode": "odescent"})"), common_param));
+}
+
+TEST_CASE("HGraph maps NUMA options", "[ut][HGraphParameter]") {
+    vsag::IndexCommonParam common_param;
+    common_param.dim_ = 128;
+    common_param.data_type_ = vsag::DataTypes::DATA_TYPE_FLOAT;
+
+    auto default_param = std::dynamic_pointer_cast<vsag::HGraphParameter>(
+        vsag::HGraph::CheckAndMappingExternalParam(vsag::JsonType::Parse("{}"), common_param));
+    REQUIRE(default_param != nullptr);
+    REQUIRE_FALSE(default_param->numa_replicas);
+
+    auto configured_param =
+        std::dynamic_pointer_cast<vsag::HGraphParameter>(vsag::HGraph::CheckAndMappingExternalParam(
+            vsag::JsonType::Parse(R"({
+                "base_io_type": "block_memory_io",
+                "graph_io_type": "block_memory_io",
+                "numa_replicas": true,
+                "base_io_numa_interleave": true,
+                "graph_io_numa_interleave": true
+            })"),
+            common_param));
+    REQUIRE(configured_param != nullptr);
+    REQUIRE(configured_param->numa_replicas);
+    auto json = configured_param->ToJson();
+    REQUIRE(json[vsag::HGRAPH_NUMA_REPLICAS].GetBool());
+    REQUIRE(json["base_codes"]["io_params"]["numa_interleave"].GetBool());
+    REQUIRE(json["graph"]["io_params"]["numa_interleave"].GetBool());
+
+    REQUIRE_THROWS(vsag::HGraph::CheckAndMappingExternalParam(
+        vsag::JsonType::Parse(R"({"numa_replicas": "yes"})"), common_param));
+}
+
+TEST_CASE("HGraph maps precise hot codes size", "[ut][HGraphParameter]") {
+    vsag::IndexCommonParam common_param;
+    common_param.dim_ = 128;
+    common_param.data_type_ = vsag::DataTypes::DATA_TYPE_FLOAT;
+
+    auto default_param = std::dynamic_pointer_cast<vsag::HGraphParameter>(
+        vsag::HGraph::CheckAndMappingExternalParam(vsag::JsonType::Parse("{}"), common_param));
+    REQUIRE(default_param != nullptr);
+    REQUIRE(default_param->precise_hot_codes_size == 0);
+
+    auto configured_param =
+        std::dynamic_pointer_cast<vsag::HGraphParameter>(vsag::HGraph::CheckAndMappingExternalParam(
+            vsag::JsonType::Parse(R"({
+                "use_reorder": true,
+                "precise_io_type": "buffer_io",
+                "precise_hot_codes_size": 1048576
+            })"),
+            common_param));
+    REQUIRE(configured_param != nullptr);
+    REQUIRE(configured_param->precise_hot_codes_size == 1048576);
+    REQUIRE(configured_param->ToJson()[vsag::HGRAPH_PRECISE_HOT_CODES_SIZE].GetUint64() ==
+            1048576);
+
+    REQUIRE_THROWS(vsag::HGraph::CheckAndMappingExternalParam(
+        vsag::JsonType::Parse(R"({"use_reorder": true, "precise_hot_codes_size": -1})"),
+        common_param));
+}
+
+TEST_CASE("HGraph maps partitioned build options", "[ut][HGraphParameter]") {
+    vsag::IndexCommonParam common_param;
+    common_param.dim_ = 128;
+    common_param.data_type_ = vsag::DataTypes::DATA_TYPE_FLOAT;
+
+    auto default_param = std::dynamic_pointer_cast<vsag::HGraphParameter>(
+        vsag::HGraph::CheckAndMappingExternalParam(vsag::JsonType::Parse("{}"), common_param));
+    REQUIRE(default_param != nullptr);
+    REQUIRE(default_param->partition_build_count == 0);
+    REQUIRE(default_param->partition_build_memory_budget == 0);
+
+    auto configured_param =
+        std::dynamic_pointer_cast<vsag::HGraphParameter>(vsag::HGraph::CheckAndMappingExternalParam(
+            vsag::JsonType::Parse(R"({
+                "partition_build_count": 8,
+                "partition_build_memory_budget": 1073741824
+            })"),
+            common_param));
+    REQUIRE(configured_param != nullptr);
+    REQUIRE(configured_param->partition_build_count == 8);
+    REQUIRE(configured_param->partition_build_memory_budget == 1073741824);
+    auto json = configured_param->ToJson();
+    REQUIRE(json[vsag::HGRAPH_PARTITION_BUILD_COUNT].GetUint64() == 8);
+    REQUIRE(json[vsag::HGRAPH_PARTITION_BUILD_MEMORY_BUDGET].GetUint64() == 1073741824);
+
+    REQUIRE_THROWS(vsag::HGraph::CheckAndMappingExternalParam(
+        vsag::JsonType::Parse(R"({"partition_build_count": -1})"), common_param));
+}
+
 TEST_CASE("HGraph rejects deduplicate_storage without support_duplicate", "[ut][HGraphParameter]") {
     auto param = vsag::JsonType::Parse(R"({
         "base_quantization_type": "fp32",
@@ -918,3 +1028,46 @@ TEST_CASE("HGraph maps MRLE RaBitQ split to base reorder", "[ut][HGraphParameter
     param["tq_chain"].SetString("pca, rabitq");
     REQUIRE_THROWS(vsag::HGraph::CheckAndMappingExternalParam(param, common_param));
 }
+
+TEST_CASE("HGraph maps huge page options", "[ut][HGraphParameter]") {
+    vsag::IndexCommonParam common_param;
+    common_param.dim_ = 128;
+    common_param.data_type_ = vsag::DataTypes::DATA_TYPE_FLOAT;
+
+    auto param =
+        std::dynamic_pointer_cast<vsag::HGraphParameter>(vsag::HGraph::CheckAndMappingExternalParam(
+            vsag::JsonType::Parse(R"({
+                "base_io_type": "block_memory_io",
+                "graph_io_type": "block_memory_io",
+                "use_reorder": true,
+                "precise_quantization_type": "fp32",
+                "precise_io_type": "block_memory_io",
+                "base_io_huge_page": "transparent",
+                "precise_io_huge_page": "2m",
+                "graph_io_huge_page": "1g"
+            })"),
+            common_param));
+    REQUIRE(param != nullptr);
+    auto json = param->ToJson();
+    REQUIRE(json["base_codes"]["io_params"]["huge_page"].GetString() == "transparent");
+    REQUIRE(json["precise_codes"]["io_params"]["huge_page"].GetString() == "2m");
+    REQUIRE(json["graph"]["io_params"]["huge_page"].GetString() == "1g");
+
+    REQUIRE_THROWS(vsag::HGraph::CheckAndMappingExternalParam(
+        vsag::JsonType::Parse(R"({"base_io_huge_page": "64k"})"), common_param));
+}
+
+TEST_CASE("HGraphSearchParameters parses early_stop_patience",
+          "[ut][HGraphSearchParameters][early_stop]") {
+    auto params = vsag::HGraphSearchParameters::FromJson(R"({"hgraph": {"ef_search": 32}})");
+    REQUIRE(params.early_stop_patience == 0);
+
+    params = vsag::HGraphSearchParameters::FromJson(
+        R"({"hgraph": {"ef_search": 32, "early_stop_patience": 8}})");
+    REQUIRE(params.early_stop_patience == 8);
+
+    REQUIRE_THROWS(vsag::HGraphSearchParameters::FromJson(
+        R"({"hgraph": {"ef_search": 32, "early_stop_patience": -1}})"));
+    REQUIRE_THROWS(vsag::HGraphSearchParameters::FromJson(
+        R"({"hgraph": {"ef_search": 32, "early_stop_patience": 1.5}})"));
+}
@@ -449,6 +449,8 @@ HGraph::SearchWithRequest(const SearchRequest& request) const {
 
     auto params = HGraphSearchParameters::FromJson(request.params_str_);
     ctx.rabitq_error_rate = params.rabitq_error_rate;
+    const auto deadline = SearchDeadline::Make(params.timeout_ms, &request);
+    ctx.deadline = deadline.get();
 
     if (use_custom_distance) {
         CHECK_ARGUMENT(params.parallel_search_thread_count == 1,
@@ -556,11 +558,16 @@ HGraph::SearchWithRequest(const SearchRequest& request) const {
     visited_list_guard vt_guard{this->pool_, this->pool_->TakeOne()};
     auto& vt = vt_guard.visited_list;
 
+    // with numa_replicas the graph and codes come from the copy on this thread's node
+    auto bottom_graph = this->bottom_graph_;
+    auto search_codes = this->basic_flatten_codes_;
+    this->select_numa_replica(bottom_graph, search_codes);
+
     const auto* raw_query = use_custom_distance ? nullptr : get_data(query);
     ctx.distance_phase = DistanceEvaluationPhase::ROUTING;
     for (auto i = static_cast<int64_t>(this->route_graphs_.size() - 1); i >= 0; --i) {
         auto result = this->search_one_graph(
-            raw_query, this->route_graphs_[i], this->basic_flatten_codes_, search_param, vt, &ctx);
+            raw_query, this->route_graphs_[i], search_codes, search_param, vt, &ctx);
         // An unrankable route seed can still bridge to finite bottom-layer results.
         if (not result->Empty()) {
             search_param.ep = result->Top().second;
@@ -603,12 +610,9 @@ HGraph::SearchWithRequest(const SearchRequest& request) const {
         search_param.consider_duplicate = true;
         search_param.enable_rabitq_one_bit_search =
             use_custom_distance ? false : params.rabitq_one_bit_search;
-        if (params.enable_time_record) {
-            search_param.time_cost = std::make_shared<Timer>();
-            search_param.time_cost->SetThreshold(params.timeout_ms);
-            stats.is_timeout.store(false, std::memory_order_relaxed);
-        }
         search_param.parallel_search_thread_count = params.parallel_search_thread_count;
+        search_param.early_stop_patience = params.early_stop_patience;
+        search_param.early_stop_topk = k;
 
         if (static_cast<uint64_t>(params.hops_limit) <= static_cast<uint64_t>(params.ef_search)) {
             search_param.hops_limit = std::numeric_limits<uint32_t>::max();
@@ -654,8 +658,8 @@ HGraph::SearchWithRequest(const SearchRequest& request) const {
                 search_result = std::move(mci_result.result);
             } else {
                 search_result = this->search_one_graph(raw_query,
-                                                       this->bottom_graph_,
-                                                       this->basic_flatten_codes_,
+                                                       bottom_graph,
+                                                       search_codes,
                                                        search_param,
                                                        vt,
                                                        &ctx,
@@ -664,8 +668,8 @@ HGraph::SearchWithRequest(const SearchRequest& request) const {
         }
     } else {
         search_result = this->search_one_graph(raw_query,
-                                               this->bottom_graph_,
-                                               this->basic_flatten_codes_,
+                                               bottom_graph,
+                                               search_codes,
                                                search_param,
                                                vt,
                                                &ctx,
@@ -691,7 +695,7 @@ HGraph::SearchWithRequest(const SearchRequest& request) const {
         auto limit = is_range ? request.limited_size_ : k;
         auto reorder_threshold = is_range ? std::nullopt : request.threshold_;
         this->reorder(raw_query,
-                      this->basic_flatten_codes_,
+                      search_codes,
                       search_result,
                       limit,
                       nullptr,
@@ -1105,6 +1105,18 @@ HGraph::GetMemoryUsageDetail() const {
     if (this->mci_cliques_ != nullptr) {
         memory_usage["mci_cliques"] = this->mci_cliques_->GetMemoryUsage();
     }
+    // huge page coverage is only reported for components that have any
+    auto report_huge_pages = [&memory_usage](const std::string& name, uint64_t bytes) {
+        if (bytes > 0) {
+            memory_usage[name + "_huge_page"] = bytes;
+        }
+    };
+    report_huge_pages("basic_flatten_codes", this->basic_flatten_codes_->GetHugePageMemoryUsage());
+    report_huge_pages("bottom_graph", this->bottom_graph_->GetHugePageMemoryUsage());
+    if (this->has_precise_reorder()) {
+        report_huge_pages("high_precise_codes",
+                          this->high_precise_codes_->GetHugePageMemoryUsage());
+    }
     return memory_usage;
 }
 
@@ -35,7 +35,6 @@ public:
 
         if (json.Contains(SEARCH_MAX_TIME_COST_MS)) {
             timeout_ms = json[SEARCH_MAX_TIME_COST_MS].GetInt();
-            enable_time_record = true;
         }
 
         if (json.Contains(SEARCH_PARAM_FACTOR)) {
@@ -52,7 +51,6 @@ public:
 
     // for timeout
     double timeout_ms{std::numeric_limits<double>::max()};
-    bool enable_time_record{false};
 
     // for reorder, controls the number of candidates to reorder
     float topk_factor{0.0F};
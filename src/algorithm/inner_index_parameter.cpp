@@ -223,6 +223,13 @@ InnerIndexParameter::FromJson(const JsonType& json) {
         this->precise_codes_param = CreateFlattenParam(json[PRECISE_CODES_KEY]);
     }
 
+    if (json.Contains(PRECISE_HOT_CODES_SIZE_KEY)) {
+        CHECK_ARGUMENT(
+            json[PRECISE_HOT_CODES_SIZE_KEY].IsNumberUnsigned(),
+            fmt::format("{} must be a non-negative integer", PRECISE_HOT_CODES_SIZE_KEY));
+        this->precise_hot_codes_size = json[PRECISE_HOT_CODES_SIZE_KEY].GetUint64();
+    }
+
     if (json.Contains(STORE_RAW_VECTOR_KEY)) {
         this->store_raw_vector = json[STORE_RAW_VECTOR_KEY].GetBool();
     }
@@ -255,6 +262,7 @@ InnerIndexParameter::ToJson() const {
     json[USE_ATTRIBUTE_FILTER_KEY].SetBool(this->use_attribute_filter);
     if (use_reorder && this->reorder_source != HGRAPH_REORDER_SOURCE_BASE) {
         json[PRECISE_CODES_KEY].SetJson(this->precise_codes_param->ToJson());
+        json[PRECISE_HOT_CODES_SIZE_KEY].SetUint64(this->precise_hot_codes_size);
     }
     json[STORE_RAW_VECTOR_KEY].SetBool(this->store_raw_vector);
     if (this->store_raw_vector) {
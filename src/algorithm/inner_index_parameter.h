@@ -57,6 +57,8 @@ public:
     bool use_reorder{false};
     std::string reorder_source{HGRAPH_REORDER_SOURCE_PRECISE};
     FlattenInterfaceParamPtr precise_codes_param{nullptr};
+    // bytes of precise codes kept in memory for the most returned ids, 0 disables the tier
+    uint64_t precise_hot_codes_size{0};
 
     bool use_attribute_filter{false};
 
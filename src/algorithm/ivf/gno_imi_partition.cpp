@@ -68,6 +68,8 @@ GNOIMIPartition::GNOIMIPartition(const IndexCommonParam& common_param,
       norms_t_(allocator_),
       precomputed_terms_st_(allocator_),
       common_param_(common_param) {
+    kmeans_algorithm_ = param->kmeans_algorithm;
+    kmeans_mini_batch_size_ = param->kmeans_mini_batch_size;
     data_centroids_s_.resize(bucket_count_s_ * dim_);
     data_centroids_t_.resize(bucket_count_t_ * dim_);
     norms_s_.resize(bucket_count_s_);
@@ -120,6 +122,7 @@ GNOIMIPartition::Train(const DatasetPtr dataset) {
         ->Owner(false);
 
     KMeansCluster cls(static_cast<int32_t>(dim), this->allocator_);
+    cls.SetAlgorithm(kmeans_algorithm_, kmeans_mini_batch_size_);
     Vector<float> residuals(vectors, vectors + num_element * dim, allocator_);
 
     auto train_and_get_residual = [&, this](const DatasetPtr& centroids,
@@ -139,10 +142,16 @@ GNOIMIPartition::Train(const DatasetPtr dataset) {
         double err_to_s = 0.0;
         double err_to_t = 0.0;
         train_and_get_residual(centroids_s, data_centroids_s_tmp.data(), &err_to_s);
-        logger::info("gnoimi train iter: {}, err of centroids_s: {}", i, err_to_s);
+        logger::info("gnoimi train iter: {}, err of centroids_s: {}, cost {}ms",
+                     i,
+                     err_to_s,
+                     cls.GetStats().train_time_ms);
 
         train_and_get_residual(centroids_t, data_centroids_t_tmp.data(), &err_to_t);
-        logger::info("gnoimi train iter: {}, err of centroids_t: {}", i, err_to_t);
+        logger::info("gnoimi train iter: {}, err of centroids_t: {}, cost {}ms",
+                     i,
+                     err_to_t,
+                     cls.GetStats().train_time_ms);
 
         if (err_to_t < min_err) {
             min_err = err_to_t;
@@ -56,6 +56,8 @@ public:
 
 public:
     IVFNearestPartitionTrainerType trainer_type_{IVFNearestPartitionTrainerType::KMeansTrainer};
+    KMeansAlgorithm kmeans_algorithm_{KMeansAlgorithm::LLOYD};
+    uint64_t kmeans_mini_batch_size_{0};
     IndexCommonParam common_param_;
     std::shared_ptr<BruteForceParameter> param_ptr_{nullptr};
     BucketIdType bucket_count_s_{0};
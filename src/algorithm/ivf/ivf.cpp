@@ -33,6 +33,7 @@
 #include "flat_bucket_searcher.h"
 #include "gno_imi_partition.h"
 #include "graph_bucket_searcher.h"
+#include "impl/cluster/kmeans_cluster.h"
 #include "impl/heap/standard_heap.h"
 #include "impl/inner_search_param.h"
 #include "impl/pruning_strategy.h"
@@ -40,6 +41,7 @@
 #include "impl/reorder/bucket_reorder.h"
 #include "impl/reorder/flatten_reorder.h"
 #include "impl/searcher/basic_searcher.h"
+#include "impl/thread_pool/inline_thread_pool.h"
 #include "index/index_impl.h"
 #include "index_feature_list.h"
 #include "inner_string_params.h"
@@ -131,7 +133,9 @@ static constexpr const char* IVF_PARAMS_TEMPLATE =
         "{ATTR_PARAMS_KEY}": {
             "{ATTR_HAS_BUCKETS_KEY}": true
         },
-        "{GRAPH_BUILD_THRESHOLD_KEY}": 0
+        "{GRAPH_BUILD_THRESHOLD_KEY}": 0,
+        "{REBALANCE_SPLIT_RATIO_KEY}": 0.0,
+        "{REBALANCE_MERGE_RATIO_KEY}": 0.25
     })";
 
 ParamPtr
@@ -216,6 +220,28 @@ IVF::CheckAndMappingExternalParam(const JsonType& external_param,
                 IVF_TRAIN_TYPE_KEY,
             },
         },
+        {
+            IVF_KMEANS_ALGORITHM,
+            {
+                IVF_PARTITION_STRATEGY_PARAMS_KEY,
+                KMEANS_ALGORITHM_KEY,
+            },
+        },
+        {
+            IVF_KMEANS_ALGORITHM,
+            {
+                BUCKET_PARAMS_KEY,
+                QUANTIZATION_PARAMS_KEY,
+                KMEANS_ALGORITHM_KEY,
+            },
+        },
+        {
+            IVF_KMEANS_MINI_BATCH_SIZE,
+            {
+                IVF_PARTITION_STRATEGY_PARAMS_KEY,
+                KMEANS_MINI_BATCH_SIZE_KEY,
+            },
+        },
         {
             IVF_PARTITION_STRATEGY_TYPE_KEY,
             {
@@ -257,6 +283,12 @@ IVF::CheckAndMappingExternalParam(const JsonType& external_param,
                 PRECISE_CODES_LAYOUT_KEY,
             },
         },
+        {
+            IVF_PRECISE_HOT_CODES_SIZE,
+            {
+                PRECISE_HOT_CODES_SIZE_KEY,
+            },
+        },
         {
             IVF_USE_RESIDUAL,
             {
@@ -376,6 +408,18 @@ IVF::CheckAndMappingExternalParam(const JsonType& external_param,
                 GRAPH_BUILD_THRESHOLD_KEY,
             },
         },
+        {
+            IVF_REBALANCE_SPLIT_RATIO,
+            {
+                REBALANCE_SPLIT_RATIO_KEY,
+            },
+        },
+        {
+            IVF_REBALANCE_MERGE_RATIO,
+            {
+                REBALANCE_MERGE_RATIO_KEY,
+            },
+        },
         {
             IVF_BASE_ENABLE_READ_CACHE,
             {
@@ -454,7 +498,13 @@ IVF::IVF(const IVFParameterPtr& param, const IndexCommonParam& common_param)
         } else {
             this->reorder_codes_ =
                 FlattenInterface::MakeInstance(param->precise_codes_param, modified_common_param);
-            reorder_ = std::make_shared<FlattenReorder>(this->reorder_codes_, allocator_);
+            if (param->precise_hot_codes_size > 0 and
+                TieredPreciseCodes::Supports(this->reorder_codes_)) {
+                this->tiered_precise_codes_ = std::make_shared<TieredPreciseCodes>(
+                    this->reorder_codes_, param->precise_hot_codes_size, allocator_);
+            }
+            reorder_ = std::make_shared<FlattenReorder>(
+                this->reorder_codes_, allocator_, this->tiered_precise_codes_);
         }
     }
     if (param->bucket_param->use_residual_) {
@@ -463,6 +513,8 @@ IVF::IVF(const IVFParameterPtr& param, const IndexCommonParam& common_param)
 
     this->graph_param_ = param->graph_param;
     this->graph_build_threshold_ = param->graph_build_threshold;
+    this->rebalance_split_ratio_ = param->rebalance_split_ratio;
+    this->rebalance_merge_ratio_ = param->rebalance_merge_ratio;
     if (this->graph_build_threshold_ > 0) {
         this->bucket_searcher_ = std::make_shared<GraphBucketSearcher>(
             this->graph_build_threshold_, this->bucket_graphs_, this->allocator_);
@@ -509,7 +561,8 @@ IVF::InitFeatures() {
 
     auto name = this->bucket_->GetQuantizerName();
     if (name != QUANTIZATION_TYPE_VALUE_FP32 and name != QUANTIZATION_TYPE_VALUE_BF16 and
-        name != QUANTIZATION_TYPE_VALUE_FP16) {
+        name != QUANTIZATION_TYPE_VALUE_FP16 and name != QUANTIZATION_TYPE_VALUE_FP8_E4M3 and
+        name != QUANTIZATION_TYPE_VALUE_FP8_E5M2) {
         this->index_feature_list_->SetFeature(IndexFeature::NEED_TRAIN);
     } else {
         this->index_feature_list_->SetFeatures({
@@ -593,6 +646,7 @@ IVF::Add(const DatasetPtr& base) {
     if (not partition_strategy_->is_trained_) {
         throw VsagException(ErrorType::INTERNAL_ERROR, "ivf index add without train error");
     }
+    std::shared_lock rebalance_lock(this->rebalance_mutex_);
     this->bucket_->Unpack();
     if (precise_bucket_ != nullptr) {
         this->precise_bucket_->Unpack();
@@ -720,6 +774,10 @@ IVF::Add(const DatasetPtr& base) {
     if (need_cal_memory_usage) {
         this->cal_memory_usage();
     }
+    if (this->rebalance_split_ratio_ > 0.0F) {
+        rebalance_lock.unlock();
+        this->flush_pending_splits();
+    }
     return {};
 }
 
@@ -889,6 +947,278 @@ IVF::build_bucket_graphs() {
         }
     }
 }
+
+void
+IVF::set_location(InnerIdType inner_id, BucketIdType bucket_id, InnerIdType offset_id) {
+    std::lock_guard lock(label_lookup_mutex_);
+    location_map_[inner_id] =
+        (static_cast<uint64_t>(bucket_id) << LOCATION_SPLIT_BIT) | static_cast<uint64_t>(offset_id);
+}
+
+void
+IVF::read_bucket_vectors(BucketIdType bucket_id,
+                         Vector<InnerIdType>& inner_ids,
+                         Vector<float>& vectors) const {
+    const auto bucket_size = bucket_->GetBucketSize(bucket_id);
+    const auto* bucket_inner_ids = bucket_->GetInnerIds(bucket_id);
+    // the precise codes hold the vectors at a higher fidelity than the bucket codes
+    Vector<uint8_t> codes(reorder_codes_ != nullptr ? reorder_codes_->GetQuantizerCodeSize() : 0,
+                          allocator_);
+    for (InnerIdType offset = 0; offset < bucket_size; ++offset) {
+        const auto inner_id = bucket_inner_ids[offset];
+        if (inner_id == std::numeric_limits<InnerIdType>::max()) {
+            continue;
+        }
+        inner_ids.push_back(inner_id);
+        vectors.resize(vectors.size() + dim_);
+        auto* vector = vectors.data() + vectors.size() - dim_;
+        bool decoded = false;
+        if (reorder_codes_ != nullptr) {
+            decoded = reorder_codes_->GetCodesById(inner_id, codes.data()) and
+                      reorder_codes_->Decode(codes.data(), vector);
+        } else {
+            decoded = bucket_->DecodeById(bucket_id, offset, vector);
+        }
+        if (not decoded) {
+            throw VsagException(
+                ErrorType::INTERNAL_ERROR,
+                fmt::format("failed to decode vector {} of bucket {}", inner_id, bucket_id));
+        }
+    }
+}
+
+bool
+IVF::dissolve_buckets(const Vector<BucketIdType>& donors) {
+    Vector<bool> is_donor(bucket_->bucket_count_, false, allocator_);
+    Vector<InnerIdType> inner_ids(allocator_);
+    Vector<float> vectors(allocator_);
+    for (auto donor : donors) {
+        is_donor[donor] = true;
+        this->read_bucket_vectors(donor, inner_ids, vectors);
+    }
+    const auto count = static_cast<InnerIdType>(inner_ids.size());
+    if (count > 0) {
+        // one candidate more than the donors always leaves a bucket that stays
+        const auto candidate_count = static_cast<BucketIdType>(
+            std::min<uint64_t>(bucket_->bucket_count_, donors.size() + 1));
+        auto candidates =
+            partition_strategy_->ClassifyDatas(vectors.data(), count, candidate_count, nullptr);
+        Vector<BucketIdType> targets(count, INVALID_BUCKET_ID, allocator_);
+        for (InnerIdType i = 0; i < count; ++i) {
+            for (BucketIdType j = 0; j < candidate_count; ++j) {
+                auto candidate = candidates[i * candidate_count + j];
+                if (candidate != INVALID_BUCKET_ID and not is_donor[candidate]) {
+                    targets[i] = candidate;
+                    break;
+                }
+            }
+            if (targets[i] == INVALID_BUCKET_ID) {
+                return false;
+            }
+        }
+        Vector<InnerIdType> offsets(count, allocator_);
+        bucket_->BatchInsertVector(
+            vectors.data(), targets.data(), inner_ids.data(), count, offsets.data());
+        for (InnerIdType i = 0; i < count; ++i) {
+            this->set_location(inner_ids[i], targets[i], offsets[i]);
+        }
+    }
+    for (auto donor : donors) {
+        bucket_->RewriteBucket(donor, nullptr, nullptr, 0);
+    }
+    this->rebalance_merge_count_.fetch_add(donors.size(), std::memory_order_relaxed);
+    return true;
+}
+
+void
+IVF::flush_pending_splits() {
+    // Four phases, as in SIMQ's split flush:
+    // Phase 1 (serial): pair oversized buckets with donor slots and dissolve the donors
+    // Phase 2 (parallel): local 2-means of every oversized bucket
+    // Phase 3 (serial): publish the new centroids and route the split vectors once
+    // Phase 4 (parallel): rewrite every split pair, boundary vectors move to third buckets
+    // Searches hold rebalance_mutex_ shared, so none observes the state between phases 3 and 4.
+    constexpr InnerIdType min_split_size = 64;
+    constexpr int split_kmeans_iter = 10;
+
+    std::unique_lock rebalance_lock(this->rebalance_mutex_);
+    const auto bucket_count = bucket_->bucket_count_;
+    if (bucket_count < 2) {
+        return;
+    }
+    uint64_t total_size = 0;
+    Vector<std::pair<InnerIdType, BucketIdType>> by_size(allocator_);
+    by_size.reserve(bucket_count);
+    for (BucketIdType b = 0; b < bucket_count; ++b) {
+        const auto size = bucket_->GetBucketSize(b);
+        total_size += size;
+        by_size.emplace_back(size, b);
+    }
+    const auto mean_size = static_cast<double>(total_size) / static_cast<double>(bucket_count);
+    const auto split_size =
+        std::max(static_cast<double>(min_split_size), mean_size * rebalance_split_ratio_);
+    const auto merge_size = mean_size * rebalance_merge_ratio_;
+    std::sort(by_size.begin(), by_size.end());
+
+    struct SplitTask {
+        BucketIdType source;
+        BucketIdType target;
+        bool valid{false};
+        Vector<InnerIdType> inner_ids;
+        Vector<float> vectors;
+        Vector<float> centroids;  // 2 * dim, source then target
+        Vector<int> labels;
+    };
+    Vector<BucketIdType> donors(allocator_);
+    std::vector<SplitTask> tasks;
+    for (uint64_t low = 0, high = by_size.size(); low + 1 < high; ++low, --high) {
+        const auto [source_size, source] = by_size[high - 1];
+        const auto [donor_size, donor] = by_size[low];
+        if (source_size <= split_size or
+            (donor_size > 0 and static_cast<double>(donor_size) >= merge_size)) {
+            break;
+        }
+        donors.push_back(donor);
+        tasks.push_back(SplitTask{source,
+                                  donor,
+                                  false,
+                                  Vector<InnerIdType>(allocator_),
+                                  Vector<float>(allocator_),
+                                  Vector<float>(allocator_),
+                                  Vector<int>(allocator_)});
+    }
+    if (tasks.empty() or not this->dissolve_buckets(donors)) {
+        return;
+    }
+
+    auto run_tasks = [&](const auto& func) {
+        if (this->thread_pool_ != nullptr) {
+            std::vector<std::future<void>> futures;
+            futures.reserve(tasks.size());
+            for (auto& task : tasks) {
+                futures.emplace_back(
+                    this->thread_pool_->GeneralEnqueue([&func, &task]() { func(task); }));
+            }
+            for (auto& future : futures) {
+                future.get();
+            }
+        } else {
+            for (auto& task : tasks) {
+                func(task);
+            }
+        }
+    };
+
+    auto inline_pool = std::make_shared<SafeThreadPool>(new InlineThreadPool(), true);
+    run_tasks([&](SplitTask& task) {
+        this->read_bucket_vectors(task.source, task.inner_ids, task.vectors);
+        const auto count = task.inner_ids.size();
+        if (count < 2) {
+            return;
+        }
+        // may run on a pool worker with rebalance_mutex_ held, the small 2-means stays on this
+        // thread instead of queueing behind thread_pool_ or starting a default pool
+        KMeansCluster cluster(static_cast<int32_t>(dim_), allocator_, inline_pool);
+        task.labels = cluster.Run(2, task.vectors.data(), count, split_kmeans_iter);
+        const auto target_count = std::count(task.labels.begin(), task.labels.end(), 1);
+        if (target_count == 0 or static_cast<uint64_t>(target_count) == count) {
+            return;
+        }
+        task.centroids.assign(cluster.k_centroids_, cluster.k_centroids_ + 2 * dim_);
+        task.valid = true;
+    });
+
+    Vector<BucketIdType> moved_buckets(allocator_);
+    Vector<float> moved_centroids(allocator_);
+    Vector<bool> in_split(bucket_count, false, allocator_);
+    Vector<float> split_vectors(allocator_);
+    for (const auto& task : tasks) {
+        if (not task.valid) {
+            continue;
+        }
+        moved_buckets.push_back(task.source);
+        moved_buckets.push_back(task.target);
+        moved_centroids.insert(moved_centroids.end(), task.centroids.begin(), task.centroids.end());
+        in_split[task.source] = true;
+        in_split[task.target] = true;
+        split_vectors.insert(split_vectors.end(), task.vectors.begin(), task.vectors.end());
+    }
+    if (moved_buckets.empty()) {
+        return;
+    }
+    partition_strategy_->UpdateCentroids(
+        moved_buckets.data(), moved_centroids.data(), moved_buckets.size());
+    const auto split_count = static_cast<int64_t>(split_vectors.size() / dim_);
+    auto nearest = partition_strategy_->ClassifyDatas(split_vectors.data(), split_count, 1, nullptr);
+
+    Vector<uint64_t> nearest_begins(tasks.size(), 0, allocator_);
+    for (uint64_t i = 0, begin = 0; i < tasks.size(); ++i) {
+        nearest_begins[i] = begin;
+        begin += tasks[i].valid ? tasks[i].inner_ids.size() : 0;
+    }
+    std::atomic<uint64_t> reassign_count{0};
+    auto rewrite_pair = [&](SplitTask& task) {
+        if (not task.valid) {
+            return;
+        }
+        const auto task_index = static_cast<uint64_t>(&task - tasks.data());
+        const auto* task_nearest = nearest.data() + nearest_begins[task_index];
+        const BucketIdType pair[2] = {task.source, task.target};
+        Vector<InnerIdType> kept_ids[2] = {Vector<InnerIdType>(allocator_),
+                                           Vector<InnerIdType>(allocator_)};
+        Vector<float> kept_vectors[2] = {Vector<float>(allocator_), Vector<float>(allocator_)};
+        Vector<InnerIdType> moved_ids(allocator_);
+        Vector<BucketIdType> moved_targets(allocator_);
+        Vector<float> moved_vectors(allocator_);
+        for (uint64_t i = 0; i < task.inner_ids.size(); ++i) {
+            const auto* vector = task.vectors.data() + i * dim_;
+            auto bucket = task_nearest[i];
+            if (bucket != INVALID_BUCKET_ID and not in_split[bucket]) {
+                // a boundary vector, now closer to a bucket outside every split pair
+                moved_ids.push_back(task.inner_ids[i]);
+                moved_targets.push_back(bucket);
+                moved_vectors.insert(moved_vectors.end(), vector, vector + dim_);
+                continue;
+            }
+            // a bucket of another pair is being rewritten, fall back to the local 2-means
+            auto side = bucket == task.source ? 0 : (bucket == task.target ? 1 : task.labels[i]);
+            kept_ids[side].push_back(task.inner_ids[i]);
+            kept_vectors[side].insert(kept_vectors[side].end(), vector, vector + dim_);
+        }
+
+        for (int side : {1, 0}) {
+            bucket_->RewriteBucket(pair[side],
+                                   kept_vectors[side].data(),
+                                   kept_ids[side].data(),
+                                   static_cast<InnerIdType>(kept_ids[side].size()));
+            if (side == 1 and not moved_ids.empty()) {
+                Vector<InnerIdType> offsets(moved_ids.size(), allocator_);
+                bucket_->BatchInsertVector(moved_vectors.data(),
+                                           moved_targets.data(),
+                                           moved_ids.data(),
+                                           static_cast<InnerIdType>(moved_ids.size()),
+                                           offsets.data());
+                for (uint64_t i = 0; i < moved_ids.size(); ++i) {
+                    this->set_location(moved_ids[i], moved_targets[i], offsets[i]);
+                }
+            }
+        }
+        for (int side : {0, 1}) {
+            for (uint64_t i = 0; i < kept_ids[side].size(); ++i) {
+                this->set_location(kept_ids[side][i], pair[side], static_cast<InnerIdType>(i));
+            }
+        }
+        reassign_count.fetch_add(moved_ids.size(), std::memory_order_relaxed);
+    };
+    run_tasks(rewrite_pair);
+
+    this->rebalance_split_count_.fetch_add(moved_buckets.size() / 2, std::memory_order_relaxed);
+    this->rebalance_reassign_count_.fetch_add(reassign_count.load(), std::memory_order_relaxed);
+    logger::debug("ivf rebalance: {} buckets split, {} dissolved, {} boundary vectors moved",
+                  moved_buckets.size() / 2,
+                  donors.size(),
+                  reassign_count.load());
+}
 DatasetPtr
 IVF::KnnSearch(const DatasetPtr& query,
                int64_t k,
@@ -989,6 +1319,8 @@ IVF::UpdateAttribute(int64_t id, const AttributeSet& new_attrs, const AttributeS
 
 void
 IVF::Serialize(StreamWriter& writer) const {
+    // a rebalance flush rewrites buckets and centroids, the written cells must come from one state
+    auto rebalance_lock = this->acquire_rebalance_read_lock();
     JsonType datacell_offsets;
     JsonType datacell_sizes;
     uint64_t offset = 0;
@@ -1119,6 +1451,7 @@ IVF::collect_streaming_header() const {
 
 void
 IVF::serialize_streaming_body(StreamWriter& writer) const {
+    auto rebalance_lock = this->acquire_rebalance_read_lock();
     auto bucket_tag = static_cast<uint32_t>(StreamSerializationTag::IVF_BUCKET);
     auto partition_tag = static_cast<uint32_t>(StreamSerializationTag::IVF_PARTITION_STRATEGY);
     auto label_tag = static_cast<uint32_t>(StreamSerializationTag::LABEL_TABLE);
@@ -1579,10 +1912,7 @@ IVF::create_search_param(const std::string& parameters, const FilterPtr& filter)
     param.first_order_scan_ratio = search_param.first_order_scan_ratio;
     param.parallel_search_thread_count = search_param.parallel_search_thread_count;
     param.ef = static_cast<uint64_t>(search_param.ef_search);
-    if (search_param.enable_time_record) {
-        param.time_cost = std::make_shared<Timer>();
-        param.time_cost->SetThreshold(search_param.timeout_ms);
-    }
+    param.timeout_ms = search_param.timeout_ms;
     return param;
 }
 
@@ -1744,9 +2074,7 @@ IVF::search(const DatasetPtr& query,
         Vector<float> dist(allocator_);
         uint64_t i = cur_bucket_num.fetch_add(1);
         for (; i < bucket_count; i = cur_bucket_num.fetch_add(1)) {
-            if (param.time_cost != nullptr and param.time_cost->CheckOvertime() and
-                ctx.stats != nullptr) {
-                ctx.stats->is_timeout.store(true, std::memory_order_relaxed);
+            if (ctx.ShouldStop()) {
                 break;
             }
             auto bucket_id = candidate_buckets[i];
@@ -1868,21 +2196,11 @@ IVF::search_with_custom_distance(const DatasetPtr& query,
     candidate_labels.reserve(batch_capacity);
     scores.resize(batch_capacity);
 
-    auto is_timed_out = [&]() {
-        if (param.time_cost == nullptr or not param.time_cost->CheckOvertime()) {
-            return false;
-        }
-        if (ctx.stats != nullptr) {
-            ctx.stats->is_timeout.store(true, std::memory_order_relaxed);
-        }
-        return true;
-    };
-
     auto submit_batch = [&]() {
         if (candidate_ids.empty()) {
             return true;
         }
-        if (is_timed_out()) {
+        if (ctx.ShouldStop()) {
             return false;
         }
         request.distance_batch_func_(
@@ -1921,7 +2239,7 @@ IVF::search_with_custom_distance(const DatasetPtr& query,
 
     bool timed_out = false;
     for (const auto bucket_id : candidate_buckets) {
-        if (is_timed_out()) {
+        if (ctx.ShouldStop()) {
             timed_out = true;
             break;
         }
@@ -2051,6 +2369,20 @@ IVF::check_merge_illegal(const vsag::MergeUnit& unit) const {
 
 DatasetPtr
 IVF::SearchWithRequest(const SearchRequest& request) const {
+    auto rebalance_lock = this->acquire_rebalance_read_lock();
+    return this->search_with_request(request);
+}
+
+std::shared_lock<std::shared_mutex>
+IVF::acquire_rebalance_read_lock() const {
+    if (this->rebalance_split_ratio_ > 0.0F) {
+        return std::shared_lock<std::shared_mutex>(this->rebalance_mutex_);
+    }
+    return {};
+}
+
+DatasetPtr
+IVF::search_with_request(const SearchRequest& request) const {
     ValidateSearchThreshold(request.threshold_);
     SearchStatistics stats;
     QueryContext ctx{.alloc = request.search_allocator_, .stats = &stats};
@@ -2070,6 +2402,8 @@ IVF::SearchWithRequest(const SearchRequest& request) const {
                        "IVF custom query distance does not support parallel search");
         param.enable_reorder = false;
     }
+    const auto deadline = SearchDeadline::Make(param.timeout_ms, &request);
+    ctx.deadline = deadline.get();
     param.query_context = &ctx;
 
     if (not request.bucket_ids_.empty()) {
@@ -2176,7 +2510,7 @@ IVF::SearchWithRequest(const SearchRequest& request) const {
                 json["ivf"]["parallelism"].SetInt64(1);
             }
             one_request.params_str_ = json.Dump();
-            auto one_result = this->SearchWithRequest(one_request);
+            auto one_result = this->search_with_request(one_request);
             const auto count = std::min(request.topk_, one_result->GetDim());
             if (count > 0) {
                 std::copy_n(one_result->GetIds(), count, ids + query_idx * request.topk_);
@@ -2439,6 +2773,7 @@ IVF::CalDistanceById(const float* query,
         CHECK_ARGUMENT(query != nullptr, "CalDistanceById query must not be null");
         CHECK_ARGUMENT(ids != nullptr, "CalDistanceById ids must not be null");
     }
+    auto rebalance_lock = this->acquire_rebalance_read_lock();
     const int64_t result_count = (topk == -1) ? count : std::min(topk, count);
     auto result = Dataset::Make();
     result->NumElements(1)->Dim(result_count)->Owner(true, allocator_);
@@ -2509,6 +2844,7 @@ IVF::CalDistanceById(const float* query,
 
 float
 IVF::CalcDistanceById(const float* query, int64_t id, bool calculate_precise_distance) const {
+    auto rebalance_lock = this->acquire_rebalance_read_lock();
     std::shared_lock<std::shared_mutex> lock(this->label_lookup_mutex_);
     auto [success, inner_id] = this->label_table_->TryGetIdByLabel(id);
     if (not success) {
@@ -2594,8 +2930,18 @@ IVF::GetStats() const {
     Vector<float> centroids(this->dim_, allocator_);
     Vector<float> bucket_counts(allocator_);
     Vector<float> bucket_radius(allocator_);
+    // entry 0 counts the empty buckets, entry i the buckets holding [2^(i-1), 2^i) vectors
+    std::vector<uint32_t> bucket_size_histogram;
     for (int i = 0; i < this->bucket_->bucket_count_; ++i) {
         auto size = bucket_->GetBucketSize(i);
+        uint64_t bin = 0;
+        while ((static_cast<uint64_t>(size) >> bin) > 0) {
+            ++bin;
+        }
+        if (bucket_size_histogram.size() <= bin) {
+            bucket_size_histogram.resize(bin + 1, 0);
+        }
+        ++bucket_size_histogram[bin];
         if (size == 0) {
             bucket_counts.push_back(0);
             continue;
@@ -2610,8 +2956,22 @@ IVF::GetStats() const {
     }
     // bucket_count_std
     stats["bucket_num"].SetJson(get_data_stats(bucket_counts));
+    stats["bucket_size_histogram"].SetVector<uint32_t>(bucket_size_histogram);
     // bucket_radius
     stats["bucket_radius"].SetJson(get_data_stats(bucket_radius));
+    if (this->rebalance_split_ratio_ > 0.0F) {
+        stats["rebalance_split_count"].SetUint64(this->rebalance_split_count_.load());
+        stats["rebalance_merge_count"].SetUint64(this->rebalance_merge_count_.load());
+        stats["rebalance_reassign_count"].SetUint64(this->rebalance_reassign_count_.load());
+    }
+    if (this->tiered_precise_codes_ != nullptr) {
+        const auto& tier = this->tiered_precise_codes_;
+        stats["precise_hot_codes_count"].SetUint64(tier->GetHotCount());
+        stats["precise_hot_codes_capacity"].SetUint64(tier->GetCapacity());
+        stats["precise_hot_codes_memory_usage"].SetUint64(tier->GetMemoryUsage());
+        stats["reorder_memory_fetch_count"].SetUint64(tier->GetMemoryFetchCount());
+        stats["reorder_disk_fetch_count"].SetUint64(tier->GetDiskFetchCount());
+    }
     return stats.Dump(4);
 }
 
@@ -2635,6 +2995,9 @@ IVF::cal_memory_usage() {
         memory += precise_bucket_ != nullptr ? precise_bucket_->GetMemoryUsage()
                                              : reorder_codes_->GetMemoryUsage();
     }
+    if (this->tiered_precise_codes_ != nullptr) {
+        memory += this->tiered_precise_codes_->GetMemoryUsage();
+    }
     if (this->extra_info_size_ > 0 and this->extra_infos_ != nullptr) {
         memory += this->extra_infos_->GetMemoryUsage();
     }
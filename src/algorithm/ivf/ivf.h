@@ -23,6 +23,7 @@
 #include "datacell/graph_interface_parameter.h"
 #include "impl/heap/distance_heap.h"
 #include "impl/reorder/reorder.h"
+#include "impl/reorder/tiered_precise_codes.h"
 #include "impl/searcher/basic_searcher.h"
 #include "index_common_param.h"
 #include "ivf_bucket_searcher.h"
@@ -55,6 +56,8 @@ namespace vsag {
  *   - Attribute-based filtering (via AttributeBucketInvertedDataCell).
  *   - Merge of pre-built shards (Merge()).
  *   - Reordering with a separate quantizer for better precision.
+ *   - Online bucket rebalancing: with rebalance_split_ratio set, Add() splits
+ *     oversized buckets into slots freed by dissolving undersized ones.
  *
  * @since v0.14
  */
@@ -192,6 +195,15 @@ private:
     InnerSearchParam
     create_search_param(const std::string& parameters, const FilterPtr& filter) const;
 
+    /// SearchWithRequest() without the rebalance lock, batch queries recurse into it.
+    DatasetPtr
+    search_with_request(const SearchRequest& request) const;
+
+    /// Shared rebalance lock for readers of bucket contents, only taken when online
+    /// rebalancing is enabled.
+    std::shared_lock<std::shared_mutex>
+    acquire_rebalance_read_lock() const;
+
     DatasetPtr
     route_buckets_only(const DatasetPtr& query,
                        const InnerSearchParam& param,
@@ -247,6 +259,31 @@ private:
     void
     build_bucket_graphs();
 
+    /**
+     * @brief Split every bucket above rebalance_split_ratio * mean size.
+     *
+     * The bucket count is fixed, so each split takes the slot of a donor bucket
+     * (empty or below rebalance_merge_ratio * mean size) whose vectors first move
+     * to their nearest remaining bucket. A local 2-means replaces the centroids of
+     * the split pair, and vectors whose nearest centroid is now a third bucket move
+     * there. Runs after Add() under an exclusive rebalance lock.
+     */
+    void
+    flush_pending_splits();
+
+    /// Move the vectors of @p donors to their nearest non-donor bucket and empty them.
+    bool
+    dissolve_buckets(const Vector<BucketIdType>& donors);
+
+    /// Collect the inner ids and full-precision vectors stored in a bucket.
+    void
+    read_bucket_vectors(BucketIdType bucket_id,
+                        Vector<InnerIdType>& inner_ids,
+                        Vector<float>& vectors) const;
+
+    void
+    set_location(InnerIdType inner_id, BucketIdType bucket_id, InnerIdType offset_id);
+
     /**
      * @brief Decode the packed (bucket_id, local_inner_id) pair from
      *        location_map_[inner_id].
@@ -294,6 +331,7 @@ private:
     FlattenInterfacePtr reorder_codes_{nullptr};  // legacy high-precision flat codes
     BucketInterfacePtr precise_bucket_{nullptr};  // high-precision codes mirroring basic buckets
     ReorderInterfacePtr reorder_{nullptr};        // high-precision reordering engine
+    TieredPreciseCodesPtr tiered_precise_codes_{nullptr};  // hot in-memory reorder codes
 
     std::shared_ptr<SafeThreadPool> thread_pool_{nullptr};  // for parallel bucket scans
 
@@ -307,6 +345,15 @@ private:
 
     std::atomic<int64_t> delete_count_{0};
 
+    float rebalance_split_ratio_{0.0F};
+    float rebalance_merge_ratio_{0.0F};
+    // Add() and readers hold it shared, flush_pending_splits() exclusive, so a search never
+    // sees centroids and bucket contents from different sides of a split
+    mutable std::shared_mutex rebalance_mutex_;
+    std::atomic<uint64_t> rebalance_split_count_{0};
+    std::atomic<uint64_t> rebalance_merge_count_{0};
+    std::atomic<uint64_t> rebalance_reassign_count_{0};
+
     // Throttle cal_memory_usage(): skip if element delta < interval
     int64_t last_cal_memory_element_{0};
     int64_t cal_memory_element_interval_{1024L};
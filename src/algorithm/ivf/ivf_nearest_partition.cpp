@@ -43,8 +43,9 @@ IVFNearestPartition::IVFNearestPartition(BucketIdType bucket_count,
                                          const IndexCommonParam& common_param,
                                          IVFPartitionStrategyParametersPtr param)
     : IVFPartitionStrategy(common_param, bucket_count),
-      ivf_partition_strategy_param_(std::move(param)) {
-    this->factory_router_index(common_param);
+      ivf_partition_strategy_param_(std::move(param)),
+      common_param_(common_param) {
+    this->route_index_ptr_ = this->factory_router_index(common_param);
 }
 
 void
@@ -64,10 +65,18 @@ IVFNearestPartition::Train(const DatasetPtr dataset) {
         IVFNearestPartitionTrainerType::KMeansTrainer) {
         constexpr int32_t kmeans_iter_count = 25;
         KMeansCluster cls(static_cast<int32_t>(dim), this->allocator_, this->thread_pool_);
+        cls.SetAlgorithm(ivf_partition_strategy_param_->kmeans_algorithm,
+                         ivf_partition_strategy_param_->kmeans_mini_batch_size);
         cls.Run(this->bucket_count_,
                 dataset->GetFloat32Vectors(),
                 dataset->GetNumElements(),
                 kmeans_iter_count);
+        const auto& stats = cls.GetStats();
+        logger::info("ivf {} kmeans train: {} iterations, inertia {}, cost {}ms",
+                     kmeans_algorithm_to_string(ivf_partition_strategy_param_->kmeans_algorithm),
+                     stats.iterations,
+                     stats.inertia,
+                     stats.train_time_ms);
         memcpy(data.data(), cls.k_centroids_, dim * this->bucket_count_ * sizeof(float));
     } else if (ivf_partition_strategy_param_->partition_train_type ==
                IVFNearestPartitionTrainerType::RandomTrainer) {
@@ -96,6 +105,7 @@ IVFNearestPartition::ClassifyDatas(const void* datas,
     std::mutex dist_cmp_reduce_mutex;
     uint32_t dist_cmp = 0;
     Vector<BucketIdType> result(buckets_per_data * count, -1, this->allocator_);
+    auto route_index = this->get_route_index();
     auto task = [&](int64_t i) {
         auto query = Dataset::Make();
         query->Dim(this->dim_)
@@ -107,7 +117,7 @@ IVFNearestPartition::ClassifyDatas(const void* datas,
                         std::max<int64_t>(10, static_cast<int64_t>(buckets_per_data * 1.2)));
         FilterPtr filter = nullptr;
         auto search_result =
-            this->route_index_ptr_->KnnSearch(query, buckets_per_data, search_param, filter);
+            route_index->KnnSearch(query, buckets_per_data, search_param, filter);
         const auto* result_ids = search_result->GetIds();
 
         for (int64_t j = 0; j < search_result->GetDim(); ++j) {
@@ -149,15 +159,15 @@ IVFNearestPartition::ClassifyDatas(const void* datas,
 void
 IVFNearestPartition::Serialize(StreamWriter& writer) {
     IVFPartitionStrategy::Serialize(writer);
-    this->route_index_ptr_->Serialize(writer);
+    this->get_route_index()->Serialize(writer);
 }
 void
 IVFNearestPartition::Deserialize(lvalue_or_rvalue<StreamReader> reader) {
     IVFPartitionStrategy::Deserialize(reader);
     this->route_index_ptr_->Deserialize(reader);
 }
-void
-IVFNearestPartition::factory_router_index(const IndexCommonParam& common_param) {
+InnerIndexPtr
+IVFNearestPartition::factory_router_index(const IndexCommonParam& common_param) const {
     ParamPtr param_ptr;
     JsonType hgraph_json;
     hgraph_json["base_quantization_type"].SetString("fp32");
@@ -165,8 +175,15 @@ IVFNearestPartition::factory_router_index(const IndexCommonParam& common_param)
     hgraph_json["ef_construction"].SetInt(ivf_partition_strategy_param_->route_ef_construction);
 
     param_ptr = HGraph::CheckAndMappingExternalParam(hgraph_json, common_param);
-    this->route_index_ptr_ = std::make_shared<HGraph>(param_ptr, common_param);
+    return std::make_shared<HGraph>(param_ptr, common_param);
+}
+
+InnerIndexPtr
+IVFNearestPartition::get_route_index() const {
+    std::shared_lock lock(this->route_mutex_);
+    return this->route_index_ptr_;
 }
+
 void
 IVFNearestPartition::GetCentroid(BucketIdType bucket_id, Vector<float>& centroid) {
     if (!is_trained_) {
@@ -175,12 +192,54 @@ IVFNearestPartition::GetCentroid(BucketIdType bucket_id, Vector<float>& centroid
     if (bucket_id >= bucket_count_) {
         throw VsagException(ErrorType::INVALID_ARGUMENT, "Invalid bucket_id");
     }
-    this->route_index_ptr_->GetCodeByInnerId(bucket_id, (uint8_t*)centroid.data());
+    this->get_route_index()->GetCodeByInnerId(bucket_id, (uint8_t*)centroid.data());
+}
+
+void
+IVFNearestPartition::UpdateCentroids(const BucketIdType* bucket_ids,
+                                     const float* centroids,
+                                     uint64_t count) {
+    if (!is_trained_) {
+        throw VsagException(ErrorType::WRONG_STATUS, "Partition not trained");
+    }
+    auto dim = this->dim_;
+    Vector<float> data(bucket_count_ * dim, allocator_);
+    Vector<float> centroid(dim, allocator_);
+    for (BucketIdType i = 0; i < bucket_count_; ++i) {
+        this->GetCentroid(i, centroid);
+        memcpy(data.data() + i * dim, centroid.data(), dim * sizeof(float));
+    }
+    for (uint64_t i = 0; i < count; ++i) {
+        if (bucket_ids[i] < 0 or bucket_ids[i] >= bucket_count_) {
+            throw VsagException(ErrorType::INVALID_ARGUMENT, "Invalid bucket_id");
+        }
+        auto* dest = data.data() + bucket_ids[i] * dim;
+        if (metric_type_ == MetricType::METRIC_TYPE_COSINE) {
+            Normalize(centroids + i * dim, dest, dim);
+        } else {
+            memcpy(dest, centroids + i * dim, dim * sizeof(float));
+        }
+    }
+
+    // the router is small, a fresh one keeps its graph valid for centroids that moved far
+    Vector<LabelType> ids(this->bucket_count_, allocator_);
+    std::iota(ids.begin(), ids.end(), 0);
+    auto dataset = Dataset::Make();
+    dataset->Ids(ids.data())
+        ->Dim(dim)
+        ->Float32Vectors(data.data())
+        ->NumElements(this->bucket_count_)
+        ->Owner(false);
+    auto route_index = this->factory_router_index(this->common_param_);
+    route_index->Build(dataset);
+
+    std::unique_lock lock(this->route_mutex_);
+    this->route_index_ptr_ = std::move(route_index);
 }
 
 [[nodiscard]] uint64_t
 IVFNearestPartition::GetMemoryUsage() const {
     return static_cast<uint64_t>(sizeof(IVFNearestPartition) +
-                                 this->route_index_ptr_->GetMemoryUsage());
+                                 this->get_route_index()->GetMemoryUsage());
 }
 }  // namespace vsag
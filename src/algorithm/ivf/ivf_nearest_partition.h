@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <shared_mutex>
+
 #include "algorithm/inner_index_interface.h"
 #include "index_common_param.h"
 #include "ivf_partition_strategy.h"
@@ -41,6 +43,11 @@ public:
     void
     GetCentroid(BucketIdType bucket_id, Vector<float>& centroid) override;
 
+    void
+    UpdateCentroids(const BucketIdType* bucket_ids,
+                    const float* centroids,
+                    uint64_t count) override;
+
     void
     Serialize(StreamWriter& writer) override;
 
@@ -56,8 +63,17 @@ public:
     InnerIndexPtr route_index_ptr_{nullptr};
 
 private:
-    void
-    factory_router_index(const IndexCommonParam& common_param);
+    InnerIndexPtr
+    factory_router_index(const IndexCommonParam& common_param) const;
+
+    InnerIndexPtr
+    get_route_index() const;
+
+private:
+    IndexCommonParam common_param_;
+
+    // route_index_ptr_ is replaced as a whole when centroids move
+    mutable std::shared_mutex route_mutex_;
 };
 
 }  // namespace vsag
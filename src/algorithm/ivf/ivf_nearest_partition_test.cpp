@@ -96,3 +96,46 @@ TEST_CASE("IVF Nearest Partition Serialize Test", "[ut][IVFNearestPartition]") {
     auto restored_class_result = partition2->ClassifyDatas(vec.data(), data_count, 1, nullptr);
     REQUIRE(restored_class_result == class_result);
 }
+
+TEST_CASE("IVF Nearest Partition updates centroids", "[ut][IVFNearestPartition]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    int64_t dim = 32;
+    int64_t bucket_count = 20;
+    IndexCommonParam param;
+    param.dim_ = dim;
+    param.metric_ = MetricType::METRIC_TYPE_L2SQR;
+    param.allocator_ = allocator;
+    IVFPartitionStrategyParametersPtr strategy_param =
+        std::make_shared<IVFPartitionStrategyParameters>();
+    auto partition = std::make_unique<IVFNearestPartition>(bucket_count, param, strategy_param);
+    BucketIdType moved[] = {3, 7};
+    std::vector<float> new_centroids(2 * dim, 0.0F);
+    REQUIRE_THROWS(partition->UpdateCentroids(moved, new_centroids.data(), 2));
+
+    int64_t data_count = 1000L;
+    auto vec = fixtures::generate_vectors(data_count, dim, true, 95);
+    auto dataset = Dataset::Make();
+    dataset->Float32Vectors(vec.data())->Dim(dim)->NumElements(data_count)->Owner(false);
+    partition->Train(dataset);
+
+    Vector<float> untouched(dim, allocator.get());
+    partition->GetCentroid(0, untouched);
+    // far outside the unit-norm data, so no other centroid can be nearer
+    for (int64_t d = 0; d < dim; ++d) {
+        new_centroids[d] = 10.0F;
+        new_centroids[dim + d] = -10.0F;
+    }
+    partition->UpdateCentroids(moved, new_centroids.data(), 2);
+
+    Vector<float> centroid(dim, allocator.get());
+    partition->GetCentroid(3, centroid);
+    REQUIRE(std::equal(centroid.begin(), centroid.end(), new_centroids.begin()));
+    partition->GetCentroid(0, centroid);
+    REQUIRE(centroid == untouched);
+    auto buckets = partition->ClassifyDatas(new_centroids.data(), 2, 1, nullptr);
+    REQUIRE(buckets[0] == 3);
+    REQUIRE(buckets[1] == 7);
+
+    BucketIdType invalid[] = {static_cast<BucketIdType>(bucket_count)};
+    REQUIRE_THROWS(partition->UpdateCentroids(invalid, new_centroids.data(), 1));
+}
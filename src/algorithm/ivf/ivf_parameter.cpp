@@ -116,6 +116,35 @@ IVFParameter::FromJson(const JsonType& json) {
                 GraphStorageTypes::GRAPH_STORAGE_TYPE_VALUE_FLAT, graph_json);
         }
     }
+
+    if (json.Contains(REBALANCE_SPLIT_RATIO_KEY)) {
+        this->rebalance_split_ratio = json[REBALANCE_SPLIT_RATIO_KEY].GetFloat();
+    }
+    if (json.Contains(REBALANCE_MERGE_RATIO_KEY)) {
+        this->rebalance_merge_ratio = json[REBALANCE_MERGE_RATIO_KEY].GetFloat();
+    }
+    CHECK_ARGUMENT(this->rebalance_split_ratio == 0.0F or this->rebalance_split_ratio > 1.0F,
+                   fmt::format("rebalance_split_ratio must be 0 or greater than 1, got {}",
+                               this->rebalance_split_ratio));
+    CHECK_ARGUMENT(this->rebalance_merge_ratio >= 0.0F and this->rebalance_merge_ratio < 1.0F,
+                   fmt::format("rebalance_merge_ratio must be in [0, 1), got {}",
+                               this->rebalance_merge_ratio));
+    if (this->rebalance_split_ratio > 0.0F) {
+        CHECK_ARGUMENT(this->ivf_partition_strategy_parameter->partition_strategy_type ==
+                           IVFPartitionStrategyType::IVF,
+                       "bucket rebalancing requires the ivf partition strategy");
+        CHECK_ARGUMENT(this->buckets_per_data == 1,
+                       "bucket rebalancing requires buckets_per_data=1");
+        CHECK_ARGUMENT(this->precise_codes_layout == PRECISE_CODES_LAYOUT_VALUE_FLAT,
+                       "bucket rebalancing requires precise_codes_layout=flat");
+        CHECK_ARGUMENT(this->graph_build_threshold == 0,
+                       "bucket rebalancing does not support bucket graphs");
+        CHECK_ARGUMENT(not this->use_attribute_filter,
+                       "bucket rebalancing does not support attribute filter");
+        CHECK_ARGUMENT(this->bucket_param->quantizer_parameter->GetTypeName() !=
+                           QUANTIZATION_TYPE_VALUE_PQFS,
+                       "bucket rebalancing does not support pqfs base quantization");
+    }
 }
 
 JsonType
@@ -128,6 +157,8 @@ IVFParameter::ToJson() const {
     json[PRECISE_CODES_LAYOUT_KEY].SetString(this->precise_codes_layout);
     json[BUCKET_PER_DATA_KEY].SetInt(this->buckets_per_data);
     json[GRAPH_BUILD_THRESHOLD_KEY].SetInt(this->graph_build_threshold);
+    json[REBALANCE_SPLIT_RATIO_KEY].SetFloat(this->rebalance_split_ratio);
+    json[REBALANCE_MERGE_RATIO_KEY].SetFloat(this->rebalance_merge_ratio);
     return json;
 }
 bool
@@ -50,6 +50,10 @@ public:
     BucketIdType buckets_per_data{1};
     GraphInterfaceParamPtr graph_param{nullptr};
     int64_t graph_build_threshold{0};
+    // a bucket above split_ratio * mean size is split during Add, 0 disables rebalancing
+    float rebalance_split_ratio{0.0F};
+    // buckets below merge_ratio * mean size are dissolved to free slots for the splits
+    float rebalance_merge_ratio{0.25F};
 };
 
 class IVFSearchParameters : public IndexSearchParameter {
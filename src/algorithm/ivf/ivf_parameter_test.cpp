@@ -20,6 +20,7 @@
 
 #include "ivf.h"
 #include "parameter_test.h"
+#include "quantization/product_quantization/product_quantizer_parameter.h"
 #include "quantization/rabitq_quantization/rabitq_quantizer_parameter.h"
 #include "unittest.h"
 #include "utils/util_functions.h"
@@ -316,6 +317,33 @@ TEST_CASE("IVF maps RabitQ external parameters", "[ut][IVFParameter]") {
     REQUIRE(rabitq_param->use_fht_);
 }
 
+TEST_CASE("IVF maps kmeans algorithm to partition and PQ training", "[ut][IVFParameter]") {
+    auto external_param = vsag::JsonType::Parse(R"({
+        "base_quantization_type": "pq",
+        "base_pq_dim": 16,
+        "kmeans_algorithm": "hamerly",
+        "kmeans_mini_batch_size": 8192
+    })");
+
+    vsag::IndexCommonParam common_param;
+    common_param.dim_ = 64;
+    common_param.data_type_ = vsag::DataTypes::DATA_TYPE_FLOAT;
+
+    auto param = vsag::IVF::CheckAndMappingExternalParam(external_param, common_param);
+    auto ivf_param = std::dynamic_pointer_cast<vsag::IVFParameter>(param);
+    REQUIRE(ivf_param != nullptr);
+    REQUIRE(ivf_param->ivf_partition_strategy_parameter->kmeans_algorithm ==
+            vsag::KMeansAlgorithm::HAMERLY);
+    REQUIRE(ivf_param->ivf_partition_strategy_parameter->kmeans_mini_batch_size == 8192);
+    auto pq_param = std::dynamic_pointer_cast<vsag::ProductQuantizerParameter>(
+        ivf_param->bucket_param->quantizer_parameter);
+    REQUIRE(pq_param != nullptr);
+    REQUIRE(pq_param->kmeans_algorithm_ == vsag::KMeansAlgorithm::HAMERLY);
+
+    external_param["kmeans_algorithm"].SetString("unknown");
+    REQUIRE_THROWS(vsag::IVF::CheckAndMappingExternalParam(external_param, common_param));
+}
+
 #define TEST_COMPATIBILITY_CASE(section_name, param_member, val1, val2, expect_compatible) \
     SECTION(section_name) {                                                                \
         IVFDefaultParam param1;                                                            \
@@ -511,3 +539,35 @@ TEST_CASE("IVF maps fast RaBitQ to base and precise quantizers", "[ut][IVFParame
     REQUIRE_FALSE(precise_json["quantization_params"]["fast_encode_rabitq"].GetBool());
     REQUIRE(precise_json["quantization_params"]["fast_encode_rabitq_rounds"].GetInt() == 10);
 }
+
+TEST_CASE("IVF maps bucket rebalancing options", "[ut][IVFParameter]") {
+    vsag::IndexCommonParam common_param;
+    common_param.dim_ = 128;
+    common_param.data_type_ = vsag::DataTypes::DATA_TYPE_FLOAT;
+    auto map_param = [&](const std::string& json) {
+        auto mapped = vsag::IVF::CheckAndMappingExternalParam(vsag::JsonType::Parse(json),
+                                                              common_param);
+        return std::dynamic_pointer_cast<vsag::IVFParameter>(mapped);
+    };
+
+    auto default_param = map_param("{}");
+    REQUIRE(default_param->rebalance_split_ratio == 0.0F);
+    REQUIRE(std::abs(default_param->rebalance_merge_ratio - 0.25F) < 1e-6F);
+
+    auto param = map_param(R"({"rebalance_split_ratio": 2.5, "rebalance_merge_ratio": 0.1})");
+    REQUIRE(std::abs(param->rebalance_split_ratio - 2.5F) < 1e-6F);
+    REQUIRE(std::abs(param->rebalance_merge_ratio - 0.1F) < 1e-6F);
+    auto json = param->ToJson();
+    auto restored = std::make_shared<vsag::IVFParameter>();
+    restored->FromJson(json);
+    REQUIRE(std::abs(restored->rebalance_split_ratio - 2.5F) < 1e-6F);
+    REQUIRE(std::abs(restored->rebalance_merge_ratio - 0.1F) < 1e-6F);
+
+    REQUIRE_THROWS(map_param(R"({"rebalance_split_ratio": 0.5})"));
+    REQUIRE_THROWS(map_param(R"({"rebalance_split_ratio": 2, "rebalance_merge_ratio": 1.0})"));
+    REQUIRE_THROWS(map_param(R"({"rebalance_split_ratio": 2, "buckets_per_data": 2})"));
+    REQUIRE_THROWS(map_param(R"({"rebalance_split_ratio": 2, "graph_build_threshold": 10})"));
+    REQUIRE_THROWS(map_param(R"({"rebalance_split_ratio": 2, "use_attribute_filter": true})"));
+    REQUIRE_THROWS(
+        map_param(R"({"rebalance_split_ratio": 2, "partition_strategy_type": "gno_imi"})"));
+}
@@ -72,6 +72,13 @@ public:
     virtual void
     GetCentroid(BucketIdType bucket_id, Vector<float>& centroid) = 0;
 
+    /// Moves the centroids of bucket_ids[i] to centroids + i * dim, other buckets keep theirs.
+    virtual void
+    UpdateCentroids(const BucketIdType* bucket_ids, const float* centroids, uint64_t count) {
+        throw VsagException(ErrorType::UNSUPPORTED_INDEX_OPERATION,
+                            "partition strategy does not support UpdateCentroids");
+    }
+
     virtual void
     Serialize(StreamWriter& writer) {
         StreamWriter::WriteObj(writer, this->is_trained_);
@@ -50,6 +50,15 @@ IVFPartitionStrategyParameters::FromJson(const JsonType& json) {
             static_cast<int32_t>(json[IVF_ROUTE_EF_CONSTRUCTION_KEY].GetInt());
         CHECK_ARGUMENT(this->route_ef_construction > 0, "route_ef_construction must be positive");
     }
+    if (json.Contains(KMEANS_ALGORITHM_KEY)) {
+        this->kmeans_algorithm =
+            kmeans_algorithm_from_string(json[KMEANS_ALGORITHM_KEY].GetString());
+    }
+    if (json.Contains(KMEANS_MINI_BATCH_SIZE_KEY)) {
+        CHECK_ARGUMENT(json[KMEANS_MINI_BATCH_SIZE_KEY].IsNumberUnsigned(),
+                       "kmeans_mini_batch_size must be a non-negative integer");
+        this->kmeans_mini_batch_size = json[KMEANS_MINI_BATCH_SIZE_KEY].GetUint64();
+    }
     CHECK_ARGUMENT(this->route_max_degree >= 4, "route_max_degree must be at least 4");
     CHECK_ARGUMENT(this->route_ef_construction >= this->route_max_degree,
                    "route_ef_construction must be no less than route_max_degree");
@@ -81,6 +90,8 @@ IVFPartitionStrategyParameters::ToJson() const {
     }
     json[IVF_ROUTE_MAX_DEGREE_KEY].SetInt(this->route_max_degree);
     json[IVF_ROUTE_EF_CONSTRUCTION_KEY].SetInt(this->route_ef_construction);
+    json[KMEANS_ALGORITHM_KEY].SetString(kmeans_algorithm_to_string(this->kmeans_algorithm));
+    json[KMEANS_MINI_BATCH_SIZE_KEY].SetUint64(this->kmeans_mini_batch_size);
     if (this->partition_strategy_type == IVFPartitionStrategyType::GNO_IMI) {
         json[IVF_PARTITION_STRATEGY_TYPE_GNO_IMI].SetJson(this->gnoimi_param->ToJson());
     }
@@ -18,6 +18,7 @@
 
 #include "datacell/bucket_datacell_parameter.h"
 #include "gno_imi_parameter.h"
+#include "impl/cluster/kmeans_cluster.h"
 #include "inner_string_params.h"
 #include "parameter.h"
 #include "typing.h"
@@ -53,6 +54,9 @@ public:
     IVFPartitionStrategyType partition_strategy_type{IVFPartitionStrategyType::IVF};
     int32_t route_max_degree{64};
     int32_t route_ef_construction{300};
+    // training only, so neither takes part in CheckCompatibility
+    KMeansAlgorithm kmeans_algorithm{KMeansAlgorithm::LLOYD};
+    uint64_t kmeans_mini_batch_size{0};
     GNOIMIParameterPtr gnoimi_param{nullptr};
 };
 
@@ -24,6 +24,7 @@
 #include "algorithm/inner_index_interface.h"
 #include "analyzer/analyzer.h"
 #include "datacell/flatten_interface.h"
+#include "impl/bitset/computable_bitset.h"
 #include "impl/distance_provider_for_graph.h"
 #include "impl/heap/standard_heap.h"
 #include "impl/odescent/odescent_graph_builder.h"
@@ -126,6 +127,24 @@ IndexNode::GetChild(const std::string& key, bool need_init) {
     return children_[key].get();
 }
 
+uint64_t
+IndexNode::GetIdCount() const {
+    std::shared_lock lock(mutex_);
+    if (status_ == Status::GRAPH) {
+        return graph_->TotalCount();
+    }
+    return ids_.size();
+}
+
+Vector<InnerIdType>
+IndexNode::GetIds() const {
+    std::shared_lock lock(mutex_);
+    if (status_ == Status::GRAPH) {
+        return graph_->GetIds();
+    }
+    return ids_;
+}
+
 void
 IndexNode::Deserialize(StreamReader& reader) {
     // deserialize `entry_point_`
@@ -293,8 +312,6 @@ Pyramid::KnnSearch(const DatasetPtr& query,
     auto parsed_param = PyramidSearchParameters::FromJson(parameters);
     ctx.rabitq_error_rate = parsed_param.rabitq_error_rate;
     CHECK_ARGUMENT(k > 0, fmt::format("k({}) must be greater than 0", k));
-    CHECK_ARGUMENT(parsed_param.hierarchy_op == PyramidSearchParameters::HierarchyOp::SINGLE,
-                   "multi-hierarchy search (union/intersection) is not yet implemented");
     auto ef_search_threshold = std::max<uint64_t>(AMPLIFICATION_FACTOR * k, 1000L);
     CHECK_ARGUMENT(  // NOLINT
         (1 <= parsed_param.ef_search) and (parsed_param.ef_search <= ef_search_threshold),
@@ -329,10 +346,8 @@ Pyramid::KnnSearch(const DatasetPtr& query,
         search_param.consider_duplicate = true;
     }
 
-    if (parsed_param.enable_time_record) {
-        search_param.time_cost = std::make_shared<Timer>();
-        search_param.time_cost->SetThreshold(parsed_param.timeout_ms);
-    }
+    const auto deadline = SearchDeadline::Make(parsed_param.timeout_ms);
+    ctx.deadline = deadline.get();
 
     search_param.is_inner_id_allowed = this->create_search_filter(filter);
     const bool collect_rabitq_lower_bounds = search_param.enable_rabitq_one_bit_search and
@@ -359,14 +374,17 @@ Pyramid::KnnSearch(const DatasetPtr& query,
         return result;
     };
 
-    std::string hierarchy_name =
-        parsed_param.hierarchies.empty() ? "" : parsed_param.hierarchies[0];
+    std::vector<std::string> hierarchy_names = parsed_param.hierarchies;
+    if (hierarchy_names.empty()) {
+        hierarchy_names.emplace_back("");
+    }
     auto result =
         this->search_impl(query,
                           search_func,
                           search_param,
                           ctx,
-                          hierarchy_name,
+                          hierarchy_names,
+                          parsed_param.hierarchy_op,
                           collect_rabitq_lower_bounds ? &rabitq_lower_bound_candidates : nullptr);
     result->Statistics(stats.Dump());
     return FilterDatasetByThreshold(result, threshold, allocator_, k);
@@ -385,8 +403,6 @@ Pyramid::RangeSearch(const DatasetPtr& query,
 
     auto parsed_param = PyramidSearchParameters::FromJson(parameters);
     ctx.rabitq_error_rate = parsed_param.rabitq_error_rate;
-    CHECK_ARGUMENT(parsed_param.hierarchy_op == PyramidSearchParameters::HierarchyOp::SINGLE,
-                   "multi-hierarchy search (union/intersection) is not yet implemented");
     InnerSearchParam search_param;
     search_param.ef = parsed_param.ef_search;
     search_param.radius = radius * RADIUS_EPSILON;
@@ -397,10 +413,8 @@ Pyramid::RangeSearch(const DatasetPtr& query,
                                                     : default_rabitq_one_bit_search_;
     search_param.topk = limited_size == -1 ? std::numeric_limits<int64_t>::max() : limited_size;
 
-    if (parsed_param.enable_time_record) {
-        search_param.time_cost = std::make_shared<Timer>();
-        search_param.time_cost->SetThreshold(parsed_param.timeout_ms);
-    }
+    const auto deadline = SearchDeadline::Make(parsed_param.timeout_ms);
+    ctx.deadline = deadline.get();
 
     if (this->support_duplicate_) {
         search_param.consider_duplicate = true;
@@ -431,14 +445,17 @@ Pyramid::RangeSearch(const DatasetPtr& query,
         return result;
     };
 
-    std::string hierarchy_name =
-        parsed_param.hierarchies.empty() ? "" : parsed_param.hierarchies[0];
+    std::vector<std::string> hierarchy_names = parsed_param.hierarchies;
+    if (hierarchy_names.empty()) {
+        hierarchy_names.emplace_back("");
+    }
     auto result =
         this->search_impl(query,
                           search_func,
                           search_param,
                           ctx,
-                          hierarchy_name,
+                          hierarchy_names,
+                          parsed_param.hierarchy_op,
                           collect_rabitq_lower_bounds ? &rabitq_lower_bound_candidates : nullptr);
     result->Statistics(stats.Dump());
     return result;
@@ -449,32 +466,37 @@ Pyramid::search_impl(const DatasetPtr& query,
                      const SearchFunc& search_func,
                      InnerSearchParam& search_param,
                      QueryContext& ctx,
-                     const std::string& hierarchy_name,
+                     const std::vector<std::string>& hierarchy_names,
+                     PyramidSearchParameters::HierarchyOp hierarchy_op,
                      const DistanceRecordVector* rabitq_lower_bound_candidates) const {
-    auto h_iter = hierarchies_.find(hierarchy_name);
-    CHECK_ARGUMENT(h_iter != hierarchies_.end(),
-                   fmt::format("unknown hierarchy name: '{}'", hierarchy_name));
-    const auto& h = *h_iter->second;
-
-    const auto* query_path = query->GetPaths(hierarchy_name);
-    if (query_path == nullptr) {
-        query_path = query->GetPaths();
-    }
-    // NOLINTNEXTLINE(readability-simplify-boolean-expr)
-    CHECK_ARGUMENT(query_path != nullptr || h.root->status_ != IndexNode::Status::NO_INDEX,
-                   "query_path is required when level0 is not built");
+    std::vector<HierarchyTarget> targets;
+    targets.reserve(hierarchy_names.size());
+    for (const auto& hierarchy_name : hierarchy_names) {
+        auto h_iter = hierarchies_.find(hierarchy_name);
+        CHECK_ARGUMENT(h_iter != hierarchies_.end(),
+                       fmt::format("unknown hierarchy name: '{}'", hierarchy_name));
+        const auto& h = *h_iter->second;
+
+        const auto* query_path = query->GetPaths(hierarchy_name);
+        if (query_path == nullptr) {
+            query_path = query->GetPaths();
+        }
+        // NOLINTNEXTLINE(readability-simplify-boolean-expr)
+        CHECK_ARGUMENT(query_path != nullptr || h.root->status_ != IndexNode::Status::NO_INDEX,
+                       "query_path is required when level0 is not built");
+        targets.push_back(HierarchyTarget{&h, query_path});
+    }
     CHECK_ARGUMENT(query->GetFloat32Vectors() != nullptr, "query vectors is required");
 
-    DistHeapPtr search_result = std::make_shared<StandardHeap<true, false>>(allocator_, -1);
+    DistHeapPtr search_result = nullptr;
 
     std::shared_lock<std::shared_mutex> lock(resize_mutex_);
-    VisitedListGuard vl_guard(pool_.get());
-    const VisitedListPtr& vl = vl_guard.get();
-    if (query_path != nullptr) {
-        const std::string& current_path = query_path[0];
-        search_hierarchy(h, search_func, vl, search_result, current_path, search_param);
+    if (hierarchy_op == PyramidSearchParameters::HierarchyOp::UNION) {
+        search_result = this->search_union(targets, search_func, search_param);
+    } else if (hierarchy_op == PyramidSearchParameters::HierarchyOp::INTERSECTION) {
+        search_result = this->search_intersection(targets, search_func, search_param);
     } else {
-        h.root->Search(search_func, vl, search_result, search_param.ef);
+        search_result = this->search_target(targets[0], search_func, search_param);
     }
 
     if (use_reorder_) {
@@ -1634,6 +1656,175 @@ Pyramid::search_hierarchy(const Hierarchy& h,
     }
 }
 
+DistHeapPtr
+Pyramid::search_target(const HierarchyTarget& target,
+                       const SearchFunc& search_func,
+                       const InnerSearchParam& search_param) const {
+    DistHeapPtr search_result = std::make_shared<StandardHeap<true, false>>(allocator_, -1);
+    VisitedListGuard vl_guard(pool_.get());
+    const VisitedListPtr& vl = vl_guard.get();
+    if (target.query_path != nullptr) {
+        const std::string& current_path = target.query_path[0];
+        search_hierarchy(
+            *target.hierarchy, search_func, vl, search_result, current_path, search_param);
+    } else {
+        target.hierarchy->root->Search(search_func, vl, search_result, search_param.ef);
+    }
+    return search_result;
+}
+
+std::vector<const IndexNode*>
+Pyramid::collect_target_nodes(const HierarchyTarget& target) const {
+    std::vector<const IndexNode*> pending;
+    if (target.query_path == nullptr) {
+        pending.push_back(target.hierarchy->root.get());
+    } else {
+        for (const auto& one_path : parse_path(target.query_path[0])) {
+            IndexNode* node = target.hierarchy->root.get();
+            for (const auto& item : one_path) {
+                node = node->GetChild(item, false);
+                if (node == nullptr) {
+                    break;
+                }
+            }
+            if (node != nullptr) {
+                pending.push_back(node);
+            }
+        }
+    }
+    // same descent as IndexNode::Search: an indexed node covers its whole subtree
+    std::vector<const IndexNode*> nodes;
+    while (not pending.empty()) {
+        const auto* node = pending.back();
+        pending.pop_back();
+        // GetChild may add children concurrently, so they are walked under the node lock
+        std::shared_lock lock(node->mutex_);
+        if (node->status_ != IndexNode::Status::NO_INDEX) {
+            nodes.push_back(node);
+            continue;
+        }
+        for (const auto& [key, child] : node->children_) {
+            pending.push_back(child.get());
+        }
+    }
+    return nodes;
+}
+
+DistHeapPtr
+Pyramid::search_union(const std::vector<HierarchyTarget>& targets,
+                      const SearchFunc& search_func,
+                      const InnerSearchParam& search_param) const {
+    // every hierarchy indexes the same vectors, so a point may come back from several of them;
+    // each hierarchy gets a fresh visited list, sharing one would block routing through points
+    // already seen in another hierarchy's graph
+    Vector<DistHeapPtr> target_results(targets.size(), allocator_);
+    if (thread_pool_ != nullptr && search_param.parallel_search_thread_count > 1 &&
+        targets.size() > 1) {
+        // the paths inside one hierarchy run inline, a pool task must not wait on the pool
+        auto target_param = search_param;
+        target_param.parallel_search_thread_count = 1;
+        std::vector<std::future<void>> futures;
+        for (uint64_t i = 1; i < targets.size(); ++i) {
+            futures.push_back(thread_pool_->GeneralEnqueue([&, i]() -> void {
+                target_results[i] = this->search_target(targets[i], search_func, target_param);
+            }));
+        }
+        target_results[0] = this->search_target(targets[0], search_func, target_param);
+        for (auto& future : futures) {
+            future.get();
+        }
+    } else {
+        for (uint64_t i = 0; i < targets.size(); ++i) {
+            target_results[i] = this->search_target(targets[i], search_func, search_param);
+        }
+    }
+
+    DistHeapPtr search_result = std::make_shared<StandardHeap<true, false>>(allocator_, -1);
+    UnorderedSet<InnerIdType> seen(allocator_);
+    for (const auto& target_result : target_results) {
+        const auto* data = target_result->GetData();
+        for (uint64_t i = 0; i < target_result->Size(); ++i) {
+            if (seen.emplace(data[i].second).second) {
+                search_result->Push(data[i].first, data[i].second);
+            }
+        }
+    }
+    // a range search keeps every hit within the radius, search_impl applies radius and limit
+    if (search_param.search_mode == KNN_SEARCH) {
+        const auto keep =
+            std::max<int64_t>(static_cast<int64_t>(search_param.ef), search_param.topk);
+        while (static_cast<int64_t>(search_result->Size()) > keep) {
+            search_result->Pop();
+        }
+    }
+    return search_result;
+}
+
+DistHeapPtr
+Pyramid::search_intersection(const std::vector<HierarchyTarget>& targets,
+                             const SearchFunc& search_func,
+                             InnerSearchParam& search_param) const {
+    std::vector<std::vector<const IndexNode*>> target_nodes;
+    target_nodes.reserve(targets.size());
+    uint64_t driver = 0;
+    uint64_t driver_count = std::numeric_limits<uint64_t>::max();
+    for (uint64_t i = 0; i < targets.size(); ++i) {
+        target_nodes.emplace_back(this->collect_target_nodes(targets[i]));
+        uint64_t count = 0;
+        for (const auto* node : target_nodes[i]) {
+            count += node->GetIdCount();
+        }
+        if (count < driver_count) {
+            driver = i;
+            driver_count = count;
+        }
+    }
+    if (driver_count == 0) {
+        return std::make_shared<StandardHeap<true, false>>(allocator_, -1);
+    }
+
+    // search the target with the fewest ids and only accept ids found under every other target
+    ComputableBitsetPtr allowed_ids = nullptr;
+    for (uint64_t i = 0; i < targets.size(); ++i) {
+        if (i == driver) {
+            continue;
+        }
+        auto target_ids =
+            ComputableBitset::MakeInstance(ComputableBitsetType::FastBitset, allocator_);
+        for (const auto* node : target_nodes[i]) {
+            for (const auto id : node->GetIds()) {
+                target_ids->Set(id);
+            }
+        }
+        if (allowed_ids == nullptr) {
+            allowed_ids = target_ids;
+        } else {
+            allowed_ids->And(*target_ids);
+        }
+    }
+
+    // search_func reads search_param by reference, so the filter applies to every node search
+    auto origin_filter = search_param.is_inner_id_allowed;
+    auto intersection_filter = std::make_shared<WhiteListFilter>(allowed_ids.get());
+    if (origin_filter == nullptr) {
+        search_param.is_inner_id_allowed = intersection_filter;
+    } else {
+        auto combined_filter = std::make_shared<CombinedFilter>();
+        combined_filter->AppendFilter(origin_filter);
+        combined_filter->AppendFilter(intersection_filter);
+        search_param.is_inner_id_allowed = combined_filter;
+    }
+    DistHeapPtr search_result = nullptr;
+    try {
+        search_result = this->search_target(targets[driver], search_func, search_param);
+    } catch (...) {
+        search_param.is_inner_id_allowed = origin_filter;
+        throw;
+    }
+    search_param.is_inner_id_allowed = origin_filter;
+    return search_result;
+}
+
 std::vector<std::vector<std::string>>
 Pyramid::parse_path(const std::string& path) {
     auto multi_paths = split(path, PART_BAR);
@@ -1659,9 +1850,7 @@ Pyramid::search_node(const IndexNode* node,
 
     if (node->status_ == IndexNode::Status::FLAT) {
         results = std::make_shared<StandardHeap<true, false>>(allocator_, -1);
-        if (search_param.time_cost != nullptr and search_param.time_cost->CheckOvertime() and
-            ctx.stats != nullptr) {
-            ctx.stats->is_timeout.store(true, std::memory_order_relaxed);
+        if (ctx.ShouldStop()) {
             return results;
         }
         const auto* ids_ptr = node->ids_.data();
@@ -87,6 +87,14 @@ public:
     IndexNode*
     GetChild(const std::string& key, bool need_init = false);
 
+    /// Number of ids indexed at this node, the flat id list or the vertices of its graph.
+    [[nodiscard]] uint64_t
+    GetIdCount() const;
+
+    /// Ids indexed at this node; a GRAPH node no longer keeps ids_, so they come from its graph.
+    [[nodiscard]] Vector<InnerIdType>
+    GetIds() const;
+
     void
     Serialize(StreamWriter& writer) const;
 
@@ -371,6 +379,35 @@ private:
                      const std::string& path,
                      const InnerSearchParam& search_param) const;
 
+    /// A hierarchy selected by a search request, with the query path given for it (or null).
+    struct HierarchyTarget {
+        const Hierarchy* hierarchy{nullptr};
+        const std::string* query_path{nullptr};
+    };
+
+    /// Search one selected hierarchy with its own visited list.
+    DistHeapPtr
+    search_target(const HierarchyTarget& target,
+                  const SearchFunc& search_func,
+                  const InnerSearchParam& search_param) const;
+
+    /// Collect the nodes a search of target would visit (the first indexed node on each branch).
+    std::vector<const IndexNode*>
+    collect_target_nodes(const HierarchyTarget& target) const;
+
+    /// UNION: search every target and merge the results, keeping each inner id once. The
+    /// targets run on thread_pool_ when parallel_search_thread_count > 1.
+    DistHeapPtr
+    search_union(const std::vector<HierarchyTarget>& targets,
+                 const SearchFunc& search_func,
+                 const InnerSearchParam& search_param) const;
+
+    /// INTERSECTION: search the smallest target, restricted to ids present in all the others.
+    DistHeapPtr
+    search_intersection(const std::vector<HierarchyTarget>& targets,
+                        const SearchFunc& search_func,
+                        InnerSearchParam& search_param) const;
+
     /// Grow internal storage to accommodate new_max_capacity vectors.
     void
     resize(int64_t new_max_capacity);
@@ -381,7 +418,8 @@ private:
                 const SearchFunc& search_func,
                 InnerSearchParam& search_param,
                 QueryContext& ctx,
-                const std::string& hierarchy_name,
+                const std::vector<std::string>& hierarchy_names,
+                PyramidSearchParameters::HierarchyOp hierarchy_op,
                 const DistanceRecordVector* rabitq_lower_bound_candidates = nullptr) const;
 
     /// Probabilistic check: should total_count trigger a new entry-point update?
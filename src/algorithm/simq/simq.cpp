@@ -35,6 +35,7 @@
 #include "inner_string_params.h"
 #include "metric_type.h"
 #include "query_context.h"
+#include "simd/fp32_simd.h"
 #include "simq_utils.h"
 #include "storage/serialization.h"
 #include "storage/stream_reader.h"
@@ -69,17 +70,21 @@ dump_simq_statistics(const SearchStatistics& stats,
                      double sort_ms,
                      uint32_t mv_io_ms,
                      uint32_t mv_compute_ms,
-                     uint32_t mv_candidates) {
+                     uint32_t mv_candidates,
+                     uint64_t interaction_candidate_count = 0,
+                     double interaction_ms = 0.0) {
     auto json = JsonType::Parse(stats.Dump());
     json["simq_coarse_dist_cmp"].SetUint64(coarse_dist_cmp);
     json["simq_coarse_probe_count"].SetUint64(coarse_probe_count);
     json["simq_coarse_candidate_count"].SetUint64(coarse_candidate_count);
+    json["simq_interaction_candidate_count"].SetUint64(interaction_candidate_count);
     json["simq_rerank_candidate_count"].SetUint64(rerank_candidate_count);
     json["simq_filtered_candidate_count"].SetUint64(filtered_candidate_count);
     json["simq_result_count"].SetUint64(result_count);
     json["simq_limited_size_applied"].SetBool(limited_size_applied);
     json["simq_coarse_ms"].SetDouble(coarse_ms);
     json["simq_query_ms"].SetDouble(query_ms);
+    json["simq_interaction_ms"].SetDouble(interaction_ms);
     json["simq_sort_ms"].SetDouble(sort_ms);
     json["simq_mv_io_ms"].SetInt(static_cast<int>(mv_io_ms));
     json["simq_mv_compute_ms"].SetInt(static_cast<int>(mv_compute_ms));
@@ -409,6 +414,7 @@ SIMQ::SIMQ(const SIMQParameterPtr& param, const IndexCommonParam& common_param)
       common_param_(common_param),
       cluster_lists_(allocator_),
       vec_to_cluster_(allocator_),
+      doc_token_offsets_(allocator_),
       token_to_doc_(allocator_),
       token_to_offset_(allocator_),
       token_to_dist_(allocator_),
@@ -420,6 +426,7 @@ SIMQ::SIMQ(const SIMQParameterPtr& param, const IndexCommonParam& common_param)
     random_seed_ = param->random_seed;
     default_coarse_k_ = param->coarse_k;
     default_rerank_k_ = param->rerank_k;
+    default_centroid_interaction_k_ = param->centroid_interaction_k;
     split_delay_seconds_ = param->split_delay_seconds;
     this->has_raw_vector_ = true;
 }
@@ -454,6 +461,8 @@ SIMQ::Build(const DatasetPtr& data) {
     token_to_doc_.resize(total_vecs);
     token_to_offset_.resize(total_vecs);
     token_to_dist_.resize(total_vecs, 0.0F);
+    doc_token_offsets_.resize(static_cast<uint64_t>(num_docs) + 1);
+    doc_token_offsets_[0] = 0;
 
     uint64_t vec_off = 0;
     for (int64_t i = 0; i < num_docs; ++i) {
@@ -471,6 +480,7 @@ SIMQ::Build(const DatasetPtr& data) {
             token_to_offset_[vec_off + t] = t;
         }
         vec_off += mvs[i].len_;
+        doc_token_offsets_[i + 1] = vec_off;
     }
 
     total_count_ = static_cast<uint64_t>(num_docs);
@@ -738,6 +748,8 @@ SIMQ::Add(const DatasetPtr& data) {
     token_to_doc_.resize(new_token_count);
     token_to_offset_.resize(new_token_count);
     token_to_dist_.resize(new_token_count, 0.0F);
+    doc_token_offsets_.insert(
+        doc_token_offsets_.end(), doc_token_offsets.begin() + 1, doc_token_offsets.end());
 
     mv_codes_->Resize(base_inner_id + static_cast<InnerIdType>(num_docs));
 
@@ -1236,7 +1248,8 @@ SIMQ::coarse_search(const float* query_tokens,
                     uint32_t query_token_count,
                     int64_t coarse_k,
                     uint64_t* coarse_dist_cmp,
-                    uint64_t* coarse_probe_count) const {
+                    uint64_t* coarse_probe_count,
+                    TokenClusterScores* token_cluster_scores) const {
     // Flat-array fast-path replacing the previous unordered_map + unordered_set
     // pair, which dominated coarse-search latency. Buffers are reused across
     // queries via mutable member state and lazily grown to fit total_count_ on
@@ -1376,14 +1389,130 @@ SIMQ::coarse_search(const float* query_tokens,
     std::sort(ranked.begin(), ranked.end(), [](const auto& a, const auto& b) {
         return a.second > b.second;
     });
+
+    if (token_cluster_scores != nullptr) {
+        token_cluster_scores->clear();
+        token_cluster_scores->reserve(query_token_count);
+        for (auto& result : token_results) {
+            token_cluster_scores->push_back(std::move(result.cscores));
+        }
+    }
     return ranked;
 }
 
+void
+SIMQ::centroid_interaction_prune(const TokenClusterScores& token_cluster_scores,
+                                 std::vector<std::pair<InnerIdType, float>>& candidates,
+                                 int64_t keep) const {
+    // PLAID-style centroid interaction: a doc is scored by MaxSim between the
+    // query tokens and the centroids its tokens are assigned to, so only
+    // vec_to_cluster_ is touched and no token codes are decoded.
+    if (static_cast<int64_t>(candidates.size()) <= keep) {
+        return;
+    }
+
+    // Give every probed cluster a slot; slot 0 stands for the unprobed ones.
+    // The cluster -> slot map is per thread so concurrent searches do not share it;
+    // only the probed entries are written and they are zeroed again below.
+    thread_local std::vector<uint32_t> centroid_slots;
+    const auto n_clusters = static_cast<size_t>(num_clusters_);
+    if (centroid_slots.size() < n_clusters) {
+        centroid_slots.resize(n_clusters, 0);
+    }
+    std::vector<InnerIdType> probed_clusters;
+    for (const auto& cscores : token_cluster_scores) {
+        for (const auto& [_, cidx] : cscores) {
+            if (cidx < n_clusters and centroid_slots[cidx] == 0) {
+                probed_clusters.push_back(cidx);
+                centroid_slots[cidx] = static_cast<uint32_t>(probed_clusters.size());
+            }
+        }
+    }
+
+    // One row of similarities per query token. The coarse probe returned the
+    // most similar clusters in descending order, so the last probed score
+    // bounds the similarity of every cluster the token did not reach.
+    const uint64_t row_size = probed_clusters.size() + 1;
+    std::vector<float> sim_table(token_cluster_scores.size() * row_size);
+    for (uint64_t ti = 0; ti < token_cluster_scores.size(); ++ti) {
+        const auto& cscores = token_cluster_scores[ti];
+        float* row = sim_table.data() + ti * row_size;
+        std::fill_n(row, row_size, cscores.empty() ? 0.0F : cscores.back().first);
+        for (const auto& [cscore, cidx] : cscores) {
+            if (cidx < n_clusters) {
+                row[centroid_slots[cidx]] = cscore;
+            }
+        }
+    }
+
+    std::vector<uint32_t> doc_slots;
+    for (auto& [doc_id, score] : candidates) {
+        const uint64_t token_begin = doc_token_offsets_[doc_id];
+        const auto token_count =
+            static_cast<uint32_t>(doc_token_offsets_[doc_id + 1] - token_begin);
+        doc_slots.resize(token_count);
+        for (uint32_t t = 0; t < token_count; ++t) {
+            doc_slots[t] = centroid_slots[vec_to_cluster_[token_begin + t]];
+        }
+        float interaction = 0.0F;
+        for (uint64_t ti = 0; ti < token_cluster_scores.size(); ++ti) {
+            const float* row = sim_table.data() + ti * row_size;
+            interaction += FP32GatherMax(row, doc_slots.data(), token_count);
+        }
+        score = interaction;
+    }
+
+    for (InnerIdType cidx : probed_clusters) {
+        centroid_slots[cidx] = 0;
+    }
+
+    std::partial_sort(candidates.begin(),
+                      candidates.begin() + keep,
+                      candidates.end(),
+                      [](const auto& a, const auto& b) { return a.second > b.second; });
+    candidates.resize(keep);
+}
+
 DatasetPtr
 SIMQ::KnnSearch(const DatasetPtr& query,
                 int64_t k,
                 const std::string& parameters,
                 const FilterPtr& filter) const {
+    return knn_search(query, k, parameters, filter, nullptr);
+}
+
+DatasetPtr
+SIMQ::RangeSearch(const DatasetPtr& query,
+                  float radius,
+                  const std::string& parameters,
+                  const FilterPtr& filter,
+                  int64_t limited_size) const {
+    return range_search(query, radius, parameters, filter, limited_size, nullptr);
+}
+
+DatasetPtr
+SIMQ::SearchWithRequest(const SearchRequest& request) const {
+    CHECK_ARGUMENT(request.query_ != nullptr, "simq search: query is nullptr");
+    CHECK_ARGUMENT(not request.enable_attribute_filter_,
+                   "simq search: attribute filter is not supported");
+    const auto filter = request.enable_filter_ ? request.filter_ : nullptr;
+    if (request.mode_ == SearchMode::RANGE_SEARCH) {
+        return range_search(request.query_,
+                            request.radius_,
+                            request.params_str_,
+                            filter,
+                            request.limited_size_,
+                            &request);
+    }
+    return knn_search(request.query_, request.topk_, request.params_str_, filter, &request);
+}
+
+DatasetPtr
+SIMQ::knn_search(const DatasetPtr& query,
+                 int64_t k,
+                 const std::string& parameters,
+                 const FilterPtr& filter,
+                 const SearchRequest* request) const {
     std::unique_lock lock(global_mutex_);
     SearchStatistics stats;
 
@@ -1405,18 +1534,43 @@ SIMQ::KnnSearch(const DatasetPtr& query,
     int64_t coarse_k = sp.coarse_k > 0 ? sp.coarse_k : default_coarse_k_;
     int64_t rerank_k = sp.rerank_k > 0 ? sp.rerank_k : default_rerank_k_;
     rerank_k = std::min(rerank_k, static_cast<int64_t>(total_count_));
+    int64_t interaction_k = sp.centroid_interaction_k >= 0 ? sp.centroid_interaction_k
+                                                           : default_centroid_interaction_k_;
+    const bool use_interaction = interaction_k > rerank_k;
     k = std::min(k, static_cast<int64_t>(total_count_));
     const auto threshold = ParseSearchThreshold(parameters);
+    const auto deadline = SearchDeadline::Make(sp.timeout_ms, request);
+    QueryContext stop_ctx{.stats = &stats,
+                          .distance_phase = DistanceEvaluationPhase::RERANK,
+                          .deadline = deadline.get()};
 
     uint64_t coarse_dist_cmp = 0;
     uint64_t coarse_probe_count = 0;
     auto t_coarse_start = std::chrono::steady_clock::now();
-    auto coarse_results = coarse_search(
-        query_mvs[0].vectors_, query_mvs[0].len_, coarse_k, &coarse_dist_cmp, &coarse_probe_count);
+    TokenClusterScores token_cluster_scores;
+    auto coarse_results = coarse_search(query_mvs[0].vectors_,
+                                        query_mvs[0].len_,
+                                        coarse_k,
+                                        &coarse_dist_cmp,
+                                        &coarse_probe_count,
+                                        use_interaction ? &token_cluster_scores : nullptr);
     double coarse_ms =
         std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t_coarse_start)
             .count();
     uint64_t coarse_candidate_count = coarse_results.size();
+    uint64_t interaction_candidate_count = 0;
+    double interaction_ms = 0.0;
+    if (use_interaction and static_cast<int64_t>(coarse_results.size()) > rerank_k) {
+        auto t_interaction_start = std::chrono::steady_clock::now();
+        if (static_cast<int64_t>(coarse_results.size()) > interaction_k) {
+            coarse_results.resize(interaction_k);
+        }
+        interaction_candidate_count = coarse_results.size();
+        centroid_interaction_prune(token_cluster_scores, coarse_results, rerank_k);
+        interaction_ms = std::chrono::duration<double, std::milli>(
+                             std::chrono::steady_clock::now() - t_interaction_start)
+                             .count();
+    }
     if (static_cast<int64_t>(coarse_results.size()) > rerank_k) {
         coarse_results.resize(rerank_k);
     }
@@ -1442,7 +1596,8 @@ SIMQ::KnnSearch(const DatasetPtr& query,
     uint32_t mv_io_ms = 0;
     uint32_t mv_compute_ms = 0;
     uint32_t mv_candidates = 0;
-    if (!batch_ids.empty()) {
+    // the batch is one MultiRead, a search stopped after the coarse stage returns no results
+    if (!batch_ids.empty() and not stop_ctx.ShouldStop()) {
         std::vector<float> batch_dists(batch_ids.size());
         // Use QueryContext so MultiVectorDataCell can report fine-grained timing
         // back through SearchStatistics.
@@ -1510,16 +1665,19 @@ SIMQ::KnnSearch(const DatasetPtr& query,
                                                sort_ms,
                                                mv_io_ms,
                                                mv_compute_ms,
-                                               mv_candidates));
+                                               mv_candidates,
+                                               interaction_candidate_count,
+                                               interaction_ms));
     return std::move(result_ds);
 }
 
 DatasetPtr
-SIMQ::RangeSearch(const DatasetPtr& query,
-                  float radius,
-                  const std::string& parameters,
-                  const FilterPtr& filter,
-                  int64_t limited_size) const {
+SIMQ::range_search(const DatasetPtr& query,
+                   float radius,
+                   const std::string& parameters,
+                   const FilterPtr& filter,
+                   int64_t limited_size,
+                   const SearchRequest* request) const {
     std::unique_lock lock(global_mutex_);
     SearchStatistics stats;
 
@@ -1543,16 +1701,41 @@ SIMQ::RangeSearch(const DatasetPtr& query,
     int64_t coarse_k = sp.coarse_k > 0 ? sp.coarse_k : default_coarse_k_;
     int64_t rerank_k = sp.rerank_k > 0 ? sp.rerank_k : default_rerank_k_;
     rerank_k = std::min(rerank_k, static_cast<int64_t>(total_count_));
+    int64_t interaction_k = sp.centroid_interaction_k >= 0 ? sp.centroid_interaction_k
+                                                           : default_centroid_interaction_k_;
+    const bool use_interaction = interaction_k > rerank_k;
+    const auto deadline = SearchDeadline::Make(sp.timeout_ms, request);
+    QueryContext stop_ctx{.stats = &stats,
+                          .distance_phase = DistanceEvaluationPhase::RERANK,
+                          .deadline = deadline.get()};
 
     uint64_t coarse_dist_cmp = 0;
     uint64_t coarse_probe_count = 0;
     auto t_coarse_start = std::chrono::steady_clock::now();
-    auto coarse_results = coarse_search(
-        query_mvs[0].vectors_, query_mvs[0].len_, coarse_k, &coarse_dist_cmp, &coarse_probe_count);
+    TokenClusterScores token_cluster_scores;
+    auto coarse_results = coarse_search(query_mvs[0].vectors_,
+                                        query_mvs[0].len_,
+                                        coarse_k,
+                                        &coarse_dist_cmp,
+                                        &coarse_probe_count,
+                                        use_interaction ? &token_cluster_scores : nullptr);
     double coarse_ms =
         std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t_coarse_start)
             .count();
     uint64_t coarse_candidate_count = coarse_results.size();
+    uint64_t interaction_candidate_count = 0;
+    double interaction_ms = 0.0;
+    if (use_interaction and static_cast<int64_t>(coarse_results.size()) > rerank_k) {
+        auto t_interaction_start = std::chrono::steady_clock::now();
+        if (static_cast<int64_t>(coarse_results.size()) > interaction_k) {
+            coarse_results.resize(interaction_k);
+        }
+        interaction_candidate_count = coarse_results.size();
+        centroid_interaction_prune(token_cluster_scores, coarse_results, rerank_k);
+        interaction_ms = std::chrono::duration<double, std::milli>(
+                             std::chrono::steady_clock::now() - t_interaction_start)
+                             .count();
+    }
     if (static_cast<int64_t>(coarse_results.size()) > rerank_k) {
         coarse_results.resize(rerank_k);
     }
@@ -1563,6 +1746,9 @@ SIMQ::RangeSearch(const DatasetPtr& query,
     uint64_t filtered_candidate_count = 0;
     auto t_query_start = std::chrono::steady_clock::now();
     for (auto& [doc_id, _] : coarse_results) {
+        if (stop_ctx.ShouldStop()) {
+            break;
+        }
         if (filter != nullptr && !filter->CheckValid(this->label_table_->GetLabelById(doc_id))) {
             ++filtered_candidate_count;
             continue;
@@ -1610,7 +1796,9 @@ SIMQ::RangeSearch(const DatasetPtr& query,
                                                sort_ms,
                                                0,
                                                0,
-                                               0));
+                                               0,
+                                               interaction_candidate_count,
+                                               interaction_ms));
     return std::move(result_ds);
 }
 
@@ -1700,6 +1888,7 @@ SIMQ::Deserialize(StreamReader& reader) {
         tmp_param.FromJson(inner);
         default_coarse_k_ = tmp_param.coarse_k;
         default_rerank_k_ = tmp_param.rerank_k;
+        default_centroid_interaction_k_ = tmp_param.centroid_interaction_k;
         max_cluster_size_ = tmp_param.max_cluster_size;
         split_start_idx_ = tmp_param.split_start_idx;
         random_seed_ = tmp_param.random_seed;
@@ -1725,6 +1914,15 @@ SIMQ::Deserialize(StreamReader& reader) {
     StreamReader::ReadVector(buf_reader, token_to_dist_);
     StreamReader::ReadVector(buf_reader, cluster_token_counts_);
 
+    // tokens are appended doc by doc, so the per-doc ranges follow from token_to_doc_
+    doc_token_offsets_.assign(total_count_val + 1, 0);
+    for (InnerIdType doc_id : token_to_doc_) {
+        ++doc_token_offsets_[doc_id + 1];
+    }
+    for (uint64_t i = 0; i < total_count_val; ++i) {
+        doc_token_offsets_[i + 1] += doc_token_offsets_[i];
+    }
+
     deserialize_rep_hgraph(buf_reader);
 
     mv_codes_->Deserialize(buf_reader);
@@ -1777,6 +1975,7 @@ SIMQ::CheckAndMappingExternalParam(const JsonType& external_param,
         {"random_seed", {"random_seed"}},
         {"coarse_k", {"coarse_k"}},
         {"rerank_k", {"rerank_k"}},
+        {"centroid_interaction_k", {"centroid_interaction_k"}},
         {"quantization_type", {"quantization_type"}},
         {BUILD_THREAD_COUNT_KEY, {BUILD_THREAD_COUNT_KEY}},
         {"split_delay_seconds", {"split_delay_seconds"}},
@@ -44,6 +44,9 @@ struct SplitTask {
     std::unordered_set<InnerIdType> new_docs;  // Docs moving to new cluster
 };
 
+// Per query token: (similarity, cluster index) of the probed clusters, most similar first
+using TokenClusterScores = std::vector<std::vector<std::pair<float, InnerIdType>>>;
+
 class SIMQ : public InnerIndexInterface {
 public:
     static ParamPtr
@@ -77,6 +80,9 @@ public:
                 const FilterPtr& filter,
                 int64_t limited_size = -1) const override;
 
+    DatasetPtr
+    SearchWithRequest(const SearchRequest& request) const override;
+
     void
     Serialize(StreamWriter& writer) const override;
 
@@ -116,7 +122,28 @@ private:
                   uint32_t query_token_count,
                   int64_t coarse_k,
                   uint64_t* coarse_dist_cmp = nullptr,
-                  uint64_t* coarse_probe_count = nullptr) const;
+                  uint64_t* coarse_probe_count = nullptr,
+                  TokenClusterScores* token_cluster_scores = nullptr) const;
+
+    DatasetPtr
+    knn_search(const DatasetPtr& query,
+               int64_t k,
+               const std::string& parameters,
+               const FilterPtr& filter,
+               const SearchRequest* request) const;
+
+    DatasetPtr
+    range_search(const DatasetPtr& query,
+                 float radius,
+                 const std::string& parameters,
+                 const FilterPtr& filter,
+                 int64_t limited_size,
+                 const SearchRequest* request) const;
+
+    void
+    centroid_interaction_prune(const TokenClusterScores& token_cluster_scores,
+                               std::vector<std::pair<InnerIdType, float>>& candidates,
+                               int64_t keep) const;
 
     void
     serialize_rep_hgraph(StreamWriter& writer) const;
@@ -156,6 +183,9 @@ private:
 
     Vector<InnerIdType> vec_to_cluster_;
 
+    // Token range per doc: doc i owns tokens [doc_token_offsets_[i], doc_token_offsets_[i + 1])
+    Vector<uint64_t> doc_token_offsets_;
+
     // Token-level metadata for precise split: maps global token_id → doc inner_id / offset / dist
     Vector<InnerIdType> token_to_doc_;
     Vector<uint32_t> token_to_offset_;
@@ -181,6 +211,7 @@ private:
     int64_t random_seed_{42};
     int64_t default_coarse_k_{8};
     int64_t default_rerank_k_{100};
+    int64_t default_centroid_interaction_k_{0};
 
     uint64_t resize_increase_count_bit_{10};
 
@@ -29,6 +29,7 @@ static constexpr const char* SIMQ_SPLIT_START_IDX = "split_start_idx";
 static constexpr const char* SIMQ_RANDOM_SEED = "random_seed";
 static constexpr const char* SIMQ_COARSE_K = "coarse_k";
 static constexpr const char* SIMQ_RERANK_K = "rerank_k";
+static constexpr const char* SIMQ_CENTROID_INTERACTION_K = "centroid_interaction_k";
 static constexpr const char* SIMQ_SPLIT_DELAY_SECONDS = "split_delay_seconds";
 static constexpr const char* SIMQ_QUANTIZATION_TYPE = "quantization_type";
 
@@ -54,6 +55,9 @@ SIMQParameter::FromJson(const JsonType& json) {
     if (json.Contains(SIMQ_RERANK_K)) {
         rerank_k = json[SIMQ_RERANK_K].GetInt();
     }
+    if (json.Contains(SIMQ_CENTROID_INTERACTION_K)) {
+        centroid_interaction_k = json[SIMQ_CENTROID_INTERACTION_K].GetInt();
+    }
     if (json.Contains(SIMQ_SPLIT_DELAY_SECONDS)) {
         split_delay_seconds = json[SIMQ_SPLIT_DELAY_SECONDS].GetFloat();
     }
@@ -68,6 +72,7 @@ SIMQParameter::FromJson(const JsonType& json) {
     CHECK_ARGUMENT(valid_split_start_idx, "simq: split_start_idx must be in (1, max_cluster_size)");
     CHECK_ARGUMENT(coarse_k > 0, "simq: coarse_k must be > 0");
     CHECK_ARGUMENT(rerank_k > 0, "simq: rerank_k must be > 0");
+    CHECK_ARGUMENT(centroid_interaction_k >= 0, "simq: centroid_interaction_k must be >= 0");
     CHECK_ARGUMENT(split_delay_seconds >= 0.0, "simq: split_delay_seconds must be >= 0");
 
     CHECK_ARGUMENT(json.Contains(BASE_CODES_KEY),
@@ -95,6 +100,7 @@ SIMQParameter::ToJson() const {
     json[SIMQ_RANDOM_SEED].SetInt(random_seed);
     json[SIMQ_COARSE_K].SetInt(coarse_k);
     json[SIMQ_RERANK_K].SetInt(rerank_k);
+    json[SIMQ_CENTROID_INTERACTION_K].SetInt(centroid_interaction_k);
     json[SIMQ_SPLIT_DELAY_SECONDS].SetDouble(split_delay_seconds);
     json[SIMQ_QUANTIZATION_TYPE].SetString(quantization_type);
     json[BASE_CODES_KEY].SetJson(base_codes_param->ToJson());
@@ -129,6 +135,9 @@ SIMQSearchParameters::FromJson(const std::string& json_string) {
     if (simq_params.Contains(SIMQ_RERANK_K)) {
         obj.rerank_k = simq_params[SIMQ_RERANK_K].GetInt();
     }
+    if (simq_params.Contains(SIMQ_CENTROID_INTERACTION_K)) {
+        obj.centroid_interaction_k = simq_params[SIMQ_CENTROID_INTERACTION_K].GetInt();
+    }
     return obj;
 }
 
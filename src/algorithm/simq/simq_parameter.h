@@ -44,6 +44,9 @@ public:
     // Search parameters (index-level defaults, overridable per-query)
     int64_t coarse_k{8};    // clusters searched per query token
     int64_t rerank_k{100};  // docs reranked with exact MaxSim
+    // docs scored by centroid interaction before the best rerank_k of them are
+    // reranked; only takes effect when larger than rerank_k, 0 disables
+    int64_t centroid_interaction_k{0};
 
     // Token-vector quantization: "fp32" (default), "fp16", "bf16",
     // "sq8_uniform", or "int8".  Controls the storage format of multi-vector
@@ -63,8 +66,9 @@ DEFINE_POINTER(SIMQParameter);
 
 class SIMQSearchParameters : public IndexSearchParameter {
 public:
-    int64_t coarse_k{-1};  // -1 means use index default
-    int64_t rerank_k{-1};  // -1 means use index default
+    int64_t coarse_k{-1};                // -1 means use index default
+    int64_t rerank_k{-1};                // -1 means use index default
+    int64_t centroid_interaction_k{-1};  // -1 means use index default
 
     static SIMQSearchParameters
     FromJson(const std::string& json_string);
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "analyzer/analyzer.h"
+#include "datacell/sindi_datacell_utils.h"
 #include "datacell/sparse_dmq_datacell.h"
 #include "datacell/sparse_vector_datacell_parameter.h"
 #include "impl/heap/standard_heap.h"
@@ -51,6 +52,8 @@ constexpr int64_t SINDI_RERANK_FLAT_FORMAT_DATACELL = 2;
 constexpr int64_t SINDI_RERANK_FLAT_FORMAT_DMQ = 3;
 constexpr const char* SINDI_POSTING_LIST_FORMAT_VERSION_KEY = "sindi_posting_list_format_version";
 constexpr int64_t SINDI_SORTED_POSTING_LIST_FORMAT_VERSION = 1;
+// queries of a batched search sharing one pass over the windows, bounds the per-query dists
+constexpr int64_t SINDI_BATCH_QUERY_BLOCK_SIZE = 32;
 
 class FilterCallbackLimiter : public Filter {
 public:
@@ -714,6 +717,8 @@ SINDI::KnnSearch(const DatasetPtr& query,
                                AMPLIFICATION_FACTOR,
                                k));
     InnerSearchParam inner_param;
+    inner_param.block_max_pruning_ratio =
+        search_param.block_max_pruning ? search_param.block_max_pruning_ratio : 0.0F;
     inner_param.ef = std::max(static_cast<int64_t>(search_param.n_candidate), k);
     inner_param.topk = threshold.has_value() ? static_cast<int64_t>(inner_param.ef) : k;
     inner_param.distance_threshold = threshold;
@@ -743,6 +748,7 @@ SINDI::KnnSearch(const DatasetPtr& query,
     auto computer = std::make_shared<SparseTermComputer>(
         effective_query, search_param, allocator_, term_datacell_->GetWindowCount());
     const SparseVector* rerank_query = (remap_term_ids_ && use_reorder_) ? &sparse_query : nullptr;
+    const auto deadline = SearchDeadline::Make(search_param.timeout_ms);
     auto result = search_impl<KNN_SEARCH>(computer,
                                           inner_param,
                                           allocator,
@@ -750,7 +756,8 @@ SINDI::KnnSearch(const DatasetPtr& query,
                                           rerank_query,
                                           nullptr,
                                           &statistics,
-                                          filter_callback_remaining_ptr);
+                                          filter_callback_remaining_ptr,
+                                          deadline.get());
     result->Statistics(statistics.Dump());
     return FilterDatasetByThreshold(result, threshold, allocator, k);
 }
@@ -764,7 +771,8 @@ SINDI::search_impl(const SparseTermComputerPtr& computer,
                    const SparseVector* original_query,
                    ReasoningContext* reasoning_ctx,
                    SearchStatistics* statistics,
-                   const uint64_t* filter_callback_remaining) const {
+                   const uint64_t* filter_callback_remaining,
+                   const SearchDeadline* deadline) const {
     auto* search_allocator = allocator != nullptr ? allocator : allocator_;
     // computer and heap
     MaxHeap heap(search_allocator);
@@ -782,7 +790,38 @@ SINDI::search_impl(const SparseTermComputerPtr& computer,
                                 ? std::make_unique<Vector<BucketIdType>>(search_allocator)
                                 : nullptr;
     SindiQueryContext query_context(search_allocator);
-    for (auto cur = min_window_id; cur <= max_window_id; cur++) {
+    QueryContext stop_ctx{.stats = statistics, .deadline = deadline};
+    bool stopped = false;
+    // block-max pruning visits windows by ascending distance lower bound and stops at the first
+    // one that cannot add a result; a filter callback limit keeps the id order of its callbacks
+    const bool block_max_pruning =
+        inner_param.block_max_pruning_ratio > 0.0F and filter_callback_remaining == nullptr;
+    Vector<std::pair<float, uint32_t>> window_order(search_allocator);
+    if (block_max_pruning) {
+        window_order = sindi_datacell_utils::OrderWindowsByLowerBound(*term_datacell_,
+                                                                      min_window_id,
+                                                                      max_window_id,
+                                                                      computer,
+                                                                      query_context,
+                                                                      search_allocator);
+    }
+    const auto visit_count = block_max_pruning ? static_cast<int64_t>(window_order.size())
+                                               : max_window_id - min_window_id + 1;
+    for (int64_t visit = 0; visit < visit_count; ++visit) {
+        if (stop_ctx.ShouldStop()) {
+            stopped = true;
+            break;
+        }
+        if (block_max_pruning and sindi_datacell_utils::CanSkipWindow<mode>(
+                                      window_order[visit].first, heap, inner_param)) {
+            if (statistics != nullptr) {
+                statistics->skipped_window_count.fetch_add(
+                    static_cast<uint32_t>(visit_count - visit), std::memory_order_relaxed);
+            }
+            break;
+        }
+        const auto cur = block_max_pruning ? static_cast<int64_t>(window_order[visit].second)
+                                           : min_window_id + visit;
         const auto window_start_id = static_cast<uint32_t>(cur) * window_size_;
         // compute
         term_datacell_->QueryWindow(dists.data(),
@@ -850,8 +889,38 @@ SINDI::search_impl(const SparseTermComputerPtr& computer,
         reasoning_ctx->RecordBucketSelection(*selected_buckets);
     }
 
-    // rerank
-    if (use_reorder_) {
+    if (not stopped and use_reorder_) {
+        stop_ctx.distance_phase = DistanceEvaluationPhase::RERANK;
+        stopped = stop_ctx.ShouldStop();
+    }
+
+    // rerank, skipped by a stopped search which keeps the low precision distances
+    return this->collect_results<mode>(heap,
+                                       use_reorder_ and not stopped,
+                                       inner_param,
+                                       computer,
+                                       search_allocator,
+                                       original_query,
+                                       reasoning_ctx,
+                                       statistics);
+}
+
+template <InnerSearchMode mode>
+DatasetPtr
+SINDI::collect_results(MaxHeap& heap,
+                       bool rerank,
+                       const InnerSearchParam& inner_param,
+                       const SparseTermComputerPtr& computer,
+                       Allocator* search_allocator,
+                       const SparseVector* original_query,
+                       ReasoningContext* reasoning_ctx,
+                       SearchStatistics* statistics) const {
+    int64_t k = 0;
+    if constexpr (mode == KNN_SEARCH) {
+        k = inner_param.topk;
+    }
+
+    if (rerank) {
         // high precision
         float cur_heap_top = std::numeric_limits<float>::max();
         auto candidate_size = heap.size();
@@ -957,6 +1026,8 @@ SINDI::RangeSearch(const DatasetPtr& query,
     SINDISearchParameter search_param;
     search_param.FromJson(JsonType::Parse(parameters));
     InnerSearchParam inner_param;
+    inner_param.block_max_pruning_ratio =
+        search_param.block_max_pruning ? search_param.block_max_pruning_ratio : 0.0F;
 
     inner_param.range_search_limit_size = static_cast<int>(limited_size);
     inner_param.radius = radius;
@@ -985,6 +1056,7 @@ SINDI::RangeSearch(const DatasetPtr& query,
     auto computer = std::make_shared<SparseTermComputer>(
         effective_query, search_param, allocator_, term_datacell_->GetWindowCount());
     const SparseVector* rerank_query = (remap_term_ids_ && use_reorder_) ? &sparse_query : nullptr;
+    const auto deadline = SearchDeadline::Make(search_param.timeout_ms);
     auto result = search_impl<RANGE_SEARCH>(computer,
                                             inner_param,
                                             allocator_,
@@ -992,7 +1064,8 @@ SINDI::RangeSearch(const DatasetPtr& query,
                                             rerank_query,
                                             nullptr,
                                             &statistics,
-                                            filter_callback_remaining_ptr);
+                                            filter_callback_remaining_ptr,
+                                            deadline.get());
     result->Statistics(statistics.Dump());
     return result;
 }
@@ -1003,21 +1076,28 @@ SINDI::SearchWithRequest(const SearchRequest& request) const {
 
     CHECK_ARGUMENT(request.query_ != nullptr, "query should not be null");
     const auto* sparse_vectors = request.query_->GetSparseVectors();
-    CHECK_ARGUMENT(request.query_->GetNumElements() == 1, "num of query should be 1");
-    auto sparse_query = sparse_vectors[0];
-    CHECK_ARGUMENT(
-        sparse_query.len_ > 0,
-        fmt::format("query->GetSparseVectors()->len_ ({}) is invalid", sparse_query.len_));
+    CHECK_ARGUMENT(sparse_vectors != nullptr, "query should contain sparse vectors");
+    CHECK_ARGUMENT(request.query_->GetNumElements() >= 1, "num of query should be at least 1");
 
     SINDISearchParameter search_param;
     search_param.FromJson(JsonType::Parse(request.params_str_));
 
     Allocator* allocator = select_query_allocator(request.search_allocator_, this->allocator_);
+    if (request.query_->GetNumElements() > 1) {
+        return this->batch_search(request, search_param, allocator);
+    }
+
+    auto sparse_query = sparse_vectors[0];
+    CHECK_ARGUMENT(
+        sparse_query.len_ > 0,
+        fmt::format("query->GetSparseVectors()->len_ ({}) is invalid", sparse_query.len_));
 
     bool is_range = (request.mode_ == SearchMode::RANGE_SEARCH);
     SearchStatistics statistics;
 
     InnerSearchParam inner_param;
+    inner_param.block_max_pruning_ratio =
+        search_param.block_max_pruning ? search_param.block_max_pruning_ratio : 0.0F;
     const bool filter_enabled = request.enable_filter_ and request.filter_ != nullptr;
     auto filter_callback_remaining =
         filter_enabled and search_param.filter_callback_limit > 0
@@ -1069,6 +1149,7 @@ SINDI::SearchWithRequest(const SearchRequest& request) const {
     auto computer = std::make_shared<SparseTermComputer>(
         effective_query, search_param, allocator, term_datacell_->GetWindowCount());
     const SparseVector* rerank_query = (remap_term_ids_ && use_reorder_) ? &sparse_query : nullptr;
+    const auto deadline = SearchDeadline::Make(search_param.timeout_ms, &request);
 
     DatasetPtr result;
     if (is_range) {
@@ -1081,7 +1162,8 @@ SINDI::SearchWithRequest(const SearchRequest& request) const {
                                            rerank_query,
                                            reasoning_ctx.get(),
                                            &statistics,
-                                           filter_callback_remaining_ptr);
+                                           filter_callback_remaining_ptr,
+                                           deadline.get());
     } else {
         CHECK_ARGUMENT(search_param.n_candidate <= SPARSE_AMPLIFICATION_FACTOR * request.topk_,
                        fmt::format("n_candidate ({}) should be less than {} * k ({})",
@@ -1097,7 +1179,8 @@ SINDI::SearchWithRequest(const SearchRequest& request) const {
                                          rerank_query,
                                          reasoning_ctx.get(),
                                          &statistics,
-                                         filter_callback_remaining_ptr);
+                                         filter_callback_remaining_ptr,
+                                         deadline.get());
     }
 
     result->Statistics(statistics.Dump());
@@ -1105,6 +1188,163 @@ SINDI::SearchWithRequest(const SearchRequest& request) const {
     return result;
 }
 
+DatasetPtr
+SINDI::batch_search(const SearchRequest& request,
+                    const SINDISearchParameter& search_param,
+                    Allocator* allocator) const {
+    CHECK_ARGUMENT(request.mode_ == SearchMode::KNN_SEARCH,
+                   "batched SINDI search only supports knn search");
+    CHECK_ARGUMENT(request.expected_labels_.empty(),
+                   "batched SINDI search does not support expected labels");
+    CHECK_ARGUMENT(request.topk_ > 0, fmt::format("topk ({}) should be positive", request.topk_));
+    CHECK_ARGUMENT(search_param.n_candidate <= SPARSE_AMPLIFICATION_FACTOR * request.topk_,
+                   fmt::format("n_candidate ({}) should be less than {} * k ({})",
+                               search_param.n_candidate,
+                               SPARSE_AMPLIFICATION_FACTOR,
+                               request.topk_));
+    const bool filter_enabled = request.enable_filter_ and request.filter_ != nullptr;
+    CHECK_ARGUMENT(not filter_enabled or search_param.filter_callback_limit == 0,
+                   "batched SINDI search does not support filter_callback_limit");
+
+    const auto* sparse_vectors = request.query_->GetSparseVectors();
+    const int64_t query_count = request.query_->GetNumElements();
+    for (int64_t i = 0; i < query_count; ++i) {
+        CHECK_ARGUMENT(sparse_vectors[i].len_ > 0,
+                       fmt::format("query->GetSparseVectors()[{}].len_ ({}) is invalid",
+                                   i,
+                                   sparse_vectors[i].len_));
+    }
+
+    const int64_t topk = request.topk_;
+    InnerSearchParam inner_param;
+    inner_param.ef = std::max(static_cast<int64_t>(search_param.n_candidate), topk);
+    inner_param.topk = topk;
+    inner_param.is_inner_id_allowed =
+        this->create_search_filter(filter_enabled ? request.filter_ : nullptr);
+    const bool with_filter = inner_param.is_inner_id_allowed != nullptr;
+
+    // row q of the result holds the topk of query q, padded with -1 when fewer are found
+    const auto total = static_cast<uint64_t>(query_count) * static_cast<uint64_t>(topk);
+    auto result = Dataset::Make();
+    result->NumElements(query_count)->Dim(topk)->Owner(true, allocator);
+    auto* ids = static_cast<int64_t*>(allocator->Allocate(sizeof(int64_t) * total));
+    result->Ids(ids);
+    auto* distances = static_cast<float*>(allocator->Allocate(sizeof(float) * total));
+    result->Distances(distances);
+    std::fill(ids, ids + total, -1);
+    std::fill(distances, distances + total, std::numeric_limits<float>::infinity());
+
+    SearchStatistics statistics;
+    const auto deadline = SearchDeadline::Make(search_param.timeout_ms, &request);
+    const auto [min_window_id, max_window_id] =
+        this->get_min_max_window_id(inner_param.is_inner_id_allowed);
+    const auto window_count = term_datacell_->GetWindowCount();
+
+    for (int64_t block_begin = 0; block_begin < query_count;
+         block_begin += SINDI_BATCH_QUERY_BLOCK_SIZE) {
+        const auto block_size = static_cast<uint32_t>(
+            std::min(SINDI_BATCH_QUERY_BLOCK_SIZE, query_count - block_begin));
+
+        // the computers keep a reference to their query, so the remapped queries and the
+        // buffers behind them live as long as the block does
+        Vector<SparseVector> effective_queries(
+            sparse_vectors + block_begin, sparse_vectors + block_begin + block_size, allocator);
+        Vector<Vector<uint32_t>> remapped_ids(block_size, Vector<uint32_t>(allocator), allocator);
+        Vector<Vector<float>> remapped_vals(block_size, Vector<float>(allocator), allocator);
+
+        // one computer per query, their pruned terms grouped by term id for the shared scan
+        Vector<SparseTermComputerPtr> computers(block_size, nullptr, allocator);
+        SindiBatchQueryTerms batch_terms(allocator);
+        for (uint32_t q = 0; q < block_size; ++q) {
+            if (remap_term_ids_) {
+                effective_queries[q] = remap_sparse_vector_for_query(
+                    effective_queries[q], remapped_ids[q], remapped_vals[q]);
+                if (effective_queries[q].len_ == 0) {
+                    continue;
+                }
+            }
+            computers[q] = std::make_shared<SparseTermComputer>(
+                effective_queries[q], search_param, allocator, window_count);
+            for (uint32_t it = 0; it < computers[q]->pruned_len_; ++it) {
+                batch_terms.push_back({computers[q]->GetTerm(it), q, it});
+            }
+        }
+        std::sort(batch_terms.begin(),
+                  batch_terms.end(),
+                  [](const SindiBatchQueryTerm& lhs, const SindiBatchQueryTerm& rhs) {
+                      return lhs.term_id < rhs.term_id or
+                             (lhs.term_id == rhs.term_id and lhs.query_index < rhs.query_index);
+                  });
+
+        Vector<float> dists(static_cast<uint64_t>(block_size) * window_size_, 0.0F, allocator);
+        Vector<float*> dist_ptrs(block_size, nullptr, allocator);
+        Vector<MaxHeap> heaps(allocator);
+        heaps.reserve(block_size);
+        for (uint32_t q = 0; q < block_size; ++q) {
+            dist_ptrs[q] = dists.data() + static_cast<uint64_t>(q) * window_size_;
+            heaps.emplace_back(allocator);
+        }
+
+        QueryContext stop_ctx{.stats = &statistics, .deadline = deadline.get()};
+        bool stopped = false;
+        for (int64_t cur = min_window_id; cur <= max_window_id; ++cur) {
+            if (stop_ctx.ShouldStop()) {
+                stopped = true;
+                break;
+            }
+            const auto window_start_id = static_cast<uint32_t>(cur) * window_size_;
+            term_datacell_->QueryWindowBatch(
+                dist_ptrs.data(), static_cast<uint32_t>(cur), computers, batch_terms);
+            const auto remaining_count =
+                static_cast<uint64_t>(cur_element_count_.load()) - window_start_id;
+            const auto window_document_count =
+                static_cast<uint32_t>(std::min<uint64_t>(window_size_, remaining_count));
+            for (uint32_t q = 0; q < block_size; ++q) {
+                if (computers[q] == nullptr) {
+                    continue;
+                }
+                term_datacell_->InsertHeapByDists(dist_ptrs[q],
+                                                  window_document_count,
+                                                  heaps[q],
+                                                  inner_param,
+                                                  window_start_id,
+                                                  KNN_SEARCH,
+                                                  with_filter);
+            }
+        }
+
+        if (not stopped and use_reorder_) {
+            stop_ctx.distance_phase = DistanceEvaluationPhase::RERANK;
+            stopped = stop_ctx.ShouldStop();
+        }
+
+        for (uint32_t q = 0; q < block_size; ++q) {
+            if (computers[q] == nullptr) {
+                continue;
+            }
+            const auto query_index = block_begin + q;
+            auto query_result = this->collect_results<KNN_SEARCH>(heaps[q],
+                                                                  use_reorder_ and not stopped,
+                                                                  inner_param,
+                                                                  computers[q],
+                                                                  allocator,
+                                                                  &sparse_vectors[query_index],
+                                                                  nullptr,
+                                                                  &statistics);
+            const auto count = std::min(query_result->GetDim(), topk);
+            std::copy(query_result->GetIds(),
+                      query_result->GetIds() + count,
+                      ids + query_index * topk);
+            std::copy(query_result->GetDistances(),
+                      query_result->GetDistances() + count,
+                      distances + query_index * topk);
+        }
+    }
+
+    result->Statistics(statistics.Dump());
+    return result;
+}
+
 void
 SINDI::AttachReasoningReport(const DatasetPtr& dataset_results,
                              ReasoningContext* reasoning_ctx) const {
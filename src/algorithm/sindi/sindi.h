@@ -188,6 +188,8 @@ private:
      *                                    per-term heap insertion (faster for
      *                                    very sparse queries).
      * @param original_query  non-null only when reranking is needed.
+     * @param deadline  checked before every window; a stopped search skips the rerank and
+     *                  returns the candidates scanned so far.
      */
     template <InnerSearchMode mode>
     DatasetPtr
@@ -198,7 +200,35 @@ private:
                 const SparseVector* original_query = nullptr,
                 ReasoningContext* reasoning_ctx = nullptr,
                 SearchStatistics* statistics = nullptr,
-                const uint64_t* filter_callback_remaining = nullptr) const;
+                const uint64_t* filter_callback_remaining = nullptr,
+                const SearchDeadline* deadline = nullptr) const;
+
+    /**
+     * @brief Rerank the candidates of @p heap when @p rerank is set, then return the top-k
+     *        (KNN) or the in-radius (RANGE) results; shared tail of search_impl and batch_search.
+     */
+    template <InnerSearchMode mode>
+    DatasetPtr
+    collect_results(MaxHeap& heap,
+                    bool rerank,
+                    const InnerSearchParam& inner_param,
+                    const SparseTermComputerPtr& computer,
+                    Allocator* search_allocator,
+                    const SparseVector* original_query,
+                    ReasoningContext* reasoning_ctx,
+                    SearchStatistics* statistics) const;
+
+    /**
+     * @brief KNN search of a multi-row sparse query dataset.
+     *
+     * Queries are handled in blocks: each window's posting lists are read once per block and
+     * accumulated into the per-query distance arrays, then every query keeps its own heap and
+     * is reranked on its own. Row i of the result holds the top-k of query i, padded with -1.
+     */
+    DatasetPtr
+    batch_search(const SearchRequest& request,
+                 const SINDISearchParameter& search_param,
+                 Allocator* allocator) const;
 
     bool
     UseTermListsHeapInsert(const SINDISearchParameter& search_param,
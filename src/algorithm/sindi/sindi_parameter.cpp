@@ -270,6 +270,20 @@ SINDISearchParameter::FromJson(const JsonType& json) {
     } else {
         n_candidate = DEFAULT_N_CANDIDATE;
     }
+    if (search_json.Contains(SEARCH_MAX_TIME_COST_MS)) {
+        timeout_ms = search_json[SEARCH_MAX_TIME_COST_MS].GetFloat();
+    }
+    block_max_pruning = DEFAULT_BLOCK_MAX_PRUNING;
+    block_max_pruning_ratio = DEFAULT_BLOCK_MAX_PRUNING_RATIO;
+    if (search_json.Contains(SPARSE_BLOCK_MAX_PRUNING)) {
+        block_max_pruning = search_json[SPARSE_BLOCK_MAX_PRUNING].GetBool();
+    }
+    if (search_json.Contains(SPARSE_BLOCK_MAX_PRUNING_RATIO)) {
+        block_max_pruning_ratio = search_json[SPARSE_BLOCK_MAX_PRUNING_RATIO].GetFloat();
+        CHECK_ARGUMENT((0.0F < block_max_pruning_ratio and block_max_pruning_ratio <= 1.0F),
+                       fmt::format("block_max_pruning_ratio must be in (0, 1], got {}",
+                                   block_max_pruning_ratio));
+    }
 
     if (search_json.Contains(LEGACY_USE_TERM_LISTS_HEAP_INSERT_KEY)) {
         logger::warn(
@@ -287,6 +301,8 @@ SINDISearchParameter::ToJson() const {
     json[INDEX_SINDI][SPARSE_FILTER_CALLBACK_LIMIT].SetUint64(filter_callback_limit);
     json[INDEX_SINDI][SPARSE_TERM_PRUNE_RATIO].SetFloat(term_prune_ratio);
     json[INDEX_SINDI][SPARSE_TERM_RETAIN_THRESHOLD].SetUint64(term_retain_threshold);
+    json[INDEX_SINDI][SPARSE_BLOCK_MAX_PRUNING].SetBool(block_max_pruning);
+    json[INDEX_SINDI][SPARSE_BLOCK_MAX_PRUNING_RATIO].SetFloat(block_max_pruning_ratio);
     return json;
 }
 
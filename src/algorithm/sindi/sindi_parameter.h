@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cstdint>
+#include <limits>
 #include <string>
 
 #include "algorithm/inner_index_parameter.h"
@@ -95,6 +96,9 @@ public:
     // search
     uint32_t n_candidate{0};
     uint64_t filter_callback_limit{0};
+    double timeout_ms{std::numeric_limits<double>::max()};
+    bool block_max_pruning{false};
+    float block_max_pruning_ratio{1.0F};
 
     // data cell
     float query_prune_ratio{0};
@@ -379,6 +379,138 @@ TEST_CASE("SINDI Filtered KNN Restores Heap Top Across Windows", "[ut][SINDI]")
     REQUIRE(filter->Count() == 1);
 }
 
+TEST_CASE("SINDI block-max pruning skips windows that cannot beat the heap", "[ut][SINDI]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    IndexCommonParam common_param;
+    common_param.allocator_ = allocator;
+    common_param.metric_ = MetricType::METRIC_TYPE_IP;
+    common_param.dim_ = 1;
+
+    const bool immutable = GENERATE(false, true);
+    CAPTURE(immutable);
+
+    auto parameter = std::make_shared<SINDIParameter>();
+    parameter->term_id_limit = 8;
+    parameter->window_size = 4;
+    parameter->doc_prune_ratio = 0.0F;
+    parameter->avg_doc_term_length = 1;
+    parameter->immutable = immutable;
+
+    // the strongest documents live in the last window, every other window is bounded below them
+    constexpr uint64_t count = 16;
+    uint32_t term = 3;
+    std::vector<float> values(count);
+    std::vector<int64_t> labels(count);
+    std::vector<SparseVector> vectors(count);
+    for (uint64_t i = 0; i < count; ++i) {
+        values[i] = static_cast<float>(i + 1);
+        labels[i] = static_cast<int64_t>(i);
+        vectors[i] = SparseVector{1, &term, &values[i]};
+    }
+    auto base = Dataset::Make();
+    base->NumElements(count)->SparseVectors(vectors.data())->Ids(labels.data())->Owner(false);
+
+    SINDI index(parameter, common_param);
+    REQUIRE(index.Build(base).empty());
+
+    float query_value = 1.0F;
+    SparseVector query_vector{1, &term, &query_value};
+    auto query = Dataset::Make();
+    query->NumElements(1)->SparseVectors(&query_vector)->Owner(false);
+
+    auto baseline = index.KnnSearch(query, 2, R"({"sindi": {"n_candidate": 2}})", nullptr);
+    auto pruned = index.KnnSearch(
+        query, 2, R"({"sindi": {"n_candidate": 2, "block_max_pruning": true}})", nullptr);
+    REQUIRE(pruned->GetDim() == 2);
+    REQUIRE(pruned->GetIds()[0] == baseline->GetIds()[0]);
+    REQUIRE(pruned->GetIds()[1] == baseline->GetIds()[1]);
+    REQUIRE(pruned->GetIds()[0] == 15);
+    auto statistics = JsonType::Parse(pruned->GetStatistics());
+    REQUIRE(statistics["skipped_window_count"].GetInt() == 3);
+
+    // range search skips the windows whose bound stays above the radius
+    auto range = index.RangeSearch(
+        query, -9.5F, R"({"sindi": {"block_max_pruning": true}})", nullptr, -1);
+    REQUIRE(range->GetDim() == 6);
+    statistics = JsonType::Parse(range->GetStatistics());
+    REQUIRE(statistics["skipped_window_count"].GetInt() == 2);
+
+    REQUIRE_THROWS(index.KnnSearch(
+        query,
+        2,
+        R"({"sindi": {"n_candidate": 2, "block_max_pruning_ratio": 1.5}})",
+        nullptr));
+}
+
+TEST_CASE("SINDI batched SearchWithRequest matches single query search", "[ut][SINDI]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    IndexCommonParam common_param;
+    common_param.allocator_ = allocator;
+    common_param.metric_ = MetricType::METRIC_TYPE_IP;
+
+    const bool immutable = GENERATE(false, true);
+    const bool use_reorder = GENERATE(false, true);
+    // remapped queries are built in per query buffers that must outlive the whole block
+    const bool remap_term_ids = GENERATE(false, true);
+    CAPTURE(immutable, use_reorder, remap_term_ids);
+
+    auto parameter = std::make_shared<SINDIParameter>();
+    parameter->term_id_limit = 1000;
+    parameter->window_size = 64;
+    parameter->doc_prune_ratio = 0.0F;
+    parameter->avg_doc_term_length = 20;
+    parameter->use_reorder = use_reorder;
+    parameter->immutable = immutable;
+    parameter->remap_term_ids = remap_term_ids;
+
+    constexpr uint32_t num_base = 300;
+    // more queries than one batch block, so the second block starts from fresh heaps
+    constexpr uint32_t num_query = 40;
+    constexpr int64_t topk = 10;
+    std::vector<int64_t> ids(num_base);
+    for (uint32_t i = 0; i < num_base; ++i) {
+        ids[i] = i;
+    }
+    auto sv_base = fixtures::GenerateSparseVectors(num_base, 20, 1000, 0, 10, 47);
+    auto base = Dataset::Make();
+    base->NumElements(num_base)->SparseVectors(sv_base.data())->Ids(ids.data())->Owner(false);
+
+    SINDI index(parameter, common_param);
+    REQUIRE(index.Build(base).empty());
+
+    auto sv_query = fixtures::GenerateSparseVectors(num_query, 20, 1000, 0, 10, 48);
+    auto queries = Dataset::Make();
+    queries->NumElements(num_query)->SparseVectors(sv_query.data())->Owner(false);
+
+    SearchRequest request;
+    request.query_ = queries;
+    request.mode_ = SearchMode::KNN_SEARCH;
+    request.topk_ = topk;
+    request.params_str_ = R"({"sindi": {"n_candidate": 20}})";
+    auto batched = index.SearchWithRequest(request);
+    REQUIRE(batched->GetNumElements() == num_query);
+    REQUIRE(batched->GetDim() == topk);
+
+    for (uint32_t q = 0; q < num_query; ++q) {
+        auto query = Dataset::Make();
+        query->NumElements(1)->SparseVectors(&sv_query[q])->Owner(false);
+        request.query_ = query;
+        auto single = index.SearchWithRequest(request);
+        REQUIRE(single->GetDim() == topk);
+        for (int64_t i = 0; i < topk; ++i) {
+            // the batch adds the terms of a query in another order, so only rounding differs
+            const auto expected = single->GetDistances()[i];
+            REQUIRE(std::abs(batched->GetDistances()[q * topk + i] - expected) <=
+                    1e-4F * std::max(1.0F, std::abs(expected)));
+        }
+        REQUIRE(batched->GetIds()[q * topk] == single->GetIds()[0]);
+    }
+
+    request.query_ = queries;
+    request.mode_ = SearchMode::RANGE_SEARCH;
+    REQUIRE_THROWS(index.SearchWithRequest(request));
+}
+
 TEST_CASE("SINDI Heap Insert Strategy Test", "[ut][SINDI]") {
     auto allocator = SafeAllocator::FactoryDefaultAllocator();
     IndexCommonParam common_param;
@@ -25,6 +25,7 @@
 #include <unordered_set>
 #include <vector>
 
+#include "datacell/sindi_datacell_utils.h"
 #include "datacell/sparse_dmq_datacell.h"
 #include "datacell/sparse_vector_datacell_parameter.h"
 #include "impl/filter/inner_id_wrapper_filter.h"
@@ -368,7 +369,21 @@ SINDIV2::GetMemoryUsageDetail() const {
 
 std::string
 SINDIV2::GetStats() const {
-    return "";
+    std::shared_lock rlock(this->global_mutex_);
+    const auto disk_datacell =
+        std::dynamic_pointer_cast<DiskSindiTermDataCellInterface>(term_datacell_);
+    if (disk_datacell == nullptr) {
+        return "";
+    }
+    const auto cache_stats = disk_datacell->GetTermCacheStats();
+    JsonType stats;
+    stats["term_hot_cache_size"].SetUint64(param_->term_hot_cache_size);
+    stats["hot_term_count"].SetUint64(cache_stats.hot_term_count);
+    stats["hot_term_memory_usage"].SetUint64(cache_stats.hot_term_memory_usage);
+    stats["hot_term_hit_count"].SetUint64(cache_stats.hot_term_hit_count);
+    stats["disk_term_read_count"].SetUint64(cache_stats.disk_term_read_count);
+    stats["disk_read_request_count"].SetUint64(cache_stats.disk_read_request_count);
+    return stats.Dump(4);
 }
 
 SparseVector
@@ -546,7 +561,8 @@ SINDIV2::Add(const DatasetPtr& base) {
             const auto pruned = this->sort_and_prune_sparse_vector_for_build(
                 sparse_vector, sorted_terms, pruned_ids, pruned_vals);
             if (remap_term_ids_) {
-                auto remapped = remap_sparse_vector_for_build(pruned, remapped_ids);
+                auto remapped =
+                    remap_sparse_vector_for_build(pruned, remapped_ids, *term_id_mapper_);
                 mutable_term_datacell->InsertVector(remapped,
                                                     static_cast<uint32_t>(cur_element_count_));
             } else {
@@ -674,7 +690,8 @@ SINDIV2::build_immutable(const DatasetPtr& base) {
             const auto pruned = this->sort_and_prune_sparse_vector_for_build(
                 sparse_vector, sorted_terms, pruned_ids, pruned_vals);
             if (remap_term_ids_) {
-                const auto remapped = remap_sparse_vector_for_build(pruned, remapped_ids);
+                const auto remapped =
+                    remap_sparse_vector_for_build(pruned, remapped_ids, *term_id_mapper_);
                 staging->InsertVector(remapped, local_id);
             } else {
                 staging->InsertVector(pruned, local_id);
@@ -730,6 +747,110 @@ SINDIV2::build_immutable(const DatasetPtr& base) {
     return failed_ids;
 }
 
+std::vector<int64_t>
+SINDIV2::BuildStreaming(const SparseChunkReader& reader,
+                        StreamWriter& writer,
+                        const ExternalSindiTermLayoutOptions& options) const {
+    CHECK_ARGUMENT(reader != nullptr, "streaming build needs a chunk reader");
+    CHECK_ARGUMENT(not use_reorder_, "streaming build does not support use_reorder");
+    CHECK_ARGUMENT(extra_info_size_ == 0, "streaming build does not support extra infos");
+    {
+        std::shared_lock rlock(this->global_mutex_);
+        CHECK_ARGUMENT(cur_element_count_ == 0, "SINDIV2 has already been built");
+    }
+
+    // the index object stays empty, labels, term ids and the value range live in this build only
+    LabelTable label_table(allocator_, true, false, param_->label_remap_type);
+    std::unique_ptr<TermIdMapper> term_id_mapper;
+    if (remap_term_ids_) {
+        term_id_mapper = std::make_unique<TermIdMapper>(term_id_limit_, allocator_);
+    }
+    auto layout_options = options;
+    if (thread_pool_ != nullptr) {
+        layout_options.thread_count =
+            std::max<uint64_t>(layout_options.thread_count, build_thread_count_);
+    }
+    ExternalSindiTermLayoutBuilder layout(term_id_limit_ + 1,
+                                          window_size_,
+                                          sparse_value_quant_type_,
+                                          layout_options,
+                                          thread_pool_,
+                                          allocator_);
+
+    std::vector<int64_t> failed_ids;
+    int64_t element_count = 0;
+    float min_val = std::numeric_limits<float>::max();
+    float max_val = std::numeric_limits<float>::lowest();
+    Vector<std::pair<uint32_t, float>> sorted_terms(allocator_);
+    Vector<uint32_t> pruned_ids(allocator_);
+    Vector<float> pruned_vals(allocator_);
+    Vector<uint32_t> remapped_ids(allocator_);
+    for (auto chunk = reader(); chunk != nullptr and chunk->GetNumElements() > 0;
+         chunk = reader()) {
+        const auto* sparse_vectors = chunk->GetSparseVectors();
+        const auto* ids = chunk->GetIds();
+        CHECK_ARGUMENT(sparse_vectors != nullptr and ids != nullptr,
+                       "streaming build chunk needs sparse vectors and ids");
+        for (int64_t i = 0; i < chunk->GetNumElements(); ++i) {
+            const auto& sparse_vector = sparse_vectors[i];
+            if (label_table.CheckLabel(ids[i]) or sparse_vector.len_ == 0) {
+                failed_ids.push_back(ids[i]);
+                continue;
+            }
+            try {
+                const auto pruned = this->sort_and_prune_sparse_vector_for_build(
+                    sparse_vector, sorted_terms, pruned_ids, pruned_vals);
+                const auto inner_id = static_cast<uint32_t>(element_count);
+                if (remap_term_ids_) {
+                    layout.AddVector(
+                        remap_sparse_vector_for_build(pruned, remapped_ids, *term_id_mapper),
+                        inner_id);
+                } else {
+                    layout.AddVector(pruned, inner_id);
+                }
+                for (uint32_t term = 0; term < pruned.len_; ++term) {
+                    min_val = std::min(min_val, pruned.vals_[term]);
+                    max_val = std::max(max_val, pruned.vals_[term]);
+                }
+            } catch (const VsagException& e) {
+                failed_ids.push_back(ids[i]);
+                logger::warn("vsag exception: {}", e.what());
+                continue;
+            }
+            label_table.Insert(element_count, ids[i]);
+            ++element_count;
+        }
+    }
+
+    QuantizationParams quantization_params;
+    if (min_val > max_val) {
+        min_val = 0.0F;
+        max_val = 0.0F;
+    }
+    quantization_params.min_val = min_val;
+    quantization_params.max_val = max_val;
+    quantization_params.diff = max_val - min_val;
+    if (quantization_params.diff < 1e-6F) {
+        quantization_params.diff = 1.0F;
+    }
+
+    StreamWriter::WriteObj(writer, element_count);
+    if (sparse_value_quant_type_ == SparseValueQuantizationType::SQ8) {
+        StreamWriter::WriteObj(writer, quantization_params.min_val);
+        StreamWriter::WriteObj(writer, quantization_params.max_val);
+        StreamWriter::WriteObj(writer, quantization_params.diff);
+    }
+    const auto term_dict_count =
+        remap_term_ids_ ? term_id_mapper->Size() : layout.GetTermDictCount();
+    layout.Write(writer, term_dict_count, &quantization_params);
+    label_table.Serialize(writer);
+    if (remap_term_ids_) {
+        term_id_mapper->Serialize(writer);
+    }
+    this->write_footer(writer);
+    return failed_ids;
+}
+
 bool
 SINDIV2::UpdateVector(int64_t id, const DatasetPtr& new_base, bool force_update) {
     throw VsagException(ErrorType::UNSUPPORTED_INDEX_OPERATION,
@@ -750,6 +871,47 @@ SINDIV2::KnnSearch(const DatasetPtr& query,
                    const std::string& parameters,
                    const FilterPtr& filter,
                    vsag::Allocator* allocator) const {
+    return knn_search(query, k, parameters, filter, allocator, nullptr);
+}
+
+DatasetPtr
+SINDIV2::RangeSearch(const DatasetPtr& query,
+                     float radius,
+                     const std::string& parameters,
+                     const FilterPtr& filter,
+                     int64_t limited_size) const {
+    return range_search(query, radius, parameters, filter, limited_size, nullptr);
+}
+
+DatasetPtr
+SINDIV2::SearchWithRequest(const SearchRequest& request) const {
+    CHECK_ARGUMENT(request.query_ != nullptr, "query should not be null");
+    CHECK_ARGUMENT(not request.enable_attribute_filter_,
+                   "SINDI_V2 does not support attribute filter");
+    const auto filter = request.enable_filter_ ? request.filter_ : nullptr;
+    if (request.mode_ == SearchMode::RANGE_SEARCH) {
+        return range_search(request.query_,
+                            request.radius_,
+                            request.params_str_,
+                            filter,
+                            request.limited_size_,
+                            &request);
+    }
+    return knn_search(request.query_,
+                      request.topk_,
+                      request.params_str_,
+                      filter,
+                      request.search_allocator_,
+                      &request);
+}
+
+DatasetPtr
+SINDIV2::knn_search(const DatasetPtr& query,
+                    int64_t k,
+                    const std::string& parameters,
+                    const FilterPtr& filter,
+                    Allocator* allocator,
+                    const SearchRequest* request) const {
     std::shared_lock rlock(this->global_mutex_);
     auto* search_allocator = allocator != nullptr ? allocator : allocator_;
 
@@ -781,6 +943,8 @@ SINDIV2::KnnSearch(const DatasetPtr& query,
                                      ? static_cast<uint64_t>(max_candidate_count)
                                      : static_cast<uint64_t>(search_param.n_candidate);
     InnerSearchParam inner_param;
+    inner_param.block_max_pruning_ratio =
+        search_param.block_max_pruning ? search_param.block_max_pruning_ratio : 0.0F;
     inner_param.ef = std::max(candidate_count, static_cast<uint64_t>(k));
     inner_param.topk = k;
 
@@ -808,13 +972,15 @@ SINDIV2::KnnSearch(const DatasetPtr& query,
     const bool use_term_lists_heap_insert =
         effective_query.len_ != 0 && UseTermListsHeapInsert(search_param);
 
+    const auto deadline = SearchDeadline::Make(search_param.timeout_ms, request);
     auto result = search_impl<KNN_SEARCH>(computer,
                                           inner_param,
                                           search_allocator,
                                           use_term_lists_heap_insert,
                                           query_context,
                                           rerank_query,
-                                          &statistics);
+                                          &statistics,
+                                          deadline.get());
     result->Statistics(statistics.Dump());
     return result;
 }
@@ -827,7 +993,8 @@ SINDIV2::search_impl(const SparseTermComputerPtr& computer,
                      bool use_term_lists_heap_insert,
                      SindiQueryContext& query_context,
                      const SparseVector* original_query,
-                     SearchStatistics* statistics) const {
+                     SearchStatistics* statistics,
+                     const SearchDeadline* deadline) const {
     MaxHeap heap(allocator);
     int64_t k = 0;
 
@@ -840,7 +1007,34 @@ SINDIV2::search_impl(const SparseTermComputerPtr& computer,
     const auto [min_window_id, max_window_id] = this->get_min_max_window_id(filter);
     const bool has_effective_query_terms = not computer->sorted_query_.empty();
 
-    for (auto cur = min_window_id; cur <= max_window_id; cur++) {
+    QueryContext stop_ctx{.stats = statistics, .deadline = deadline};
+    bool stopped = false;
+    // block-max pruning visits windows by ascending distance lower bound and stops at the first
+    // one that cannot add a result
+    const bool block_max_pruning =
+        inner_param.block_max_pruning_ratio > 0.0F and has_effective_query_terms;
+    Vector<std::pair<float, uint32_t>> window_order(allocator);
+    if (block_max_pruning) {
+        window_order = sindi_datacell_utils::OrderWindowsByLowerBound(
+            *term_datacell_, min_window_id, max_window_id, computer, query_context, allocator);
+    }
+    const auto visit_count = block_max_pruning ? static_cast<int64_t>(window_order.size())
+                                               : max_window_id - min_window_id + 1;
+    for (int64_t visit = 0; visit < visit_count; ++visit) {
+        if (stop_ctx.ShouldStop()) {
+            stopped = true;
+            break;
+        }
+        if (block_max_pruning and sindi_datacell_utils::CanSkipWindow<mode>(
+                                      window_order[visit].first, heap, inner_param)) {
+            if (statistics != nullptr) {
+                statistics->skipped_window_count.fetch_add(
+                    static_cast<uint32_t>(visit_count - visit), std::memory_order_relaxed);
+            }
+            break;
+        }
+        const auto cur = block_max_pruning ? static_cast<int64_t>(window_order[visit].second)
+                                           : min_window_id + visit;
         auto window_start_id = static_cast<uint32_t>(cur) * window_size_;
         term_datacell_->QueryWindow(dists.data(),
                                     static_cast<uint32_t>(cur),
@@ -913,8 +1107,13 @@ SINDIV2::search_impl(const SparseTermComputerPtr& computer,
         }
     }
 
-    // rerank
-    if (use_reorder_) {
+    if (not stopped and use_reorder_) {
+        stop_ctx.distance_phase = DistanceEvaluationPhase::RERANK;
+        stopped = stop_ctx.ShouldStop();
+    }
+
+    // rerank, skipped by a stopped search which keeps the low precision distances
+    if (use_reorder_ and not stopped) {
         float cur_heap_top = std::numeric_limits<float>::max();
         const uint64_t candidate_size = heap.size();
         auto high_precise_heap = std::make_shared<StandardHeap<true, false>>(allocator, -1);
@@ -1001,11 +1200,12 @@ SINDIV2::search_impl(const SparseTermComputerPtr& computer,
 }
 
 DatasetPtr
-SINDIV2::RangeSearch(const DatasetPtr& query,
-                     float radius,
-                     const std::string& parameters,
-                     const FilterPtr& filter,
-                     int64_t limited_size) const {
+SINDIV2::range_search(const DatasetPtr& query,
+                      float radius,
+                      const std::string& parameters,
+                      const FilterPtr& filter,
+                      int64_t limited_size,
+                      const SearchRequest* request) const {
     std::shared_lock rlock(this->global_mutex_);
     CHECK_ARGUMENT(query->GetNumElements() == 1, "num of query should be 1");
     auto sparse_query = query->GetSparseVectors()[0];
@@ -1024,6 +1224,8 @@ SINDIV2::RangeSearch(const DatasetPtr& query,
         limited_size >= -1 && limited_size <= std::numeric_limits<int>::max(),
         "SINDI_V2 range limit must be -1 or fit in int range");
     InnerSearchParam inner_param;
+    inner_param.block_max_pruning_ratio =
+        search_param.block_max_pruning ? search_param.block_max_pruning_ratio : 0.0F;
     inner_param.radius = radius;
     inner_param.range_search_limit_size = static_cast<int>(limited_size);
     if (filter != nullptr) {
@@ -1044,6 +1246,7 @@ SINDIV2::RangeSearch(const DatasetPtr& query,
         term_datacell_->LoadQueryTermBuffers(query_term_ids, allocator_);
     const SparseVector* rerank_query =
         remap_term_ids_ && use_reorder_ ? &query->GetSparseVectors()[0] : nullptr;
+    const auto deadline = SearchDeadline::Make(search_param.timeout_ms, request);
     auto result =
         search_impl<RANGE_SEARCH>(computer,
                                   inner_param,
@@ -1051,7 +1254,8 @@ SINDIV2::RangeSearch(const DatasetPtr& query,
                                   sparse_query.len_ != 0 && UseTermListsHeapInsert(search_param),
                                   query_context,
                                   rerank_query,
-                                  &statistics);
+                                  &statistics,
+                                  deadline.get());
     result->Statistics(statistics.Dump());
     return result;
 }
@@ -1135,7 +1339,11 @@ SINDIV2::Serialize(StreamWriter& writer) const {
         term_id_mapper_->Serialize(writer);
     }
 
-    // Footer
+    this->write_footer(writer);
+}
+
+void
+SINDIV2::write_footer(StreamWriter& writer) const {
     JsonType jsonify_basic_info;
     auto metadata = std::make_shared<Metadata>();
     jsonify_basic_info[INDEX_PARAM].SetString(this->create_param_ptr_->ToString());
@@ -1283,6 +1491,7 @@ SINDIV2::Deserialize(StreamReader& reader) {
                                                                           param_->term_io_parameter,
                                                                           common_param_);
         disk_datacell->DeserializeTermLayout(reader, window_count, cur_element_count_);
+        disk_datacell->SetHotTermCacheSize(param_->term_hot_cache_size);
         term_datacell_ = std::move(disk_datacell);
     }
 
@@ -1627,28 +1836,30 @@ SINDIV2::remap_sparse_vector_for_query(const SparseVector& input,
 }
 
 SparseVector
-SINDIV2::remap_sparse_vector_for_build(const SparseVector& input, Vector<uint32_t>& tmp_ids) {
+SINDIV2::remap_sparse_vector_for_build(const SparseVector& input,
+                                       Vector<uint32_t>& tmp_ids,
+                                       TermIdMapper& term_id_mapper) const {
     tmp_ids.clear();
     tmp_ids.reserve(input.len_);
     for (uint32_t index = 0; index < input.len_; ++index) {
-        if (not term_id_mapper_->TryMap(input.ids_[index]).has_value()) {
+        if (not term_id_mapper.TryMap(input.ids_[index]).has_value()) {
             tmp_ids.push_back(input.ids_[index]);
         }
     }
     std::sort(tmp_ids.begin(), tmp_ids.end());
     tmp_ids.erase(std::unique(tmp_ids.begin(), tmp_ids.end()), tmp_ids.end());
     CHECK_ARGUMENT(  // NOLINT(readability-simplify-boolean-expr)
-        term_id_mapper_->Size() <= term_id_limit_ &&
-            tmp_ids.size() <= static_cast<uint64_t>(term_id_limit_ - term_id_mapper_->Size()),
+        term_id_mapper.Size() <= term_id_limit_ &&
+            tmp_ids.size() <= static_cast<uint64_t>(term_id_limit_ - term_id_mapper.Size()),
         fmt::format("term id mapper is full: mapper size ({}) + new terms ({}) exceeds "
                     "term_id_limit ({})",
-                    term_id_mapper_->Size(),
+                    term_id_mapper.Size(),
                     tmp_ids.size(),
                     term_id_limit_));
 
     tmp_ids.resize(input.len_);
     for (uint32_t i = 0; i < input.len_; ++i) {
-        tmp_ids[i] = term_id_mapper_->Map(input.ids_[i]);
+        tmp_ids[i] = term_id_mapper.Map(input.ids_[i]);
     }
     SparseVector remapped;
     remapped.len_ = input.len_;
@@ -15,10 +15,13 @@
 
 #pragma once
 
+#include <functional>
+
 #include "algorithm/inner_index_interface.h"
 #include "algorithm/sindi/term_id_mapper.h"
 #include "algorithm/sindi_v2/sindi_v2_parameter.h"
 #include "datacell/disk_sindi_term_datacell.h"
+#include "datacell/external_sindi_term_layout_builder.h"
 #include "datacell/flatten_interface.h"
 #include "datacell/immutable_sindi_term_datacell.h"
 #include "datacell/mutable_sindi_term_datacell.h"
@@ -27,6 +30,9 @@
 
 namespace vsag {
 
+/// Returns the next chunk of a streaming build, nullptr or an empty dataset ends the stream.
+using SparseChunkReader = std::function<DatasetPtr()>;
+
 class SINDIV2 : public InnerIndexInterface {
 public:
     static ParamPtr
@@ -60,6 +66,21 @@ public:
     std::vector<int64_t>
     Build(const DatasetPtr& base) override;
 
+    /**
+     * @brief External-memory build of a corpus that does not fit in memory.
+     *
+     * Pulls documents chunk by chunk from @p reader, spills their postings as term-sorted runs
+     * under @p options.temp_dir and merges them into the serialized index written to @p writer.
+     * The in-memory index is left untouched; load the result with a disk term_io to search it.
+     * use_reorder and extra infos are not supported.
+     *
+     * @return labels of the documents that were skipped, as Build reports them.
+     */
+    std::vector<int64_t>
+    BuildStreaming(const SparseChunkReader& reader,
+                   StreamWriter& writer,
+                   const ExternalSindiTermLayoutOptions& options = {}) const;
+
     bool
     UpdateVector(int64_t id, const DatasetPtr& new_base, bool force_update = false) override;
 
@@ -83,6 +104,9 @@ public:
                 const FilterPtr& filter,
                 int64_t limited_size = -1) const override;
 
+    DatasetPtr
+    SearchWithRequest(const SearchRequest& request) const override;
+
     void
     Serialize(StreamWriter& writer) const override;
 
@@ -144,6 +168,22 @@ private:
     friend class SINDIV2TestAccess;
 #endif
 
+    DatasetPtr
+    knn_search(const DatasetPtr& query,
+               int64_t k,
+               const std::string& parameters,
+               const FilterPtr& filter,
+               Allocator* allocator,
+               const SearchRequest* request) const;
+
+    DatasetPtr
+    range_search(const DatasetPtr& query,
+                 float radius,
+                 const std::string& parameters,
+                 const FilterPtr& filter,
+                 int64_t limited_size,
+                 const SearchRequest* request) const;
+
     template <InnerSearchMode mode>
     DatasetPtr
     search_impl(const SparseTermComputerPtr& computer,
@@ -152,7 +192,8 @@ private:
                 bool use_term_lists_heap_insert,
                 SindiQueryContext& query_context,
                 const SparseVector* original_query = nullptr,
-                SearchStatistics* statistics = nullptr) const;
+                SearchStatistics* statistics = nullptr,
+                const SearchDeadline* deadline = nullptr) const;
 
     bool
     UseTermListsHeapInsert(const SINDIV2SearchParameter& search_param) const;
@@ -173,7 +214,9 @@ private:
     init_quantization_params_from_pruned_vectors(const DatasetPtr& base);
 
     SparseVector
-    remap_sparse_vector_for_build(const SparseVector& input, Vector<uint32_t>& tmp_ids);
+    remap_sparse_vector_for_build(const SparseVector& input,
+                                  Vector<uint32_t>& tmp_ids,
+                                  TermIdMapper& term_id_mapper) const;
 
     SparseVector
     remap_sparse_vector_for_query(const SparseVector& input,
@@ -192,6 +235,9 @@ private:
     void
     serialize_term_layout(StreamWriter& writer) const;
 
+    void
+    write_footer(StreamWriter& writer) const;
+
 private:
     mutable std::shared_mutex global_mutex_;
 
@@ -244,6 +244,15 @@ SINDIV2Parameter::FromJson(const JsonType& json) {
     CHECK_ARGUMENT(rerank_type != SPARSE_RERANK_TYPE_DMQ8 ||
                        rerank_io_parameter->GetTypeName() == IO_TYPE_VALUE_BLOCK_MEMORY_IO,
                    "SINDIV2 rerank_type=dmq8 only supports block_memory_io");
+
+    if (json.Contains(SPARSE_TERM_HOT_CACHE_SIZE)) {
+        CHECK_ARGUMENT(
+            json[SPARSE_TERM_HOT_CACHE_SIZE].IsNumberUnsigned(),
+            fmt::format("{} must be a non-negative integer", SPARSE_TERM_HOT_CACHE_SIZE));
+        term_hot_cache_size = json[SPARSE_TERM_HOT_CACHE_SIZE].GetUint64();
+    } else {
+        term_hot_cache_size = 0;
+    }
 }
 
 JsonType
@@ -275,6 +284,9 @@ SINDIV2Parameter::ToJson() const {
     if (rerank_io_parameter != nullptr) {
         json[SINDI_V2_RERANK_IO_KEY].SetJson(rerank_io_parameter->ToJson());
     }
+    if (term_hot_cache_size > 0) {
+        json[SPARSE_TERM_HOT_CACHE_SIZE].SetUint64(term_hot_cache_size);
+    }
     return json;
 }
 
@@ -362,6 +374,20 @@ SINDIV2SearchParameter::FromJson(const JsonType& json) {
     } else {
         n_candidate = DEFAULT_N_CANDIDATE;
     }
+    if (search_json.Contains(SEARCH_MAX_TIME_COST_MS)) {
+        timeout_ms = search_json[SEARCH_MAX_TIME_COST_MS].GetFloat();
+    }
+    block_max_pruning = DEFAULT_BLOCK_MAX_PRUNING;
+    block_max_pruning_ratio = DEFAULT_BLOCK_MAX_PRUNING_RATIO;
+    if (search_json.Contains(SPARSE_BLOCK_MAX_PRUNING)) {
+        block_max_pruning = search_json[SPARSE_BLOCK_MAX_PRUNING].GetBool();
+    }
+    if (search_json.Contains(SPARSE_BLOCK_MAX_PRUNING_RATIO)) {
+        block_max_pruning_ratio = search_json[SPARSE_BLOCK_MAX_PRUNING_RATIO].GetFloat();
+        CHECK_ARGUMENT((0.0F < block_max_pruning_ratio and block_max_pruning_ratio <= 1.0F),
+                       fmt::format("block_max_pruning_ratio must be in (0, 1], got {}",
+                                   block_max_pruning_ratio));
+    }
 
     if (search_json.Contains(LEGACY_USE_TERM_LISTS_HEAP_INSERT_KEY)) {
         logger::warn(
@@ -378,6 +404,8 @@ SINDIV2SearchParameter::ToJson() const {
     json[INDEX_SINDI_V2][SPARSE_N_CANDIDATE].SetInt(n_candidate);
     json[INDEX_SINDI_V2][SPARSE_TERM_PRUNE_RATIO].SetFloat(term_prune_ratio);
     json[INDEX_SINDI_V2][SPARSE_TERM_RETAIN_THRESHOLD].SetUint64(term_retain_threshold);
+    json[INDEX_SINDI_V2][SPARSE_BLOCK_MAX_PRUNING].SetBool(block_max_pruning);
+    json[INDEX_SINDI_V2][SPARSE_BLOCK_MAX_PRUNING_RATIO].SetFloat(block_max_pruning_ratio);
     return json;
 }
 
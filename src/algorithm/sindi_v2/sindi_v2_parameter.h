@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include <limits>
 #include <string>
 
 #include "algorithm/inner_index_parameter.h"
@@ -68,6 +69,8 @@ public:
 
     IOParamPtr term_io_parameter{nullptr};
     IOParamPtr rerank_io_parameter{nullptr};
+
+    uint64_t term_hot_cache_size{0};
 };
 
 class SINDIV2SearchParameter : public Parameter {
@@ -83,6 +86,9 @@ public:
 public:
     // search
     uint32_t n_candidate{0};
+    double timeout_ms{std::numeric_limits<double>::max()};
+    bool block_max_pruning{false};
+    float block_max_pruning_ratio{1.0F};
 
     // data cell
     float query_prune_ratio{0};
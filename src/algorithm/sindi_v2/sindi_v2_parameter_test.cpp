@@ -70,6 +70,29 @@ TEST_CASE("SINDIV2 term prune parameter validation", "[ut][SINDIV2Parameter]") {
     REQUIRE_THROWS(parse(R"({"sindi_v2": {"term_retain_threshold": 18446744073709551616}})"));
 }
 
+TEST_CASE("SINDIV2 block-max pruning parameters", "[ut][SINDIV2Parameter]") {
+    auto parse = [](const std::string& parameters) {
+        SINDIV2SearchParameter search_parameter;
+        search_parameter.FromJson(JsonType::Parse(parameters));
+        return search_parameter;
+    };
+
+    const auto defaults = parse(R"({"sindi_v2": {}})");
+    REQUIRE_FALSE(defaults.block_max_pruning);
+    REQUIRE(defaults.block_max_pruning_ratio == DEFAULT_BLOCK_MAX_PRUNING_RATIO);
+
+    const auto approximate =
+        parse(R"({"sindi_v2": {"block_max_pruning": true, "block_max_pruning_ratio": 0.8}})");
+    REQUIRE(approximate.block_max_pruning);
+    REQUIRE(approximate.block_max_pruning_ratio == 0.8F);
+    const auto roundtrip = approximate.ToJson();
+    REQUIRE(roundtrip[INDEX_SINDI_V2][SPARSE_BLOCK_MAX_PRUNING].GetBool());
+    REQUIRE(roundtrip[INDEX_SINDI_V2][SPARSE_BLOCK_MAX_PRUNING_RATIO].GetFloat() == 0.8F);
+
+    REQUIRE_THROWS(parse(R"({"sindi_v2": {"block_max_pruning_ratio": 0.0}})"));
+    REQUIRE_THROWS(parse(R"({"sindi_v2": {"block_max_pruning_ratio": 1.1}})"));
+}
+
 TEST_CASE("SINDIV2 doc prune ratio boundaries", "[ut][SINDIV2Parameter]") {
     SINDIV2Parameter param;
     REQUIRE_NOTHROW(param.FromJson(JsonType::Parse(R"({"doc_prune_ratio": 0.99})")));
@@ -340,6 +363,33 @@ TEST_CASE("SINDIV2 rerank layout uses the top terms count", "[ut][SINDIV2Paramet
     REQUIRE(param->rerank_layout == 0);
 }
 
+TEST_CASE("SINDIV2 term hot cache size parameter", "[ut][SINDIV2Parameter]") {
+    auto param_str = R"({
+        "term_id_limit": 30109,
+        "window_size": 60000,
+        "term_hot_cache_size": 1048576,
+        "term_io": {
+            "type": "reader_io"
+        }
+    })";
+
+    auto param = std::make_shared<vsag::SINDIV2Parameter>();
+    param->FromJson(vsag::JsonType::Parse(param_str));
+    REQUIRE(param->term_hot_cache_size == 1048576);
+    REQUIRE(param->ToJson()[SPARSE_TERM_HOT_CACHE_SIZE].GetUint64() == 1048576);
+
+    auto restored = std::make_shared<vsag::SINDIV2Parameter>();
+    restored->FromJson(vsag::JsonType::Parse(R"({"term_id_limit": 30109, "window_size": 60000})"));
+    REQUIRE(restored->term_hot_cache_size == 0);
+    REQUIRE(param->CheckCompatibility(restored));
+
+    auto negative = vsag::JsonType::Parse(param_str);
+    negative[SPARSE_TERM_HOT_CACHE_SIZE].SetInt(-1);
+    REQUIRE_THROWS_WITH(
+        param->FromJson(negative),
+        Catch::Matchers::ContainsSubstring("term_hot_cache_size must be a non-negative integer"));
+}
+
 TEST_CASE("SINDIV2 DMQ parameter validation and compatibility", "[ut][SINDIV2Parameter]") {
     const auto dmq_json = JsonType::Parse(R"({
         "term_id_limit": 30109,
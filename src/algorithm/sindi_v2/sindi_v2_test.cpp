@@ -26,8 +26,10 @@
 #include <cstring>
 #include <limits>
 #include <numeric>
+#include <random>
 #include <set>
 #include <sstream>
+#include <vector>
 
 #include "datacell/extra_info_datacell_parameter.h"
 #include "impl/allocator/safe_allocator.h"
@@ -398,6 +400,62 @@ TEST_CASE("SINDIV2 Batch Rerank End-To-End", "[ut][SINDIV2]") {
     index.reset();
 }
 
+TEST_CASE("SINDIV2 SearchWithRequest stops on a cancelled token", "[ut][SINDIV2]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    IndexCommonParam common_param;
+    common_param.allocator_ = allocator;
+    common_param.metric_ = MetricType::METRIC_TYPE_IP;
+
+    const uint32_t num_base = 200;
+    const int64_t max_dim = 64;
+    const uint32_t term_id_limit = 1000;
+    const int64_t k = 10;
+    common_param.dim_ = max_dim;
+
+    std::vector<int64_t> ids(num_base);
+    std::iota(ids.begin(), ids.end(), 0);
+    auto sv_base = fixtures::GenerateSparseVectors(
+        num_base, max_dim, /*max_id=*/term_id_limit - 1, 0.1F, 1.0F);
+    auto base = Dataset::Make();
+    base->NumElements(num_base)->SparseVectors(sv_base.data())->Ids(ids.data())->Owner(false);
+
+    fixtures::TempDir dir("sindi_v2_cancelled_request");
+    const std::string term_path = dir.GenerateRandomFile(false);
+    auto index = std::make_unique<SINDIV2>(create_sindi_v2_param(term_id_limit, term_path),
+                                           common_param);
+    REQUIRE(index->Build(base).empty());
+
+    auto query = Dataset::Make();
+    query->NumElements(1)->SparseVectors(sv_base.data())->Owner(false);
+    SearchRequest request;
+    request.query_ = query;
+    request.topk_ = k;
+    request.params_str_ = R"({"sindi_v2": {"n_candidate": 100}})";
+    request.cancellation_token_ = std::make_shared<CancellationToken>();
+
+    auto result = index->SearchWithRequest(request);
+    REQUIRE(result->GetDim() == k);
+    REQUIRE(result->GetIds()[0] == 0);
+    REQUIRE_FALSE(JsonType::Parse(result->GetStatistics())["is_cancelled"].GetBool());
+
+    request.cancellation_token_->Cancel();
+    for (auto mode : {SearchMode::KNN_SEARCH, SearchMode::RANGE_SEARCH}) {
+        request.mode_ = mode;
+        request.radius_ = 100.0F;
+        result = index->SearchWithRequest(request);
+        auto statistics = JsonType::Parse(result->GetStatistics());
+        REQUIRE(statistics["is_cancelled"].GetBool());
+        REQUIRE(statistics["is_partial"].GetBool());
+        REQUIRE(result->GetDim() < k);
+    }
+
+    for (auto& item : sv_base) {
+        delete[] item.vals_;
+        delete[] item.ids_;
+    }
+    index.reset();
+}
+
 TEST_CASE("SINDIV2 Top Terms Rerank Layout End-To-End", "[ut][SINDIV2]") {
     auto allocator = SafeAllocator::FactoryDefaultAllocator();
     IndexCommonParam common_param;
@@ -1308,3 +1366,147 @@ TEST_CASE("SINDIV2 optimized DMQ and batch distance end-to-end", "[ut][SINDIV2]"
         }
     }
 }
+
+TEST_CASE("SINDIV2 streaming build matches in-memory build", "[ut][SINDIV2]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    IndexCommonParam common_param;
+    common_param.allocator_ = allocator;
+    common_param.metric_ = MetricType::METRIC_TYPE_IP;
+
+    constexpr int64_t document_count = 21000;
+    constexpr int64_t chunk_size = 997;
+    std::mt19937 rng(47);
+    std::uniform_int_distribution<uint32_t> term_dist(0, 199);
+    std::uniform_int_distribution<uint32_t> value_dist(1, 64);
+    std::vector<std::vector<uint32_t>> term_ids(document_count);
+    std::vector<std::vector<float>> term_values(document_count);
+    std::vector<SparseVector> vectors(document_count);
+    std::vector<int64_t> labels(document_count);
+    for (int64_t i = 0; i < document_count; ++i) {
+        std::set<uint32_t> terms;
+        while (terms.size() < 8) {
+            terms.insert(term_dist(rng));
+        }
+        for (auto term : terms) {
+            term_ids[i].push_back(term * 3);
+            term_values[i].push_back(static_cast<float>(value_dist(rng)) / 64.0F);
+        }
+        vectors[i] = {static_cast<uint32_t>(term_ids[i].size()),
+                      term_ids[i].data(),
+                      term_values[i].data()};
+        labels[i] = 1000 + i;
+    }
+    // a duplicate label and an empty document are reported as failed by both builds
+    labels[120] = labels[7];
+    vectors[300].len_ = 0;
+    auto base = Dataset::Make();
+    base->NumElements(document_count)->SparseVectors(vectors.data())->Ids(labels.data());
+    base->Owner(false);
+
+    fixtures::TempDir temp_dir("vsag_sindi_v2_streaming_build");
+    ExternalSindiTermLayoutOptions options;
+    options.temp_dir = temp_dir.path;
+    options.run_memory_limit = 64 * 1024;
+
+    const std::string search_param = R"({
+        "sindi_v2": {
+            "query_prune_ratio": 0.0,
+            "term_prune_ratio": 0.0,
+            "n_candidate": 20
+        }
+    })";
+
+    struct TestConfig {
+        const char* name;
+        const char* quantization;
+        bool immutable;
+        bool remap_term_ids;
+        float doc_prune_ratio;
+    };
+    const TestConfig configs[] = {{"mutable-fp32", "false", false, false, 0.0F},
+                                  {"immutable-fp16", R"("fp16")", true, false, 0.2F},
+                                  {"remap-sq8", "true", false, true, 0.1F}};
+    for (const auto& config : configs) {
+        DYNAMIC_SECTION(config.name) {
+            const auto param_json = fmt::format(R"({{
+                "term_id_limit": 1000,
+                "window_size": 10000,
+                "doc_prune_ratio": {},
+                "use_quantization": {},
+                "use_reorder": false,
+                "immutable": {},
+                "remap_term_ids": {},
+                "term_io": {{"type": "memory_io"}}
+            }})",
+                                                config.doc_prune_ratio,
+                                                config.quantization,
+                                                config.immutable,
+                                                config.remap_term_ids);
+            auto parameter = std::make_shared<SINDIV2Parameter>();
+            parameter->FromJson(JsonType::Parse(param_json));
+
+            SINDIV2 built(parameter, common_param);
+            const auto build_failed = built.Build(base);
+            std::stringstream built_stream;
+            IOStreamWriter built_writer(built_stream);
+            built.Serialize(built_writer);
+
+            SINDIV2 streaming(parameter, common_param);
+            int64_t next = 0;
+            SparseChunkReader reader = [&]() -> DatasetPtr {
+                if (next >= document_count) {
+                    return nullptr;
+                }
+                const auto count = std::min(chunk_size, document_count - next);
+                auto chunk = Dataset::Make();
+                chunk->NumElements(count)
+                    ->SparseVectors(vectors.data() + next)
+                    ->Ids(labels.data() + next)
+                    ->Owner(false);
+                next += count;
+                return chunk;
+            };
+            std::stringstream streamed_stream;
+            IOStreamWriter streamed_writer(streamed_stream);
+            const auto streamed_failed =
+                streaming.BuildStreaming(reader, streamed_writer, options);
+            REQUIRE(streamed_failed == build_failed);
+            REQUIRE(streamed_failed.size() == 2);
+            REQUIRE(streaming.GetNumElements() == 0);
+            REQUIRE(streamed_stream.str() == built_stream.str());
+
+            auto disk_parameter_json = parameter->ToJson();
+            disk_parameter_json["term_io"].SetJson(JsonType::Parse(R"({"type":"reader_io"})"));
+            auto disk_parameter = std::make_shared<SINDIV2Parameter>();
+            disk_parameter->FromJson(disk_parameter_json);
+            SINDIV2 disk_loaded(disk_parameter, common_param);
+            streamed_stream.seekg(0, std::ios::beg);
+            disk_loaded.Deserialize(streamed_stream);
+            REQUIRE(disk_loaded.GetNumElements() == built.GetNumElements());
+            for (int64_t i = 0; i < document_count; i += 2000) {
+                auto query = Dataset::Make();
+                query->NumElements(1)->SparseVectors(vectors.data() + i)->Owner(false);
+                auto expected = built.KnnSearch(query, 10, search_param, nullptr);
+                auto result = disk_loaded.KnnSearch(query, 10, search_param, nullptr);
+                REQUIRE(result->GetDim() == expected->GetDim());
+                for (int64_t j = 0; j < expected->GetDim(); ++j) {
+                    REQUIRE(result->GetIds()[j] == expected->GetIds()[j]);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("SINDIV2 streaming build rejects unsupported configurations", "[ut][SINDIV2]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    IndexCommonParam common_param;
+    common_param.allocator_ = allocator;
+    common_param.metric_ = MetricType::METRIC_TYPE_IP;
+    auto parameter = create_sindi_v2_param(100, "", "memory_io");
+    SINDIV2 index(parameter, common_param);
+    std::stringstream stream;
+    IOStreamWriter writer(stream);
+    REQUIRE_THROWS_WITH(
+        index.BuildStreaming([]() -> DatasetPtr { return nullptr; }, writer),
+        Catch::Matchers::ContainsSubstring("streaming build does not support use_reorder"));
+}
@@ -68,6 +68,8 @@ static constexpr const float DEFAULT_DOC_PRUNE_RATIO = 0.0F;
 static constexpr const float DEFAULT_TERM_PRUNE_RATIO = 0.0F;
 static constexpr const uint64_t DEFAULT_TERM_RETAIN_THRESHOLD = 0;
 static constexpr const uint64_t DEFAULT_FILTER_CALLBACK_LIMIT = 0;
+static constexpr const bool DEFAULT_BLOCK_MAX_PRUNING = false;
+static constexpr const float DEFAULT_BLOCK_MAX_PRUNING_RATIO = 1.0F;
 static constexpr const uint32_t DEFAULT_N_CANDIDATE = 0;
 static constexpr const uint32_t DEFAULT_AVG_DOC_TERM_LENGTH = 100;
 static constexpr const uint32_t INVALID_ENTRY_POINT = std::numeric_limits<uint32_t>::max();
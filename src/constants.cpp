@@ -72,6 +72,7 @@ const char* const REPR_DENSE = "dense";
 const char* const REPR_SPARSE = "sparse";
 const char* const REPR_MULTI_VECTOR = "multi_vector";
 const char* const PARAMETER_USE_OLD_SERIAL_FORMAT = "use_old_serial_format";
+const char* const PARAMETER_MEMORY_LIMIT = "memory_limit";
 
 const char* const ODESCENT_PARAMETER_ALPHA = "alpha";
 const char* const ODESCENT_PARAMETER_GRAPH_ITER_TURN = "graph_iter_turn";
@@ -167,6 +168,7 @@ const char* const HGRAPH_PRECISE_FILE_PATH = "precise_file_path";
 const char* const HGRAPH_PRECISE_DIRECT_READ = "precise_direct_read";
 const char* const HGRAPH_PARAMETER_EF_RUNTIME = "ef_search";
 const char* const HGRAPH_PARAMETER_HOPS_LIMIT = "hops_limit";
+const char* const HGRAPH_PARAMETER_EARLY_STOP_PATIENCE = "early_stop_patience";
 const char* const HGRAPH_PARAMETER_RABITQ_ONE_BIT_SEARCH = "rabitq_one_bit_search";
 const char* const HGRAPH_PARAMETER_BRUTE_FORCE_THRESHOLD = "brute_force_threshold";
 const char* const HGRAPH_PARAMETER_SKIP_RATIO = "skip_ratio";
@@ -190,6 +192,18 @@ const char* const STORE_RAW_VECTOR = "store_raw_vector";
 const char* const RAW_VECTOR_IO_TYPE = "raw_vector_io_type";
 const char* const RAW_VECTOR_FILE_PATH = "raw_vector_file_path";
 const char* const HGRAPH_PERSIST_SOURCE_ID = "persist_source_id";
+const char* const HGRAPH_MERGE_MODE = "merge_mode";
+const char* const HGRAPH_MERGE_MODE_REBUILD = "rebuild";
+const char* const HGRAPH_MERGE_MODE_INCREMENTAL = "incremental";
+const char* const HGRAPH_NUMA_REPLICAS = "numa_replicas";
+const char* const HGRAPH_PARTITION_BUILD_COUNT = "partition_build_count";
+const char* const HGRAPH_PARTITION_BUILD_MEMORY_BUDGET = "partition_build_memory_budget";
+const char* const HGRAPH_BASE_IO_NUMA_INTERLEAVE = "base_io_numa_interleave";
+const char* const HGRAPH_GRAPH_IO_NUMA_INTERLEAVE = "graph_io_numa_interleave";
+const char* const HGRAPH_BASE_IO_HUGE_PAGE = "base_io_huge_page";
+const char* const HGRAPH_PRECISE_IO_HUGE_PAGE = "precise_io_huge_page";
+const char* const HGRAPH_PRECISE_HOT_CODES_SIZE = "precise_hot_codes_size";
+const char* const HGRAPH_GRAPH_IO_HUGE_PAGE = "graph_io_huge_page";
 const char* const PYRAMID_PERSIST_SOURCE_ID = HGRAPH_PERSIST_SOURCE_ID;
 
 const char* const BRUTE_FORCE_BASE_QUANTIZATION_TYPE = "base_quantization_type";
@@ -201,10 +215,13 @@ const char* const BRUTE_FORCE_PRECISE_IO_TYPE = "precise_io_type";
 const char* const BRUTE_FORCE_PRECISE_FILE_PATH = "precise_file_path";
 const char* const BRUTE_FORCE_THREAD_COUNT = "thread_count";
 const char* const BRUTE_FORCE_USE_RESIDUAL = "use_residual";
+const char* const WARP_RESIDUAL_CENTROIDS = "residual_centroids";
 
 const char* const IVF_USE_RESIDUAL = "use_residual";
 const char* const IVF_USE_REORDER = "use_reorder";
 const char* const IVF_TRAIN_TYPE = "ivf_train_type";
+const char* const IVF_KMEANS_ALGORITHM = "kmeans_algorithm";
+const char* const IVF_KMEANS_MINI_BATCH_SIZE = "kmeans_mini_batch_size";
 const char* const IVF_BUCKETS_COUNT = "buckets_count";
 const char* const IVF_BASE_QUANTIZATION_TYPE = "base_quantization_type";
 const char* const IVF_BASE_IO_TYPE = "base_io_type";
@@ -261,6 +278,9 @@ const char* const IVF_PRECISE_FILE_PATH = "precise_file_path";
 const char* const IVF_PRECISE_CODES_LAYOUT = "precise_codes_layout";
 const char* const IVF_PRECISE_CODES_LAYOUT_FLAT = "flat";
 const char* const IVF_PRECISE_CODES_LAYOUT_BUCKET = "bucket";
+const char* const IVF_PRECISE_HOT_CODES_SIZE = "precise_hot_codes_size";
+const char* const IVF_REBALANCE_SPLIT_RATIO = "rebalance_split_ratio";
+const char* const IVF_REBALANCE_MERGE_RATIO = "rebalance_merge_ratio";
 const char* const USE_ATTRIBUTE_FILTER = "use_attribute_filter";
 const char* const IVF_THREAD_COUNT = "thread_count";
 
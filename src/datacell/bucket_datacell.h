@@ -117,6 +117,15 @@ public:
                            InnerIdType inner_id,
                            InnerIdType offset_id) override;
 
+    void
+    RewriteBucket(BucketIdType bucket_id,
+                  const float* vectors,
+                  const InnerIdType* inner_ids,
+                  InnerIdType count) override;
+
+    bool
+    DecodeById(BucketIdType bucket_id, InnerIdType offset_id, float* vector) override;
+
     InnerIdType*
     GetInnerIds(BucketIdType bucket_id) override {
         check_valid_bucket_id(bucket_id);
@@ -888,6 +897,68 @@ BucketDataCell<QuantTmpl, IOTmpl>::InsertVectorWithOffset(const void* vector,
     }
 }
 
+template <typename QuantTmpl, typename IOTmpl>
+void
+BucketDataCell<QuantTmpl, IOTmpl>::RewriteBucket(BucketIdType bucket_id,
+                                                 const float* vectors,
+                                                 const InnerIdType* inner_ids,
+                                                 InnerIdType count) {
+    check_valid_bucket_id(bucket_id);
+    if (count > 0 and (vectors == nullptr or inner_ids == nullptr)) {
+        throw VsagException(ErrorType::INVALID_ARGUMENT,
+                            "bucket rewrite requires non-null vectors and inner ids");
+    }
+    check_valid_bucket_capacity(count, true);
+    const bool has_bias = use_residual_ and metric_ == MetricType::METRIC_TYPE_L2SQR;
+    // encode outside the lock, searches keep scanning the old content meanwhile
+    Vector<uint8_t> codes(static_cast<uint64_t>(count) * code_size_, this->allocator_);
+    Vector<float> residual_scores(has_bias ? count : 0, this->allocator_);
+    for (InnerIdType i = 0; i < count; ++i) {
+        if (inner_ids[i] == EMPTY_INNER_ID) {
+            throw VsagException(ErrorType::INVALID_ARGUMENT, "invalid inner id for bucket");
+        }
+        float residual_score = 0.0F;
+        encode_vector(vectors + static_cast<uint64_t>(i) * input_dim_,
+                      bucket_id,
+                      codes.data() + static_cast<uint64_t>(i) * code_size_,
+                      residual_score);
+        if (has_bias) {
+            residual_scores[i] = residual_score;
+        }
+    }
+
+    std::unique_lock lock(this->bucket_mutexes_[bucket_id]);
+    if (count > 0) {
+        this->datas_[bucket_id].Write(codes.data(), codes.size(), 0);
+    }
+    this->inner_ids_[bucket_id].assign(inner_ids, inner_ids + count);
+    if (has_bias) {
+        this->residual_bias_[bucket_id].assign(residual_scores.begin(), residual_scores.end());
+    }
+    this->bucket_sizes_[bucket_id] = count;
+}
+
+template <typename QuantTmpl, typename IOTmpl>
+bool
+BucketDataCell<QuantTmpl, IOTmpl>::DecodeById(BucketIdType bucket_id,
+                                              InnerIdType offset_id,
+                                              float* vector) {
+    ByteBuffer codes(static_cast<uint64_t>(code_size_), this->allocator_);
+    {
+        std::shared_lock lock(this->bucket_mutexes_[bucket_id]);
+        this->GetCodesById(bucket_id, offset_id, codes.data);
+    }
+    if (not this->quantizer_->DecodeOne(codes.data, vector)) {
+        return false;
+    }
+    if (use_residual_) {
+        Vector<float> centroid(this->quantizer_->GetDim(), allocator_);
+        strategy_->GetCentroid(bucket_id, centroid);
+        FP32Add(vector, centroid.data(), vector, this->quantizer_->GetDim());
+    }
+    return true;
+}
+
 template <typename QuantTmpl, typename IOTmpl>
 void
 BucketDataCell<QuantTmpl, IOTmpl>::Serialize(StreamWriter& writer) {
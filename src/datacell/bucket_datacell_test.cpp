@@ -1449,3 +1449,61 @@ TEST_CASE("BucketDataCell InsertVectorWithOffset", "[ut][BucketDataCell]") {
         REQUIRE(dst->GetInnerIds(bucket_id)[2] == 25);
     }
 }
+
+TEST_CASE("BucketDataCell rewrites one bucket in place", "[ut][BucketDataCell]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    constexpr int64_t dim = 8;
+    constexpr uint64_t bucket_count = 2;
+    constexpr uint64_t base_count = 8;
+    auto vectors = fixtures::generate_vectors(base_count, dim);
+    auto queries = fixtures::generate_vectors(1, dim, 43);
+    auto use_residual = GENERATE(false, true);
+
+    auto param = std::make_shared<BucketDataCellParameter>();
+    param->FromJson(JsonType::Parse(fmt::format(R"({{
+        "io_params": {{
+            "type": "memory_io"
+        }},
+        "quantization_params": {{
+            "type": "fp32"
+        }},
+        "buckets_count": 2,
+        "use_residual": {}
+    }})",
+                                                use_residual)));
+    IndexCommonParam common_param;
+    common_param.allocator_ = allocator;
+    common_param.dim_ = dim;
+    common_param.metric_ = MetricType::METRIC_TYPE_L2SQR;
+    auto bucket = BucketInterface::MakeInstance(param, common_param);
+    bucket->SetStrategy(std::make_shared<FixedCentroidPartitionStrategy>(common_param, bucket_count));
+    bucket->Train(vectors.data(), base_count);
+    for (uint64_t i = 0; i < base_count; ++i) {
+        bucket->InsertVector(vectors.data() + i * dim,
+                             static_cast<BucketIdType>(i % bucket_count),
+                             static_cast<InnerIdType>(i));
+    }
+
+    std::vector<InnerIdType> inner_ids{15, 16, 17};
+    bucket->RewriteBucket(0, vectors.data() + 5 * dim, inner_ids.data(), 3);
+    REQUIRE(bucket->GetBucketSize(0) == 3);
+    REQUIRE(bucket->GetBucketSize(1) == 4);
+    auto computer = bucket->FactoryComputer(queries.data());
+    std::vector<float> decoded(dim);
+    for (InnerIdType offset = 0; offset < 3; ++offset) {
+        const auto* expected = vectors.data() + (5 + offset) * dim;
+        REQUIRE(bucket->GetInnerIds(0)[offset] == inner_ids[offset]);
+        REQUIRE(bucket->DecodeById(0, offset, decoded.data()));
+        for (int64_t d = 0; d < dim; ++d) {
+            REQUIRE(std::abs(decoded[d] - expected[d]) < 1e-5F);
+        }
+        auto dist = bucket->QueryOneById(computer, 0, offset);
+        REQUIRE(std::abs(dist - FP32ComputeL2Sqr(queries.data(), expected, dim)) < 1e-4F);
+    }
+    REQUIRE(bucket->GetInnerIds(1)[3] == 7);
+
+    bucket->RewriteBucket(0, nullptr, nullptr, 0);
+    REQUIRE(bucket->GetBucketSize(0) == 0);
+    REQUIRE_THROWS(bucket->RewriteBucket(0, nullptr, inner_ids.data(), 3));
+    REQUIRE_THROWS(bucket->RewriteBucket(bucket_count, nullptr, nullptr, 0));
+}
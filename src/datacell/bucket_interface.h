@@ -91,6 +91,23 @@ public:
                             "InsertVectorWithOffset not implemented");
     }
 
+    // Replaces the whole content of a bucket under its lock; offset i then holds inner_ids[i],
+    // encoded from vectors[i] against the current centroid of the bucket.
+    virtual void
+    RewriteBucket(BucketIdType bucket_id,
+                  const float* vectors,
+                  const InnerIdType* inner_ids,
+                  InnerIdType count) {
+        throw VsagException(ErrorType::UNSUPPORTED_INDEX_OPERATION,
+                            "RewriteBucket not implemented");
+    }
+
+    // Decodes one entry back to a full vector, adding the centroid back for residual codes.
+    virtual bool
+    DecodeById(BucketIdType bucket_id, InnerIdType offset_id, float* vector) {
+        throw VsagException(ErrorType::UNSUPPORTED_INDEX_OPERATION, "DecodeById not implemented");
+    }
+
     virtual InnerIdType*
     GetInnerIds(BucketIdType bucket_id) = 0;
 
@@ -71,6 +71,12 @@ MakeBucketDataCellInstance(const BucketDataCellParamPtr& param,
     if (quantization_string == QUANTIZATION_TYPE_VALUE_FP16) {
         return MakeBucketDataCellInstance<FP16Quantizer<metric>, IOTemp>(param, common_param);
     }
+    if (quantization_string == QUANTIZATION_TYPE_VALUE_FP8_E4M3) {
+        return MakeBucketDataCellInstance<FP8E4M3Quantizer<metric>, IOTemp>(param, common_param);
+    }
+    if (quantization_string == QUANTIZATION_TYPE_VALUE_FP8_E5M2) {
+        return MakeBucketDataCellInstance<FP8E5M2Quantizer<metric>, IOTemp>(param, common_param);
+    }
     if (quantization_string == QUANTIZATION_TYPE_VALUE_RABITQ) {
         return MakeBucketDataCellInstance<RaBitQuantizer<metric>, IOTemp>(param, common_param);
     }
@@ -178,6 +178,11 @@ public:
         return base_->GetMemoryUsage();
     }
 
+    uint64_t
+    GetHugePageMemoryUsage() const override {
+        return base_->GetHugePageMemoryUsage();
+    }
+
     IndexCommonParam
     ExportCommonParam() override {
         return base_->ExportCommonParam();
@@ -17,7 +17,9 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <limits>
+#include <numeric>
 #include <type_traits>
 
 #include "datacell/sindi_datacell_utils.h"
@@ -138,7 +140,10 @@ DiskSindiTermDataCell<IOTmpl>::DiskSindiTermDataCell(
       quantization_params_(std::move(quantization_params)),
       window_size_(window_size),
       io_param_(std::move(io_param)),
-      common_param_(std::move(common_param)) {
+      common_param_(std::move(common_param)),
+      hot_term_slots_(allocator),
+      hot_term_payloads_(allocator),
+      term_hits_(allocator, "disk_sindi_term_datacell", [this]() { this->RefreshHotTerms(); }) {
     CHECK_ARGUMENT(  // NOLINT(readability-simplify-boolean-expr)
         window_size_ > 0 &&
             window_size_ <= static_cast<uint32_t>(std::numeric_limits<uint16_t>::max()) + 1,
@@ -171,7 +176,11 @@ void
 DiskSindiTermDataCell<IOTmpl>::DeserializeTermLayout(StreamReader& reader,
                                                      uint32_t window_count,
                                                      uint64_t total_count) {
+    // a refresh reads io_ outside the layout lock, it must not overlap the swap below
+    this->WaitForHotTermRefresh();
+    std::lock_guard refresh_lock(hot_term_refresh_mutex_);
     std::unique_lock lock(term_layout_mutex_);
+    this->ClearHotTerms();
     window_count_ = window_count;
     total_count_ = total_count;
     term_dict_ = sindi_datacell_utils::DeserializeTermDictionary(reader, term_id_limit_);
@@ -212,7 +221,10 @@ template <typename IOTmpl>
 void
 DiskSindiTermDataCell<IOTmpl>::SetIO(const std::shared_ptr<Reader>& reader) {
     if constexpr (std::is_same_v<IOTmpl, ReaderIO>) {
+        this->WaitForHotTermRefresh();
+        std::lock_guard refresh_lock(hot_term_refresh_mutex_);
         std::unique_lock lock(term_layout_mutex_);
+        this->ClearHotTerms();
         auto reader_param = std::make_shared<ReaderIOParameter>();
         reader_param->reader = reader;
         io_param_ = reader_param;
@@ -281,26 +293,210 @@ DiskSindiTermDataCell<IOTmpl>::ValidateBoundPayloads() const {
     }
 }
 
+template <typename IOTmpl>
+void
+DiskSindiTermDataCell<IOTmpl>::SetHotTermCacheSize(uint64_t memory_limit,
+                                                   uint64_t refresh_interval) {
+    std::lock_guard refresh_lock(hot_term_refresh_mutex_);
+    if constexpr (std::is_same_v<IOTmpl, MMapIO>) {
+        memory_limit = 0;
+    }
+    hot_term_cache_size_.store(memory_limit, std::memory_order_relaxed);
+    hot_term_refresh_interval_.store(std::max<uint64_t>(refresh_interval, 1),
+                                     std::memory_order_relaxed);
+    if (memory_limit == 0) {
+        this->ClearHotTerms();
+    }
+}
+
+template <typename IOTmpl>
+void
+DiskSindiTermDataCell<IOTmpl>::ClearHotTerms() {
+    term_hits_.Clear();
+    std::unique_lock lock(hot_term_mutex_);
+    hot_term_slots_.clear();
+    hot_term_payloads_.clear();
+    hot_term_payloads_.shrink_to_fit();
+}
+
+template <typename IOTmpl>
+DiskSindiTermCacheStats
+DiskSindiTermDataCell<IOTmpl>::GetTermCacheStats() const {
+    DiskSindiTermCacheStats stats;
+    {
+        std::shared_lock lock(hot_term_mutex_);
+        stats.hot_term_count = hot_term_slots_.size();
+        stats.hot_term_memory_usage = hot_term_payloads_.size();
+    }
+    stats.hot_term_hit_count = hot_term_hit_count_.load(std::memory_order_relaxed);
+    stats.disk_term_read_count = disk_term_read_count_.load(std::memory_order_relaxed);
+    stats.disk_read_request_count = disk_read_request_count_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+template <typename IOTmpl>
+void
+DiskSindiTermDataCell<IOTmpl>::ReadTermPayloads(const Vector<TermReadPlan>& plans,
+                                                Vector<uint8_t>& payloads,
+                                                Vector<uint64_t>& plan_offsets,
+                                                Allocator* allocator) const {
+    plan_offsets.assign(plans.size(), 0);
+    if (plans.empty()) {
+        payloads.clear();
+        return;
+    }
+
+    // term payloads are laid out in term id order, so visiting the plans by file offset lets
+    // neighbouring terms share one read instead of one request per term
+    Vector<uint32_t> order(plans.size(), allocator);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&plans](uint32_t lhs, uint32_t rhs) {
+        return plans[lhs].entry.posting_payload_offset < plans[rhs].entry.posting_payload_offset;
+    });
+
+    Vector<uint64_t> sizes(allocator);
+    Vector<uint64_t> offsets(allocator);
+    uint64_t total_size = 0;
+    uint64_t extent_end = 0;
+    for (auto index : order) {
+        const auto& entry = plans[index].entry;
+        const auto begin = entry.posting_payload_offset;
+        const auto end = begin + entry.posting_payload_size;
+        if (offsets.empty() or begin > extent_end + TERM_READ_COALESCE_GAP) {
+            offsets.push_back(begin);
+            sizes.push_back(0);
+            extent_end = begin;
+        }
+        if (end > extent_end) {
+            total_size += end - extent_end;
+            sizes.back() += end - extent_end;
+            extent_end = end;
+        }
+        plan_offsets[index] = total_size - (extent_end - begin);
+    }
+
+    payloads.resize(total_size);
+    const bool read_succeeded =
+        io_->MultiRead(payloads.data(), sizes.data(), offsets.data(), offsets.size());
+    if (not read_succeeded) {
+        throw VsagException(ErrorType::INTERNAL_ERROR,
+                            "failed to batch read SINDI_V2 term payloads");
+    }
+    disk_term_read_count_.fetch_add(plans.size(), std::memory_order_relaxed);
+    disk_read_request_count_.fetch_add(offsets.size(), std::memory_order_relaxed);
+}
+
+template <typename IOTmpl>
+void
+DiskSindiTermDataCell<IOTmpl>::RecordTermHits(const Vector<TermReadPlan>& plans) const {
+    for (const auto& plan : plans) {
+        term_hits_.Count(plan.term_id);
+    }
+    term_hits_.Tick(hot_term_refresh_interval_.load(std::memory_order_relaxed));
+}
+
+template <typename IOTmpl>
+void
+DiskSindiTermDataCell<IOTmpl>::WaitForHotTermRefresh() const {
+    term_hits_.Wait();
+}
+
+template <typename IOTmpl>
+DiskSindiTermDataCell<IOTmpl>::~DiskSindiTermDataCell() {
+    // the scheduled refresh captures this
+    this->WaitForHotTermRefresh();
+}
+
+template <typename IOTmpl>
+void
+DiskSindiTermDataCell<IOTmpl>::RefreshHotTerms() const {
+    std::lock_guard refresh_lock(hot_term_refresh_mutex_);
+    const auto cache_size = hot_term_cache_size_.load(std::memory_order_relaxed);
+    if (cache_size == 0 or io_ == nullptr) {
+        return;
+    }
+
+    // the payload budget decides how many terms fit, so every counted term is ranked
+    auto ranked = term_hits_.TakeRanked(std::numeric_limits<uint64_t>::max(), allocator_);
+
+    Vector<TermReadPlan> selected(allocator_);
+    {
+        std::shared_lock lock(term_layout_mutex_);
+        uint64_t budget = cache_size;
+        for (const auto& [hit_count, term_id] : ranked) {
+            if (term_id >= term_dict_.size()) {
+                continue;
+            }
+            const auto& entry = term_dict_[term_id];
+            if (entry.posting_count == 0 or entry.posting_payload_size > budget) {
+                continue;
+            }
+            budget -= entry.posting_payload_size;
+            selected.push_back({term_id, entry});
+        }
+    }
+
+    UnorderedMap<uint32_t, std::pair<uint64_t, uint32_t>> new_slots(allocator_);
+    new_slots.reserve(selected.size());
+    Vector<uint8_t> new_payloads(allocator_);
+    Vector<TermReadPlan> missing(allocator_);
+    {
+        // terms that stay hot are copied from memory instead of being read again
+        std::shared_lock lock(hot_term_mutex_);
+        for (const auto& plan : selected) {
+            auto iter = hot_term_slots_.find(plan.term_id);
+            if (iter == hot_term_slots_.end()) {
+                missing.push_back(plan);
+                continue;
+            }
+            const auto [offset, size] = iter->second;
+            new_slots.emplace(plan.term_id, std::make_pair(new_payloads.size(), size));
+            new_payloads.insert(new_payloads.end(),
+                                hot_term_payloads_.begin() + static_cast<int64_t>(offset),
+                                hot_term_payloads_.begin() + static_cast<int64_t>(offset + size));
+        }
+    }
+    if (not missing.empty()) {
+        Vector<uint8_t> payloads(allocator_);
+        Vector<uint64_t> plan_offsets(allocator_);
+        this->ReadTermPayloads(missing, payloads, plan_offsets, allocator_);
+        for (uint64_t i = 0; i < missing.size(); ++i) {
+            const auto size = missing[i].entry.posting_payload_size;
+            new_slots.emplace(missing[i].term_id, std::make_pair(new_payloads.size(), size));
+            new_payloads.insert(new_payloads.end(),
+                                payloads.begin() + static_cast<int64_t>(plan_offsets[i]),
+                                payloads.begin() + static_cast<int64_t>(plan_offsets[i] + size));
+        }
+    }
+
+    std::unique_lock lock(hot_term_mutex_);
+    hot_term_slots_.swap(new_slots);
+    hot_term_payloads_.swap(new_payloads);
+}
+
 template <typename IOTmpl>
 QueryTermBuffers
 DiskSindiTermDataCell<IOTmpl>::LoadQueryTermBuffers(const Vector<uint32_t>& query_term_ids,
                                                     Allocator* query_allocator) const {
     auto* allocator = query_allocator == nullptr ? allocator_ : query_allocator;
+    return this->LoadTermBuffers(query_term_ids, allocator, true);
+}
+
+template <typename IOTmpl>
+QueryTermBuffers
+DiskSindiTermDataCell<IOTmpl>::LoadTermBuffers(const Vector<uint32_t>& term_ids,
+                                               Allocator* allocator,
+                                               bool record_hits) const {
     QueryTermBuffers query_term_buffers(allocator);
     if (io_ == nullptr) {
         return query_term_buffers;
     }
 
-    struct query_term_read_plan {
-        uint32_t term_id{0};
-        DiskTermEntry entry{};
-    };
-
-    Vector<query_term_read_plan> read_plans(allocator);
+    Vector<TermReadPlan> read_plans(allocator);
     UnorderedSet<uint32_t> planned_terms(allocator);
-    read_plans.reserve(query_term_ids.size());
-    planned_terms.reserve(query_term_ids.size());
-    query_term_buffers.reserve(query_term_ids.size());
+    read_plans.reserve(term_ids.size());
+    planned_terms.reserve(term_ids.size());
+    query_term_buffers.reserve(term_ids.size());
     uint32_t window_count = 0;
     uint32_t window_size = 0;
     uint64_t total_count = 0;
@@ -314,7 +510,7 @@ DiskSindiTermDataCell<IOTmpl>::LoadQueryTermBuffers(const Vector<uint32_t>& quer
         payload_size = payload_size_;
         CHECK_ARGUMENT(payloads_validated_, "SINDI_V2 term payloads have not been validated");
         sparse_value_quant_type = sparse_value_quant_type_;
-        for (uint32_t term_id : query_term_ids) {
+        for (uint32_t term_id : term_ids) {
             if (term_id >= term_dict_.size() || planned_terms.contains(term_id)) {
                 continue;
             }
@@ -328,7 +524,7 @@ DiskSindiTermDataCell<IOTmpl>::LoadQueryTermBuffers(const Vector<uint32_t>& quer
         }
     }
 
-    const auto validate_entry = [payload_size](const query_term_read_plan& plan) {
+    const auto validate_entry = [payload_size](const TermReadPlan& plan) {
         const auto& entry = plan.entry;
         const bool valid_entry =
             entry.posting_payload_offset <= payload_size &&
@@ -340,48 +536,51 @@ DiskSindiTermDataCell<IOTmpl>::LoadQueryTermBuffers(const Vector<uint32_t>& quer
     const auto value_code_size = sindi_datacell_utils::GetValueCodeSize(sparse_value_quant_type);
 
     if constexpr (not std::is_same_v<IOTmpl, MMapIO>) {
-        Vector<uint64_t> sizes(allocator);
-        Vector<uint64_t> offsets(allocator);
-        Vector<uint64_t> buffer_offsets(allocator);
-        sizes.reserve(read_plans.size());
-        offsets.reserve(read_plans.size());
-        buffer_offsets.reserve(read_plans.size());
-
-        uint64_t total_payload_size = 0;
-        for (const auto& plan : read_plans) {
-            validate_entry(plan);
-            CHECK_ARGUMENT(plan.entry.posting_payload_size <=
-                               std::numeric_limits<uint64_t>::max() - total_payload_size,
-                           "SINDI_V2 query term payload size overflow");
-            buffer_offsets.push_back(total_payload_size);
-            sizes.push_back(plan.entry.posting_payload_size);
-            offsets.push_back(plan.entry.posting_payload_offset);
-            total_payload_size += plan.entry.posting_payload_size;
-        }
-
-        if (not read_plans.empty()) {
-            Vector<uint8_t> payloads(total_payload_size, 0, allocator);
-            const bool read_succeeded =
-                io_->MultiRead(payloads.data(), sizes.data(), offsets.data(), read_plans.size());
-            if (not read_succeeded) {
-                throw VsagException(ErrorType::INTERNAL_ERROR,
-                                    "failed to batch read SINDI_V2 term payloads");
+        const auto parse_payload = [&](const TermReadPlan& plan, const uint8_t* payload) {
+            auto term_buffer =
+                sindi_datacell_utils::ParseTrustedTermPayload(payload,
+                                                              plan.entry.posting_payload_size,
+                                                              plan.entry,
+                                                              window_count,
+                                                              window_size,
+                                                              total_count,
+                                                              value_code_size,
+                                                              allocator);
+            query_term_buffers.emplace(plan.term_id, std::move(term_buffer));
+        };
+
+        // hot terms are parsed straight from memory, only the cold ones go to the IO
+        Vector<TermReadPlan> cold_plans(allocator);
+        cold_plans.reserve(read_plans.size());
+        uint64_t hot_count = 0;
+        {
+            std::shared_lock lock(hot_term_mutex_);
+            for (const auto& plan : read_plans) {
+                validate_entry(plan);
+                auto iter = hot_term_slots_.find(plan.term_id);
+                if (iter == hot_term_slots_.end()) {
+                    cold_plans.push_back(plan);
+                    continue;
+                }
+                parse_payload(plan, hot_term_payloads_.data() + iter->second.first);
+                ++hot_count;
             }
-
-            for (uint64_t i = 0; i < read_plans.size(); ++i) {
-                const auto& plan = read_plans[i];
-                auto term_buffer = sindi_datacell_utils::ParseTrustedTermPayload(
-                    payloads.data() + buffer_offsets[i],
-                    plan.entry.posting_payload_size,
-                    plan.entry,
-                    window_count,
-                    window_size,
-                    total_count,
-                    value_code_size,
-                    allocator);
-                query_term_buffers.emplace(plan.term_id, std::move(term_buffer));
+        }
+        hot_term_hit_count_.fetch_add(hot_count, std::memory_order_relaxed);
+
+        if (not cold_plans.empty()) {
+            Vector<uint8_t> payloads(allocator);
+            Vector<uint64_t> plan_offsets(allocator);
+            this->ReadTermPayloads(cold_plans, payloads, plan_offsets, allocator);
+            for (uint64_t i = 0; i < cold_plans.size(); ++i) {
+                parse_payload(cold_plans[i], payloads.data() + plan_offsets[i]);
             }
         }
+
+        if (record_hits and hot_term_cache_size_.load(std::memory_order_relaxed) > 0 and
+            not read_plans.empty()) {
+            this->RecordTermHits(read_plans);
+        }
         return query_term_buffers;
     }
 
@@ -558,6 +757,10 @@ DiskSindiTermDataCell<IOTmpl>::GetMemoryUsage() const {
     uint64_t memory = sizeof(DiskSindiTermDataCell<IOTmpl>);
     std::shared_lock lock(term_layout_mutex_);
     memory += term_dict_.size() * sizeof(DiskTermEntry);
+    std::shared_lock hot_lock(hot_term_mutex_);
+    memory += hot_term_payloads_.capacity() +
+              hot_term_slots_.size() * (sizeof(uint32_t) + sizeof(std::pair<uint64_t, uint32_t>) +
+                                        sizeof(void*));
     return memory;
 }
 
@@ -611,6 +814,38 @@ DiskSindiTermDataCell<IOTmpl>::QueryWindow(float* dists,
     computer->ResetTerm();
 }
 
+template <typename IOTmpl>
+float
+DiskSindiTermDataCell<IOTmpl>::GetWindowDistanceLowerBound(
+    uint32_t window_id,
+    const SparseTermComputerPtr& computer,
+    const SindiQueryContext& query_context) const {
+    if (window_id >= window_count_) {
+        return 0.0F;
+    }
+    const auto value_code_size = sindi_datacell_utils::GetValueCodeSize(sparse_value_quant_type_);
+    float bound = 0.0F;
+    std::shared_lock lock(term_layout_mutex_);
+    for (uint32_t it = 0; it < computer->pruned_len_; ++it) {
+        const auto* tb =
+            this->GetTermBufferNoLock(computer->GetTerm(it), query_context.query_term_buffers);
+        if (tb == nullptr) {
+            continue;
+        }
+        const auto [start, count] = tb->GetPostingRange(window_id);
+        if (count == 0) {
+            continue;
+        }
+        bound += sindi_datacell_utils::GetPostingDistanceLowerBound(
+            computer->sorted_query_[it].second,
+            tb->ValuesData() + static_cast<uint64_t>(start) * value_code_size,
+            computer->GetTermScanCount(count),
+            sparse_value_quant_type_,
+            quantization_params_.get());
+    }
+    return bound;
+}
+
 template <typename IOTmpl>
 void
 DiskSindiTermDataCell<IOTmpl>::GetSparseVector(uint32_t inner_id,
@@ -627,7 +862,8 @@ DiskSindiTermDataCell<IOTmpl>::GetSparseVector(uint32_t inner_id,
             }
         }
     }
-    auto query_term_buffers = this->LoadQueryTermBuffers(term_ids, allocator);
+    // a full row scan must not look like a query to the hot term counters
+    auto query_term_buffers = this->LoadTermBuffers(term_ids, allocator, false);
     std::shared_lock lock(term_layout_mutex_);
     Vector<uint32_t> ids(allocator);
     Vector<float> vals(allocator);
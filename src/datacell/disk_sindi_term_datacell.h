@@ -15,7 +15,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <cmath>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <shared_mutex>
@@ -23,6 +25,7 @@
 
 #include "container_types.h"
 #include "datacell/sindi_search_term_datacell.h"
+#include "impl/hot_set_refresher.h"
 #include "impl/inner_search_param.h"
 #include "index_common_param.h"
 #include "io/common/basic_io.h"
@@ -40,6 +43,14 @@ namespace vsag {
 
 using TermBuffer = SindiTermBuffer;
 
+struct DiskSindiTermCacheStats {
+    uint64_t hot_term_count{0};
+    uint64_t hot_term_memory_usage{0};
+    uint64_t hot_term_hit_count{0};
+    uint64_t disk_term_read_count{0};
+    uint64_t disk_read_request_count{0};
+};
+
 class DiskSindiTermDataCellInterface : public SindiSearchTermDataCell {
 public:
     static std::shared_ptr<DiskSindiTermDataCellInterface>
@@ -56,6 +67,34 @@ public:
 
     virtual void
     SetIO(const std::shared_ptr<Reader>& reader) = 0;
+
+    /**
+     * Keeps the payloads of the most frequently queried terms in memory, up to memory_limit
+     * bytes. Hit counters are collected by LoadQueryTermBuffers and every refresh_interval
+     * loads the hot set is rebuilt on a background thread, the query that crosses the interval
+     * does not wait for it. A memory_limit of 0 disables the cache; mmap payloads are already
+     * served from the page cache and ignore it.
+     */
+    virtual void
+    SetHotTermCacheSize(uint64_t memory_limit,
+                        uint64_t refresh_interval = DEFAULT_HOT_TERM_REFRESH_INTERVAL) = 0;
+
+    /// Rebuilds the hot term set from the hit counters and halves the counters afterwards.
+    virtual void
+    RefreshHotTerms() const = 0;
+
+    /// Blocks until the background refresh scheduled by a query load, if any, has finished.
+    virtual void
+    WaitForHotTermRefresh() const = 0;
+
+    [[nodiscard]] virtual DiskSindiTermCacheStats
+    GetTermCacheStats() const = 0;
+
+public:
+    static constexpr uint64_t DEFAULT_HOT_TERM_REFRESH_INTERVAL = 256;
+
+    /// Term payloads closer than this are fetched by one read, the gap is read and discarded.
+    static constexpr uint64_t TERM_READ_COALESCE_GAP = 4096;
 };
 
 using DiskSindiTermDataCellInterfacePtr = std::shared_ptr<DiskSindiTermDataCellInterface>;
@@ -71,6 +110,8 @@ public:
                           IOParamPtr io_param,
                           IndexCommonParam common_param);
 
+    ~DiskSindiTermDataCell() override;
+
     void
     SerializeTermLayout(StreamWriter& writer, uint32_t term_dict_count) const override;
 
@@ -82,6 +123,18 @@ public:
     void
     SetIO(const std::shared_ptr<Reader>& reader) override;
 
+    void
+    SetHotTermCacheSize(uint64_t memory_limit, uint64_t refresh_interval) override;
+
+    void
+    RefreshHotTerms() const override;
+
+    void
+    WaitForHotTermRefresh() const override;
+
+    [[nodiscard]] DiskSindiTermCacheStats
+    GetTermCacheStats() const override;
+
     QueryTermBuffers
     LoadQueryTermBuffers(const Vector<uint32_t>& query_term_ids,
                          Allocator* query_allocator = nullptr) const override;
@@ -106,6 +159,11 @@ public:
                 bool use_term_lists_heap_insert,
                 SindiQueryContext& query_context) const override;
 
+    [[nodiscard]] float
+    GetWindowDistanceLowerBound(uint32_t window_id,
+                                const SparseTermComputerPtr& computer,
+                                const SindiQueryContext& query_context) const override;
+
     bool
     InsertHeapByWindow(float* dists,
                        uint32_t window_id,
@@ -139,9 +197,29 @@ public:
                           const QueryTermBuffers& query_term_buffers) const override;
 
 private:
+    struct TermReadPlan {
+        uint32_t term_id{0};
+        DiskTermEntry entry{};
+    };
+
     void
     InitIO(const IOParamPtr& io_param);
 
+    QueryTermBuffers
+    LoadTermBuffers(const Vector<uint32_t>& term_ids, Allocator* allocator, bool record_hits) const;
+
+    void
+    ReadTermPayloads(const Vector<TermReadPlan>& plans,
+                     Vector<uint8_t>& payloads,
+                     Vector<uint64_t>& plan_offsets,
+                     Allocator* allocator) const;
+
+    void
+    RecordTermHits(const Vector<TermReadPlan>& plans) const;
+
+    void
+    ClearHotTerms();
+
     const TermBuffer*
     GetTermBufferNoLock(uint32_t term_id, const QueryTermBuffers& query_term_buffers) const;
 
@@ -232,6 +310,24 @@ private:
     uint64_t total_count_{0};
     uint64_t payload_size_{0};
     bool payloads_validated_{false};
+
+    // read by every query load, written by SetHotTermCacheSize
+    std::atomic<uint64_t> hot_term_cache_size_{0};
+    std::atomic<uint64_t> hot_term_refresh_interval_{DEFAULT_HOT_TERM_REFRESH_INTERVAL};
+
+    // term id -> (offset, size) of its payload in hot_term_payloads_
+    mutable std::shared_mutex hot_term_mutex_;
+    mutable UnorderedMap<uint32_t, std::pair<uint64_t, uint32_t>> hot_term_slots_;
+    mutable Vector<uint8_t> hot_term_payloads_;
+
+    mutable std::mutex hot_term_refresh_mutex_;
+
+    // declared after the hot terms, the scheduled refresh it runs writes into them
+    mutable HotSetRefresher term_hits_;
+
+    mutable std::atomic<uint64_t> hot_term_hit_count_{0};
+    mutable std::atomic<uint64_t> disk_term_read_count_{0};
+    mutable std::atomic<uint64_t> disk_read_request_count_{0};
 };
 
 template <typename IOTmpl>
@@ -541,6 +541,96 @@ TEST_CASE("DiskSindiTermDataCell expands sparse window metadata", "[ut][DiskSind
     REQUIRE(buffer.IdsData()[1] == 1);
 }
 
+TEST_CASE("DiskSindiTermDataCell coalesces reads and caches hot terms",
+          "[ut][DiskSindiTermDataCell]") {
+    fixtures::TempDir dir("disk_sindi_hot_terms");
+    constexpr uint32_t term_id_limit = 32;
+    constexpr uint32_t window_size = 4;
+
+    IndexCommonParam common_param;
+    common_param.allocator_ = SafeAllocator::FactoryDefaultAllocator();
+    auto* allocator = common_param.allocator_.get();
+    auto io_param = IOParameter::GetIOParameterByJson(JsonType::Parse(
+        fmt::format(R"({{"type":"buffer_io","file_path":"{}"}})", dir.GenerateRandomFile(true))));
+
+    auto source =
+        std::make_shared<MutableSindiTermDataCell>(term_id_limit,
+                                                   window_size,
+                                                   allocator,
+                                                   SparseValueQuantizationType::FP32,
+                                                   std::make_shared<QuantizationParams>());
+    uint32_t term_ids[] = {2, 3, 5, 20};
+    for (uint32_t document = 0; document < 10; ++document) {
+        float values[] = {1.0F + document, 2.0F + document, 3.0F + document, 4.0F + document};
+        SparseVector vector{4, term_ids, values};
+        source->InsertVector(vector, document);
+    }
+    source->Finalize();
+
+    std::stringstream stream;
+    IOStreamWriter writer(stream);
+    source->SerializeTermLayout(writer, source->GetTermDictCount());
+    stream.seekg(0, std::ios::beg);
+    auto restored = DiskSindiTermDataCellInterface::MakeInstance(term_id_limit,
+                                                                 allocator,
+                                                                 SparseValueQuantizationType::FP32,
+                                                                 nullptr,
+                                                                 window_size,
+                                                                 io_param,
+                                                                 common_param);
+    IOStreamReader reader(stream);
+    restored->DeserializeTermLayout(reader, 3, 10);
+
+    const auto require_same_buffers = [](const QueryTermBuffers& lhs, const QueryTermBuffers& rhs) {
+        REQUIRE(lhs.size() == rhs.size());
+        for (const auto& [term_id, buffer] : lhs) {
+            const auto& other = rhs.at(term_id);
+            REQUIRE(buffer.window_offsets == other.window_offsets);
+            const auto count = buffer.window_offsets.back();
+            REQUIRE(std::memcmp(buffer.IdsData(), other.IdsData(), count * sizeof(uint16_t)) == 0);
+            REQUIRE(buffer.ValuesSize() == other.ValuesSize());
+            REQUIRE(std::memcmp(buffer.ValuesData(), other.ValuesData(), buffer.ValuesSize()) ==
+                    0);
+        }
+    };
+
+    Vector<uint32_t> all_terms(allocator);
+    all_terms = {20, 5, 3, 2};
+    const auto cold_buffers = restored->LoadQueryTermBuffers(all_terms);
+    REQUIRE(cold_buffers.size() == 4);
+    auto stats = restored->GetTermCacheStats();
+    REQUIRE(stats.disk_term_read_count == 4);
+    REQUIRE(stats.disk_read_request_count == 1);
+    REQUIRE(stats.hot_term_count == 0);
+
+    const auto memory_usage_before_cache = restored->GetMemoryUsage();
+    restored->SetHotTermCacheSize(1 << 20, 2);
+    Vector<uint32_t> hot_terms(allocator);
+    hot_terms = {2, 3};
+    (void)restored->LoadQueryTermBuffers(hot_terms);
+    REQUIRE(restored->GetTermCacheStats().hot_term_count == 0);
+    (void)restored->LoadQueryTermBuffers(hot_terms);
+    // the second load scheduled a refresh in the background
+    restored->WaitForHotTermRefresh();
+    stats = restored->GetTermCacheStats();
+    REQUIRE(stats.hot_term_count == 2);
+    REQUIRE(stats.hot_term_memory_usage > 0);
+    REQUIRE(restored->GetMemoryUsage() > memory_usage_before_cache);
+
+    const auto disk_reads_before = stats.disk_term_read_count;
+    const auto mixed_buffers = restored->LoadQueryTermBuffers(all_terms);
+    stats = restored->GetTermCacheStats();
+    REQUIRE(stats.hot_term_hit_count == 2);
+    REQUIRE(stats.disk_term_read_count == disk_reads_before + 2);
+    require_same_buffers(cold_buffers, mixed_buffers);
+
+    restored->SetHotTermCacheSize(0, 1);
+    stats = restored->GetTermCacheStats();
+    REQUIRE(stats.hot_term_count == 0);
+    REQUIRE(stats.hot_term_memory_usage == 0);
+    require_same_buffers(cold_buffers, restored->LoadQueryTermBuffers(all_terms));
+}
+
 TEST_CASE("DiskSindiTermDataCell rejects memory io", "[ut][DiskSindiTermDataCell]") {
     IndexCommonParam common_param;
     common_param.allocator_ = SafeAllocator::FactoryDefaultAllocator();
@@ -0,0 +1,427 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "external_sindi_term_layout_builder.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <future>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "datacell/sindi_datacell_utils.h"
+#include "vsag_exception.h"
+
+namespace vsag {
+
+namespace {
+
+constexpr uint64_t MIN_RUN_READER_POSTINGS = 4096;
+constexpr uint64_t MIN_SECTION_MEMORY = 1024 * 1024;
+constexpr uint64_t SECTION_COPY_BUFFER_SIZE = 1024 * 1024;
+
+std::string
+make_temp_file_path(const std::string& directory, const std::string& tag) {
+    static std::atomic<uint64_t> sequence{0};
+    static const auto process_tag = std::random_device{}();
+    const auto base = directory.empty() ? std::filesystem::temp_directory_path().string()
+                                        : directory;
+    return (std::filesystem::path(base) /
+            fmt::format("vsag_sindi_{}_{:x}_{}.tmp", tag, process_tag, sequence.fetch_add(1)))
+        .string();
+}
+
+}  // namespace
+
+ExternalSindiTermLayoutBuilder::TempFile::TempFile(const std::string& directory,
+                                                   const std::string& tag)
+    : path_(make_temp_file_path(directory, tag)) {
+    file_.open(path_, std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
+    if (not file_.is_open()) {
+        throw VsagException(ErrorType::INTERNAL_ERROR,
+                            fmt::format("failed to create SINDI spill file {}", path_));
+    }
+}
+
+ExternalSindiTermLayoutBuilder::TempFile::~TempFile() {
+    file_.close();
+    std::error_code error;
+    std::filesystem::remove(path_, error);
+}
+
+void
+ExternalSindiTermLayoutBuilder::TempFile::Append(const void* data, uint64_t size) {
+    if (size == 0) {
+        return;
+    }
+    file_.seekp(static_cast<std::streamoff>(size_));
+    file_.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    if (not file_.good()) {
+        throw VsagException(ErrorType::INTERNAL_ERROR,
+                            fmt::format("failed to write SINDI spill file {}", path_));
+    }
+    size_ += size;
+}
+
+void
+ExternalSindiTermLayoutBuilder::TempFile::Read(uint64_t offset, uint64_t size, void* dest) {
+    CHECK_ARGUMENT(offset <= size_ and size <= size_ - offset, "SINDI spill read out of range");
+    file_.seekg(static_cast<std::streamoff>(offset));
+    file_.read(static_cast<char*>(dest), static_cast<std::streamsize>(size));
+    if (not file_.good()) {
+        throw VsagException(ErrorType::READ_ERROR,
+                            fmt::format("failed to read SINDI spill file {}", path_));
+    }
+}
+
+ExternalSindiTermLayoutBuilder::ExternalSindiTermLayoutBuilder(
+    uint32_t term_dict_limit,
+    uint32_t window_size,
+    SparseValueQuantizationType value_type,
+    const ExternalSindiTermLayoutOptions& options,
+    SafeThreadPoolPtr thread_pool,
+    Allocator* allocator)
+    : term_dict_limit_(term_dict_limit),
+      window_size_(window_size),
+      value_type_(value_type),
+      value_code_size_(sindi_datacell_utils::GetValueCodeSize(value_type)),
+      temp_dir_(options.temp_dir),
+      run_memory_limit_(options.run_memory_limit),
+      // pending and sorted postings both live while a run is spilled
+      run_capacity_(std::max<uint64_t>(options.run_memory_limit / (2 * sizeof(RunPosting)), 1)),
+      thread_count_(std::max<uint64_t>(options.thread_count, 1)),
+      thread_pool_(std::move(thread_pool)),
+      allocator_(allocator),
+      pending_(allocator),
+      sorted_(allocator),
+      runs_(allocator),
+      term_posting_counts_(term_dict_limit, 0, allocator),
+      term_window_counts_(term_dict_limit, 0, allocator),
+      term_last_windows_(term_dict_limit, std::numeric_limits<uint32_t>::max(), allocator),
+      window_ids_(allocator),
+      window_codes_(allocator),
+      sort_order_(allocator),
+      sorted_ids_(allocator),
+      sorted_codes_(allocator),
+      ids_section_(allocator),
+      values_section_(allocator) {
+    CHECK_ARGUMENT(window_size_ > 0 and window_size_ <= 65536, "window_size must be in (0, 65536]");
+    CHECK_ARGUMENT(term_dict_limit_ > 0, "term dictionary limit must be positive");
+    if (not temp_dir_.empty()) {
+        CHECK_ARGUMENT(std::filesystem::is_directory(temp_dir_),
+                       fmt::format("SINDI spill directory {} does not exist", temp_dir_));
+    }
+    pending_.reserve(run_capacity_);
+}
+
+ExternalSindiTermLayoutBuilder::~ExternalSindiTermLayoutBuilder() = default;
+
+void
+ExternalSindiTermLayoutBuilder::AddVector(const SparseVector& vector, uint32_t inner_id) {
+    CHECK_ARGUMENT(inner_id == document_count_,
+                   fmt::format("external SINDI build expects inner id {}, got {}",
+                               document_count_,
+                               inner_id));
+    for (uint32_t index = 0; index < vector.len_; ++index) {
+        CHECK_ARGUMENT(vector.ids_[index] < term_dict_limit_,
+                       fmt::format("term id {} exceeds the term dictionary limit {}",
+                                   vector.ids_[index],
+                                   term_dict_limit_));
+    }
+
+    const auto window_id = inner_id / window_size_;
+    for (uint32_t index = 0; index < vector.len_; ++index) {
+        const auto term_id = vector.ids_[index];
+        pending_.push_back({term_id, inner_id, vector.vals_[index]});
+        pending_max_term_ = std::max(pending_max_term_, term_id);
+        ++term_posting_counts_[term_id];
+        if (term_last_windows_[term_id] != window_id) {
+            term_last_windows_[term_id] = window_id;
+            ++term_window_counts_[term_id];
+        }
+    }
+    ++document_count_;
+    if (pending_.size() >= run_capacity_) {
+        this->spill_run();
+    }
+}
+
+uint32_t
+ExternalSindiTermLayoutBuilder::GetTermDictCount() const {
+    for (auto term = term_dict_limit_; term > 0; --term) {
+        if (term_posting_counts_[term - 1] != 0) {
+            return term;
+        }
+    }
+    return 0;
+}
+
+template <typename Func>
+void
+ExternalSindiTermLayoutBuilder::run_slices(uint64_t slice_count, const Func& func) {
+    if (thread_pool_ == nullptr or slice_count == 1) {
+        for (uint64_t slice = 0; slice < slice_count; ++slice) {
+            func(slice);
+        }
+        return;
+    }
+    std::vector<std::future<void>> futures;
+    futures.reserve(slice_count);
+    for (uint64_t slice = 0; slice < slice_count; ++slice) {
+        futures.emplace_back(thread_pool_->GeneralEnqueue(func, slice));
+    }
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
+void
+ExternalSindiTermLayoutBuilder::spill_run() {
+    const uint64_t count = pending_.size();
+    if (count == 0) {
+        return;
+    }
+    if (run_file_ == nullptr) {
+        run_file_ = std::make_unique<TempFile>(temp_dir_, "runs");
+    }
+
+    // stable counting sort by term: every slice counts its terms, the prefix sums give each
+    // (term, slice) pair its first position, and the slices scatter their postings in order
+    const uint64_t slice_count = thread_pool_ == nullptr ? 1 : std::min(thread_count_, count);
+    const uint64_t term_range = static_cast<uint64_t>(pending_max_term_) + 1;
+    Vector<uint64_t> positions(slice_count * term_range, 0, allocator_);
+    const auto slice_begin = [count, slice_count](uint64_t slice) {
+        return count * slice / slice_count;
+    };
+    run_slices(slice_count, [&](uint64_t slice) {
+        auto* slice_positions = positions.data() + slice * term_range;
+        for (auto index = slice_begin(slice); index < slice_begin(slice + 1); ++index) {
+            ++slice_positions[pending_[index].term_id];
+        }
+    });
+    uint64_t position = 0;
+    for (uint64_t term = 0; term < term_range; ++term) {
+        for (uint64_t slice = 0; slice < slice_count; ++slice) {
+            auto& slot = positions[slice * term_range + term];
+            const auto term_count = slot;
+            slot = position;
+            position += term_count;
+        }
+    }
+    sorted_.resize(count);
+    run_slices(slice_count, [&](uint64_t slice) {
+        auto* slice_positions = positions.data() + slice * term_range;
+        for (auto index = slice_begin(slice); index < slice_begin(slice + 1); ++index) {
+            sorted_[slice_positions[pending_[index].term_id]++] = pending_[index];
+        }
+    });
+
+    const uint64_t offset = run_file_->Size() / sizeof(RunPosting);
+    run_file_->Append(sorted_.data(), count * sizeof(RunPosting));
+    runs_.push_back({offset, count});
+    pending_.clear();
+    pending_max_term_ = 0;
+}
+
+void
+ExternalSindiTermLayoutBuilder::append_section(Vector<uint8_t>& memory,
+                                               std::unique_ptr<TempFile>& spill,
+                                               const char* tag,
+                                               const void* data,
+                                               uint64_t size) {
+    const auto memory_limit = std::max(MIN_SECTION_MEMORY, run_memory_limit_ / 4);
+    const bool spilled = spill != nullptr and spill->Size() > 0;
+    if (not spilled and memory.size() + size <= memory_limit) {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        memory.insert(memory.end(), bytes, bytes + size);
+        return;
+    }
+    // a section outgrowing its memory continues in the spill file, which keeps the order
+    if (spill == nullptr) {
+        spill = std::make_unique<TempFile>(temp_dir_, tag);
+    }
+    if (not spilled) {
+        spill->Append(memory.data(), memory.size());
+        memory.clear();
+    }
+    spill->Append(data, size);
+}
+
+void
+ExternalSindiTermLayoutBuilder::write_section(StreamWriter& writer,
+                                              const Vector<uint8_t>& memory,
+                                              const std::unique_ptr<TempFile>& spill) {
+    if (spill == nullptr or spill->Size() == 0) {
+        writer.Write(reinterpret_cast<const char*>(memory.data()), memory.size());
+        return;
+    }
+    Vector<char> buffer(std::min(SECTION_COPY_BUFFER_SIZE, spill->Size()), allocator_);
+    for (uint64_t offset = 0; offset < spill->Size(); offset += buffer.size()) {
+        const auto size = std::min<uint64_t>(buffer.size(), spill->Size() - offset);
+        spill->Read(offset, size, buffer.data());
+        writer.Write(buffer.data(), size);
+    }
+}
+
+void
+ExternalSindiTermLayoutBuilder::flush_window(uint32_t window_id, Vector<TermWindowMeta>& metas) {
+    const auto posting_count = static_cast<uint32_t>(window_ids_.size());
+    if (posting_count == 0) {
+        return;
+    }
+    sindi_datacell_utils::SortPostingListByValue(window_ids_.data(),
+                                                 window_codes_.data(),
+                                                 posting_count,
+                                                 value_type_,
+                                                 sort_order_,
+                                                 sorted_ids_,
+                                                 sorted_codes_);
+    metas.push_back({window_id, posting_count});
+    append_section(ids_section_,
+                   ids_spill_,
+                   "ids",
+                   window_ids_.data(),
+                   static_cast<uint64_t>(posting_count) * sizeof(uint16_t));
+    append_section(values_section_,
+                   values_spill_,
+                   "values",
+                   window_codes_.data(),
+                   static_cast<uint64_t>(posting_count) * value_code_size_);
+    window_ids_.clear();
+    window_codes_.clear();
+}
+
+void
+ExternalSindiTermLayoutBuilder::Write(StreamWriter& writer,
+                                      uint32_t term_dict_count,
+                                      const QuantizationParams* quantization_params) {
+    this->spill_run();
+    pending_.clear();
+    pending_.shrink_to_fit();
+    sorted_.clear();
+    sorted_.shrink_to_fit();
+    CHECK_ARGUMENT(  // NOLINT(readability-simplify-boolean-expr)
+        term_dict_count >= this->GetTermDictCount() && term_dict_count <= term_dict_limit_,
+        fmt::format("term dict count {} does not cover the built terms", term_dict_count));
+
+    // the dictionary comes first, its offsets follow from the counters kept by AddVector
+    std::vector<DiskTermEntry> term_dict(term_dict_count);
+    uint64_t payload_offset = 0;
+    for (uint32_t term = 0; term < term_dict_count; ++term) {
+        const auto posting_count = term_posting_counts_[term];
+        if (posting_count == 0) {
+            continue;
+        }
+        CHECK_ARGUMENT(posting_count <= std::numeric_limits<uint32_t>::max(),
+                       "SINDI term posting count exceeds uint32_t");
+        const auto payload_size =
+            sindi_datacell_utils::GetTermPayloadSize(term_window_counts_[term],
+                                                     static_cast<uint32_t>(posting_count),
+                                                     value_code_size_);
+        CHECK_ARGUMENT(payload_size <= std::numeric_limits<uint32_t>::max(),
+                       "SINDI term payload exceeds uint32_t");
+        term_dict[term] = {payload_offset,
+                           static_cast<uint32_t>(payload_size),
+                           static_cast<uint32_t>(posting_count)};
+        payload_offset += payload_size;
+    }
+    StreamWriter::WriteVector(writer, term_dict);
+    StreamWriter::WriteObj(writer, payload_offset);
+
+    // every run is sorted by term, so one forward cursor per run serves the terms in order
+    const auto run_count = runs_.size();
+    const auto reader_capacity =
+        run_count == 0 ? 0 : std::max(MIN_RUN_READER_POSTINGS, run_capacity_ / run_count);
+    Vector<Vector<RunPosting>> buffers(allocator_);
+    buffers.reserve(run_count);
+    Vector<uint64_t> buffer_positions(run_count, 0, allocator_);
+    Vector<uint64_t> next_postings(run_count, 0, allocator_);
+    for (uint64_t run = 0; run < run_count; ++run) {
+        buffers.emplace_back(allocator_);
+    }
+    const auto peek = [&](uint64_t run) -> const RunPosting* {
+        auto& buffer = buffers[run];
+        if (buffer_positions[run] == buffer.size()) {
+            const auto remaining = runs_[run].count - next_postings[run];
+            if (remaining == 0) {
+                return nullptr;
+            }
+            buffer.resize(std::min(reader_capacity, remaining));
+            run_file_->Read((runs_[run].offset + next_postings[run]) * sizeof(RunPosting),
+                            buffer.size() * sizeof(RunPosting),
+                            buffer.data());
+            next_postings[run] += buffer.size();
+            buffer_positions[run] = 0;
+        }
+        return &buffer[buffer_positions[run]];
+    };
+
+    constexpr char padding[sizeof(uint32_t)] = {0};
+    Vector<TermWindowMeta> metas(allocator_);
+    for (uint32_t term = 0; term < term_dict_count; ++term) {
+        if (term_posting_counts_[term] == 0) {
+            continue;
+        }
+        metas.clear();
+        ids_section_.clear();
+        values_section_.clear();
+        if (ids_spill_ != nullptr) {
+            ids_spill_->Reset();
+        }
+        if (values_spill_ != nullptr) {
+            values_spill_->Reset();
+        }
+
+        // runs cover increasing inner ids, so visiting them in order yields ascending windows
+        auto current_window = std::numeric_limits<uint32_t>::max();
+        for (uint64_t run = 0; run < run_count; ++run) {
+            for (const auto* posting = peek(run); posting != nullptr and posting->term_id == term;
+                 posting = peek(run)) {
+                const auto window_id = posting->inner_id / window_size_;
+                if (window_id != current_window) {
+                    this->flush_window(current_window, metas);
+                    current_window = window_id;
+                }
+                window_ids_.push_back(static_cast<uint16_t>(posting->inner_id % window_size_));
+                const auto code_offset = window_codes_.size();
+                window_codes_.resize(code_offset + value_code_size_);
+                sindi_datacell_utils::EncodeValue(posting->value,
+                                                  value_type_,
+                                                  quantization_params,
+                                                  window_codes_.data() + code_offset);
+                ++buffer_positions[run];
+            }
+        }
+        this->flush_window(current_window, metas);
+        CHECK_ARGUMENT(metas.size() == term_window_counts_[term],
+                       "SINDI spilled runs do not match the term counters");
+
+        const auto window_count = static_cast<uint32_t>(metas.size());
+        StreamWriter::WriteObj(writer, window_count);
+        writer.Write(reinterpret_cast<const char*>(metas.data()),
+                     static_cast<uint64_t>(window_count) * sizeof(TermWindowMeta));
+        this->write_section(writer, ids_section_, ids_spill_);
+        const auto ids_padding = sindi_datacell_utils::GetIdsPadding(term_posting_counts_[term]);
+        if (ids_padding != 0) {
+            writer.Write(padding, ids_padding);
+        }
+        this->write_section(writer, values_section_, values_spill_);
+    }
+}
+
+}  // namespace vsag
@@ -0,0 +1,186 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "datacell/sindi_search_term_datacell.h"
+#include "impl/thread_pool/safe_thread_pool.h"
+#include "storage/stream_writer.h"
+#include "typing.h"
+
+namespace vsag {
+
+struct ExternalSindiTermLayoutOptions {
+    static constexpr uint64_t DEFAULT_RUN_MEMORY_LIMIT = 256ULL * 1024 * 1024;
+
+    // directory of the spill files, the system temp directory when empty
+    std::string temp_dir;
+    // memory of the posting buffers, a full buffer is sorted and spilled as one run
+    uint64_t run_memory_limit{DEFAULT_RUN_MEMORY_LIMIT};
+    // slices of the parallel run sort, used when a thread pool is given
+    uint64_t thread_count{1};
+};
+
+/**
+ * Writes the SINDI term layout of a document stream that does not fit in memory.
+ *
+ * AddVector buffers the postings of consecutive documents. A full buffer is sorted by term on the
+ * thread pool, with a stable counting sort so every term keeps document order, and appended to a
+ * run file. Write walks the terms once, reads every run sequentially and emits the dictionary and
+ * payload of sindi_datacell_utils::SerializeTermLayout, so DiskSindiTermDataCell loads the result
+ * as written by an in-memory build. Memory stays within run_memory_limit plus the per-term
+ * counters; term sections larger than that are staged in a spill file.
+ */
+class ExternalSindiTermLayoutBuilder {
+public:
+    ExternalSindiTermLayoutBuilder(uint32_t term_dict_limit,
+                                   uint32_t window_size,
+                                   SparseValueQuantizationType value_type,
+                                   const ExternalSindiTermLayoutOptions& options,
+                                   SafeThreadPoolPtr thread_pool,
+                                   Allocator* allocator);
+
+    ~ExternalSindiTermLayoutBuilder();
+
+    ExternalSindiTermLayoutBuilder(const ExternalSindiTermLayoutBuilder&) = delete;
+
+    ExternalSindiTermLayoutBuilder&
+    operator=(const ExternalSindiTermLayoutBuilder&) = delete;
+
+    /// Adds the postings of one document, inner ids are consecutive from 0.
+    void
+    AddVector(const SparseVector& vector, uint32_t inner_id);
+
+    /// One past the largest term id holding a posting.
+    [[nodiscard]] uint32_t
+    GetTermDictCount() const;
+
+    [[nodiscard]] uint64_t
+    GetRunCount() const {
+        return runs_.size();
+    }
+
+    /**
+     * Spills the remaining postings and writes the term layout with term_dict_count dictionary
+     * entries; values are encoded with quantization_params, which only SQ8 reads.
+     */
+    void
+    Write(StreamWriter& writer,
+          uint32_t term_dict_count,
+          const QuantizationParams* quantization_params);
+
+private:
+    struct RunPosting {
+        uint32_t term_id{0};
+        uint32_t inner_id{0};
+        float value{0.0F};
+    };
+
+    struct Run {
+        uint64_t offset{0};  // first posting in the run file
+        uint64_t count{0};
+    };
+
+    class TempFile {
+    public:
+        TempFile(const std::string& directory, const std::string& tag);
+
+        ~TempFile();
+
+        void
+        Append(const void* data, uint64_t size);
+
+        void
+        Read(uint64_t offset, uint64_t size, void* dest);
+
+        void
+        Reset() {
+            size_ = 0;
+        }
+
+        [[nodiscard]] uint64_t
+        Size() const {
+            return size_;
+        }
+
+    private:
+        std::string path_;
+        std::fstream file_;
+        uint64_t size_{0};
+    };
+
+    void
+    spill_run();
+
+    template <typename Func>
+    void
+    run_slices(uint64_t slice_count, const Func& func);
+
+    void
+    flush_window(uint32_t window_id, Vector<TermWindowMeta>& metas);
+
+    void
+    append_section(Vector<uint8_t>& memory,
+                   std::unique_ptr<TempFile>& spill,
+                   const char* tag,
+                   const void* data,
+                   uint64_t size);
+
+    void
+    write_section(StreamWriter& writer,
+                  const Vector<uint8_t>& memory,
+                  const std::unique_ptr<TempFile>& spill);
+
+private:
+    const uint32_t term_dict_limit_{0};
+    const uint32_t window_size_{0};
+    const SparseValueQuantizationType value_type_{SparseValueQuantizationType::FP32};
+    const uint32_t value_code_size_{sizeof(float)};
+    const std::string temp_dir_;
+    const uint64_t run_memory_limit_{0};
+    const uint64_t run_capacity_{0};  // postings of one run
+    const uint64_t thread_count_{1};
+    SafeThreadPoolPtr thread_pool_{nullptr};
+    Allocator* const allocator_{nullptr};
+
+    Vector<RunPosting> pending_;
+    Vector<RunPosting> sorted_;
+    uint32_t pending_max_term_{0};
+    std::unique_ptr<TempFile> run_file_;
+    Vector<Run> runs_;
+
+    uint32_t document_count_{0};
+    Vector<uint64_t> term_posting_counts_;
+    Vector<uint32_t> term_window_counts_;
+    Vector<uint32_t> term_last_windows_;
+
+    // one window of the term being written, sorted by value before it is appended
+    Vector<uint16_t> window_ids_;
+    Vector<uint8_t> window_codes_;
+    Vector<uint32_t> sort_order_;
+    Vector<uint16_t> sorted_ids_;
+    Vector<uint8_t> sorted_codes_;
+
+    // ids and values sections of the term being written
+    Vector<uint8_t> ids_section_;
+    Vector<uint8_t> values_section_;
+    std::unique_ptr<TempFile> ids_spill_;
+    std::unique_ptr<TempFile> values_spill_;
+};
+
+}  // namespace vsag
@@ -0,0 +1,209 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "external_sindi_term_layout_builder.h"
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "impl/allocator/safe_allocator.h"
+#include "mutable_sindi_term_datacell.h"
+#include "storage/stream_writer.h"
+#include "unittest.h"
+
+using namespace vsag;
+
+namespace {
+
+struct TestDocument {
+    std::vector<uint32_t> ids;
+    std::vector<float> vals;
+};
+
+std::vector<TestDocument>
+make_documents(uint32_t count, uint32_t term_count, uint32_t max_length, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<uint32_t> length_dist(1, max_length);
+    std::uniform_int_distribution<uint32_t> term_dist(0, term_count - 1);
+    // coarse values produce ties, which the value sort breaks by id
+    std::uniform_int_distribution<uint32_t> value_dist(1, 16);
+    std::vector<TestDocument> documents(count);
+    for (auto& document : documents) {
+        const auto length = length_dist(rng);
+        for (uint32_t i = 0; i < length; ++i) {
+            const auto term = term_dist(rng);
+            if (std::find(document.ids.begin(), document.ids.end(), term) != document.ids.end()) {
+                continue;
+            }
+            document.ids.push_back(term);
+            document.vals.push_back(static_cast<float>(value_dist(rng)) / 16.0F);
+        }
+    }
+    return documents;
+}
+
+std::string
+serialize_in_memory(const std::vector<TestDocument>& documents,
+                    uint32_t term_dict_limit,
+                    uint32_t window_size,
+                    SparseValueQuantizationType value_type,
+                    const std::shared_ptr<QuantizationParams>& quantization_params,
+                    Allocator* allocator) {
+    MutableSindiTermDataCell data_cell(
+        term_dict_limit, window_size, allocator, value_type, quantization_params);
+    for (uint32_t inner_id = 0; inner_id < documents.size(); ++inner_id) {
+        const auto& document = documents[inner_id];
+        SparseVector vector{static_cast<uint32_t>(document.ids.size()),
+                            const_cast<uint32_t*>(document.ids.data()),
+                            const_cast<float*>(document.vals.data())};
+        data_cell.InsertVector(vector, inner_id);
+    }
+    for (uint32_t window = 0; window < data_cell.GetWindowCount(); ++window) {
+        data_cell.SortByValue(window);
+    }
+    std::stringstream stream;
+    IOStreamWriter writer(stream);
+    data_cell.SerializeTermLayout(writer, data_cell.GetTermDictCount());
+    return stream.str();
+}
+
+std::string
+serialize_external(const std::vector<TestDocument>& documents,
+                   uint32_t term_dict_limit,
+                   uint32_t window_size,
+                   SparseValueQuantizationType value_type,
+                   const std::shared_ptr<QuantizationParams>& quantization_params,
+                   const ExternalSindiTermLayoutOptions& options,
+                   const SafeThreadPoolPtr& thread_pool,
+                   Allocator* allocator,
+                   uint64_t* run_count = nullptr) {
+    ExternalSindiTermLayoutBuilder builder(
+        term_dict_limit, window_size, value_type, options, thread_pool, allocator);
+    for (uint32_t inner_id = 0; inner_id < documents.size(); ++inner_id) {
+        const auto& document = documents[inner_id];
+        SparseVector vector{static_cast<uint32_t>(document.ids.size()),
+                            const_cast<uint32_t*>(document.ids.data()),
+                            const_cast<float*>(document.vals.data())};
+        builder.AddVector(vector, inner_id);
+    }
+    std::stringstream stream;
+    IOStreamWriter writer(stream);
+    builder.Write(writer, builder.GetTermDictCount(), quantization_params.get());
+    if (run_count != nullptr) {
+        *run_count = builder.GetRunCount();
+    }
+    return stream.str();
+}
+
+}  // namespace
+
+TEST_CASE("ExternalSindiTermLayoutBuilder matches the in-memory term layout",
+          "[ut][ExternalSindiTermLayoutBuilder]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    auto thread_pool = SafeThreadPool::FactoryDefaultThreadPool();
+    auto quantization_params = std::make_shared<QuantizationParams>();
+    quantization_params->min_val = 0.0F;
+    quantization_params->max_val = 1.0F;
+    quantization_params->diff = 1.0F;
+    const auto documents = make_documents(1000, 64, 12, 47);
+
+    fixtures::TempDir temp_dir("vsag_external_sindi_layout_test");
+    ExternalSindiTermLayoutOptions options;
+    options.temp_dir = temp_dir.path;
+    // a few hundred postings per run, so every term spans several runs
+    options.run_memory_limit = 4096;
+    options.thread_count = 4;
+
+    for (auto value_type : {SparseValueQuantizationType::FP32,
+                            SparseValueQuantizationType::FP16,
+                            SparseValueQuantizationType::SQ8}) {
+        DYNAMIC_SECTION("value type " << static_cast<int>(value_type)) {
+            const auto expected = serialize_in_memory(
+                documents, 64, 100, value_type, quantization_params, allocator.get());
+            uint64_t run_count = 0;
+            const auto parallel = serialize_external(documents,
+                                                     64,
+                                                     100,
+                                                     value_type,
+                                                     quantization_params,
+                                                     options,
+                                                     thread_pool,
+                                                     allocator.get(),
+                                                     &run_count);
+            REQUIRE(run_count > 1);
+            REQUIRE(parallel == expected);
+            const auto serial = serialize_external(documents,
+                                                   64,
+                                                   100,
+                                                   value_type,
+                                                   quantization_params,
+                                                   options,
+                                                   nullptr,
+                                                   allocator.get());
+            REQUIRE(serial == expected);
+        }
+    }
+}
+
+TEST_CASE("ExternalSindiTermLayoutBuilder spills large term sections",
+          "[ut][ExternalSindiTermLayoutBuilder]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    auto quantization_params = std::make_shared<QuantizationParams>();
+    // every document holds term 0, whose ids alone outgrow the in-memory section limit
+    std::vector<TestDocument> documents(600000);
+    for (uint32_t inner_id = 0; inner_id < documents.size(); ++inner_id) {
+        documents[inner_id].ids = {0, 1 + inner_id % 3};
+        documents[inner_id].vals = {static_cast<float>(inner_id % 7) + 1.0F, 0.5F};
+    }
+    fixtures::TempDir temp_dir("vsag_external_sindi_spill_test");
+    ExternalSindiTermLayoutOptions options;
+    options.temp_dir = temp_dir.path;
+    options.run_memory_limit = 1024 * 1024;
+
+    const auto expected = serialize_in_memory(documents,
+                                              4,
+                                              65536,
+                                              SparseValueQuantizationType::FP32,
+                                              quantization_params,
+                                              allocator.get());
+    const auto external = serialize_external(documents,
+                                             4,
+                                             65536,
+                                             SparseValueQuantizationType::FP32,
+                                             quantization_params,
+                                             options,
+                                             nullptr,
+                                             allocator.get());
+    REQUIRE(external == expected);
+}
+
+TEST_CASE("ExternalSindiTermLayoutBuilder rejects invalid input",
+          "[ut][ExternalSindiTermLayoutBuilder]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    ExternalSindiTermLayoutBuilder builder(
+        8, 16, SparseValueQuantizationType::FP32, {}, nullptr, allocator.get());
+    uint32_t ids[] = {9};
+    float vals[] = {1.0F};
+    SparseVector vector{1, ids, vals};
+    REQUIRE_THROWS(builder.AddVector(vector, 0));
+    ids[0] = 3;
+    REQUIRE_THROWS(builder.AddVector(vector, 1));
+    REQUIRE_NOTHROW(builder.AddVector(vector, 0));
+
+    std::stringstream stream;
+    IOStreamWriter writer(stream);
+    REQUIRE_THROWS(builder.Write(writer, 2, nullptr));
+}
@@ -55,6 +55,24 @@ public:
         this->query(result_dists, comp, idx, id_count, ctx);
     }
 
+    void
+    QueryCodes(float* result_dists,
+               const ComputerInterfacePtr& computer,
+               const uint8_t* codes,
+               uint64_t count,
+               QueryContext* ctx = nullptr) override {
+        auto* comp = static_cast<Computer<QuantTmpl>*>(computer.get());
+        comp->ScanBatchDists(count, codes, result_dists);
+        if (ctx != nullptr and ctx->stats != nullptr and ctx->track_distance_evaluations) {
+            ctx->stats->AddDistance(ctx->distance_phase, backend_, count);
+        }
+    }
+
+    [[nodiscard]] bool
+    SupportQueryCodes() const override {
+        return true;
+    }
+
     ComputerInterfacePtr
     FactoryComputer(const void* query) override {
         return this->factory_computer(static_cast<const float*>(query));
@@ -148,6 +166,11 @@ public:
     bool
     GetCodesById(InnerIdType id, uint8_t* codes) const override;
 
+    bool
+    GetCodesByIds(const InnerIdType* ids, uint64_t count, uint8_t* codes) const override {
+        return this->layout_->MultiRead(ids, count, codes, this->allocator_);
+    }
+
     [[nodiscard]] const float*
     TryGetContiguousRawFloatData(uint64_t* row_stride = nullptr) override {
         if (row_stride != nullptr) {
@@ -202,6 +225,11 @@ public:
     uint64_t
     GetMemoryUsage() const override;
 
+    uint64_t
+    GetHugePageMemoryUsage() const override {
+        return this->layout_->GetHugePageMemoryUsage();
+    }
+
 public:
     IndexCommonParam common_param_;
 
@@ -19,6 +19,7 @@
 #include "inner_string_params.h"
 #include "io/io_headers.h"
 #include "multi_vector_datacell.h"
+#include "multi_vector_datacell_parameter.h"
 #include "quantization/int8_quantizer.h"
 #include "quantization/quantizer_adapter.h"
 #include "quantization/quantizer_headers.h"
@@ -54,8 +55,11 @@ make_instance_multi_vector(const FlattenInterfaceParamPtr& param,
     auto& quantizer_param = param->quantizer_parameter;
 
     if (param->name == MULTI_VECTOR_DATA_CELL) {
+        auto multi_vector_param = std::dynamic_pointer_cast<MultiVectorDataCellParameter>(param);
+        uint32_t residual_centroids =
+            multi_vector_param != nullptr ? multi_vector_param->residual_centroids : 0;
         return std::make_shared<MultiVectorDataCell<QuantTemp, IOTemp>>(
-            quantizer_param, io_param, common_param);
+            quantizer_param, io_param, common_param, residual_centroids);
     }
     throw VsagException(ErrorType::INVALID_ARGUMENT,
                         fmt::format("Unknown flatten interface name: {}", param->name));
@@ -105,6 +109,10 @@ make_instance(const FlattenInterfaceParamPtr& param, const IndexCommonParam& com
             return make_instance_multi_vector<SQ8UniformQuantizer<metric>, IOTemp>(param,
                                                                                    common_param);
         }
+        if (quantization_string == QUANTIZATION_TYPE_VALUE_SQ4_UNIFORM) {
+            return make_instance_multi_vector<SQ4UniformQuantizer<metric>, IOTemp>(param,
+                                                                                   common_param);
+        }
         if (quantization_string == QUANTIZATION_TYPE_VALUE_INT8) {
             return make_instance_multi_vector<INT8Quantizer<metric>, IOTemp>(param, common_param);
         }
@@ -193,6 +201,14 @@ make_instance(const FlattenInterfaceParamPtr& param, const IndexCommonParam& com
         return make_instance_with_tq<FP16Quantizer<metric>, IOTemp, metric>(
             param, common_param, is_transform_quantizer);
     }
+    if (actual_quant_type == QUANTIZATION_TYPE_VALUE_FP8_E4M3) {
+        return make_instance_with_tq<FP8E4M3Quantizer<metric>, IOTemp, metric>(
+            param, common_param, is_transform_quantizer);
+    }
+    if (actual_quant_type == QUANTIZATION_TYPE_VALUE_FP8_E5M2) {
+        return make_instance_with_tq<FP8E5M2Quantizer<metric>, IOTemp, metric>(
+            param, common_param, is_transform_quantizer);
+    }
     if (actual_quant_type == QUANTIZATION_TYPE_VALUE_PQ) {
         return make_instance_with_tq<ProductQuantizer<metric>, IOTemp, metric>(
             param, common_param, is_transform_quantizer);
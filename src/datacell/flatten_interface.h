@@ -104,6 +104,27 @@ public:
         this->Query(result_dists, computer, idx, id_count, ctx);
     }
 
+    /**
+     * @brief Distances from the computer's query to codes laid out back to back.
+     *
+     * Serves codes held outside the datacell (e.g. an in-memory copy of hot disk codes);
+     * only valid when SupportQueryCodes() returns true.
+     */
+    virtual void
+    QueryCodes(float* result_dists,
+               const ComputerInterfacePtr& computer,
+               const uint8_t* codes,
+               uint64_t count,
+               QueryContext* ctx = nullptr) {
+        throw VsagException(ErrorType::UNSUPPORTED_INDEX_OPERATION,
+                            "QueryCodes is not supported by this datacell");
+    }
+
+    [[nodiscard]] virtual bool
+    SupportQueryCodes() const {
+        return false;
+    }
+
     virtual ComputerInterfacePtr
     FactoryComputer(const void* query) = 0;
 
@@ -197,6 +218,12 @@ public:
         return 0;
     }
 
+    /// Part of GetMemoryUsage() that is backed by huge pages.
+    virtual uint64_t
+    GetHugePageMemoryUsage() const {
+        return 0;
+    }
+
     virtual IndexCommonParam
     ExportCommonParam();
 
@@ -242,6 +269,18 @@ public:
     virtual bool
     GetCodesById(InnerIdType id, uint8_t* codes) const = 0;
 
+    // Copies the codes of count ids into codes, code_size_ bytes per id. Disk-backed layouts
+    // override this to issue a single batched read instead of one read per id.
+    virtual bool
+    GetCodesByIds(const InnerIdType* ids, uint64_t count, uint8_t* codes) const {
+        for (uint64_t i = 0; i < count; ++i) {
+            if (not this->GetCodesById(ids[i], codes + i * this->code_size_)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     // Optional fast path for algorithms that can consume a contiguous FP32 matrix directly.
     // Implementations return nullptr when data is quantized, external, block-backed, or otherwise
     // unavailable as a single stable buffer; callers must fall back to Query/GetCodesById.
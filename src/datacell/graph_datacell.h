@@ -118,6 +118,11 @@ public:
         return memory;
     }
 
+    uint64_t
+    GetHugePageMemoryUsage() const override {
+        return io_->GetHugePageMemoryUsage();
+    }
+
     void
     GetIncomingNeighbors(InnerIdType id, Vector<InnerIdType>& neighbors) const override {
         if (reverse_edges_) {
@@ -93,6 +93,12 @@ public:
         return 0;
     }
 
+    /// Part of GetMemoryUsage() that is backed by huge pages.
+    virtual uint64_t
+    GetHugePageMemoryUsage() const {
+        return 0;
+    }
+
     virtual void
     GetIncomingNeighbors(InnerIdType id, Vector<InnerIdType>& neighbors) const {
         if (reverse_edges_) {
@@ -351,6 +351,41 @@ ImmutableSindiTermDataCell::QueryWindow(float* dists,
     computer->ResetTerm();
 }
 
+void
+ImmutableSindiTermDataCell::QueryWindowBatch(float* const* dists,
+                                            uint32_t window_id,
+                                            const Vector<SparseTermComputerPtr>& computers,
+                                            const SindiBatchQueryTerms& batch_terms) const {
+    CHECK_ARGUMENT(window_id < windows_.size(), "immutable SINDI window id out of range");
+    sindi_datacell_utils::AccumulateWindowBatch(
+        dists, computers, batch_terms, sparse_value_quant_type_, [this, window_id](uint32_t term) {
+            return this->GetTermPostingView(term, window_id);
+        });
+}
+
+float
+ImmutableSindiTermDataCell::GetWindowDistanceLowerBound(
+    uint32_t window_id,
+    const SparseTermComputerPtr& computer,
+    const SindiQueryContext& query_context) const {
+    (void)query_context;
+    CHECK_ARGUMENT(window_id < windows_.size(), "immutable SINDI window id out of range");
+    float bound = 0.0F;
+    for (uint32_t it = 0; it < computer->pruned_len_; ++it) {
+        const auto posting = this->GetTermPostingView(computer->GetTerm(it), window_id);
+        if (posting.count == 0) {
+            continue;
+        }
+        bound += sindi_datacell_utils::GetPostingDistanceLowerBound(
+            computer->sorted_query_[it].second,
+            posting.values,
+            computer->GetTermScanCount(posting.count),
+            sparse_value_quant_type_,
+            quantization_params_.get());
+    }
+    return bound;
+}
+
 template <InnerSearchMode mode, InnerSearchType type>
 bool
 ImmutableSindiTermDataCell::insert_heap_by_terms(float* dists,
@@ -89,6 +89,17 @@ public:
                 bool use_term_lists_heap_insert,
                 SindiQueryContext& query_context) const override;
 
+    void
+    QueryWindowBatch(float* const* dists,
+                     uint32_t window_id,
+                     const Vector<SparseTermComputerPtr>& computers,
+                     const SindiBatchQueryTerms& batch_terms) const override;
+
+    [[nodiscard]] float
+    GetWindowDistanceLowerBound(uint32_t window_id,
+                                const SparseTermComputerPtr& computer,
+                                const SindiQueryContext& query_context) const override;
+
     bool
     InsertHeapByWindow(float* dists,
                        uint32_t window_id,
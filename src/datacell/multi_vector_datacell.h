@@ -31,7 +31,8 @@ public:
 
     MultiVectorDataCell(const QuantizerParamPtr& quantization_param,
                         const IOParamPtr& io_param,
-                        const IndexCommonParam& common_param);
+                        const IndexCommonParam& common_param,
+                        uint32_t residual_centroids = 0);
 
     void
     Query(float* result_dists,
@@ -45,7 +46,7 @@ public:
 
     bool
     Decode(const uint8_t* codes, float* vector) override {
-        this->quantizer_->DecodeOne(codes, vector);
+        this->decode_token(codes, vector);
         return true;
     }
 
@@ -118,6 +119,27 @@ public:
     uint64_t
     GetMemoryUsage() const override;
 
+    [[nodiscard]] uint32_t
+    GetResidualCentroidCount() const {
+        return multi_vector_dim_ == 0
+                   ? 0
+                   : static_cast<uint32_t>(residual_centroids_.size() / multi_vector_dim_);
+    }
+
+private:
+    /// Bytes per stored token: the quantizer codes, prefixed by a centroid id in residual mode.
+    [[nodiscard]] uint64_t
+    token_code_size() const;
+
+    void
+    encode_token(const float* token, uint8_t* codes, float* residual) const;
+
+    void
+    decode_token(const uint8_t* codes, float* token) const;
+
+    [[nodiscard]] uint32_t
+    nearest_centroid(const float* token) const;
+
 private:
     std::shared_ptr<Quantizer<QuantTmpl>> quantizer_{nullptr};
     std::shared_ptr<BasicIO<IOTmpl>> io_{nullptr};
@@ -135,6 +157,13 @@ private:
     // io_->MultiRead that would otherwise fetch the 4-byte token count from disk for
     // every candidate, eliminating one io_submit + io_getevents round trip per query.
     Vector<uint32_t> token_counts_{allocator_};
+
+    // Residual mode (ColBERTv2-style): residual_centroid_limit_ > 0 trains up to that many
+    // k-means centroids over all tokens; each token is stored as the id of its nearest
+    // centroid followed by the quantizer codes of token - centroid, so a 4-bit quantizer
+    // only spends its range on the small residuals.
+    const uint32_t residual_centroid_limit_{0};
+    Vector<float> residual_centroids_{allocator_};
 };
 
 }  // namespace vsag
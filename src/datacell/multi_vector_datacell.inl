@@ -21,7 +21,9 @@
 #include <numeric>
 
 #include "common.h"
+#include "impl/cluster/kmeans_cluster.h"
 #include "multi_vector_datacell.h"
+#include "simd/fp32_simd.h"
 #include "utils/byte_buffer.h"
 #include "vsag/options.h"
 
@@ -31,10 +33,12 @@ template <typename QuantTmpl, typename IOTmpl>
 MultiVectorDataCell<QuantTmpl, IOTmpl>::MultiVectorDataCell(
     const QuantizerParamPtr& quantization_param,
     const IOParamPtr& io_param,
-    const IndexCommonParam& common_param)
+    const IndexCommonParam& common_param,
+    uint32_t residual_centroids)
     : allocator_(common_param.allocator_.get()),
       multi_vector_dim_(static_cast<uint32_t>(common_param.dim_)),
-      metric_(common_param.metric_) {
+      metric_(common_param.metric_),
+      residual_centroid_limit_(residual_centroids) {
     this->quantizer_ = std::make_shared<QuantTmpl>(quantization_param, common_param);
     this->backend_ =
         QuantizerDistanceBackend<QuantTmpl>::Get(static_cast<const QuantTmpl&>(*this->quantizer_));
@@ -48,7 +52,90 @@ MultiVectorDataCell<QuantTmpl, IOTmpl>::MultiVectorDataCell(
 template <typename QuantTmpl, typename IOTmpl>
 void
 MultiVectorDataCell<QuantTmpl, IOTmpl>::Train(const void* data, uint64_t count) {
-    this->quantizer_->Train(static_cast<const float*>(data), count);
+    const auto* tokens = static_cast<const float*>(data);
+    if (residual_centroid_limit_ == 0 or count == 0) {
+        this->quantizer_->Train(tokens, count);
+        return;
+    }
+
+    const auto centroid_count =
+        static_cast<uint32_t>(std::min<uint64_t>(residual_centroid_limit_, count));
+    const uint64_t dim = multi_vector_dim_;
+    KMeansCluster cluster(static_cast<int32_t>(dim), allocator_);
+    cluster.Run(centroid_count, tokens, count);
+    residual_centroids_.resize(centroid_count * dim);
+    std::memcpy(
+        residual_centroids_.data(), cluster.k_centroids_, centroid_count * dim * sizeof(float));
+
+    // the quantizer only ever sees residuals, so its range is trained on them
+    Vector<float> residuals(count * dim, allocator_);
+    for (uint64_t i = 0; i < count; ++i) {
+        const float* token = tokens + i * dim;
+        const float* centroid =
+            residual_centroids_.data() + static_cast<uint64_t>(nearest_centroid(token)) * dim;
+        FP32Sub(token, centroid, residuals.data() + i * dim, dim);
+    }
+    this->quantizer_->Train(residuals.data(), count);
+}
+
+template <typename QuantTmpl, typename IOTmpl>
+uint64_t
+MultiVectorDataCell<QuantTmpl, IOTmpl>::token_code_size() const {
+    const uint64_t prefix = residual_centroid_limit_ > 0 ? sizeof(uint32_t) : 0;
+    return prefix + this->quantizer_->GetCodeSize();
+}
+
+template <typename QuantTmpl, typename IOTmpl>
+uint32_t
+MultiVectorDataCell<QuantTmpl, IOTmpl>::nearest_centroid(const float* token) const {
+    const uint64_t dim = multi_vector_dim_;
+    const auto centroid_count = static_cast<uint32_t>(residual_centroids_.size() / dim);
+    uint32_t nearest = 0;
+    float nearest_dist = std::numeric_limits<float>::max();
+    for (uint32_t c = 0; c < centroid_count; ++c) {
+        float dist = FP32ComputeL2Sqr(token, residual_centroids_.data() + c * dim, dim);
+        if (dist < nearest_dist) {
+            nearest_dist = dist;
+            nearest = c;
+        }
+    }
+    return nearest;
+}
+
+template <typename QuantTmpl, typename IOTmpl>
+void
+MultiVectorDataCell<QuantTmpl, IOTmpl>::encode_token(const float* token,
+                                                     uint8_t* codes,
+                                                     float* residual) const {
+    if (residual_centroid_limit_ == 0) {
+        this->quantizer_->EncodeOne(token, codes);
+        return;
+    }
+    CHECK_ARGUMENT(not residual_centroids_.empty(),
+                   "multi-vector datacell with residual centroids must be trained before insert");
+    const uint32_t centroid_id = nearest_centroid(token);
+    std::memcpy(codes, &centroid_id, sizeof(centroid_id));
+    FP32Sub(token,
+            residual_centroids_.data() + static_cast<uint64_t>(centroid_id) * multi_vector_dim_,
+            residual,
+            multi_vector_dim_);
+    this->quantizer_->EncodeOne(residual, codes + sizeof(centroid_id));
+}
+
+template <typename QuantTmpl, typename IOTmpl>
+void
+MultiVectorDataCell<QuantTmpl, IOTmpl>::decode_token(const uint8_t* codes, float* token) const {
+    if (residual_centroid_limit_ == 0) {
+        this->quantizer_->DecodeOne(codes, token);
+        return;
+    }
+    uint32_t centroid_id = 0;
+    std::memcpy(&centroid_id, codes, sizeof(centroid_id));
+    this->quantizer_->DecodeOne(codes + sizeof(centroid_id), token);
+    FP32Add(token,
+            residual_centroids_.data() + static_cast<uint64_t>(centroid_id) * multi_vector_dim_,
+            token,
+            multi_vector_dim_);
 }
 
 template <typename QuantTmpl, typename IOTmpl>
@@ -70,20 +157,22 @@ MultiVectorDataCell<QuantTmpl, IOTmpl>::InsertVector(const void* vector, InnerId
         }
     }
 
-    const uint64_t code_size_per_token = this->quantizer_->GetCodeSize();
+    const uint64_t code_size_per_token = this->token_code_size();
     const uint64_t payload_bytes = static_cast<uint64_t>(multi_vector->len_) * code_size_per_token;
     const uint64_t code_size = sizeof(uint32_t) + payload_bytes;
     ByteBuffer codes(code_size, allocator_);
     std::memcpy(codes.data, &multi_vector->len_, sizeof(uint32_t));
 
     // Encode each token through the quantizer (FP32Quantizer is a no-op memcpy)
+    Vector<float> residual(multi_vector_dim_, allocator_);
     for (uint32_t t = 0; t < multi_vector->len_; ++t) {
         const float* token_vec =
             multi_vector->vectors_ +
             static_cast<uint64_t>(t) * static_cast<uint64_t>(multi_vector_dim_);
-        this->quantizer_->EncodeOne(
+        this->encode_token(
             token_vec,
-            codes.data + sizeof(uint32_t) + static_cast<uint64_t>(t) * code_size_per_token);
+            codes.data + sizeof(uint32_t) + static_cast<uint64_t>(t) * code_size_per_token,
+            residual.data());
     }
 
     uint64_t old_offset = 0;
@@ -159,7 +248,7 @@ MultiVectorDataCell<QuantTmpl, IOTmpl>::GetCodesById(InnerIdType id, bool& need_
     offset_io_->Read(sizeof(offset), static_cast<uint64_t>(id) * sizeof(offset), (uint8_t*)&offset);
     uint32_t len = 0;
     io_->Read(sizeof(len), offset, (uint8_t*)&len);
-    const uint64_t code_size_per_token = this->quantizer_->GetCodeSize();
+    const uint64_t code_size_per_token = this->token_code_size();
     uint64_t read_size = sizeof(uint32_t) + static_cast<uint64_t>(len) * code_size_per_token;
     auto* codes = static_cast<uint8_t*>(allocator_->Allocate(read_size));
     io_->Read(read_size, offset, codes);
@@ -188,6 +277,9 @@ MultiVectorDataCell<QuantTmpl, IOTmpl>::Serialize(StreamWriter& writer) {
     this->offset_io_->Serialize(writer);
     this->io_->Serialize(writer);
     this->quantizer_->Serialize(writer);
+    if (residual_centroid_limit_ > 0) {
+        StreamWriter::WriteVector(writer, residual_centroids_);
+    }
 }
 
 template <typename QuantTmpl, typename IOTmpl>
@@ -199,6 +291,10 @@ MultiVectorDataCell<QuantTmpl, IOTmpl>::Deserialize(lvalue_or_rvalue<StreamReade
     this->offset_io_->Deserialize(reader);
     this->io_->Deserialize(reader);
     this->quantizer_->Deserialize(reader);
+    // only written when the parameter enables residual mode, older indexes read unchanged
+    if (residual_centroid_limit_ > 0) {
+        StreamReader::ReadVector(reader, residual_centroids_);
+    }
     this->backend_ =
         QuantizerDistanceBackend<QuantTmpl>::Get(static_cast<const QuantTmpl&>(*this->quantizer_));
 
@@ -279,7 +375,7 @@ MultiVectorDataCell<QuantTmpl, IOTmpl>::Query(float* result_dists,
 
     // Step 2: Look up token counts from in-memory cache (no disk IO)
     //         Populated by InsertVector (Build) or rebuilt in Deserialize.
-    const uint64_t code_size_per_token = this->quantizer_->GetCodeSize();
+    const uint64_t code_size_per_token = this->token_code_size();
     std::vector<uint64_t> data_sizes(id_count);
     uint64_t total_size = 0;
     for (InnerIdType i = 0; i < id_count; ++i) {
@@ -343,11 +439,11 @@ MultiVectorDataCell<QuantTmpl, IOTmpl>::Query(float* result_dists,
 
         // Decode quantized tokens back to float32 for ComputeDist.
         // For FP32Quantizer this is a no-op memcpy; for SQ8/FP16 it performs
-        // the actual dequantization.
+        // the actual dequantization, residual mode adds the token's centroid back.
         decoded_tokens.resize(static_cast<uint64_t>(token_count) *
                               static_cast<uint64_t>(multi_vector_dim_));
         for (uint32_t t = 0; t < token_count; ++t) {
-            this->quantizer_->DecodeOne(
+            this->decode_token(
                 encoded + static_cast<uint64_t>(t) * code_size_per_token,
                 decoded_tokens.data() +
                     static_cast<uint64_t>(t) * static_cast<uint64_t>(multi_vector_dim_));
@@ -396,6 +492,7 @@ MultiVectorDataCell<QuantTmpl, IOTmpl>::GetMemoryUsage() const {
     }
     memory += sizeof(QuantTmpl);
     memory += token_counts_.capacity() * sizeof(uint32_t);
+    memory += residual_centroids_.capacity() * sizeof(float);
     return memory;
 }
 
@@ -47,6 +47,17 @@ public:
         } else {
             this->quantizer_parameter = std::make_shared<FP32QuantizerParameter>();
         }
+
+        // ColBERTv2-style residual storage: each token keeps the id of its nearest of
+        // residual_centroids k-means centroids, the quantizer encodes token - centroid.
+        if (json.Contains(MULTI_VECTOR_RESIDUAL_CENTROIDS_KEY)) {
+            auto centroids = json[MULTI_VECTOR_RESIDUAL_CENTROIDS_KEY].GetInt();
+            CHECK_ARGUMENT(centroids >= 0,
+                           fmt::format("{} must be non-negative, got {}",
+                                       MULTI_VECTOR_RESIDUAL_CENTROIDS_KEY,
+                                       centroids));
+            this->residual_centroids = static_cast<uint32_t>(centroids);
+        }
     }
 
     JsonType
@@ -55,13 +66,18 @@ public:
         json[IO_PARAMS_KEY].SetJson(this->io_parameter->ToJson());
         json[CODES_TYPE_KEY].SetString(MULTI_VECTOR_CODES);
         json[QUANTIZATION_PARAMS_KEY].SetJson(this->quantizer_parameter->ToJson());
+        json[MULTI_VECTOR_RESIDUAL_CENTROIDS_KEY].SetInt(this->residual_centroids);
         return json;
     }
 
     bool
     CheckCompatibility(const vsag::ParamPtr& other) const override {
         PARAM_CAST_OR_RETURN(MultiVectorDataCellParameter, p, other);
-        return true;
+        return this->residual_centroids == p->residual_centroids;
     }
+
+public:
+    /// 0 stores tokens as-is, otherwise the number of residual centroids
+    uint32_t residual_centroids{0};
 };
 }  // namespace vsag
@@ -17,6 +17,8 @@
 #include <cmath>
 #include <cstdint>
 #include <limits>
+#include <numeric>
+#include <random>
 #include <sstream>
 #include <vector>
 
@@ -55,6 +57,36 @@ MakeMultiVectorDataCell(const std::string& io_type,
     return FlattenInterface::MakeInstance(param, index_common_param);
 }
 
+FlattenInterfacePtr
+MakeQuantizedMultiVectorDataCell(const std::string& quantization_type,
+                                 uint32_t residual_centroids,
+                                 int64_t dim,
+                                 const std::shared_ptr<Allocator>& allocator) {
+    constexpr const char* param_template =
+        R"(
+        {{
+            "io_params": {{
+                "type": "memory_io"
+            }},
+            "quantization_params": {{
+                "type": "{}"
+            }},
+            "residual_centroids": {}
+        }}
+        )";
+    JsonType parsed_json =
+        JsonType::Parse(fmt::format(param_template, quantization_type, residual_centroids));
+    MultiVectorDataCellParamPtr param = std::make_shared<MultiVectorDataCellParameter>();
+    param->FromJson(parsed_json);
+    REQUIRE(param->residual_centroids == residual_centroids);
+
+    IndexCommonParam index_common_param;
+    index_common_param.allocator_ = allocator;
+    index_common_param.metric_ = MetricType::METRIC_TYPE_IP;
+    index_common_param.dim_ = dim;
+    return FlattenInterface::MakeInstance(param, index_common_param);
+}
+
 void
 FillMultiVectors(const std::vector<uint32_t>& token_counts,
                  uint32_t dim,
@@ -284,6 +316,87 @@ TEST_CASE("MultiVectorDataCell Serialize/Deserialize round-trip", "[ut][MultiVec
     }
 }
 
+TEST_CASE("MultiVectorDataCell residual storage tracks exact MaxSim",
+          "[ut][MultiVectorDataCell]") {
+    constexpr uint32_t dim = 8;
+    constexpr uint32_t cluster_count = 4;
+    constexpr uint32_t doc_count = 12;
+    std::mt19937 gen(17);
+    std::uniform_real_distribution<float> center_dist(-4.0F, 4.0F);
+    std::uniform_real_distribution<float> noise_dist(-0.05F, 0.05F);
+    std::uniform_real_distribution<float> query_dist(-0.3F, 0.3F);
+
+    // tokens sit close to a few far-apart centers, as contextual token embeddings do
+    std::vector<float> centers(cluster_count * dim);
+    for (auto& value : centers) {
+        value = center_dist(gen);
+    }
+    std::vector<std::vector<float>> token_storage(doc_count);
+    std::vector<MultiVector> docs(doc_count);
+    std::vector<float> all_tokens;
+    for (uint32_t i = 0; i < doc_count; ++i) {
+        const uint32_t token_count = 3 + i * 7;
+        for (uint32_t t = 0; t < token_count; ++t) {
+            const float* center = centers.data() + ((i + t) % cluster_count) * dim;
+            for (uint32_t k = 0; k < dim; ++k) {
+                token_storage[i].push_back(center[k] + noise_dist(gen));
+            }
+        }
+        docs[i] = MultiVector{token_count, token_storage[i].data()};
+        all_tokens.insert(all_tokens.end(), token_storage[i].begin(), token_storage[i].end());
+    }
+    std::vector<float> query_data(3 * dim);
+    for (auto& value : query_data) {
+        value = query_dist(gen);
+    }
+    MultiVector query_mv{3, query_data.data()};
+    std::vector<InnerIdType> idx(doc_count);
+    std::iota(idx.begin(), idx.end(), 0);
+
+    std::shared_ptr<Allocator> allocator = SafeAllocator::FactoryDefaultAllocator();
+    auto query_error = [&](const FlattenInterfacePtr& data_cell) {
+        std::vector<float> dists(doc_count);
+        auto computer = data_cell->FactoryComputer(&query_mv);
+        data_cell->Query(dists.data(), computer, idx.data(), doc_count);
+        float error = 0.0F;
+        for (uint32_t i = 0; i < doc_count; ++i) {
+            error += std::abs(dists[i] - CalMaxSimIP(query_data.data(),
+                                                     3,
+                                                     token_storage[i].data(),
+                                                     docs[i].len_,
+                                                     dim));
+        }
+        return error / doc_count;
+    };
+    auto build = [&](uint32_t residual_centroids) {
+        auto data_cell =
+            MakeQuantizedMultiVectorDataCell("sq4_uniform", residual_centroids, dim, allocator);
+        data_cell->Train(all_tokens.data(), all_tokens.size() / dim);
+        data_cell->Resize(doc_count);
+        data_cell->BatchInsertVector(docs.data(), doc_count, idx.data());
+        return data_cell;
+    };
+
+    auto plain = build(0);
+    auto residual = build(8);
+    const float plain_error = query_error(plain);
+    const float residual_error = query_error(residual);
+    REQUIRE(residual_error < 0.05F);
+    REQUIRE(residual_error < plain_error);
+
+    std::stringstream ss;
+    IOStreamWriter writer(ss);
+    residual->Serialize(writer);
+    auto restored = MakeQuantizedMultiVectorDataCell("sq4_uniform", 8, dim, allocator);
+    IOStreamReader reader(ss);
+    restored->Deserialize(reader);
+    REQUIRE(query_error(restored) == residual_error);
+
+    auto untrained = MakeQuantizedMultiVectorDataCell("sq4_uniform", 8, dim, allocator);
+    untrained->Resize(1);
+    REQUIRE_THROWS(untrained->InsertVector(docs.data(), 0));
+}
+
 TEST_CASE("MultiVectorDataCell rejects invalid InsertVector inputs", "[ut][MultiVectorDataCell]") {
     constexpr uint32_t dim = 4;
     std::shared_ptr<Allocator> allocator = SafeAllocator::FactoryDefaultAllocator();
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <limits>
 
 #include "datacell/sindi_datacell_utils.h"
 #include "simd/fp16_simd.h"
@@ -262,6 +263,45 @@ MutableSindiTermDataCell::QueryWindow(float* dists,
     computer->ResetTerm();
 }
 
+void
+MutableSindiTermDataCell::QueryWindowBatch(float* const* dists,
+                                          uint32_t window_id,
+                                          const Vector<SparseTermComputerPtr>& computers,
+                                          const SindiBatchQueryTerms& batch_terms) const {
+    CHECK_ARGUMENT(window_id < windows_.size(), "mutable SINDI window id out of range");
+    sindi_datacell_utils::AccumulateWindowBatch(
+        dists, computers, batch_terms, sparse_value_quant_type_, [this, window_id](uint32_t term) {
+            return this->GetTermPostingView(term, window_id);
+        });
+}
+
+float
+MutableSindiTermDataCell::GetWindowDistanceLowerBound(
+    uint32_t window_id,
+    const SparseTermComputerPtr& computer,
+    const SindiQueryContext& query_context) const {
+    (void)query_context;
+    CHECK_ARGUMENT(window_id < windows_.size(), "mutable SINDI window id out of range");
+    const auto& window = windows_[window_id];
+    if (not window.postings_sorted_) {
+        return -std::numeric_limits<float>::infinity();
+    }
+    float bound = 0.0F;
+    for (uint32_t it = 0; it < computer->pruned_len_; ++it) {
+        const auto term = computer->GetTerm(it);
+        if (term >= window.term_sizes_.size() || window.term_sizes_[term] == 0) {
+            continue;
+        }
+        bound += sindi_datacell_utils::GetPostingDistanceLowerBound(
+            computer->sorted_query_[it].second,
+            window.term_datas_[term]->data(),
+            computer->GetTermScanCount(window.term_sizes_[term]),
+            sparse_value_quant_type_,
+            quantization_params_.get());
+    }
+    return bound;
+}
+
 bool
 MutableSindiTermDataCell::InsertHeapByWindow(float* dists,
                                              uint32_t window_id,
@@ -160,6 +160,44 @@ TEST_CASE("MutableSindiTermDataCell prunes sorted postings", "[ut][MutableSindiT
     REQUIRE(sorted_distances[2] == 0.0F);
 }
 
+TEST_CASE("MutableSindiTermDataCell bounds window distances from sorted postings",
+          "[ut][MutableSindiTermDataCell]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    auto data_cell = std::make_shared<MutableSindiTermDataCell>(
+        16, 4, allocator.get(), SparseValueQuantizationType::FP32, nullptr);
+
+    std::array<uint32_t, 2> terms = {3, 5};
+    std::array<std::array<float, 2>, 4> values = {
+        {{1.0F, 2.0F}, {3.0F, 0.0F}, {2.0F, -1.0F}, {0.5F, 0.0F}}};
+    std::array<uint32_t, 4> term_counts = {2, 1, 2, 1};
+    for (uint32_t document = 0; document < values.size(); ++document) {
+        SparseVector vector{term_counts[document], terms.data(), values[document].data()};
+        data_cell->InsertVector(vector, document);
+    }
+    data_cell->SortByValue(0);
+
+    // a negative query value is bounded by the smallest stored value of its list
+    std::array<float, 2> query_values = {1.0F, -2.0F};
+    SparseVector query{2, terms.data(), query_values.data()};
+    SINDISearchParameter search_parameter;
+    auto computer = std::make_shared<SparseTermComputer>(query, search_parameter, allocator.get());
+    SindiQueryContext query_context(allocator.get());
+    const auto bound = data_cell->GetWindowDistanceLowerBound(0, computer, query_context);
+    REQUIRE(bound == -5.0F);
+
+    std::array<float, 4> distances{};
+    QueryFirstWindow(data_cell, distances.data(), computer, allocator.get());
+    for (auto distance : distances) {
+        REQUIRE(bound <= distance);
+    }
+
+    // postings appended after the sort leave the window unbounded until it is sorted again
+    SparseVector appended{1, terms.data(), values[1].data()};
+    data_cell->InsertVector(appended, 3);
+    REQUIRE(data_cell->GetWindowDistanceLowerBound(0, computer, query_context) ==
+            -std::numeric_limits<float>::infinity());
+}
+
 TEST_CASE("MutableSindiTermDataCell normalizes legacy posting order on deserialize",
           "[ut][MutableSindiTermDataCell]") {
     auto allocator = SafeAllocator::FactoryDefaultAllocator();
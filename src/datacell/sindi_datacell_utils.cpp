@@ -30,16 +30,6 @@ namespace vsag {
 namespace sindi_datacell_utils {
 namespace {
 
-uint64_t
-get_term_payload_size(uint32_t non_empty_window_count,
-                      uint32_t posting_count,
-                      uint32_t value_code_size) {
-    return sizeof(uint32_t) +
-           static_cast<uint64_t>(non_empty_window_count) * sizeof(TermWindowMeta) +
-           static_cast<uint64_t>(posting_count) * sizeof(uint16_t) + GetIdsPadding(posting_count) +
-           static_cast<uint64_t>(posting_count) * value_code_size;
-}
-
 void
 validate_term_posting_record(const TermPostingRecord& record,
                              uint32_t term_dict_count,
@@ -110,6 +100,51 @@ DecodeValue(const uint8_t* source,
     return value;
 }
 
+float
+GetPostingDistanceLowerBound(float query_value,
+                             const uint8_t* values,
+                             uint32_t scan_count,
+                             SparseValueQuantizationType type,
+                             const QuantizationParams* quantization_params) {
+    if (scan_count == 0) {
+        return 0.0F;
+    }
+    const auto first = DecodeValue(values, type, quantization_params);
+    // fp16 codes are sorted as integers, which only matches the value order without negatives
+    if (type == SparseValueQuantizationType::FP16 and std::signbit(first)) {
+        return -std::numeric_limits<float>::infinity();
+    }
+    const auto last =
+        DecodeValue(values + static_cast<uint64_t>(scan_count - 1) * GetValueCodeSize(type),
+                    type,
+                    quantization_params);
+    return std::min({0.0F, query_value * first, query_value * last});
+}
+
+Vector<std::pair<float, uint32_t>>
+OrderWindowsByLowerBound(const SindiSearchTermDataCell& term_datacell,
+                         int64_t min_window_id,
+                         int64_t max_window_id,
+                         const SparseTermComputerPtr& computer,
+                         const SindiQueryContext& query_context,
+                         Allocator* allocator) {
+    Vector<std::pair<float, uint32_t>> windows(allocator);
+    if (min_window_id > max_window_id) {
+        return windows;
+    }
+    windows.reserve(static_cast<uint64_t>(max_window_id - min_window_id + 1));
+    for (auto window_id = min_window_id; window_id <= max_window_id; ++window_id) {
+        const auto id = static_cast<uint32_t>(window_id);
+        windows.emplace_back(term_datacell.GetWindowDistanceLowerBound(id, computer, query_context),
+                             id);
+    }
+    std::stable_sort(windows.begin(),
+                     windows.end(),
+                     [](const std::pair<float, uint32_t>& lhs,
+                        const std::pair<float, uint32_t>& rhs) { return lhs.first < rhs.first; });
+    return windows;
+}
+
 void
 SortPostingListByValue(uint16_t* ids,
                        uint8_t* data,
@@ -173,6 +208,16 @@ GetIdsPadding(uint64_t posting_count) {
     return (sizeof(uint32_t) - ids_size % sizeof(uint32_t)) % sizeof(uint32_t);
 }
 
+uint64_t
+GetTermPayloadSize(uint32_t non_empty_window_count,
+                   uint32_t posting_count,
+                   uint32_t value_code_size) {
+    return sizeof(uint32_t) +
+           static_cast<uint64_t>(non_empty_window_count) * sizeof(TermWindowMeta) +
+           static_cast<uint64_t>(posting_count) * sizeof(uint16_t) + GetIdsPadding(posting_count) +
+           static_cast<uint64_t>(posting_count) * value_code_size;
+}
+
 TermLayout
 BuildTermLayout(uint32_t term_dict_count,
                 uint32_t window_count,
@@ -219,7 +264,7 @@ BuildTermLayout(uint32_t term_dict_count,
             ++non_empty_window_count;
         }
         const auto payload_size =
-            get_term_payload_size(non_empty_window_count, posting_count, value_code_size);
+            GetTermPayloadSize(non_empty_window_count, posting_count, value_code_size);
         CHECK_ARGUMENT(payload_size <= std::numeric_limits<uint32_t>::max(),
                        "SINDI term payload exceeds uint32_t");
         layout.term_dict[term_id] = {
@@ -581,7 +626,7 @@ ReadTermPayloadMetadata(StreamReader& reader,
     reader.PopSeek();
 
     const auto expected_payload_size =
-        get_term_payload_size(non_empty_window_count, entry.posting_count, value_code_size);
+        GetTermPayloadSize(non_empty_window_count, entry.posting_count, value_code_size);
     CHECK_ARGUMENT(expected_payload_size == entry.posting_payload_size,
                    "SINDI_V2 term values size is invalid");
 
@@ -55,6 +55,83 @@ DecodeValue(const uint8_t* source,
             SparseValueQuantizationType type,
             const QuantizationParams* quantization_params);
 
+/**
+ * Lowest amount query_value * value adds to a distance among the first scan_count postings of a
+ * list sorted by SortPostingListByValue, never above 0 since a document without the term adds 0.
+ * Returns -inf when the order of the encoded values does not follow the decoded ones.
+ */
+[[nodiscard]] float
+GetPostingDistanceLowerBound(float query_value,
+                             const uint8_t* values,
+                             uint32_t scan_count,
+                             SparseValueQuantizationType type,
+                             const QuantizationParams* quantization_params);
+
+/**
+ * Windows [min_window_id, max_window_id] paired with their distance lower bound and sorted by it,
+ * so a search visiting them in order fills its heap from the most promising windows first.
+ */
+[[nodiscard]] Vector<std::pair<float, uint32_t>>
+OrderWindowsByLowerBound(const SindiSearchTermDataCell& term_datacell,
+                         int64_t min_window_id,
+                         int64_t max_window_id,
+                         const SparseTermComputerPtr& computer,
+                         const SindiQueryContext& query_context,
+                         Allocator* allocator);
+
+/// Whether no document of a window with distance lower bound lower_bound can enter heap, the
+/// bound is scaled by param.block_max_pruning_ratio first.
+template <InnerSearchMode mode>
+[[nodiscard]] bool
+CanSkipWindow(float lower_bound, const MaxHeap& heap, const InnerSearchParam& param) {
+    const auto bound = lower_bound * param.block_max_pruning_ratio;
+    if constexpr (mode == InnerSearchMode::KNN_SEARCH) {
+        return heap.size() >= param.ef and bound >= heap.top().first;
+    } else {
+        return bound > param.radius - 1;
+    }
+}
+
+/**
+ * Shared body of QueryWindowBatch: walks the term groups of batch_terms, fetches each posting list
+ * once through get_posting(term_id) and accumulates it into the dists of every query of the group
+ * with the SparseTermComputer scan of its value type.
+ */
+template <typename GetPostingFunc>
+void
+AccumulateWindowBatch(float* const* dists,
+                      const Vector<SparseTermComputerPtr>& computers,
+                      const SindiBatchQueryTerms& batch_terms,
+                      SparseValueQuantizationType type,
+                      const GetPostingFunc& get_posting) {
+    uint64_t begin = 0;
+    while (begin < batch_terms.size()) {
+        const auto term_id = batch_terms[begin].term_id;
+        auto end = begin + 1;
+        while (end < batch_terms.size() and batch_terms[end].term_id == term_id) {
+            ++end;
+        }
+        const SindiTermPostingView posting = get_posting(term_id);
+        for (auto index = begin; posting.count != 0 and index < end; ++index) {
+            const auto& query_term = batch_terms[index];
+            const auto& computer = computers[query_term.query_index];
+            auto* query_dists = dists[query_term.query_index];
+            const auto count = computer->GetTermScanCount(posting.count);
+            if (type == SparseValueQuantizationType::SQ8) {
+                computer->ScanForAccumulateSQ8(
+                    query_term.term_iterator, posting.ids, posting.values, count, query_dists);
+            } else if (type == SparseValueQuantizationType::FP16) {
+                computer->ScanForAccumulateFP16Bytes(
+                    query_term.term_iterator, posting.ids, posting.values, count, query_dists);
+            } else {
+                computer->ScanForAccumulateFloatBytes(
+                    query_term.term_iterator, posting.ids, posting.values, count, query_dists);
+            }
+        }
+        begin = end;
+    }
+}
+
 void
 SortPostingListByValue(uint16_t* ids,
                        uint8_t* data,
@@ -67,6 +144,12 @@ SortPostingListByValue(uint16_t* ids,
 [[nodiscard]] uint64_t
 GetIdsPadding(uint64_t posting_count);
 
+/// Bytes of one term payload: window count, window metas, ids with padding, then values.
+[[nodiscard]] uint64_t
+GetTermPayloadSize(uint32_t non_empty_window_count,
+                   uint32_t posting_count,
+                   uint32_t value_code_size);
+
 [[nodiscard]] TermLayout
 BuildTermLayout(uint32_t term_dict_count,
                 uint32_t window_count,
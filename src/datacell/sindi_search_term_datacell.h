@@ -29,6 +29,7 @@
 #include "utils/pointer_define.h"
 #include "vsag/allocator.h"
 #include "vsag/dataset.h"
+#include "vsag_exception.h"
 
 namespace vsag {
 
@@ -135,6 +136,16 @@ struct SindiTermPostingView {
 using QueryTermBuffers = UnorderedMap<uint32_t, SindiTermBuffer>;
 using MappedQueryTerms = Vector<std::pair<uint32_t, uint32_t>>;
 
+/// One query term of a query batch, term_iterator indexes the query's sorted_query_.
+struct SindiBatchQueryTerm {
+    uint32_t term_id{0};
+    uint32_t query_index{0};
+    uint32_t term_iterator{0};
+};
+
+/// Query terms of a batch sorted by term_id, so the queries sharing a term are adjacent.
+using SindiBatchQueryTerms = Vector<SindiBatchQueryTerm>;
+
 struct SindiQueryContext {
     explicit SindiQueryContext(Allocator* allocator)
         : query_term_buffers(allocator),
@@ -171,6 +182,35 @@ public:
                 bool use_term_lists_heap_insert,
                 SindiQueryContext& query_context) const = 0;
 
+    /**
+     * Batched QueryWindow: every posting list of window_id named in batch_terms is read once and
+     * accumulated into dists[query_index] of each query of the batch holding the term, using
+     * computers[query_index]. Memory DataCells override it; a disk DataCell loads its term
+     * buffers per query and does not support batches.
+     */
+    virtual void
+    QueryWindowBatch(float* const* dists,
+                     uint32_t window_id,
+                     const Vector<SparseTermComputerPtr>& computers,
+                     const SindiBatchQueryTerms& batch_terms) const {
+        (void)dists;
+        (void)window_id;
+        (void)computers;
+        (void)batch_terms;
+        throw VsagException(ErrorType::UNSUPPORTED_INDEX_OPERATION,
+                            "batched window query is not supported by this SINDI term DataCell");
+    }
+
+    /**
+     * Lower bound of the distance QueryWindow can produce for any document of window_id, read
+     * from the first and last scanned posting of every value-sorted query term list. Returns
+     * -inf when the window cannot be bounded, e.g. a mutable window with unsorted postings.
+     */
+    [[nodiscard]] virtual float
+    GetWindowDistanceLowerBound(uint32_t window_id,
+                                const SparseTermComputerPtr& computer,
+                                const SindiQueryContext& query_context) const = 0;
+
     virtual bool
     InsertHeapByWindow(float* dists,
                        uint32_t window_id,
@@ -260,6 +260,7 @@ SparseGraphDataCell::MergeOther(GraphInterfacePtr other, uint64_t bias) {
 
 Vector<InnerIdType>
 SparseGraphDataCell::GetIds() const {
+    std::shared_lock<std::shared_mutex> rlock(this->neighbors_map_mutex_);
     Vector<InnerIdType> ids(allocator_);
     for (const auto& item : neighbors_) {
         ids.push_back(item.first);
@@ -15,17 +15,19 @@
 
 #include "vsag/resource.h"
 
+#include "impl/allocator/memory_budget.h"
 #include "impl/allocator/safe_allocator.h"
 #include "impl/thread_pool/safe_thread_pool.h"
 
 namespace vsag {
 
-Resource::Resource() {
+Resource::Resource() : memory_budget_(std::make_shared<MemoryBudget>()) {
     this->allocator_ = SafeAllocator::FactoryDefaultAllocator();
     this->thread_pool_ = SafeThreadPool::FactoryDefaultThreadPool();
 }
 
-Resource::Resource(Allocator* allocator, ThreadPool* thread_pool) {
+Resource::Resource(Allocator* allocator, ThreadPool* thread_pool)
+    : memory_budget_(std::make_shared<MemoryBudget>()) {
     if (allocator != nullptr) {
         this->allocator_ = std::make_shared<SafeAllocator>(allocator, false);
     }
@@ -35,7 +37,8 @@ Resource::Resource(Allocator* allocator, ThreadPool* thread_pool) {
 }
 
 Resource::Resource(const std::shared_ptr<Allocator>& allocator,
-                   const std::shared_ptr<ThreadPool>& thread_pool) {
+                   const std::shared_ptr<ThreadPool>& thread_pool)
+    : memory_budget_(std::make_shared<MemoryBudget>()) {
     if (allocator != nullptr) {
         this->allocator_ = std::make_shared<SafeAllocator>(allocator);
     }
@@ -44,4 +47,19 @@ Resource::Resource(const std::shared_ptr<Allocator>& allocator,
     }
 }
 
+void
+Resource::SetMemoryLimit(uint64_t limit) {
+    this->GetMemoryBudget()->SetLimit(limit);
+}
+
+uint64_t
+Resource::GetMemoryLimit() const {
+    return this->GetMemoryBudget()->GetLimit();
+}
+
+std::unordered_map<std::string, uint64_t>
+Resource::GetMemoryUsageDetail() const {
+    return this->GetMemoryBudget()->GetUsageDetail();
+}
+
 }  // namespace vsag
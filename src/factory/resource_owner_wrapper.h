@@ -34,6 +34,11 @@ public:
         return resource_->GetThreadPool();
     }
 
+    std::shared_ptr<MemoryBudget>
+    GetMemoryBudget() const override {
+        return resource_->GetMemoryBudget();
+    }
+
     ~ResourceOwnerWrapper() override {
         if (owned_) {
             delete resource_;
@@ -0,0 +1,275 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "vsag/hybrid_search.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "common.h"
+#include "json_types.h"
+#include "impl/logger/logger.h"
+#include "vsag_exception.h"
+
+namespace vsag {
+
+namespace {
+
+struct HybridCandidate {
+    int64_t label{0};
+    float score{0.0F};
+};
+
+DatasetPtr
+unwrap_result(const tl::expected<DatasetPtr, Error>& result, const char* side) {
+    if (not result.has_value()) {
+        throw VsagException(result.error().type,
+                            fmt::format("{} search failed: {}", side, result.error().message));
+    }
+    return result.value();
+}
+
+/// Min-max normalization maps the best (smallest) distance to 1 and the worst to 0.
+float
+normalized_similarity(float dist, float min_dist, float max_dist) {
+    const float range = max_dist - min_dist;
+    return range > 0.0F ? (max_dist - dist) / range : 1.0F;
+}
+
+/// Adds the fusion score of every result of one side, higher is better.
+void
+accumulate_scores(const DatasetPtr& result,
+                  const HybridSearchRequest& request,
+                  float weight,
+                  std::unordered_map<int64_t, uint64_t>& positions,
+                  std::vector<HybridCandidate>& candidates) {
+    const auto count = result->GetDim();
+    if (count <= 0) {
+        return;
+    }
+    const auto* ids = result->GetIds();
+    const auto* dists = result->GetDistances();
+    const auto [min_dist, max_dist] = std::minmax_element(dists, dists + count);
+    for (int64_t i = 0; i < count; ++i) {
+        float score = 0.0F;
+        if (request.fusion_type_ == HybridFusionType::RRF) {
+            score = weight / static_cast<float>(request.rrf_k_ + i + 1);
+        } else {
+            score = weight * normalized_similarity(dists[i], *min_dist, *max_dist);
+        }
+        auto [iter, inserted] = positions.emplace(ids[i], candidates.size());
+        if (inserted) {
+            candidates.push_back({ids[i], score});
+        } else {
+            candidates[iter->second].score += score;
+        }
+    }
+}
+
+/// Exact distances of labels on one side, empty for labels the index does not hold.
+std::vector<std::optional<float>>
+exact_distances(const IndexPtr& index,
+                const DatasetPtr& query,
+                const std::vector<int64_t>& labels,
+                const char* side) {
+    // membership comes from CheckIdExist where the index supports it, since -1 is also a
+    // valid distance, e.g. for inner product
+    std::vector<bool> exists(labels.size(), true);
+    bool checked = true;
+    try {
+        for (uint64_t i = 0; i < labels.size(); ++i) {
+            exists[i] = index->CheckIdExist(labels[i]);
+        }
+    } catch (const std::exception&) {
+        checked = false;
+    }
+    auto result = unwrap_result(
+        index->CalcDistancesById(query, labels.data(), static_cast<int64_t>(labels.size())),
+        side);
+    const auto* dists = result->GetDistances();
+    std::vector<std::optional<float>> distances(labels.size());
+    for (uint64_t i = 0; i < labels.size(); ++i) {
+        // without CheckIdExist, fall back to the -1 CalcDistancesById reports for missing ids
+        if (checked ? exists[i] : dists[i] != -1.0F) {
+            distances[i] = dists[i];
+        }
+    }
+    return distances;
+}
+
+DatasetPtr
+make_result(const std::vector<HybridCandidate>& candidates, uint64_t count) {
+    auto result = Dataset::Make();
+    result->NumElements(1)->Dim(static_cast<int64_t>(count))->Owner(true);
+    if (count == 0) {
+        return result;
+    }
+    auto* ids = new int64_t[count];
+    auto* dists = new float[count];
+    for (uint64_t i = 0; i < count; ++i) {
+        ids[i] = candidates[i].label;
+        dists[i] = candidates[i].score;
+    }
+    result->Ids(ids)->Distances(dists);
+    return result;
+}
+
+DatasetPtr
+hybrid_search_impl(const IndexPtr& dense_index,
+                   const IndexPtr& sparse_index,
+                   const HybridSearchRequest& request) {
+    CHECK_ARGUMENT(dense_index != nullptr and sparse_index != nullptr,
+                   "hybrid search requires a dense and a sparse index");
+    CHECK_ARGUMENT(request.dense_request_.query_ != nullptr and
+                       request.sparse_request_.query_ != nullptr,
+                   "hybrid search requires a dense and a sparse query");
+    CHECK_ARGUMENT(request.dense_request_.mode_ == SearchMode::KNN_SEARCH and
+                       request.sparse_request_.mode_ == SearchMode::KNN_SEARCH,
+                   "hybrid search only supports knn requests");
+    CHECK_ARGUMENT(request.topk_ > 0,
+                   fmt::format("hybrid topk must be positive, got {}", request.topk_));
+    CHECK_ARGUMENT(request.dense_weight_ >= 0.0F and request.sparse_weight_ >= 0.0F and
+                       request.dense_weight_ + request.sparse_weight_ > 0.0F,
+                   "hybrid weights must be non-negative and not both zero");
+
+    // the sparse side is offered to the pool while the calling thread searches the dense side,
+    // and whichever thread claims it first runs it: a caller that is itself a worker of a busy
+    // or size-1 pool takes the sparse side back instead of waiting on a task that cannot start
+    struct SparseSide {
+        std::atomic<bool> claimed{false};
+        std::promise<void> done;
+        tl::expected<DatasetPtr, Error> result =
+            tl::unexpected(Error(ErrorType::INTERNAL_ERROR, "sparse search did not run"));
+    };
+    auto sparse_side = std::make_shared<SparseSide>();
+    auto sparse_finished = sparse_side->done.get_future();
+    auto search_sparse = [&sparse_index, &request](SparseSide& side) {
+        try {
+            side.result = sparse_index->SearchWithRequest(request.sparse_request_);
+        } catch (const std::exception& e) {
+            side.result = tl::unexpected(Error(ErrorType::INTERNAL_ERROR, e.what()));
+        } catch (...) {
+            side.result = tl::unexpected(Error(ErrorType::UNKNOWN_ERROR, "unknown exception"));
+        }
+        side.done.set_value();
+    };
+    if (request.thread_pool_ != nullptr) {
+        try {
+            // the task owns the shared state, it only touches this frame after claiming the
+            // work, and then the caller waits for it below
+            request.thread_pool_->Enqueue([sparse_side, search_sparse]() {
+                if (not sparse_side->claimed.exchange(true, std::memory_order_acq_rel)) {
+                    search_sparse(*sparse_side);
+                }
+            });
+        } catch (const std::exception& e) {
+            logger::warn("hybrid search runs the sparse side inline: {}", e.what());
+        }
+    }
+    tl::expected<DatasetPtr, Error> dense_result =
+        tl::unexpected(Error(ErrorType::INTERNAL_ERROR, "dense search did not run"));
+    try {
+        dense_result = dense_index->SearchWithRequest(request.dense_request_);
+    } catch (const std::exception& e) {
+        dense_result = tl::unexpected(Error(ErrorType::INTERNAL_ERROR, e.what()));
+    }
+    if (not sparse_side->claimed.exchange(true, std::memory_order_acq_rel)) {
+        search_sparse(*sparse_side);
+    }
+    // a pool worker that claimed the sparse side is running it, wait before reading the result
+    sparse_finished.wait();
+    auto sparse_result = std::move(sparse_side->result);
+    auto dense = unwrap_result(dense_result, "dense");
+    auto sparse = unwrap_result(sparse_result, "sparse");
+
+    std::unordered_map<int64_t, uint64_t> positions;
+    std::vector<HybridCandidate> candidates;
+    accumulate_scores(dense, request, request.dense_weight_, positions, candidates);
+    accumulate_scores(sparse, request, request.sparse_weight_, positions, candidates);
+    const auto candidate_count = candidates.size();
+
+    if (request.enable_rerank_ and not candidates.empty()) {
+        std::vector<int64_t> labels(candidates.size());
+        for (uint64_t i = 0; i < candidates.size(); ++i) {
+            labels[i] = candidates[i].label;
+        }
+        auto dense_dists =
+            exact_distances(dense_index, request.dense_request_.query_, labels, "dense");
+        auto sparse_dists =
+            exact_distances(sparse_index, request.sparse_request_.query_, labels, "sparse");
+        std::vector<int64_t> kept_labels;
+        std::vector<float> kept_dense;
+        std::vector<float> kept_sparse;
+        for (uint64_t i = 0; i < candidates.size(); ++i) {
+            if (dense_dists[i].has_value() and sparse_dists[i].has_value()) {
+                kept_labels.push_back(labels[i]);
+                kept_dense.push_back(*dense_dists[i]);
+                kept_sparse.push_back(*sparse_dists[i]);
+            }
+        }
+        std::vector<HybridCandidate> reranked;
+        reranked.reserve(kept_labels.size());
+        if (not kept_labels.empty()) {
+            // the two metrics live on unrelated scales, so they are normalized like the fusion
+            const auto [dense_min, dense_max] =
+                std::minmax_element(kept_dense.begin(), kept_dense.end());
+            const auto [sparse_min, sparse_max] =
+                std::minmax_element(kept_sparse.begin(), kept_sparse.end());
+            for (uint64_t i = 0; i < kept_labels.size(); ++i) {
+                reranked.push_back(
+                    {kept_labels[i],
+                     request.dense_weight_ *
+                             normalized_similarity(kept_dense[i], *dense_min, *dense_max) +
+                         request.sparse_weight_ *
+                             normalized_similarity(kept_sparse[i], *sparse_min, *sparse_max)});
+            }
+        }
+        candidates.swap(reranked);
+    }
+
+    const auto count = std::min(candidates.size(), static_cast<uint64_t>(request.topk_));
+    auto better = [](const HybridCandidate& lhs, const HybridCandidate& rhs) {
+        return lhs.score > rhs.score or (lhs.score == rhs.score and lhs.label < rhs.label);
+    };
+    std::partial_sort(candidates.begin(), candidates.begin() + count, candidates.end(), better);
+    for (uint64_t i = 0; i < count; ++i) {
+        candidates[i].score = -candidates[i].score;
+    }
+
+    auto result = make_result(candidates, count);
+    JsonType statistics;
+    statistics["dense"].SetJson(JsonType::Parse(dense->GetStatistics(), false));
+    statistics["sparse"].SetJson(JsonType::Parse(sparse->GetStatistics(), false));
+    statistics["fused_candidate_count"].SetUint64(candidate_count);
+    result->Statistics(statistics.Dump());
+    return result;
+}
+
+}  // namespace
+
+tl::expected<DatasetPtr, Error>
+HybridSearch(const IndexPtr& dense_index,
+             const IndexPtr& sparse_index,
+             const HybridSearchRequest& request) {
+    SAFE_CALL(return hybrid_search_impl(dense_index, sparse_index, request));
+}
+
+}  // namespace vsag
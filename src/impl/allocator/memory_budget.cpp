@@ -0,0 +1,373 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "memory_budget.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+
+#include "vsag_exception.h"
+
+namespace vsag {
+
+namespace {
+
+// keeps the malloc alignment (16 bytes) of the block handed out behind the header
+struct alignas(16) BlockHeader {
+    uint64_t size;
+    uint64_t category;
+};
+
+static_assert(sizeof(BlockHeader) == 16);
+
+// the header is charged too, so an allocator with outstanding blocks never reports zero usage
+constexpr uint64_t BLOCK_OVERHEAD = sizeof(BlockHeader);
+
+thread_local MemoryCategory current_category = MemoryCategory::INDEX;
+
+inline BlockHeader*
+header_of(void* p) {
+    return static_cast<BlockHeader*>(p) - 1;
+}
+
+bool
+try_charge_limited(std::atomic<uint64_t>& used, uint64_t limit, uint64_t size) {
+    auto current = used.load(std::memory_order_relaxed);
+    do {
+        if (limit != 0 and (current > limit or size > limit - current)) {
+            return false;
+        }
+    } while (not used.compare_exchange_weak(current, current + size, std::memory_order_relaxed));
+    return true;
+}
+
+void
+fill_usage_detail(std::unordered_map<std::string, uint64_t>& detail,
+                  const std::atomic<uint64_t>* category_used) {
+    for (uint64_t i = 0; i < static_cast<uint64_t>(MemoryCategory::COUNT); ++i) {
+        detail[MemoryCategoryName(static_cast<MemoryCategory>(i))] =
+            category_used[i].load(std::memory_order_relaxed);
+    }
+}
+
+}  // namespace
+
+const char*
+MemoryCategoryName(MemoryCategory category) {
+    switch (category) {
+        case MemoryCategory::INDEX:
+            return "index";
+        case MemoryCategory::VISITED_LIST:
+            return "visited_list";
+        case MemoryCategory::SEARCH:
+            return "search";
+        case MemoryCategory::IO_CACHE:
+            return "io_cache";
+        default:
+            return "unknown";
+    }
+}
+
+ScopedMemoryCategory::ScopedMemoryCategory(MemoryCategory category)
+    : previous_(current_category) {
+    current_category = category;
+}
+
+ScopedMemoryCategory::~ScopedMemoryCategory() {
+    current_category = previous_;
+}
+
+MemoryCategory
+ScopedMemoryCategory::Current() {
+    return current_category;
+}
+
+BudgetAllocator::BudgetAllocator(std::shared_ptr<Allocator> raw_allocator,
+                                 MemoryBudget* budget,
+                                 uint64_t limit)
+    : raw_allocator_(std::move(raw_allocator)), budget_(budget), limit_(limit) {
+}
+
+std::string
+BudgetAllocator::Name() {
+    return raw_allocator_->Name() + "_budget";
+}
+
+void*
+BudgetAllocator::Allocate(uint64_t size) {
+    const auto category = ScopedMemoryCategory::Current();
+    this->charge(size + BLOCK_OVERHEAD, category);
+    void* block = nullptr;
+    try {
+        block = raw_allocator_->Allocate(size + BLOCK_OVERHEAD);
+    } catch (...) {
+        this->release(size + BLOCK_OVERHEAD, category);
+        throw;
+    }
+    if (block == nullptr) {
+        this->release(size + BLOCK_OVERHEAD, category);
+        return nullptr;
+    }
+    auto* header = static_cast<BlockHeader*>(block);
+    header->size = size;
+    header->category = static_cast<uint64_t>(category);
+    return header + 1;
+}
+
+void
+BudgetAllocator::Deallocate(void* p) {
+    if (p == nullptr) {
+        return;
+    }
+    auto* header = header_of(p);
+    this->release(header->size + BLOCK_OVERHEAD, static_cast<MemoryCategory>(header->category));
+    raw_allocator_->Deallocate(header);
+}
+
+void*
+BudgetAllocator::Reallocate(void* p, uint64_t size) {
+    if (p == nullptr) {
+        return this->Allocate(size);
+    }
+    auto* header = header_of(p);
+    const auto old_size = header->size;
+    const auto category = static_cast<MemoryCategory>(header->category);
+    if (size > old_size) {
+        this->charge(size - old_size, category);
+    }
+    void* block = nullptr;
+    try {
+        block = raw_allocator_->Reallocate(header, size + BLOCK_OVERHEAD);
+    } catch (...) {
+        if (size > old_size) {
+            this->release(size - old_size, category);
+        }
+        throw;
+    }
+    if (block == nullptr) {
+        if (size > old_size) {
+            this->release(size - old_size, category);
+        }
+        return nullptr;
+    }
+    if (size < old_size) {
+        this->release(old_size - size, category);
+    }
+    header = static_cast<BlockHeader*>(block);
+    header->size = size;
+    return header + 1;
+}
+
+bool
+BudgetAllocator::CanAdmit(uint64_t bytes) const {
+    const auto used = this->GetUsage();
+    if (this->limit_ != 0 and (used > this->limit_ or bytes > this->limit_ - used)) {
+        return false;
+    }
+    return this->budget_->CanAdmit(bytes);
+}
+
+bool
+BudgetAllocator::TryAdmit(uint64_t bytes) {
+    if (this->CanAdmit(bytes)) {
+        return true;
+    }
+    this->Reclaim(bytes);
+    if (this->CanAdmit(bytes)) {
+        return true;
+    }
+    this->budget_->Reclaim(bytes);
+    return this->CanAdmit(bytes);
+}
+
+void
+BudgetAllocator::RegisterReclaimer(const std::weak_ptr<void>& owner, MemoryReclaimer reclaimer) {
+    std::scoped_lock lock(this->reclaimer_mutex_);
+    this->reclaimers_.erase(
+        std::remove_if(this->reclaimers_.begin(),
+                       this->reclaimers_.end(),
+                       [](const Reclaimer& item) { return item.owner.expired(); }),
+        this->reclaimers_.end());
+    // a cache shared by several IO views is registered once
+    for (const auto& item : this->reclaimers_) {
+        if (not item.owner.owner_before(owner) and not owner.owner_before(item.owner)) {
+            return;
+        }
+    }
+    this->reclaimers_.push_back({owner, std::move(reclaimer)});
+}
+
+uint64_t
+BudgetAllocator::Reclaim(uint64_t bytes) {
+    std::scoped_lock lock(this->reclaimer_mutex_);
+    uint64_t freed = 0;
+    for (auto& item : this->reclaimers_) {
+        if (freed >= bytes) {
+            break;
+        }
+        // holding the owner keeps the cache alive while it is being shrunk
+        auto owner = item.owner.lock();
+        if (owner != nullptr) {
+            freed += item.reclaim(bytes - freed);
+        }
+    }
+    return freed;
+}
+
+std::unordered_map<std::string, uint64_t>
+BudgetAllocator::GetUsageDetail() const {
+    std::unordered_map<std::string, uint64_t> detail;
+    fill_usage_detail(detail, this->category_used_.data());
+    detail["total"] = this->GetUsage();
+    detail["limit"] = this->limit_;
+    return detail;
+}
+
+bool
+BudgetAllocator::try_charge_local(uint64_t size) {
+    return try_charge_limited(this->used_, this->limit_, size);
+}
+
+void
+BudgetAllocator::charge(uint64_t size, MemoryCategory category) {
+    if (not this->try_charge_local(size)) {
+        // the index limit is hit: only the caches of this index can help
+        this->Reclaim(size);
+        if (not this->try_charge_local(size)) {
+            throw VsagException(
+                ErrorType::NO_ENOUGH_MEMORY,
+                fmt::format("index memory limit exceeded: allocating {} bytes with {} of {} used",
+                            size,
+                            this->GetUsage(),
+                            this->limit_));
+        }
+    }
+    if (not this->budget_->charge(size, category)) {
+        this->used_.fetch_sub(size, std::memory_order_relaxed);
+        throw VsagException(
+            ErrorType::NO_ENOUGH_MEMORY,
+            fmt::format("memory budget exceeded: allocating {} bytes with {} of {} used",
+                        size,
+                        this->budget_->GetUsage(),
+                        this->budget_->GetLimit()));
+    }
+    this->category_used_[static_cast<uint64_t>(category)].fetch_add(size,
+                                                                    std::memory_order_relaxed);
+}
+
+void
+BudgetAllocator::release(uint64_t size, MemoryCategory category) {
+    this->category_used_[static_cast<uint64_t>(category)].fetch_sub(size,
+                                                                    std::memory_order_relaxed);
+    this->used_.fetch_sub(size, std::memory_order_relaxed);
+    this->budget_->release(size, category);
+}
+
+MemoryBudget::MemoryBudget(uint64_t limit) : limit_(limit), enabled_(limit != 0) {
+}
+
+std::shared_ptr<Allocator>
+MemoryBudget::CreateIndexAllocator(const std::shared_ptr<MemoryBudget>& budget,
+                                   const std::shared_ptr<Allocator>& raw_allocator,
+                                   uint64_t index_limit) {
+    auto* allocator = new BudgetAllocator(raw_allocator, budget.get(), index_limit);
+    {
+        std::scoped_lock lock(budget->allocators_mutex_);
+        budget->prune_closed_allocators();
+        budget->allocators_.emplace_back(allocator);
+    }
+    // the deleter keeps the budget alive as long as the index uses the allocator
+    return {allocator, [budget](BudgetAllocator* ptr) { budget->close(ptr); }};
+}
+
+bool
+MemoryBudget::CanAdmit(uint64_t bytes) const {
+    const auto limit = this->GetLimit();
+    const auto used = this->GetUsage();
+    return limit == 0 or (used <= limit and bytes <= limit - used);
+}
+
+uint64_t
+MemoryBudget::Reclaim(uint64_t bytes) {
+    std::scoped_lock lock(this->allocators_mutex_);
+    uint64_t freed = 0;
+    for (auto& allocator : this->allocators_) {
+        if (freed >= bytes) {
+            break;
+        }
+        freed += allocator->Reclaim(bytes - freed);
+    }
+    return freed;
+}
+
+std::unordered_map<std::string, uint64_t>
+MemoryBudget::GetUsageDetail() {
+    std::unordered_map<std::string, uint64_t> detail;
+    fill_usage_detail(detail, this->category_used_.data());
+    detail["total"] = this->GetUsage();
+    detail["limit"] = this->GetLimit();
+    std::scoped_lock lock(this->allocators_mutex_);
+    this->prune_closed_allocators();
+    detail["index_count"] = this->allocators_.size();
+    return detail;
+}
+
+bool
+MemoryBudget::try_charge(uint64_t size) {
+    return try_charge_limited(this->used_, this->GetLimit(), size);
+}
+
+bool
+MemoryBudget::charge(uint64_t size, MemoryCategory category) {
+    if (not this->try_charge(size)) {
+        // disk-backed caches are the cheapest memory to give back, shrink them before failing
+        this->Reclaim(size);
+        if (not this->try_charge(size)) {
+            return false;
+        }
+    }
+    this->category_used_[static_cast<uint64_t>(category)].fetch_add(size,
+                                                                    std::memory_order_relaxed);
+    return true;
+}
+
+void
+MemoryBudget::release(uint64_t size, MemoryCategory category) {
+    this->category_used_[static_cast<uint64_t>(category)].fetch_sub(size,
+                                                                    std::memory_order_relaxed);
+    this->used_.fetch_sub(size, std::memory_order_relaxed);
+}
+
+void
+MemoryBudget::close(BudgetAllocator* allocator) {
+    allocator->closed_.store(true, std::memory_order_relaxed);
+    std::scoped_lock lock(this->allocators_mutex_);
+    this->prune_closed_allocators();
+}
+
+void
+MemoryBudget::prune_closed_allocators() {
+    this->allocators_.erase(std::remove_if(this->allocators_.begin(),
+                                           this->allocators_.end(),
+                                           [](const std::unique_ptr<BudgetAllocator>& allocator) {
+                                               return allocator->closed_.load(
+                                                          std::memory_order_relaxed) and
+                                                      allocator->GetUsage() == 0;
+                                           }),
+                            this->allocators_.end());
+}
+
+}  // namespace vsag
@@ -0,0 +1,270 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "vsag/allocator.h"
+
+namespace vsag {
+
+/// What an allocation is used for, attributed by the innermost ScopedMemoryCategory.
+enum class MemoryCategory : uint8_t {
+    INDEX = 0,
+    VISITED_LIST = 1,
+    SEARCH = 2,
+    IO_CACHE = 3,
+    COUNT = 4,
+};
+
+const char*
+MemoryCategoryName(MemoryCategory category);
+
+/**
+ * @brief Attributes the allocations of the calling thread to a category for its lifetime.
+ *
+ * Guards nest, the previous category is restored on destruction.
+ */
+class ScopedMemoryCategory {
+public:
+    explicit ScopedMemoryCategory(MemoryCategory category);
+
+    ~ScopedMemoryCategory();
+
+    ScopedMemoryCategory(const ScopedMemoryCategory&) = delete;
+    ScopedMemoryCategory&
+    operator=(const ScopedMemoryCategory&) = delete;
+
+    static MemoryCategory
+    Current();
+
+private:
+    MemoryCategory previous_;
+};
+
+/// Releases up to the requested bytes (e.g. by evicting cached pages), returns the bytes freed.
+using MemoryReclaimer = std::function<uint64_t(uint64_t)>;
+
+class MemoryBudget;
+
+/**
+ * @brief Allocator of one index that charges every allocation to the index and to the budget.
+ *
+ * Each block carries a small header with its size and category so that deallocation can be
+ * accounted without a lookup. An allocation that would exceed the index limit or the global
+ * limit first asks the registered reclaimers (read caches) to shrink, then throws
+ * NO_ENOUGH_MEMORY. Instances are created and owned by MemoryBudget::CreateIndexAllocator.
+ */
+class BudgetAllocator : public Allocator {
+public:
+    BudgetAllocator(std::shared_ptr<Allocator> raw_allocator,
+                    MemoryBudget* budget,
+                    uint64_t limit);
+
+    ~BudgetAllocator() override = default;
+
+    std::string
+    Name() override;
+
+    void*
+    Allocate(uint64_t size) override;
+
+    void
+    Deallocate(void* p) override;
+
+    void*
+    Reallocate(void* p, uint64_t size) override;
+
+public:
+    [[nodiscard]] uint64_t
+    GetUsage() const {
+        return this->used_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t
+    GetUsage(MemoryCategory category) const {
+        return this->category_used_[static_cast<uint64_t>(category)].load(
+            std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t
+    GetLimit() const {
+        return this->limit_;
+    }
+
+    /// Whether bytes more could be charged right now, without reclaiming anything.
+    [[nodiscard]] bool
+    CanAdmit(uint64_t bytes) const;
+
+    /// Like CanAdmit, but shrinks the read caches of this index and then of all indexes first.
+    bool
+    TryAdmit(uint64_t bytes);
+
+    /// Registers a reclaimer that is dropped once owner expires, once per owner.
+    void
+    RegisterReclaimer(const std::weak_ptr<void>& owner, MemoryReclaimer reclaimer);
+
+    /// Runs the reclaimers of this index until bytes are freed, returns the bytes freed.
+    uint64_t
+    Reclaim(uint64_t bytes);
+
+    /// Usage per category plus the total and the limit of this index.
+    [[nodiscard]] std::unordered_map<std::string, uint64_t>
+    GetUsageDetail() const;
+
+private:
+    friend class MemoryBudget;
+
+    void
+    charge(uint64_t size, MemoryCategory category);
+
+    void
+    release(uint64_t size, MemoryCategory category);
+
+    bool
+    try_charge_local(uint64_t size);
+
+private:
+    struct Reclaimer {
+        std::weak_ptr<void> owner;
+        MemoryReclaimer reclaim;
+    };
+
+    std::shared_ptr<Allocator> const raw_allocator_;
+
+    MemoryBudget* const budget_{nullptr};
+
+    const uint64_t limit_{0};
+
+    std::atomic<uint64_t> used_{0};
+
+    std::array<std::atomic<uint64_t>, static_cast<uint64_t>(MemoryCategory::COUNT)>
+        category_used_{};
+
+    std::mutex reclaimer_mutex_;
+    std::vector<Reclaimer> reclaimers_;
+
+    std::atomic<bool> closed_{false};
+};
+
+/**
+ * @brief Global memory budget shared by all indexes created on one Resource.
+ *
+ * A limit of 0 means unlimited; usage is tracked either way. When the global limit is hit the
+ * read caches of every live index are shrunk before the allocation is refused.
+ */
+class MemoryBudget {
+public:
+    explicit MemoryBudget(uint64_t limit = 0);
+
+    ~MemoryBudget() = default;
+
+    MemoryBudget(const MemoryBudget&) = delete;
+    MemoryBudget&
+    operator=(const MemoryBudget&) = delete;
+
+    /**
+     * @brief Wraps raw_allocator in a BudgetAllocator charged to budget.
+     *
+     * The returned allocator stays alive inside the budget after the last reference is gone
+     * while memory allocated from it (e.g. search results) is still outstanding.
+     */
+    static std::shared_ptr<Allocator>
+    CreateIndexAllocator(const std::shared_ptr<MemoryBudget>& budget,
+                         const std::shared_ptr<Allocator>& raw_allocator,
+                         uint64_t index_limit);
+
+    /// Sets the limit and enables accounting for the indexes created afterwards.
+    void
+    SetLimit(uint64_t limit) {
+        this->limit_.store(limit, std::memory_order_relaxed);
+        this->enabled_.store(true, std::memory_order_relaxed);
+    }
+
+    /// Whether new indexes should be charged to this budget.
+    [[nodiscard]] bool
+    IsEnabled() const {
+        return this->enabled_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t
+    GetLimit() const {
+        return this->limit_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t
+    GetUsage() const {
+        return this->used_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t
+    GetUsage(MemoryCategory category) const {
+        return this->category_used_[static_cast<uint64_t>(category)].load(
+            std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool
+    CanAdmit(uint64_t bytes) const;
+
+    /// Runs the reclaimers of all live indexes until bytes are freed, returns the bytes freed.
+    uint64_t
+    Reclaim(uint64_t bytes);
+
+    /// Usage per category plus the total, the limit and the number of live index allocators.
+    [[nodiscard]] std::unordered_map<std::string, uint64_t>
+    GetUsageDetail();
+
+private:
+    friend class BudgetAllocator;
+
+    bool
+    charge(uint64_t size, MemoryCategory category);
+
+    void
+    release(uint64_t size, MemoryCategory category);
+
+    bool
+    try_charge(uint64_t size);
+
+    void
+    close(BudgetAllocator* allocator);
+
+    void
+    prune_closed_allocators();
+
+private:
+    std::atomic<uint64_t> limit_{0};
+
+    std::atomic<bool> enabled_{false};
+
+    std::atomic<uint64_t> used_{0};
+
+    std::array<std::atomic<uint64_t>, static_cast<uint64_t>(MemoryCategory::COUNT)>
+        category_used_{};
+
+    std::mutex allocators_mutex_;
+    std::vector<std::unique_ptr<BudgetAllocator>> allocators_;
+};
+
+}  // namespace vsag
@@ -0,0 +1,119 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "memory_budget.h"
+
+#include "safe_allocator.h"
+#include "unittest.h"
+#include "vsag_exception.h"
+
+using namespace vsag;
+
+TEST_CASE("MemoryBudget Accounting Test", "[ut][MemoryBudget]") {
+    auto budget = std::make_shared<MemoryBudget>();
+    REQUIRE_FALSE(budget->IsEnabled());
+    auto allocator =
+        MemoryBudget::CreateIndexAllocator(budget, SafeAllocator::FactoryDefaultAllocator(), 0);
+    auto* budget_allocator = dynamic_cast<BudgetAllocator*>(allocator.get());
+    REQUIRE(budget_allocator != nullptr);
+
+    void* index_data = allocator->Allocate(1000);
+    void* visited = nullptr;
+    {
+        ScopedMemoryCategory category(MemoryCategory::VISITED_LIST);
+        visited = allocator->Allocate(200);
+    }
+    REQUIRE(ScopedMemoryCategory::Current() == MemoryCategory::INDEX);
+    REQUIRE(budget_allocator->GetUsage(MemoryCategory::INDEX) >= 1000);
+    REQUIRE(budget_allocator->GetUsage(MemoryCategory::VISITED_LIST) >= 200);
+    REQUIRE(budget->GetUsage() == budget_allocator->GetUsage());
+
+    // growing keeps the category of the block
+    visited = allocator->Reallocate(visited, 400);
+    REQUIRE(budget_allocator->GetUsage(MemoryCategory::VISITED_LIST) >= 400);
+    REQUIRE(budget->GetUsage(MemoryCategory::VISITED_LIST) ==
+            budget_allocator->GetUsage(MemoryCategory::VISITED_LIST));
+
+    allocator->Deallocate(index_data);
+    allocator->Deallocate(visited);
+    REQUIRE(budget_allocator->GetUsage() == 0);
+    REQUIRE(budget->GetUsage() == 0);
+
+    auto detail = budget->GetUsageDetail();
+    REQUIRE(detail["index_count"] == 1);
+    REQUIRE(detail["total"] == 0);
+    allocator.reset();
+    REQUIRE(budget->GetUsageDetail()["index_count"] == 0);
+}
+
+TEST_CASE("MemoryBudget Limit Test", "[ut][MemoryBudget]") {
+    auto budget = std::make_shared<MemoryBudget>();
+    budget->SetLimit(4096);
+    REQUIRE(budget->IsEnabled());
+    auto raw = SafeAllocator::FactoryDefaultAllocator();
+
+    SECTION("global limit") {
+        auto first = MemoryBudget::CreateIndexAllocator(budget, raw, 0);
+        auto second = MemoryBudget::CreateIndexAllocator(budget, raw, 0);
+        void* data = first->Allocate(3000);
+        REQUIRE_THROWS_AS(second->Allocate(2000), VsagException);
+        REQUIRE(budget->GetUsage() == dynamic_cast<BudgetAllocator*>(first.get())->GetUsage());
+        REQUIRE_FALSE(dynamic_cast<BudgetAllocator*>(second.get())->CanAdmit(2000));
+        first->Deallocate(data);
+        data = second->Allocate(2000);
+        second->Deallocate(data);
+    }
+
+    SECTION("index limit") {
+        auto limited = MemoryBudget::CreateIndexAllocator(budget, raw, 1024);
+        REQUIRE_THROWS_AS(limited->Allocate(2000), VsagException);
+        REQUIRE(budget->GetUsage() == 0);
+        void* data = limited->Allocate(512);
+        REQUIRE_THROWS_AS(limited->Reallocate(data, 2000), VsagException);
+        limited->Deallocate(data);
+    }
+
+    SECTION("reclaim before refusing") {
+        auto allocator = MemoryBudget::CreateIndexAllocator(budget, raw, 0);
+        auto* budget_allocator = dynamic_cast<BudgetAllocator*>(allocator.get());
+        auto cached = std::make_shared<void*>(allocator->Allocate(3000));
+        auto* slot = cached.get();
+        budget_allocator->RegisterReclaimer(cached, [&allocator, slot](uint64_t) -> uint64_t {
+            if (*slot == nullptr) {
+                return 0;
+            }
+            allocator->Deallocate(*slot);
+            *slot = nullptr;
+            return 3000;
+        });
+        REQUIRE(budget_allocator->TryAdmit(2000));
+        void* data = allocator->Allocate(2000);
+        REQUIRE(*cached == nullptr);
+        allocator->Deallocate(data);
+    }
+}
+
+TEST_CASE("MemoryBudget Outstanding Block Test", "[ut][MemoryBudget]") {
+    auto budget = std::make_shared<MemoryBudget>();
+    auto allocator =
+        MemoryBudget::CreateIndexAllocator(budget, SafeAllocator::FactoryDefaultAllocator(), 0);
+    Allocator* raw_pointer = allocator.get();
+    // e.g. a search result that outlives its index
+    void* result = raw_pointer->Allocate(0);
+    allocator.reset();
+    REQUIRE(budget->GetUsageDetail()["index_count"] == 1);
+    raw_pointer->Deallocate(result);
+    REQUIRE(budget->GetUsageDetail()["index_count"] == 0);
+}
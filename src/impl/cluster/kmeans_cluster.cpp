@@ -17,6 +17,9 @@
 
 #include <omp.h>
 
+#include <atomic>
+#include <chrono>
+#include <cmath>
 #include <random>
 
 #include "algorithm/inner_index_interface.h"
@@ -43,6 +46,70 @@ KMeansCluster::~KMeansCluster() {
     }
 }
 
+KMeansAlgorithm
+kmeans_algorithm_from_string(const std::string& name) {
+    if (name == "lloyd") {
+        return KMeansAlgorithm::LLOYD;
+    }
+    if (name == "mini_batch") {
+        return KMeansAlgorithm::MINI_BATCH;
+    }
+    if (name == "hamerly") {
+        return KMeansAlgorithm::HAMERLY;
+    }
+    if (name == "elkan") {
+        return KMeansAlgorithm::ELKAN;
+    }
+    throw VsagException(ErrorType::INVALID_ARGUMENT,
+                        fmt::format("unknown kmeans algorithm: {}", name));
+}
+
+std::string
+kmeans_algorithm_to_string(KMeansAlgorithm algorithm) {
+    switch (algorithm) {
+        case KMeansAlgorithm::MINI_BATCH:
+            return "mini_batch";
+        case KMeansAlgorithm::HAMERLY:
+            return "hamerly";
+        case KMeansAlgorithm::ELKAN:
+            return "elkan";
+        default:
+            return "lloyd";
+    }
+}
+
+// finds the nearest and second nearest centroid of one sample by a full scan
+static void
+find_nearest_two(const float* data,
+                 const float* centroids,
+                 uint32_t k,
+                 int32_t dim,
+                 int32_t& first,
+                 float& first_dist,
+                 float& second_dist) {
+    first = 0;
+    first_dist = std::numeric_limits<float>::max();
+    second_dist = std::numeric_limits<float>::max();
+    for (uint32_t c = 0; c < k; ++c) {
+        auto dist = FP32ComputeL2Sqr(data, centroids + static_cast<uint64_t>(c) * dim, dim);
+        if (dist < first_dist) {
+            second_dist = first_dist;
+            first_dist = dist;
+            first = static_cast<int32_t>(c);
+        } else if (dist < second_dist) {
+            second_dist = dist;
+        }
+    }
+    first_dist = std::sqrt(first_dist);
+    second_dist = std::sqrt(second_dist);
+}
+
+void
+KMeansCluster::SetAlgorithm(KMeansAlgorithm algorithm, uint64_t mini_batch_size) {
+    this->algorithm_ = algorithm;
+    this->mini_batch_size_ = mini_batch_size;
+}
+
 Vector<int>
 KMeansCluster::Run(uint32_t k,
                    const float* datas,
@@ -65,6 +132,8 @@ KMeansCluster::Run(uint32_t k,
         throw VsagException(ErrorType::INVALID_ARGUMENT, "k cannot be larger than count");
     }
 
+    auto start_time = std::chrono::steady_clock::now();
+    this->stats_ = KMeansStats();
     if (k_centroids_ != nullptr) {
         allocator_->Deallocate(k_centroids_);
         k_centroids_ = nullptr;
@@ -81,16 +150,54 @@ KMeansCluster::Run(uint32_t k,
         select_initial_centroids_random(datas, count, k, gen);
     }
 
-    double total_err = std::numeric_limits<double>::max();
-    double last_err = std::numeric_limits<double>::max();
     Vector<int32_t> labels(count, -1, this->allocator_);
-    std::vector<std::future<void>> futures;
-    ByteBuffer y_sqr_buffer(static_cast<uint64_t>(k) * sizeof(float), allocator_);
-    ByteBuffer distances_buffer(static_cast<uint64_t>(k) * QUERY_BS * sizeof(float), allocator_);
-    auto* y_sqr = reinterpret_cast<float*>(y_sqr_buffer.data);
-    auto* distances = reinterpret_cast<float*>(distances_buffer.data);
+    logger::trace("KMeansCluster::Run {} k: {}, count: {}, iter: {}",
+                  kmeans_algorithm_to_string(algorithm_),
+                  k,
+                  count,
+                  iter);
+    double total_err = 0.0;
+    if (algorithm_ == KMeansAlgorithm::LLOYD) {
+        total_err = this->run_lloyd(
+            k, datas, count, iter, use_mse_for_convergence, threshold, gen, labels);
+    } else {
+        if (algorithm_ == KMeansAlgorithm::MINI_BATCH) {
+            this->run_mini_batch(k, datas, count, iter, gen, labels);
+        } else if (algorithm_ == KMeansAlgorithm::HAMERLY) {
+            this->run_hamerly(k, datas, count, iter, gen, labels);
+        } else {
+            this->run_elkan(k, datas, count, iter, gen, labels);
+        }
+    }
+    this->stats_.inertia = this->compute_inertia(datas, count, labels);
+    if (algorithm_ != KMeansAlgorithm::LLOYD) {
+        total_err = this->stats_.inertia / static_cast<double>(count);
+    }
+    this->stats_.train_time_ms = std::chrono::duration<double, std::milli>(
+                                     std::chrono::steady_clock::now() - start_time)
+                                     .count();
+    logger::debug("KMeansCluster::Run {} finished, iterations: {}, inertia: {}, cost {}ms",
+                  kmeans_algorithm_to_string(algorithm_),
+                  stats_.iterations,
+                  stats_.inertia,
+                  stats_.train_time_ms);
+    if (err != nullptr) {
+        *err = total_err;
+    }
+    return labels;
+}
 
-    logger::trace("KMeansCluster::Run k: {}, count: {}, iter: {}", k, count, iter);
+double
+KMeansCluster::run_lloyd(uint32_t k,
+                         const float* datas,
+                         uint64_t count,
+                         int iter,
+                         bool use_mse_for_convergence,
+                         float threshold,
+                         std::mt19937& gen,
+                         Vector<int32_t>& labels) {
+    double total_err = std::numeric_limits<double>::max();
+    double last_err = std::numeric_limits<double>::max();
     if (k < THRESHOLD_FOR_HGRAPH) {
         logger::trace("KMeansCluster::Run use blas");
     } else {
@@ -98,95 +205,453 @@ KMeansCluster::Run(uint32_t k,
     }
 
     for (int it = 0; it < iter; ++it) {
-        if (k < THRESHOLD_FOR_HGRAPH) {
-            total_err = this->find_nearest_one_with_blas(datas, count, k, y_sqr, distances, labels);
-        } else {
-            total_err = this->find_nearest_one_with_hgraph(datas, count, k, labels);
+        total_err = this->find_nearest_one(datas, count, k, labels);
+        this->update_centroids(k, datas, count, labels, gen);
+        this->stats_.iterations = static_cast<uint32_t>(it + 1);
+
+        logger::trace("[{}] KMeansCluster::Run iter: {}/{} finished, cur loss is {}",
+                      get_current_time(),
+                      static_cast<int>(it),
+                      static_cast<int>(iter),
+                      static_cast<double>(total_err));
+        if (it > 0 && use_mse_for_convergence &&
+            std::fabs(last_err - total_err) / static_cast<double>(count) < threshold) {
+            break;
         }
-        constexpr uint64_t bs = 1024;
 
-        Vector<int> counts(k, 0, allocator_);
-        Vector<float> new_centroids(static_cast<uint64_t>(k) * dim_, 0.0F, allocator_);
-        std::mutex merge_mutex;
+        last_err = total_err;
+    }
+    return total_err;
+}
 
-        auto update_centroids_func = [&](uint64_t start, uint64_t end) {
-            omp_set_num_threads(1);
-            Vector<int> local_counts(k, 0, allocator_);
-            Vector<float> local_centroids(static_cast<uint64_t>(k) * dim_, 0.0F, allocator_);
+void
+KMeansCluster::run_mini_batch(uint32_t k,
+                              const float* datas,
+                              uint64_t count,
+                              int iter,
+                              std::mt19937& gen,
+                              Vector<int32_t>& labels) {
+    uint64_t batch_size = this->mini_batch_size_;
+    if (batch_size == 0) {
+        batch_size = std::max<uint64_t>(DEFAULT_MINI_BATCH_SIZE, 4ULL * k);
+    }
+    batch_size = std::min(batch_size, count);
+    const auto dim = static_cast<uint64_t>(dim_);
+
+    Vector<float> batch(batch_size * dim, allocator_);
+    Vector<int32_t> batch_labels(batch_size, -1, allocator_);
+    Vector<uint64_t> seen_counts(k, 0, allocator_);
+    Vector<uint32_t> offsets(static_cast<uint64_t>(k) + 1, 0, allocator_);
+    Vector<uint32_t> members(batch_size, allocator_);
+    std::uniform_int_distribution<uint64_t> dis(0, count - 1);
 
-            for (uint64_t i = start; i < end; ++i) {
-                int32_t label = labels[i];
-                if (label >= 0 && label < static_cast<int32_t>(k)) {
-                    local_counts[label]++;
-                    BlasFunction::Saxpy(
-                        dim_,
-                        1.0F,
-                        datas + i * dim_,
-                        1,
-                        local_centroids.data() + label * static_cast<uint64_t>(dim_),
-                        1);
+    for (int it = 0; it < iter; ++it) {
+        for (uint64_t i = 0; i < batch_size; ++i) {
+            auto index = dis(gen);
+            std::copy(datas + index * dim, datas + (index + 1) * dim, batch.data() + i * dim);
+        }
+        this->find_nearest_one(batch.data(), batch_size, k, batch_labels);
+
+        // group the batch by centroid, then every centroid moves towards its samples with
+        // learning rate 1 / samples seen so far, which keeps it the mean of all of them
+        std::fill(offsets.begin(), offsets.end(), 0);
+        for (uint64_t i = 0; i < batch_size; ++i) {
+            ++offsets[batch_labels[i] + 1];
+        }
+        for (uint32_t c = 0; c < k; ++c) {
+            offsets[c + 1] += offsets[c];
+        }
+        for (uint64_t i = 0; i < batch_size; ++i) {
+            members[offsets[batch_labels[i]]++] = static_cast<uint32_t>(i);
+        }
+        for (uint32_t c = k; c > 0; --c) {
+            offsets[c] = offsets[c - 1];
+        }
+        offsets[0] = 0;
+
+        this->run_in_blocks(k, UPDATE_BLOCK_SIZE, [&](uint64_t begin, uint64_t end) {
+            for (auto c = begin; c < end; ++c) {
+                auto* centroid = k_centroids_ + c * dim;
+                for (auto m = offsets[c]; m < offsets[c + 1]; ++m) {
+                    const auto* sample = batch.data() + static_cast<uint64_t>(members[m]) * dim;
+                    auto eta = 1.0F / static_cast<float>(++seen_counts[c]);
+                    for (uint64_t d = 0; d < dim; ++d) {
+                        centroid[d] += eta * (sample[d] - centroid[d]);
+                    }
                 }
             }
+        });
+        this->stats_.iterations = static_cast<uint32_t>(it + 1);
+    }
+    this->find_nearest_one(datas, count, k, labels);
+}
 
-            {
-                std::lock_guard<std::mutex> lock(merge_mutex);
-                for (uint32_t j = 0; j < k; ++j) {
-                    if (local_counts[j] > 0) {
-                        counts[j] += local_counts[j];
-                        BlasFunction::Saxpy(
-                            dim_,
-                            1.0F,
-                            local_centroids.data() + j * static_cast<uint64_t>(dim_),
-                            1,
-                            new_centroids.data() + j * static_cast<uint64_t>(dim_),
-                            1);
-                    }
+void
+KMeansCluster::run_hamerly(uint32_t k,
+                           const float* datas,
+                           uint64_t count,
+                           int iter,
+                           std::mt19937& gen,
+                           Vector<int32_t>& labels) {
+    const auto dim = static_cast<uint64_t>(dim_);
+    // upper bounds the distance to the own centroid, lower the distance to any other one
+    Vector<float> upper(count, allocator_);
+    Vector<float> lower(count, allocator_);
+    Vector<float> old_centroids(static_cast<uint64_t>(k) * dim, allocator_);
+    this->run_in_blocks(count, UPDATE_BLOCK_SIZE, [&](uint64_t begin, uint64_t end) {
+        for (auto i = begin; i < end; ++i) {
+            find_nearest_two(
+                datas + i * dim, k_centroids_, k, dim_, labels[i], upper[i], lower[i]);
+        }
+    });
+    this->stats_.distance_count += count * k;
+
+    for (int it = 0; it < iter; ++it) {
+        std::copy(k_centroids_, k_centroids_ + k * dim, old_centroids.begin());
+        this->update_centroids(k, datas, count, labels, gen);
+        auto shifts = this->centroid_shifts(k, old_centroids);
+        auto half_distances = this->half_nearest_centroid_distances(k);
+        uint32_t max_shift_id = 0;
+        float max_shift = 0.0F;
+        float second_shift = 0.0F;
+        for (uint32_t c = 0; c < k; ++c) {
+            if (shifts[c] > max_shift) {
+                second_shift = max_shift;
+                max_shift = shifts[c];
+                max_shift_id = c;
+            } else if (shifts[c] > second_shift) {
+                second_shift = shifts[c];
+            }
+        }
+
+        std::atomic<uint64_t> changed{0};
+        std::atomic<uint64_t> distance_count{0};
+        this->run_in_blocks(count, UPDATE_BLOCK_SIZE, [&](uint64_t begin, uint64_t end) {
+            uint64_t local_changed = 0;
+            uint64_t local_distance_count = 0;
+            for (auto i = begin; i < end; ++i) {
+                auto label = labels[i];
+                upper[i] += shifts[label];
+                lower[i] -= static_cast<uint32_t>(label) == max_shift_id ? second_shift
+                                                                          : max_shift;
+                auto bound = std::max(half_distances[label], lower[i]);
+                if (upper[i] <= bound) {
+                    continue;
+                }
+                const auto* sample = datas + i * dim;
+                upper[i] = std::sqrt(FP32ComputeL2Sqr(sample, k_centroids_ + label * dim, dim));
+                ++local_distance_count;
+                if (upper[i] <= bound) {
+                    continue;
                 }
+                find_nearest_two(sample, k_centroids_, k, dim_, labels[i], upper[i], lower[i]);
+                local_distance_count += k;
+                local_changed += static_cast<uint64_t>(labels[i] != label);
             }
-        };
-        for (uint64_t i = 0; i < count; i += bs) {
-            futures.emplace_back(
-                thread_pool_->GeneralEnqueue(update_centroids_func, i, std::min(i + bs, count)));
+            changed += local_changed;
+            distance_count += local_distance_count;
+        });
+        this->stats_.distance_count += distance_count.load();
+        this->stats_.iterations = static_cast<uint32_t>(it + 1);
+        logger::trace("KMeansCluster::Run hamerly iter: {}/{}, changed: {}, distances: {}",
+                      it,
+                      iter,
+                      changed.load(),
+                      distance_count.load());
+        if (changed.load() == 0) {
+            break;
         }
-        for (auto& future : futures) {
-            future.wait();
+    }
+}
+
+void
+KMeansCluster::run_elkan(uint32_t k,
+                         const float* datas,
+                         uint64_t count,
+                         int iter,
+                         std::mt19937& gen,
+                         Vector<int32_t>& labels) {
+    if ((count + k) * k > ELKAN_MAX_BOUND_COUNT) {
+        logger::warn("KMeansCluster: elkan bounds of {} samples and {} centroids exceed {}, "
+                     "use hamerly instead",
+                     count,
+                     k,
+                     ELKAN_MAX_BOUND_COUNT);
+        this->run_hamerly(k, datas, count, iter, gen, labels);
+        return;
+    }
+    const auto dim = static_cast<uint64_t>(dim_);
+    Vector<float> upper(count, allocator_);
+    Vector<float> lower(count * k, allocator_);
+    Vector<float> centroid_distances(static_cast<uint64_t>(k) * k, allocator_);
+    Vector<float> half_distances(k, allocator_);
+    Vector<float> old_centroids(static_cast<uint64_t>(k) * dim, allocator_);
+    this->run_in_blocks(count, UPDATE_BLOCK_SIZE, [&](uint64_t begin, uint64_t end) {
+        for (auto i = begin; i < end; ++i) {
+            auto* sample_lower = lower.data() + i * k;
+            for (uint32_t c = 0; c < k; ++c) {
+                sample_lower[c] =
+                    std::sqrt(FP32ComputeL2Sqr(datas + i * dim, k_centroids_ + c * dim, dim));
+            }
+            auto nearest = std::min_element(sample_lower, sample_lower + k);
+            labels[i] = static_cast<int32_t>(nearest - sample_lower);
+            upper[i] = *nearest;
         }
-        futures.clear();
+    });
+    this->stats_.distance_count += count * k;
+
+    for (int it = 0; it < iter; ++it) {
+        std::copy(k_centroids_, k_centroids_ + k * dim, old_centroids.begin());
+        this->update_centroids(k, datas, count, labels, gen);
+        auto shifts = this->centroid_shifts(k, old_centroids);
+        this->run_in_blocks(k, UPDATE_BLOCK_SIZE, [&](uint64_t begin, uint64_t end) {
+            for (auto c = begin; c < end; ++c) {
+                auto nearest = std::numeric_limits<float>::max();
+                for (uint32_t other = 0; other < k; ++other) {
+                    auto dist = std::sqrt(
+                        FP32ComputeL2Sqr(k_centroids_ + c * dim, k_centroids_ + other * dim, dim));
+                    centroid_distances[c * k + other] = 0.5F * dist;
+                    if (other != c) {
+                        nearest = std::min(nearest, dist);
+                    }
+                }
+                half_distances[c] = 0.5F * nearest;
+            }
+        });
+
+        std::atomic<uint64_t> changed{0};
+        std::atomic<uint64_t> distance_count{0};
+        this->run_in_blocks(count, UPDATE_BLOCK_SIZE, [&](uint64_t begin, uint64_t end) {
+            uint64_t local_changed = 0;
+            uint64_t local_distance_count = 0;
+            for (auto i = begin; i < end; ++i) {
+                auto* sample_lower = lower.data() + i * k;
+                for (uint32_t c = 0; c < k; ++c) {
+                    sample_lower[c] = std::max(sample_lower[c] - shifts[c], 0.0F);
+                }
+                auto label = labels[i];
+                auto best = label;
+                auto bound = upper[i] + shifts[label];
+                if (bound <= half_distances[label]) {
+                    upper[i] = bound;
+                    continue;
+                }
+                const auto* sample = datas + i * dim;
+                bool tight = false;
+                for (uint32_t c = 0; c < k; ++c) {
+                    auto skip = [&]() {
+                        return bound <= sample_lower[c] or
+                               bound <= centroid_distances[best * k + c];
+                    };
+                    if (static_cast<int32_t>(c) == best or skip()) {
+                        continue;
+                    }
+                    if (not tight) {
+                        bound =
+                            std::sqrt(FP32ComputeL2Sqr(sample, k_centroids_ + best * dim, dim));
+                        sample_lower[best] = bound;
+                        ++local_distance_count;
+                        tight = true;
+                        if (skip()) {
+                            continue;
+                        }
+                    }
+                    auto dist = std::sqrt(FP32ComputeL2Sqr(sample, k_centroids_ + c * dim, dim));
+                    sample_lower[c] = dist;
+                    ++local_distance_count;
+                    if (dist < bound) {
+                        best = static_cast<int32_t>(c);
+                        bound = dist;
+                    }
+                }
+                upper[i] = bound;
+                labels[i] = best;
+                local_changed += static_cast<uint64_t>(best != label);
+            }
+            changed += local_changed;
+            distance_count += local_distance_count;
+        });
+        this->stats_.distance_count += distance_count.load();
+        this->stats_.iterations = static_cast<uint32_t>(it + 1);
+        logger::trace("KMeansCluster::Run elkan iter: {}/{}, changed: {}, distances: {}",
+                      it,
+                      iter,
+                      changed.load(),
+                      distance_count.load());
+        if (changed.load() == 0) {
+            break;
+        }
+    }
+}
+
+void
+KMeansCluster::update_centroids(uint32_t k,
+                                const float* datas,
+                                uint64_t count,
+                                const Vector<int32_t>& labels,
+                                std::mt19937& gen) {
+    Vector<int> counts(k, 0, allocator_);
+    Vector<float> new_centroids(static_cast<uint64_t>(k) * dim_, 0.0F, allocator_);
+    std::mutex merge_mutex;
+
+    auto update_centroids_func = [&](uint64_t start, uint64_t end) {
+        omp_set_num_threads(1);
+        Vector<int> local_counts(k, 0, allocator_);
+        Vector<float> local_centroids(static_cast<uint64_t>(k) * dim_, 0.0F, allocator_);
 
-        std::uniform_int_distribution<uint64_t> dis(0, count - 1);
-        for (int j = 0; j < k; ++j) {
-            if (counts[j] > 0) {
-                BlasFunction::Sscal(dim_,
-                                    1.0F / static_cast<float>(counts[j]),
-                                    new_centroids.data() + j * static_cast<uint64_t>(dim_),
+        for (uint64_t i = start; i < end; ++i) {
+            int32_t label = labels[i];
+            if (label >= 0 && label < static_cast<int32_t>(k)) {
+                local_counts[label]++;
+                BlasFunction::Saxpy(dim_,
+                                    1.0F,
+                                    datas + i * dim_,
+                                    1,
+                                    local_centroids.data() + label * static_cast<uint64_t>(dim_),
                                     1);
-                std::copy(new_centroids.data() + j * static_cast<uint64_t>(dim_),
-                          new_centroids.data() + (j + 1) * static_cast<uint64_t>(dim_),
-                          k_centroids_ + j * static_cast<uint64_t>(dim_));
-            } else {
-                auto index = dis(gen);
-                for (int s = 0; s < dim_; ++s) {
-                    k_centroids_[j * dim_ + s] = datas[index * dim_ + s];
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(merge_mutex);
+            for (uint32_t j = 0; j < k; ++j) {
+                if (local_counts[j] > 0) {
+                    counts[j] += local_counts[j];
+                    BlasFunction::Saxpy(dim_,
+                                        1.0F,
+                                        local_centroids.data() + j * static_cast<uint64_t>(dim_),
+                                        1,
+                                        new_centroids.data() + j * static_cast<uint64_t>(dim_),
+                                        1);
                 }
             }
         }
+    };
+    this->run_in_blocks(count, UPDATE_BLOCK_SIZE, update_centroids_func);
 
-        logger::trace("[{}] KMeansCluster::Run iter: {}/{} finished, cur loss is {}",
-                      get_current_time(),
-                      static_cast<int>(it),
-                      static_cast<int>(iter),
-                      static_cast<double>(total_err));
-        if (it > 0 && use_mse_for_convergence &&
-            std::fabs(last_err - total_err) / static_cast<double>(count) < threshold) {
-            break;
+    std::uniform_int_distribution<uint64_t> dis(0, count - 1);
+    for (int j = 0; j < k; ++j) {
+        if (counts[j] > 0) {
+            BlasFunction::Sscal(dim_,
+                                1.0F / static_cast<float>(counts[j]),
+                                new_centroids.data() + j * static_cast<uint64_t>(dim_),
+                                1);
+            std::copy(new_centroids.data() + j * static_cast<uint64_t>(dim_),
+                      new_centroids.data() + (j + 1) * static_cast<uint64_t>(dim_),
+                      k_centroids_ + j * static_cast<uint64_t>(dim_));
+        } else {
+            auto index = dis(gen);
+            for (int s = 0; s < dim_; ++s) {
+                k_centroids_[j * dim_ + s] = datas[index * dim_ + s];
+            }
         }
+    }
+}
 
-        last_err = total_err;
+Vector<float>
+KMeansCluster::centroid_shifts(uint32_t k, const Vector<float>& old_centroids) {
+    Vector<float> shifts(k, allocator_);
+    for (uint64_t c = 0; c < k; ++c) {
+        shifts[c] = std::sqrt(
+            FP32ComputeL2Sqr(k_centroids_ + c * dim_, old_centroids.data() + c * dim_, dim_));
     }
-    if (err != nullptr) {
-        *err = total_err;
+    return shifts;
+}
+
+Vector<float>
+KMeansCluster::half_nearest_centroid_distances(uint32_t k) {
+    Vector<float> half_distances(k, 0.0F, allocator_);
+    if (k < 2) {
+        return half_distances;
+    }
+    if (k >= THRESHOLD_FOR_HGRAPH) {
+        // the same approximate neighbor search find_nearest_one_with_hgraph assigns with, the
+        // first hit is the centroid itself unless a duplicate centroid ties with it
+        IndexCommonParam param;
+        auto hgraph = this->build_centroid_hgraph(k, param);
+        constexpr const char* search_param = R"({"hgraph":{"ef_search":10}})";
+        FilterPtr filter = nullptr;
+        this->run_in_blocks(k, UPDATE_BLOCK_SIZE, [&](uint64_t begin, uint64_t end) {
+            for (auto c = begin; c < end; ++c) {
+                auto q = Dataset::Make();
+                q->Owner(false)->Float32Vectors(k_centroids_ + c * dim_)->NumElements(1)->Dim(dim_);
+                auto ret = hgraph->KnnSearch(q, 2, search_param, filter);
+                auto nearest = std::numeric_limits<float>::max();
+                for (int64_t j = 0; j < ret->GetDim(); ++j) {
+                    if (ret->GetIds()[j] != static_cast<int64_t>(c)) {
+                        nearest = std::min(nearest, ret->GetDistances()[j]);
+                    }
+                }
+                half_distances[c] =
+                    nearest == std::numeric_limits<float>::max() ? 0.0F : 0.5F * std::sqrt(nearest);
+            }
+        });
+        return half_distances;
+    }
+    this->run_in_blocks(k, UPDATE_BLOCK_SIZE, [&](uint64_t begin, uint64_t end) {
+        for (auto c = begin; c < end; ++c) {
+            auto nearest = std::numeric_limits<float>::max();
+            for (uint64_t other = 0; other < k; ++other) {
+                if (other != c) {
+                    nearest = std::min(nearest,
+                                       FP32ComputeL2Sqr(k_centroids_ + c * dim_,
+                                                        k_centroids_ + other * dim_,
+                                                        dim_));
+                }
+            }
+            half_distances[c] = 0.5F * std::sqrt(nearest);
+        }
+    });
+    return half_distances;
+}
+
+template <typename Func>
+void
+KMeansCluster::run_in_blocks(uint64_t count, uint64_t block_size, const Func& func) {
+    std::vector<std::future<void>> futures;
+    for (uint64_t i = 0; i < count; i += block_size) {
+        futures.emplace_back(
+            thread_pool_->GeneralEnqueue(func, i, std::min(i + block_size, count)));
+    }
+    for (auto& future : futures) {
+        future.wait();
     }
-    return labels;
+}
+
+double
+KMeansCluster::compute_inertia(const float* datas, uint64_t count, const Vector<int32_t>& labels) {
+    double inertia = 0.0;
+    std::mutex inertia_mutex;
+    this->run_in_blocks(count, UPDATE_BLOCK_SIZE, [&](uint64_t begin, uint64_t end) {
+        double local_inertia = 0.0;
+        for (auto i = begin; i < end; ++i) {
+            local_inertia += static_cast<double>(FP32ComputeL2Sqr(
+                datas + i * dim_, k_centroids_ + static_cast<uint64_t>(labels[i]) * dim_, dim_));
+        }
+        std::lock_guard<std::mutex> lock(inertia_mutex);
+        inertia += local_inertia;
+    });
+    return inertia;
+}
+
+double
+KMeansCluster::find_nearest_one(const float* query,
+                                uint64_t query_count,
+                                uint32_t k,
+                                Vector<int32_t>& labels) {
+    this->stats_.distance_count += query_count * k;
+    if (k >= THRESHOLD_FOR_HGRAPH) {
+        return this->find_nearest_one_with_hgraph(query, query_count, k, labels);
+    }
+    ByteBuffer y_sqr_buffer(static_cast<uint64_t>(k) * sizeof(float), allocator_);
+    ByteBuffer distances_buffer(
+        static_cast<uint64_t>(k) * std::min(QUERY_BS, query_count) * sizeof(float), allocator_);
+    return this->find_nearest_one_with_blas(query,
+                                            query_count,
+                                            k,
+                                            reinterpret_cast<float*>(y_sqr_buffer.data),
+                                            reinterpret_cast<float*>(distances_buffer.data),
+                                            labels);
 }
 
 double
@@ -316,24 +781,7 @@ KMeansCluster::find_nearest_one_with_hgraph(const float* query,
     std::mutex error_mutex;
 
     IndexCommonParam param;
-    param.dim_ = dim_;
-    param.allocator_ = std::make_shared<SafeAllocator>(this->allocator_);
-    param.thread_pool_ = this->thread_pool_;
-    param.metric_ = MetricType::METRIC_TYPE_L2SQR;
-    auto max_degree = std::max(32, dim_ / 8);
-
-    auto hgraph =
-        InnerIndexInterface::FastCreateIndex(fmt::format("hgraph|{}|fp32", max_degree), param);
-    auto base = Dataset::Make();
-    Vector<int64_t> ids(k, allocator_);
-    std::iota(ids.begin(), ids.end(), 0);
-    base->Dim(dim_)
-        ->NumElements(static_cast<int64_t>(k))
-        ->Float32Vectors(this->k_centroids_)
-        ->Ids(ids.data())
-        ->Owner(false);
-    hgraph->Build(base);
-    hgraph->SetImmutable();
+    auto hgraph = this->build_centroid_hgraph(k, param);
     FilterPtr filter = nullptr;
     constexpr const char* search_param = R"({"hgraph":{"ef_search":10}})";
     auto func = [&](const uint64_t begin, const uint64_t end) -> void {
@@ -364,6 +812,29 @@ KMeansCluster::find_nearest_one_with_hgraph(const float* query,
     return error / static_cast<float>(query_count);
 }
 
+InnerIndexPtr
+KMeansCluster::build_centroid_hgraph(uint64_t k, IndexCommonParam& param) {
+    param.dim_ = dim_;
+    param.allocator_ = std::make_shared<SafeAllocator>(this->allocator_);
+    param.thread_pool_ = this->thread_pool_;
+    param.metric_ = MetricType::METRIC_TYPE_L2SQR;
+    auto max_degree = std::max(32, dim_ / 8);
+
+    auto hgraph =
+        InnerIndexInterface::FastCreateIndex(fmt::format("hgraph|{}|fp32", max_degree), param);
+    auto base = Dataset::Make();
+    Vector<int64_t> ids(k, allocator_);
+    std::iota(ids.begin(), ids.end(), 0);
+    base->Dim(dim_)
+        ->NumElements(static_cast<int64_t>(k))
+        ->Float32Vectors(this->k_centroids_)
+        ->Ids(ids.data())
+        ->Owner(false);
+    hgraph->Build(base);
+    hgraph->SetImmutable();
+    return hgraph;
+}
+
 void
 // NOLINTNEXTLINE(readability-make-member-function-const)
 KMeansCluster::select_initial_centroids_random(const float* datas,
@@ -16,18 +16,45 @@
 #pragma once
 
 #include <random>
+#include <string>
 
 #include "impl/thread_pool/safe_thread_pool.h"
 #include "typing.h"
+#include "utils/pointer_define.h"
 
 namespace vsag {
 class Allocator;
+class IndexCommonParam;
+DEFINE_POINTER2(InnerIndex, InnerIndexInterface);
 
 enum class KMeansInitMethod {
     RANDOM,
     KMEANS_PLUS_PLUS,
 };
 
+enum class KMeansAlgorithm {
+    LLOYD,       // full assignment of every sample in every iteration
+    MINI_BATCH,  // one random batch per iteration with per-center learning rates
+    HAMERLY,     // exact, one lower bound per sample skips most distances
+    ELKAN,       // exact, one lower bound per sample and center, needs count * k floats
+};
+
+/// Parses "lloyd", "mini_batch", "hamerly" or "elkan", throws on anything else.
+KMeansAlgorithm
+kmeans_algorithm_from_string(const std::string& name);
+
+std::string
+kmeans_algorithm_to_string(KMeansAlgorithm algorithm);
+
+struct KMeansStats {
+    uint32_t iterations{0};
+    // sum of squared distances from every sample to its centroid after the last iteration
+    double inertia{0.0};
+    double train_time_ms{0.0};
+    // sample to centroid distances computed, GEMM assignments count k per sample
+    uint64_t distance_count{0};
+};
+
 class KMeansCluster {
 public:
     explicit KMeansCluster(int32_t dim,
@@ -46,10 +73,84 @@ public:
         float threshold = 1e-6F,
         KMeansInitMethod init_method = KMeansInitMethod::KMEANS_PLUS_PLUS);
 
+    /// Selects the iteration scheme of Run; a zero mini_batch_size picks max(4096, 4 * k).
+    void
+    SetAlgorithm(KMeansAlgorithm algorithm, uint64_t mini_batch_size = 0);
+
+    [[nodiscard]] const KMeansStats&
+    GetStats() const {
+        return stats_;
+    }
+
 public:
     float* k_centroids_{nullptr};
 
 private:
+    double
+    run_lloyd(uint32_t k,
+              const float* datas,
+              uint64_t count,
+              int iter,
+              bool use_mse_for_convergence,
+              float threshold,
+              std::mt19937& gen,
+              Vector<int32_t>& labels);
+
+    void
+    run_mini_batch(uint32_t k,
+                   const float* datas,
+                   uint64_t count,
+                   int iter,
+                   std::mt19937& gen,
+                   Vector<int32_t>& labels);
+
+    void
+    run_hamerly(uint32_t k,
+                const float* datas,
+                uint64_t count,
+                int iter,
+                std::mt19937& gen,
+                Vector<int32_t>& labels);
+
+    void
+    run_elkan(uint32_t k,
+              const float* datas,
+              uint64_t count,
+              int iter,
+              std::mt19937& gen,
+              Vector<int32_t>& labels);
+
+    /// Moves every centroid to the mean of its samples, empty ones to a random sample.
+    void
+    update_centroids(uint32_t k,
+                     const float* datas,
+                     uint64_t count,
+                     const Vector<int32_t>& labels,
+                     std::mt19937& gen);
+
+    /// Euclidean distance each centroid moved from old_centroids.
+    Vector<float>
+    centroid_shifts(uint32_t k, const Vector<float>& old_centroids);
+
+    /// Half the distance from every centroid to its nearest other centroid, found through an
+    /// HGraph over the centroids from THRESHOLD_FOR_HGRAPH on, as find_nearest_one does.
+    Vector<float>
+    half_nearest_centroid_distances(uint32_t k);
+
+    template <typename Func>
+    void
+    run_in_blocks(uint64_t count, uint64_t block_size, const Func& func);
+
+    double
+    compute_inertia(const float* datas, uint64_t count, const Vector<int32_t>& labels);
+
+    /// Assigns every query to its nearest centroid, by GEMM below THRESHOLD_FOR_HGRAPH.
+    double
+    find_nearest_one(const float* query,
+                     uint64_t query_count,
+                     uint32_t k,
+                     Vector<int32_t>& labels);
+
     double
     find_nearest_one_with_blas(const float* query,
                                const uint64_t query_count,
@@ -58,6 +159,10 @@ private:
                                float* distances,
                                Vector<int32_t>& labels);
 
+    /// HGraph over the first k centroids, param holds its allocator and must outlive it.
+    InnerIndexPtr
+    build_centroid_hgraph(uint64_t k, IndexCommonParam& param);
+
     double
     find_nearest_one_with_hgraph(const float* query,
                                  const uint64_t query_count,
@@ -83,9 +188,22 @@ private:
 
     const int32_t dim_{0};
 
+    KMeansAlgorithm algorithm_{KMeansAlgorithm::LLOYD};
+
+    uint64_t mini_batch_size_{0};
+
+    KMeansStats stats_;
+
+    static constexpr uint64_t DEFAULT_MINI_BATCH_SIZE = 4096ULL;
+
+    // Elkan falls back to Hamerly when its (count + k) * k bounds would exceed this many floats
+    static constexpr uint64_t ELKAN_MAX_BOUND_COUNT = 1ULL << 28;
+
     static constexpr uint64_t THRESHOLD_FOR_HGRAPH = 10000ULL;
 
     static constexpr uint64_t QUERY_BS = 65536ULL;
+
+    static constexpr uint64_t UPDATE_BLOCK_SIZE = 1024ULL;
 };
 
 }  // namespace vsag
@@ -102,3 +102,103 @@ TEST_CASE("Kmeans Larger Dim (AMX BF16 path)", "[ut][KMeansCluster]") {
     }
     REQUIRE(converged);
 }
+
+TEST_CASE("Kmeans accelerated algorithms find the clusters", "[ut][KMeansCluster]") {
+    std::vector<int> labels;
+    int32_t k = 10;
+    int32_t dim = 8;
+    uint64_t count = 3000;
+    auto datas = GenerateDataset(k, dim, count, labels);
+    auto allocator = vsag::SafeAllocator::FactoryDefaultAllocator();
+
+    auto algorithm = GENERATE(vsag::KMeansAlgorithm::MINI_BATCH,
+                              vsag::KMeansAlgorithm::HAMERLY,
+                              vsag::KMeansAlgorithm::ELKAN);
+    vsag::KMeansCluster cluster(dim, allocator.get());
+    cluster.SetAlgorithm(algorithm, 512);
+    std::vector<int> new_labels(k);
+    bool converged = false;
+    for (int attempt = 0; attempt < 20 and not converged; ++attempt) {
+        std::fill(new_labels.begin(), new_labels.end(), 0);
+        auto pos = cluster.Run(k, datas.data(), count, 25);
+        for (uint64_t i = 0; i < count; ++i) {
+            new_labels[pos[i]]++;
+        }
+        std::sort(new_labels.begin(), new_labels.end());
+        converged = new_labels == labels;
+    }
+    REQUIRE(converged);
+    const auto& stats = cluster.GetStats();
+    REQUIRE(stats.iterations > 0);
+    REQUIRE(stats.inertia < 1e-3);
+    REQUIRE(stats.train_time_ms >= 0.0);
+}
+
+TEST_CASE("Kmeans bound algorithms skip distance computations", "[ut][KMeansCluster]") {
+    int32_t k = 32;
+    int32_t dim = 16;
+    uint64_t count = 5000;
+    // blobs around the cluster centers, so most samples stay with their centroid
+    std::vector<int> labels;
+    auto datas = GenerateDataset(k, dim, count, labels);
+    auto noise = fixtures::generate_vectors(count, dim, /*normalize=*/false, /*seed=*/49);
+    for (uint64_t i = 0; i < datas.size(); ++i) {
+        datas[i] += 0.2F * noise[i];
+    }
+    auto allocator = vsag::SafeAllocator::FactoryDefaultAllocator();
+
+    vsag::KMeansCluster lloyd(dim, allocator.get());
+    double lloyd_err = 0.0;
+    lloyd.Run(k, datas.data(), count, 20, &lloyd_err);
+    REQUIRE(lloyd.GetStats().distance_count == count * k * lloyd.GetStats().iterations);
+
+    for (auto algorithm : {vsag::KMeansAlgorithm::HAMERLY, vsag::KMeansAlgorithm::ELKAN}) {
+        vsag::KMeansCluster cluster(dim, allocator.get());
+        cluster.SetAlgorithm(algorithm);
+        double err = 0.0;
+        auto pos = cluster.Run(k, datas.data(), count, 20, &err);
+        const auto& stats = cluster.GetStats();
+        // the first assignment scans every centroid, later ones are mostly pruned
+        REQUIRE(stats.distance_count < count * k * (stats.iterations + 1) * 3 / 4);
+        REQUIRE(std::abs(err - stats.inertia / static_cast<double>(count)) < 1e-6 * err);
+        // both are exact, only the random initialization separates their optimum from lloyd
+        REQUIRE(err < lloyd_err * 1.5);
+        for (uint64_t i = 0; i < count; ++i) {
+            REQUIRE(pos[i] >= 0);
+            REQUIRE(pos[i] < k);
+        }
+    }
+}
+
+TEST_CASE("Kmeans hamerly keeps pruning with an hgraph over the centroids",
+          "[ut][KMeansCluster]") {
+    // k at the hgraph threshold, where the nearest other centroid comes from a graph search
+    int32_t k = 10000;
+    int32_t dim = 8;
+    uint64_t count = 2 * static_cast<uint64_t>(k);
+    auto datas = fixtures::generate_vectors(count, dim, /*normalize=*/false, /*seed=*/97);
+    auto allocator = vsag::SafeAllocator::FactoryDefaultAllocator();
+
+    vsag::KMeansCluster cluster(dim, allocator.get());
+    cluster.SetAlgorithm(vsag::KMeansAlgorithm::HAMERLY);
+    double err = 0.0;
+    auto pos = cluster.Run(k, datas.data(), count, 5, &err);
+    const auto& stats = cluster.GetStats();
+    REQUIRE(stats.distance_count < count * k * (stats.iterations + 1) * 3 / 4);
+    REQUIRE(std::abs(err - stats.inertia / static_cast<double>(count)) < 1e-6 * err);
+    for (uint64_t i = 0; i < count; ++i) {
+        REQUIRE(pos[i] >= 0);
+        REQUIRE(pos[i] < k);
+    }
+}
+
+TEST_CASE("Kmeans algorithm names", "[ut][KMeansCluster]") {
+    for (auto algorithm : {vsag::KMeansAlgorithm::LLOYD,
+                           vsag::KMeansAlgorithm::MINI_BATCH,
+                           vsag::KMeansAlgorithm::HAMERLY,
+                           vsag::KMeansAlgorithm::ELKAN}) {
+        REQUIRE(vsag::kmeans_algorithm_from_string(vsag::kmeans_algorithm_to_string(algorithm)) ==
+                algorithm);
+    }
+    REQUIRE_THROWS(vsag::kmeans_algorithm_from_string("unknown"));
+}
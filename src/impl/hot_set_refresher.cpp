@@ -0,0 +1,116 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hot_set_refresher.h"
+
+#include <algorithm>
+
+#include "impl/logger/logger.h"
+#include "impl/thread_pool/default_thread_pool.h"
+
+namespace vsag {
+
+HotSetRefresher::HotSetRefresher(Allocator* allocator,
+                                 std::string name,
+                                 std::function<void()> refresh)
+    : shards_(allocator), name_(std::move(name)), refresh_(std::move(refresh)) {
+    this->shards_.reserve(SHARD_COUNT);
+    for (uint64_t i = 0; i < SHARD_COUNT; ++i) {
+        this->shards_.emplace_back(std::make_unique<Shard>(allocator));
+    }
+}
+
+HotSetRefresher::~HotSetRefresher() {
+    this->Wait();
+}
+
+void
+HotSetRefresher::Count(uint32_t id) {
+    auto& shard = *this->shards_[id % SHARD_COUNT];
+    std::lock_guard lock(shard.mutex);
+    ++shard.hits[id];
+}
+
+void
+HotSetRefresher::Tick(uint64_t refresh_interval) {
+    refresh_interval = std::max<uint64_t>(refresh_interval, 1);
+    if ((this->tick_count_.fetch_add(1, std::memory_order_relaxed) + 1) % refresh_interval !=
+            0 or
+        this->scheduled_.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    std::lock_guard lock(this->schedule_mutex_);
+    if (this->pool_ == nullptr) {
+        this->pool_ = std::make_shared<SafeThreadPool>(new DefaultThreadPool(1), true);
+    }
+    this->future_ = this->pool_->GeneralEnqueue([this]() {
+        try {
+            this->refresh_();
+        } catch (const std::exception& e) {
+            // the current hot set stays, a later tick schedules the next refresh
+            logger::warn("[{}] hot set refresh failed: {}", this->name_, e.what());
+        }
+        this->scheduled_.store(false, std::memory_order_release);
+    });
+}
+
+Vector<std::pair<uint32_t, uint32_t>>
+HotSetRefresher::TakeRanked(uint64_t limit, Allocator* allocator) {
+    Vector<std::pair<uint32_t, uint32_t>> ranked(allocator);
+    for (auto& shard : this->shards_) {
+        std::lock_guard lock(shard->mutex);
+        ranked.reserve(ranked.size() + shard->hits.size());
+        for (auto iter = shard->hits.begin(); iter != shard->hits.end();) {
+            ranked.emplace_back(iter->second, iter->first);
+            iter.value() /= 2;
+            if (iter->second == 0) {
+                iter = shard->hits.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+    }
+    auto by_hits = [](const std::pair<uint32_t, uint32_t>& lhs,
+                      const std::pair<uint32_t, uint32_t>& rhs) {
+        return lhs.first > rhs.first or (lhs.first == rhs.first and lhs.second < rhs.second);
+    };
+    if (ranked.size() > limit) {
+        std::nth_element(ranked.begin(), ranked.begin() + limit, ranked.end(), by_hits);
+        ranked.resize(limit);
+    }
+    std::sort(ranked.begin(), ranked.end(), by_hits);
+    return ranked;
+}
+
+void
+HotSetRefresher::Wait() {
+    std::future<void> pending;
+    {
+        std::lock_guard lock(this->schedule_mutex_);
+        pending = std::move(this->future_);
+    }
+    if (pending.valid()) {
+        pending.wait();
+    }
+}
+
+void
+HotSetRefresher::Clear() {
+    for (auto& shard : this->shards_) {
+        std::lock_guard lock(shard->mutex);
+        shard->hits.clear();
+    }
+}
+
+}  // namespace vsag
@@ -0,0 +1,92 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "impl/thread_pool/safe_thread_pool.h"
+#include "typing.h"
+#include "vsag/allocator.h"
+
+namespace vsag {
+
+/**
+ * @brief Hit counters for a hot set plus the background task that rebuilds it.
+ *
+ * Searches Count the ids they touch and Tick once per search. Every refresh_interval ticks the
+ * refresh callback is scheduled on a private one-thread pool, at most one at a time, and the
+ * ticking search never waits for it. The callback reads the ranking through TakeRanked.
+ */
+class HotSetRefresher {
+public:
+    static constexpr uint64_t SHARD_COUNT = 16;
+
+    /// name only labels the warning logged when refresh throws.
+    HotSetRefresher(Allocator* allocator, std::string name, std::function<void()> refresh);
+
+    ~HotSetRefresher();
+
+    void
+    Count(uint32_t id);
+
+    /// Counts one search, every refresh_interval searches schedules the refresh callback.
+    void
+    Tick(uint64_t refresh_interval);
+
+    /**
+     * @brief Returns up to limit (hits, id) pairs, most hits first and ties by ascending id.
+     *
+     * Every counter is halved afterwards, so ids that stopped being hit age out.
+     */
+    Vector<std::pair<uint32_t, uint32_t>>
+    TakeRanked(uint64_t limit, Allocator* allocator);
+
+    /// Blocks until the scheduled refresh, if any, has finished.
+    void
+    Wait();
+
+    /// Drops every counter.
+    void
+    Clear();
+
+private:
+    struct Shard {
+        explicit Shard(Allocator* allocator) : hits(allocator) {
+        }
+
+        std::mutex mutex;
+        UnorderedMap<uint32_t, uint32_t> hits;
+    };
+    // concurrent searches mostly count different ids, sharding by id keeps them apart
+    Vector<std::unique_ptr<Shard>> shards_;
+
+    const std::string name_;
+
+    const std::function<void()> refresh_;
+
+    std::mutex schedule_mutex_;
+    SafeThreadPoolPtr pool_{nullptr};
+    std::future<void> future_;
+    std::atomic<bool> scheduled_{false};
+
+    std::atomic<uint64_t> tick_count_{0};
+};
+
+}  // namespace vsag
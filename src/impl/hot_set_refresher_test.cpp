@@ -0,0 +1,83 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hot_set_refresher.h"
+
+#include <atomic>
+#include <stdexcept>
+
+#include "impl/allocator/safe_allocator.h"
+#include "unittest.h"
+
+namespace vsag {
+
+TEST_CASE("HotSetRefresher ranks and ages hit counters", "[ut][HotSetRefresher]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    HotSetRefresher refresher(allocator.get(), "test", []() {});
+
+    for (int i = 0; i < 4; ++i) {
+        refresher.Count(7);
+    }
+    refresher.Count(3);
+    refresher.Count(3);
+    refresher.Count(5);
+    refresher.Count(5);
+    refresher.Count(9);
+
+    auto top = refresher.TakeRanked(2, allocator.get());
+    REQUIRE(top.size() == 2);
+    REQUIRE(top[0] == std::make_pair(4U, 7U));
+    REQUIRE(top[1] == std::make_pair(2U, 3U));
+
+    // every counter was halved, the single hit on 9 is gone
+    auto all = refresher.TakeRanked(16, allocator.get());
+    REQUIRE(all.size() == 3);
+    REQUIRE(all[0] == std::make_pair(2U, 7U));
+    REQUIRE(all[1] == std::make_pair(1U, 3U));
+    REQUIRE(all[2] == std::make_pair(1U, 5U));
+
+    refresher.Clear();
+    REQUIRE(refresher.TakeRanked(16, allocator.get()).empty());
+}
+
+TEST_CASE("HotSetRefresher schedules the refresh every interval", "[ut][HotSetRefresher]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    std::atomic<int> refresh_count{0};
+    bool fail = true;
+    HotSetRefresher refresher(allocator.get(), "test", [&]() {
+        refresh_count.fetch_add(1);
+        if (fail) {
+            throw std::runtime_error("read failed");
+        }
+    });
+
+    refresher.Tick(3);
+    refresher.Tick(3);
+    refresher.Wait();
+    REQUIRE(refresh_count.load() == 0);
+
+    refresher.Tick(3);
+    refresher.Wait();
+    REQUIRE(refresh_count.load() == 1);
+
+    // a refresh that threw must not block the next one
+    fail = false;
+    for (int i = 0; i < 3; ++i) {
+        refresher.Tick(3);
+    }
+    refresher.Wait();
+    REQUIRE(refresh_count.load() == 2);
+}
+
+}  // namespace vsag
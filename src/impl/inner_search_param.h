@@ -45,6 +45,10 @@ public:
     InnerIdType ep{0};
     uint64_t ef{10};
     uint32_t hops_limit{std::numeric_limits<uint32_t>::max()};
+    // adaptive early termination (KNN only): stop once the best early_stop_topk distances have
+    // not improved for early_stop_patience consecutive hops; 0 disables, topk when unset
+    uint32_t early_stop_patience{0};
+    int64_t early_stop_topk{0};
     FilterPtr is_inner_id_allowed{nullptr};
     float skip_ratio{0.2F};
     FilterSearchSkipStrategyType skip_strategy_type{
@@ -63,6 +67,9 @@ public:
     bool enable_reorder{true};
     float first_order_scan_ratio{1.0F};
     std::optional<float> distance_threshold{std::nullopt};
+    // for sindi: skip windows whose distance lower bound, scaled by this ratio, cannot beat the
+    // heap top; 1 is exact, below 1 skips more windows at some recall, 0 disables
+    float block_max_pruning_ratio{0.0F};
     std::vector<ExecutorPtr> executors;
     std::vector<int64_t> bucket_ids;
     QueryContext* query_context{nullptr};
@@ -76,8 +83,8 @@ public:
     // use in search process with duplicate ids
     bool consider_duplicate{false};
 
-    // time record
-    std::shared_ptr<Timer> time_cost{nullptr};
+    // timeout_ms search parameter, turned into QueryContext::deadline by the index
+    double timeout_ms{std::numeric_limits<double>::max()};
 
     InnerSearchParam&
     operator=(const InnerSearchParam& other) = default;
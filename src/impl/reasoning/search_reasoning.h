@@ -103,6 +103,7 @@ public:
     static constexpr const char* kTerminationLowerBoundReached = "lower_bound_reached";
     static constexpr const char* kTerminationHopsLimitReached = "hops_limit_reached";
     static constexpr const char* kTerminationTimeout = "timeout";
+    static constexpr const char* kTerminationEarlyStop = "early_stop";
 
 public:
     int64_t topk_{0};
@@ -57,6 +57,42 @@ FlattenReorder::Reorder(const vsag::DistHeapPtr& input,
                         IteratorFilterContext* iter_ctx,
                         const DistanceRecordVector* rabitq_lower_bound_candidates,
                         const std::optional<float>& distance_threshold) {
+    auto result = this->reorder(
+        input, query, topk, ctx, iter_ctx, rabitq_lower_bound_candidates, distance_threshold);
+    if (tiered_codes_ != nullptr and result != nullptr and not result->Empty()) {
+        // what reorder returns is what the hot tier should keep in memory
+        Allocator* query_allocator = select_query_allocator(ctx.alloc, allocator_);
+        Vector<InnerIdType> ids(result->Size(), query_allocator);
+        const auto* data = result->GetData();
+        for (uint64_t i = 0; i < result->Size(); ++i) {
+            ids[i] = data[i].second;
+        }
+        tiered_codes_->RecordHits(ids.data(), ids.size());
+    }
+    return result;
+}
+
+void
+FlattenReorder::query_precise(float* dists,
+                              const ComputerInterfacePtr& computer,
+                              const InnerIdType* ids,
+                              uint64_t count,
+                              QueryContext& ctx) {
+    if (tiered_codes_ != nullptr) {
+        tiered_codes_->Query(dists, computer, ids, count, &ctx);
+        return;
+    }
+    flatten_->Query(dists, computer, ids, static_cast<InnerIdType>(count), &ctx);
+}
+
+DistHeapPtr
+FlattenReorder::reorder(const vsag::DistHeapPtr& input,
+                        const void* query,
+                        int64_t topk,
+                        QueryContext& ctx,
+                        IteratorFilterContext* iter_ctx,
+                        const DistanceRecordVector* rabitq_lower_bound_candidates,
+                        const std::optional<float>& distance_threshold) {
     // set query allocator
     Allocator* query_allocator = select_query_allocator(ctx.alloc, allocator_);
     auto is_distance_eligible = [&distance_threshold](float distance) {
@@ -86,7 +122,7 @@ FlattenReorder::Reorder(const vsag::DistHeapPtr& input,
         add_reorder_distance_count(ctx, heap_candidate_size);
         {
             ScopedDistancePhase scoped(ctx, DistanceEvaluationPhase::RERANK);
-            flatten_->Query(dists.data(), computer, ids.data(), heap_candidate_size, &ctx);
+            this->query_precise(dists.data(), computer, ids.data(), heap_candidate_size, ctx);
         }
         for (uint64_t i = 0; i < heap_candidate_size; ++i) {
             if (ctx.reasoning_ctx != nullptr) {
@@ -182,8 +218,8 @@ FlattenReorder::Reorder(const vsag::DistHeapPtr& input,
         add_reorder_distance_count(ctx, candidate_size);
         {
             ScopedDistancePhase scoped(ctx, DistanceEvaluationPhase::RERANK);
-            flatten_->Query(
-                lower_bound_probe_dists.data(), computer, all_ids.data(), candidate_size, &ctx);
+            this->query_precise(
+                lower_bound_probe_dists.data(), computer, all_ids.data(), candidate_size, ctx);
         }
         for (uint64_t i = 0; i < candidate_size; ++i) {
             if (ctx.reasoning_ctx != nullptr) {
@@ -253,6 +289,13 @@ FlattenReorder::Reorder(const vsag::DistHeapPtr& input,
             lower_bounds[order[cursor]] >= reorder_heap->Top().first) {
             break;
         }
+        {
+            // a stopped search keeps the candidates reranked so far
+            ScopedDistancePhase scoped(ctx, DistanceEvaluationPhase::RERANK);
+            if (ctx.ShouldStop()) {
+                break;
+            }
+        }
 
         const auto pruning_threshold = reorder_heap->Size() == topk
                                            ? reorder_heap->Top().first
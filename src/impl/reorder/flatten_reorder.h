@@ -20,13 +20,16 @@
 #include "datacell/flatten_interface.h"
 #include "impl/heap/distance_heap.h"
 #include "impl/reorder/reorder.h"
+#include "impl/reorder/tiered_precise_codes.h"
 #include "utils/pointer_define.h"
 
 namespace vsag {
 class FlattenReorder : public ReorderInterface {
 public:
-    FlattenReorder(const FlattenInterfacePtr& flatten, Allocator* allocator)
-        : flatten_(flatten), allocator_(allocator) {
+    FlattenReorder(const FlattenInterfacePtr& flatten,
+                   Allocator* allocator,
+                   TieredPreciseCodesPtr tiered_codes = nullptr)
+        : flatten_(flatten), allocator_(allocator), tiered_codes_(std::move(tiered_codes)) {
     }
 
     DistHeapPtr
@@ -38,8 +41,32 @@ public:
             const DistanceRecordVector* rabitq_lower_bound_candidates = nullptr,
             const std::optional<float>& distance_threshold = std::nullopt) override;
 
+    [[nodiscard]] const TieredPreciseCodesPtr&
+    GetTieredCodes() const {
+        return this->tiered_codes_;
+    }
+
+private:
+    DistHeapPtr
+    reorder(const DistHeapPtr& input,
+            const void* query,
+            int64_t topk,
+            QueryContext& ctx,
+            IteratorFilterContext* iter_ctx,
+            const DistanceRecordVector* rabitq_lower_bound_candidates,
+            const std::optional<float>& distance_threshold);
+
+    void
+    query_precise(float* dists,
+                  const ComputerInterfacePtr& computer,
+                  const InnerIdType* ids,
+                  uint64_t count,
+                  QueryContext& ctx);
+
 private:
     const FlattenInterfacePtr flatten_;
     Allocator* allocator_{nullptr};
+    // serves hot ids from memory when the precise codes live on disk, may be null
+    const TieredPreciseCodesPtr tiered_codes_{nullptr};
 };
 }  // namespace vsag
@@ -0,0 +1,210 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tiered_precise_codes.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "query_context.h"
+
+namespace vsag {
+
+TieredPreciseCodes::TieredPreciseCodes(FlattenInterfacePtr precise_codes,
+                                       uint64_t memory_limit,
+                                       Allocator* allocator,
+                                       uint64_t refresh_interval)
+    : precise_codes_(std::move(precise_codes)),
+      allocator_(allocator),
+      code_size_(precise_codes_->GetQuantizerCodeSize()),
+      capacity_(code_size_ == 0 ? 0 : memory_limit / code_size_),
+      refresh_interval_(std::max<uint64_t>(refresh_interval, 1)),
+      hot_slots_(allocator),
+      hot_codes_(allocator),
+      invalidated_(allocator),
+      hits_(allocator, "tiered_precise_codes", [this]() { this->Refresh(); }) {
+}
+
+TieredPreciseCodes::~TieredPreciseCodes() {
+    // the scheduled refresh captures this
+    this->WaitForRefresh();
+}
+
+bool
+TieredPreciseCodes::Supports(const FlattenInterfacePtr& precise_codes) {
+    return precise_codes != nullptr and precise_codes->SupportQueryCodes() and
+           precise_codes->GetQuantizerCodeSize() > 0;
+}
+
+void
+TieredPreciseCodes::Query(float* result_dists,
+                          const ComputerInterfacePtr& computer,
+                          const InnerIdType* ids,
+                          uint64_t count,
+                          QueryContext* ctx) {
+    Allocator* search_alloc = select_query_allocator(ctx, allocator_);
+    Vector<InnerIdType> cold_ids(search_alloc);
+    Vector<uint64_t> cold_positions(search_alloc);
+    uint64_t hot_count = 0;
+    {
+        std::shared_lock lock(this->hot_mutex_);
+        if (this->hot_slots_.empty()) {
+            lock.unlock();
+            this->precise_codes_->Query(
+                result_dists, computer, ids, static_cast<InnerIdType>(count), ctx);
+            this->disk_fetch_count_.fetch_add(count, std::memory_order_relaxed);
+            if (ctx != nullptr and ctx->stats != nullptr) {
+                ctx->stats->reorder_disk_fetch_count.fetch_add(static_cast<uint32_t>(count),
+                                                               std::memory_order_relaxed);
+            }
+            return;
+        }
+        cold_ids.reserve(count);
+        cold_positions.reserve(count);
+        for (uint64_t i = 0; i < count; ++i) {
+            auto iter = this->hot_slots_.find(ids[i]);
+            if (iter == this->hot_slots_.end()) {
+                cold_ids.push_back(ids[i]);
+                cold_positions.push_back(i);
+                continue;
+            }
+            const auto* codes =
+                this->hot_codes_.data() + static_cast<uint64_t>(iter->second) * this->code_size_;
+            this->precise_codes_->QueryCodes(result_dists + i, computer, codes, 1, ctx);
+            ++hot_count;
+        }
+    }
+
+    const uint64_t cold_count = cold_ids.size();
+    if (cold_count > 0) {
+        // the cold ids go through the datacell together, a disk layout batches them in MultiRead
+        Vector<float> cold_dists(cold_count, search_alloc);
+        this->precise_codes_->Query(cold_dists.data(),
+                                    computer,
+                                    cold_ids.data(),
+                                    static_cast<InnerIdType>(cold_count),
+                                    ctx);
+        for (uint64_t i = 0; i < cold_count; ++i) {
+            result_dists[cold_positions[i]] = cold_dists[i];
+        }
+    }
+
+    this->memory_fetch_count_.fetch_add(hot_count, std::memory_order_relaxed);
+    this->disk_fetch_count_.fetch_add(cold_count, std::memory_order_relaxed);
+    if (ctx != nullptr and ctx->stats != nullptr) {
+        ctx->stats->reorder_memory_fetch_count.fetch_add(static_cast<uint32_t>(hot_count),
+                                                         std::memory_order_relaxed);
+        ctx->stats->reorder_disk_fetch_count.fetch_add(static_cast<uint32_t>(cold_count),
+                                                       std::memory_order_relaxed);
+    }
+}
+
+void
+TieredPreciseCodes::RecordHits(const InnerIdType* ids, uint64_t count) {
+    if (this->capacity_ == 0) {
+        return;
+    }
+    for (uint64_t i = 0; i < count; ++i) {
+        this->hits_.Count(ids[i]);
+    }
+    this->hits_.Tick(this->refresh_interval_);
+}
+
+void
+TieredPreciseCodes::WaitForRefresh() {
+    this->hits_.Wait();
+}
+
+void
+TieredPreciseCodes::Refresh() {
+    std::lock_guard refresh_lock(this->refresh_mutex_);
+    if (this->capacity_ == 0) {
+        return;
+    }
+    {
+        std::unique_lock lock(this->hot_mutex_);
+        this->refreshing_ = true;
+        this->invalidated_.clear();
+    }
+
+    auto ranked = this->hits_.TakeRanked(this->capacity_, allocator_);
+
+    UnorderedMap<InnerIdType, uint32_t> new_slots(allocator_);
+    new_slots.reserve(ranked.size());
+    Vector<uint8_t> new_codes(ranked.size() * this->code_size_, allocator_);
+    Vector<InnerIdType> missing(allocator_);
+    {
+        // ids that stay hot are copied from memory instead of being read again
+        std::shared_lock lock(this->hot_mutex_);
+        for (const auto& [hit_count, id] : ranked) {
+            auto iter = this->hot_slots_.find(id);
+            if (iter == this->hot_slots_.end()) {
+                missing.push_back(id);
+                continue;
+            }
+            const auto slot = static_cast<uint32_t>(new_slots.size());
+            std::memcpy(new_codes.data() + slot * this->code_size_,
+                        this->hot_codes_.data() + iter->second * this->code_size_,
+                        this->code_size_);
+            new_slots.emplace(id, slot);
+        }
+    }
+    if (not missing.empty()) {
+        // newly hot ids are read in one batch, ascending ids keep a disk layout's reads sequential
+        std::sort(missing.begin(), missing.end());
+        const auto first_slot = static_cast<uint32_t>(new_slots.size());
+        if (this->precise_codes_->GetCodesByIds(
+                missing.data(), missing.size(), new_codes.data() + first_slot * this->code_size_)) {
+            for (uint64_t i = 0; i < missing.size(); ++i) {
+                new_slots.emplace(missing[i], first_slot + static_cast<uint32_t>(i));
+            }
+        }
+    }
+    new_codes.resize(new_slots.size() * this->code_size_);
+
+    std::unique_lock lock(this->hot_mutex_);
+    // codes read above may predate an update that arrived meanwhile, those ids stay cold
+    for (auto id : this->invalidated_) {
+        new_slots.erase(id);
+    }
+    this->invalidated_.clear();
+    this->refreshing_ = false;
+    this->hot_slots_.swap(new_slots);
+    this->hot_codes_.swap(new_codes);
+}
+
+void
+TieredPreciseCodes::Invalidate(InnerIdType id) {
+    std::unique_lock lock(this->hot_mutex_);
+    this->hot_slots_.erase(id);
+    if (this->refreshing_) {
+        this->invalidated_.insert(id);
+    }
+}
+
+uint64_t
+TieredPreciseCodes::GetHotCount() const {
+    std::shared_lock lock(this->hot_mutex_);
+    return this->hot_slots_.size();
+}
+
+uint64_t
+TieredPreciseCodes::GetMemoryUsage() const {
+    std::shared_lock lock(this->hot_mutex_);
+    return sizeof(TieredPreciseCodes) + this->hot_codes_.capacity() +
+           this->hot_slots_.size() * (sizeof(InnerIdType) + sizeof(uint32_t) + sizeof(void*));
+}
+
+}  // namespace vsag
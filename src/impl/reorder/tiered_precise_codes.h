@@ -0,0 +1,129 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+
+#include "datacell/flatten_interface.h"
+#include "impl/hot_set_refresher.h"
+#include "typing.h"
+#include "utils/pointer_define.h"
+
+namespace vsag {
+
+DEFINE_POINTER(TieredPreciseCodes);
+
+/**
+ * @brief Size-bounded in-memory tier in front of (usually disk-backed) precise codes.
+ *
+ * Reorder records the ids it returns; every refresh_interval searches a background refresh
+ * copies the most returned ids into memory, up to memory_limit bytes of codes. Query serves
+ * those ids from memory and reads all other ids through the precise datacell in one batch, so
+ * a disk layout still turns them into a single MultiRead.
+ */
+class TieredPreciseCodes {
+public:
+    static constexpr uint64_t DEFAULT_REFRESH_INTERVAL = 1024;
+
+    TieredPreciseCodes(FlattenInterfacePtr precise_codes,
+                       uint64_t memory_limit,
+                       Allocator* allocator,
+                       uint64_t refresh_interval = DEFAULT_REFRESH_INTERVAL);
+
+    ~TieredPreciseCodes();
+
+    /// Whether precise_codes can be served by the tier, see FlattenInterface::SupportQueryCodes.
+    static bool
+    Supports(const FlattenInterfacePtr& precise_codes);
+
+    void
+    Query(float* result_dists,
+          const ComputerInterfacePtr& computer,
+          const InnerIdType* ids,
+          uint64_t count,
+          QueryContext* ctx = nullptr);
+
+    /// Counts one search returning ids; every refresh_interval searches schedules a background
+    /// Refresh, the calling search never waits for it.
+    void
+    RecordHits(const InnerIdType* ids, uint64_t count);
+
+    /// Rebuilds the hot set from the hit counters and halves the counters afterwards. Runs on the
+    /// calling thread, searches keep the current hot set until the new one is published.
+    void
+    Refresh();
+
+    /// Blocks until the background refresh scheduled by RecordHits, if any, has finished.
+    void
+    WaitForRefresh();
+
+    /// Drops the in-memory copy of id, called when its precise codes change.
+    void
+    Invalidate(InnerIdType id);
+
+    [[nodiscard]] uint64_t
+    GetHotCount() const;
+
+    [[nodiscard]] uint64_t
+    GetCapacity() const {
+        return this->capacity_;
+    }
+
+    [[nodiscard]] uint64_t
+    GetMemoryUsage() const;
+
+    [[nodiscard]] uint64_t
+    GetMemoryFetchCount() const {
+        return this->memory_fetch_count_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t
+    GetDiskFetchCount() const {
+        return this->disk_fetch_count_.load(std::memory_order_relaxed);
+    }
+
+private:
+    const FlattenInterfacePtr precise_codes_;
+
+    Allocator* const allocator_{nullptr};
+
+    const uint64_t code_size_{0};
+
+    const uint64_t capacity_{0};
+
+    const uint64_t refresh_interval_{DEFAULT_REFRESH_INTERVAL};
+
+    mutable std::shared_mutex hot_mutex_;
+    UnorderedMap<InnerIdType, uint32_t> hot_slots_;
+    Vector<uint8_t> hot_codes_;
+
+    // ids invalidated while a refresh reads codes, dropped from its result before publishing
+    bool refreshing_{false};
+    UnorderedSet<InnerIdType> invalidated_;
+
+    std::mutex refresh_mutex_;
+
+    // declared after the hot set, the scheduled refresh it runs writes into it
+    HotSetRefresher hits_;
+
+    std::atomic<uint64_t> memory_fetch_count_{0};
+    std::atomic<uint64_t> disk_fetch_count_{0};
+};
+
+}  // namespace vsag
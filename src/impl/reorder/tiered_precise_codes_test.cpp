@@ -0,0 +1,144 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tiered_precise_codes.h"
+
+#include <vector>
+
+#include "datacell/flatten_datacell_parameter.h"
+#include "flatten_reorder.h"
+#include "impl/heap/standard_heap.h"
+#include "index_common_param.h"
+#include "io/memory_io/memory_io_parameter.h"
+#include "quantization/fp32_quantizer_parameter.h"
+#include "query_context.h"
+#include "unittest.h"
+#include "vsag/engine.h"
+
+namespace vsag {
+
+namespace {
+
+constexpr uint64_t TIER_TEST_DIM = 4;
+constexpr InnerIdType TIER_TEST_COUNT = 16;
+
+FlattenInterfacePtr
+make_precise_codes(const std::shared_ptr<Allocator>& allocator) {
+    auto flatten_param = std::make_shared<FlattenDataCellParameter>();
+    flatten_param->quantizer_parameter = std::make_shared<FP32QuantizerParameter>();
+    flatten_param->io_parameter = std::make_shared<MemoryIOParameter>();
+
+    IndexCommonParam common_param;
+    common_param.allocator_ = allocator;
+    common_param.metric_ = MetricType::METRIC_TYPE_L2SQR;
+    common_param.dim_ = TIER_TEST_DIM;
+    auto flatten = FlattenInterface::MakeInstance(flatten_param, common_param);
+
+    std::vector<float> vectors(TIER_TEST_COUNT * TIER_TEST_DIM);
+    for (uint64_t i = 0; i < vectors.size(); ++i) {
+        vectors[i] = static_cast<float>(i / TIER_TEST_DIM);
+    }
+    flatten->Train(vectors.data(), TIER_TEST_COUNT);
+    flatten->BatchInsertVector(vectors.data(), TIER_TEST_COUNT);
+    return flatten;
+}
+
+}  // namespace
+
+TEST_CASE("TieredPreciseCodes serves hot ids from memory", "[ut][reorder][TieredPreciseCodes]") {
+    auto allocator = Engine::CreateDefaultAllocator();
+    auto flatten = make_precise_codes(allocator);
+    REQUIRE(TieredPreciseCodes::Supports(flatten));
+
+    // room for two codes, refreshed every second search
+    const auto code_size = flatten->GetQuantizerCodeSize();
+    TieredPreciseCodes tier(flatten, code_size * 2 + code_size / 2, allocator.get(), 2);
+    REQUIRE(tier.GetCapacity() == 2);
+
+    float query[TIER_TEST_DIM] = {3.0F, 3.0F, 3.0F, 3.0F};
+    auto computer = flatten->FactoryComputer(query);
+    std::vector<InnerIdType> ids{1, 3, 5, 7};
+    std::vector<float> expected(ids.size());
+    flatten->Query(expected.data(), computer, ids.data(), ids.size());
+
+    std::vector<float> dists(ids.size());
+    tier.Query(dists.data(), computer, ids.data(), ids.size());
+    REQUIRE(dists == expected);
+    REQUIRE(tier.GetDiskFetchCount() == ids.size());
+
+    std::vector<InnerIdType> frequent{3, 5};
+    std::vector<InnerIdType> rare{7};
+    tier.RecordHits(frequent.data(), frequent.size());
+    tier.RecordHits(rare.data(), rare.size());
+    // the second search scheduled a refresh on the tier's worker
+    tier.WaitForRefresh();
+    REQUIRE(tier.GetHotCount() == 2);
+
+    SearchStatistics stats;
+    QueryContext ctx{.alloc = allocator.get(), .stats = &stats};
+    tier.Query(dists.data(), computer, ids.data(), ids.size(), &ctx);
+    REQUIRE(dists == expected);
+    REQUIRE(stats.reorder_memory_fetch_count.load() == 2);
+    REQUIRE(stats.reorder_disk_fetch_count.load() == 2);
+
+    // an updated vector must not be served from the stale copy
+    tier.Invalidate(3);
+    REQUIRE(tier.GetHotCount() == 1);
+
+    // counters are halved on every refresh, ids that are no longer returned age out
+    for (int i = 0; i < 8; ++i) {
+        tier.RecordHits(rare.data(), rare.size());
+    }
+    tier.Refresh();
+    REQUIRE(tier.GetHotCount() == 1);
+    auto before = tier.GetMemoryFetchCount();
+    tier.Query(dists.data(), computer, rare.data(), 1);
+    REQUIRE(tier.GetMemoryFetchCount() == before + 1);
+}
+
+TEST_CASE("FlattenReorder records hits in the tiered precise codes",
+          "[ut][reorder][TieredPreciseCodes]") {
+    auto allocator = Engine::CreateDefaultAllocator();
+    auto flatten = make_precise_codes(allocator);
+    auto tier = std::make_shared<TieredPreciseCodes>(
+        flatten, flatten->GetQuantizerCodeSize() * 4, allocator.get(), 1);
+    FlattenReorder reorder(flatten, allocator.get(), tier);
+    REQUIRE(reorder.GetTieredCodes() == tier);
+
+    float query[TIER_TEST_DIM] = {0.0F, 0.0F, 0.0F, 0.0F};
+    auto make_candidates = [&]() {
+        auto candidates = std::make_shared<StandardHeap<true, false>>(allocator.get(), -1);
+        for (InnerIdType id = 0; id < TIER_TEST_COUNT; ++id) {
+            candidates->Push(static_cast<float>(TIER_TEST_COUNT - id), id);
+        }
+        return candidates;
+    };
+
+    QueryContext ctx{.alloc = allocator.get()};
+    auto result = reorder.Reorder(make_candidates(), query, 2, ctx);
+    REQUIRE(result->Size() == 2);
+    tier->WaitForRefresh();
+    REQUIRE(tier->GetHotCount() == 2);
+
+    SearchStatistics stats;
+    QueryContext stats_ctx{.alloc = allocator.get(), .stats = &stats};
+    auto second = reorder.Reorder(make_candidates(), query, 2, stats_ctx);
+    REQUIRE(second->Size() == 2);
+    REQUIRE(second->Top().second == 1);
+    REQUIRE(stats.reorder_memory_fetch_count.load() == 2);
+    REQUIRE(stats.reorder_disk_fetch_count.load() == TIER_TEST_COUNT - 2);
+}
+
+}  // namespace vsag
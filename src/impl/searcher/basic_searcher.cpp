@@ -15,6 +15,7 @@
 
 #include "basic_searcher.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cmath>
@@ -568,6 +569,30 @@ BasicSearcher::search_impl(const GraphInterfacePtr& graph,
         return top_candidates;
     }
 
+    if constexpr (mode == KNN_SEARCH) {
+        if (specialized_kernel_ != nullptr and flatten != nullptr and
+            is_specialized_pair(graph, flatten) and
+            SupportSpecializedGraphSearch(inner_search_param, preset_computer, ctx)) {
+            if (rabitq_lower_bound_candidates != nullptr) {
+                rabitq_lower_bound_candidates->clear();
+            }
+            auto result = specialized_kernel_(graph.get(),
+                                              flatten.get(),
+                                              vl.get(),
+                                              query,
+                                              inner_search_param,
+                                              mutex_array_,
+                                              prefetch_stride_visit_,
+                                              ctx,
+                                              alloc);
+            if (result != nullptr) {
+                return result;
+            }
+            // a non-finite distance needs the bridge handling of the generic loop below
+            vl->Reset();
+        }
+    }
+
     ComputerInterfacePtr computer = nullptr;
     if (not use_custom_distance) {
         computer = preset_computer != nullptr ? preset_computer : flatten->FactoryComputer(query);
@@ -616,6 +641,34 @@ BasicSearcher::search_impl(const GraphInterfacePtr& graph,
     };
     auto* reasoning = ctx == nullptr ? nullptr : ctx->reasoning_ctx;
 
+    // adaptive early termination: a max-heap over the best early_stop_k result distances, the
+    // search stops once it has not changed for early_stop_patience consecutive hops
+    const uint32_t early_stop_patience =
+        mode == KNN_SEARCH ? inner_search_param.early_stop_patience : 0;
+    const auto early_stop_k = static_cast<uint64_t>(std::max<int64_t>(
+        inner_search_param.early_stop_topk > 0 ? inner_search_param.early_stop_topk
+                                               : inner_search_param.topk,
+        1));
+    Vector<float> best_k_dists(alloc);
+    uint32_t stale_hops = 0;
+    bool best_k_improved = false;
+    auto track_best_k = [&](float result_dist) {
+        if (early_stop_patience == 0) {
+            return;
+        }
+        if (best_k_dists.size() < early_stop_k) {
+            best_k_dists.push_back(result_dist);
+            std::push_heap(best_k_dists.begin(), best_k_dists.end());
+        } else if (result_dist < best_k_dists.front()) {
+            std::pop_heap(best_k_dists.begin(), best_k_dists.end());
+            best_k_dists.back() = result_dist;
+            std::push_heap(best_k_dists.begin(), best_k_dists.end());
+        } else {
+            return;
+        }
+        best_k_improved = true;
+    };
+
     auto score_ids = [&](const InnerIdType* ids, uint64_t count, float* scores) {
         if (not use_custom_distance) {
             flatten->Query(scores, computer, ids, count, ctx);
@@ -698,6 +751,11 @@ BasicSearcher::search_impl(const GraphInterfacePtr& graph,
     ++dist_cmp;
     if (check_func(ep) and is_result_distance_eligible<mode>(dist, inner_search_param)) {
         top_candidates->Push(dist, ep);
+        if (std::isfinite(dist)) {
+            // the entry point seeds the best distances, only hops count as improvements
+            track_best_k(dist);
+            best_k_improved = false;
+        }
     }
     if (not std::isfinite(dist) and inner_search_param.consider_duplicate and
         not use_custom_distance and is_result_distance_eligible<mode>(dist, inner_search_param)) {
@@ -740,11 +798,7 @@ BasicSearcher::search_impl(const GraphInterfacePtr& graph,
         }
         auto current_node_pair = candidate_set->Top();
 
-        if (inner_search_param.time_cost != nullptr and
-            inner_search_param.time_cost->CheckOvertime()) {
-            if (ctx != nullptr and ctx->stats != nullptr) {
-                ctx->stats->is_timeout.store(true, std::memory_order_relaxed);
-            }
+        if (ctx != nullptr and ctx->ShouldStop()) {
             if (reasoning != nullptr) {
                 reasoning->SetTermination(ReasoningContext::kTerminationTimeout);
             }
@@ -758,6 +812,16 @@ BasicSearcher::search_impl(const GraphInterfacePtr& graph,
                 }
                 break;
             }
+            if (early_stop_patience > 0 and best_k_dists.size() >= early_stop_k and
+                stale_hops >= early_stop_patience) {
+                if (ctx != nullptr and ctx->stats != nullptr) {
+                    ctx->stats->early_stop_count.fetch_add(1, std::memory_order_relaxed);
+                }
+                if (reasoning != nullptr) {
+                    reasoning->SetTermination(ReasoningContext::kTerminationEarlyStop);
+                }
+                break;
+            }
         }
         candidate_set->Pop();
 
@@ -850,6 +914,7 @@ BasicSearcher::search_impl(const GraphInterfacePtr& graph,
                 //                flatten->Prefetch(candidate_set->Top().second);
                 if (check_func(cur_id)) {
                     top_candidates->Push(dist, cur_id);
+                    track_best_k(dist);
                 } else if (reasoning != nullptr) {
                     reasoning->RecordFilterReject(cur_id);
                 }
@@ -876,6 +941,8 @@ BasicSearcher::search_impl(const GraphInterfacePtr& graph,
                 }
             }
         }
+        stale_hops = best_k_improved ? 0 : stale_hops + 1;
+        best_k_improved = false;
     }
 
     if constexpr (mode == KNN_SEARCH) {
@@ -997,4 +1064,28 @@ BasicSearcher::SetMutexArray(MutexArrayPtr new_mutex_array) {
     mutex_array_ = std::move(new_mutex_array);
 }
 
+bool
+BasicSearcher::BindSpecializedKernel(const GraphInterfacePtr& graph,
+                                     const FlattenInterfacePtr& flatten) {
+    specialized_kernel_ = ResolveSpecializedGraphSearch(graph, flatten);
+    if (specialized_kernel_ == nullptr) {
+        specialized_graph_.reset();
+        specialized_flatten_.reset();
+        return false;
+    }
+    specialized_graph_ = graph;
+    specialized_flatten_ = flatten;
+    return true;
+}
+
+bool
+BasicSearcher::is_specialized_pair(const GraphInterfacePtr& graph,
+                                   const FlattenInterfacePtr& flatten) const {
+    // owner comparison avoids the atomic lock() on every search
+    return not specialized_graph_.owner_before(graph) and
+           not graph.owner_before(specialized_graph_) and
+           not specialized_flatten_.owner_before(flatten) and
+           not flatten.owner_before(specialized_flatten_);
+}
+
 }  // namespace vsag
@@ -24,6 +24,7 @@
 #include "impl/heap/distance_heap.h"
 #include "impl/inner_search_param.h"
 #include "impl/label_table/label_table.h"
+#include "impl/searcher/specialized_graph_search.h"
 #include "index_common_param_fwd.h"
 #include "query_context.h"
 #include "utils/lock_strategy.h"
@@ -102,7 +103,22 @@ public:
     void
     SetMutexArray(MutexArrayPtr new_mutex_array);
 
+    /**
+     * @brief Select the devirtualized search kernel for this (graph, flatten) pair once.
+     *
+     * Later searches on the same pair with plain KNN parameters take the kernel; any other pair
+     * or parameter set keeps the generic loop. Rebind after replacing either data cell. Not
+     * thread safe against concurrent searches.
+     *
+     * @return true if a kernel exists for the runtime types of graph and flatten.
+     */
+    bool
+    BindSpecializedKernel(const GraphInterfacePtr& graph, const FlattenInterfacePtr& flatten);
+
 private:
+    [[nodiscard]] bool
+    is_specialized_pair(const GraphInterfacePtr& graph, const FlattenInterfacePtr& flatten) const;
+
     // rid means the neighbor's rank (e.g., the first neighbor's rid == 0)
     //  id means the neighbor's  id  (e.g., the first neighbor's  id == 12345)
     uint32_t
@@ -159,6 +175,12 @@ private:
     uint64_t mock_dim_{0};
     uint32_t mock_n_trials_{1};
 
+    // specialized kernel, bound to one (graph, flatten) pair; weak pointers keep the identity
+    // check immune to a freed data cell whose address gets reused
+    SpecializedGraphSearchKernel specialized_kernel_{nullptr};
+    std::weak_ptr<GraphInterface> specialized_graph_;
+    std::weak_ptr<FlattenInterface> specialized_flatten_;
+
     // runtime parameters
     uint32_t prefetch_stride_visit_{3};
 };
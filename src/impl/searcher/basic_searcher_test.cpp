@@ -15,6 +15,9 @@
 
 #include "basic_searcher.h"
 
+#include <algorithm>
+#include <limits>
+#include <random>
 #include <set>
 #include <vector>
 
@@ -25,6 +28,7 @@
 #include "searcher_test.h"
 #include "unittest.h"
 #include "utils/visited_list.h"
+#include "vsag/search_request.h"
 using namespace vsag;
 
 TEST_CASE("BasicSearcher supports KNN, range, filters, and empty data cells",
@@ -453,3 +457,244 @@ TEST_CASE("BasicSearcher traverses through a non-finite-distance bridge",
     }
     REQUIRE(found_target);
 }
+
+TEST_CASE("BasicSearcher stops early once the best results stop improving",
+          "[ut][BasicSearcher][early_stop]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    IndexCommonParam common;
+    common.dim_ = 1;
+    common.allocator_ = allocator;
+    common.metric_ = MetricType::METRIC_TYPE_L2SQR;
+
+    constexpr const char* param_temp = R"({{"type": "{}"}})";
+    auto quantizer_param = QuantizerParameter::GetQuantizerParameterByJson(
+        JsonType::Parse(fmt::format(param_temp, "fp32")));
+    auto io_param =
+        IOParameter::GetIOParameterByJson(JsonType::Parse(fmt::format(param_temp, "memory_io")));
+    auto flatten = std::make_shared<
+        FlattenDataCell<FP32Quantizer<MetricType::METRIC_TYPE_L2SQR>, FixedLayout<MemoryIO>>>(
+        quantizer_param, io_param, common);
+    flatten->SetQuantizer(
+        std::make_shared<FP32Quantizer<MetricType::METRIC_TYPE_L2SQR>>(1, allocator.get()));
+    flatten->SetIO(std::make_unique<MemoryIO>(allocator.get()));
+    // a chain walking away from the query, every hop after the entry point is wasted work
+    constexpr InnerIdType count = 16;
+    std::vector<float> vectors(count);
+    std::vector<InnerIdType> ids(count);
+    std::vector<std::vector<InnerIdType>> neighbors(count);
+    for (InnerIdType i = 0; i < count; ++i) {
+        vectors[i] = static_cast<float>(i);
+        ids[i] = i;
+        if (i + 1 < count) {
+            neighbors[i].push_back(i + 1);
+        }
+    }
+    flatten->Train(vectors.data(), count);
+    flatten->BatchInsertVector(vectors.data(), count, ids.data());
+    auto graph = std::make_shared<MockGraphDataCell>(neighbors);
+    auto pool = std::make_shared<VisitedListPool>(1, allocator.get(), count, allocator.get());
+
+    auto search = [&](uint32_t patience, SearchStatistics& stats) {
+        InnerSearchParam param;
+        param.ep = 0;
+        param.ef = count;
+        param.topk = count;
+        param.early_stop_patience = patience;
+        param.early_stop_topk = 1;
+        float query = 0.0F;
+        QueryContext ctx{.alloc = allocator.get(), .stats = &stats};
+        auto vl = pool->TakeOne();
+        auto result =
+            BasicSearcher(common).Search(graph, flatten, vl, &query, param, LabelTablePtr{}, &ctx);
+        pool->ReturnOne(vl);
+        while (result->Size() > 1) {
+            result->Pop();
+        }
+        return result->Top().second;
+    };
+
+    SearchStatistics full_stats;
+    REQUIRE(search(0, full_stats) == 0);
+    REQUIRE(full_stats.early_stop_count.load() == 0);
+    REQUIRE(full_stats.hops.load() >= count);
+
+    SearchStatistics early_stats;
+    REQUIRE(search(3, early_stats) == 0);
+    REQUIRE(early_stats.early_stop_count.load() == 1);
+    REQUIRE(early_stats.hops.load() == 4);
+    REQUIRE(early_stats.dist_cmp.load() < full_stats.dist_cmp.load());
+
+    InnerSearchParam param;
+    param.early_stop_patience = 3;
+    REQUIRE_FALSE(SupportSpecializedGraphSearch(param, nullptr, nullptr));
+}
+
+TEST_CASE("BasicSearcher stops a cancelled search with partial results",
+          "[ut][BasicSearcher][cancellation]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    IndexCommonParam common;
+    common.dim_ = 1;
+    common.allocator_ = allocator;
+    common.metric_ = MetricType::METRIC_TYPE_L2SQR;
+
+    constexpr const char* param_temp = R"({{"type": "{}"}})";
+    auto quantizer_param = QuantizerParameter::GetQuantizerParameterByJson(
+        JsonType::Parse(fmt::format(param_temp, "fp32")));
+    auto io_param =
+        IOParameter::GetIOParameterByJson(JsonType::Parse(fmt::format(param_temp, "memory_io")));
+    auto flatten = std::make_shared<
+        FlattenDataCell<FP32Quantizer<MetricType::METRIC_TYPE_L2SQR>, FixedLayout<MemoryIO>>>(
+        quantizer_param, io_param, common);
+    flatten->SetQuantizer(
+        std::make_shared<FP32Quantizer<MetricType::METRIC_TYPE_L2SQR>>(1, allocator.get()));
+    flatten->SetIO(std::make_unique<MemoryIO>(allocator.get()));
+    constexpr InnerIdType count = 8;
+    std::vector<float> vectors(count);
+    std::vector<InnerIdType> ids(count);
+    std::vector<std::vector<InnerIdType>> neighbors(count);
+    for (InnerIdType i = 0; i < count; ++i) {
+        vectors[i] = static_cast<float>(count - i);
+        ids[i] = i;
+        if (i + 1 < count) {
+            neighbors[i].push_back(i + 1);
+        }
+    }
+    flatten->Train(vectors.data(), count);
+    flatten->BatchInsertVector(vectors.data(), count, ids.data());
+    auto graph = std::make_shared<MockGraphDataCell>(neighbors);
+    auto pool = std::make_shared<VisitedListPool>(1, allocator.get(), count, allocator.get());
+
+    SearchRequest request;
+    request.cancellation_token_ = std::make_shared<CancellationToken>();
+    request.cancellation_token_->Cancel();
+    auto deadline = SearchDeadline::Make(std::numeric_limits<double>::max(), &request);
+
+    InnerSearchParam param;
+    param.ep = 0;
+    param.ef = count;
+    param.topk = count;
+    float query = 0.0F;
+    SearchStatistics stats;
+    QueryContext ctx{.alloc = allocator.get(), .stats = &stats, .deadline = deadline.get()};
+    REQUIRE_FALSE(SupportSpecializedGraphSearch(param, nullptr, &ctx));
+    auto vl = pool->TakeOne();
+    auto result =
+        BasicSearcher(common).Search(graph, flatten, vl, &query, param, LabelTablePtr{}, &ctx);
+    pool->ReturnOne(vl);
+
+    // only the entry point was evaluated before the first check
+    REQUIRE(result->Size() == 1);
+    REQUIRE(result->Top().second == 0);
+    REQUIRE(stats.is_cancelled.load());
+    REQUIRE_FALSE(stats.is_timeout.load());
+    REQUIRE(JsonType::Parse(stats.Dump())["terminated_phase"].GetString() == "approximate");
+}
+
+TEST_CASE("BasicSearcher specialized kernel matches the generic search",
+          "[ut][BasicSearcher][specialized]") {
+    constexpr uint64_t dim = 8;
+    constexpr InnerIdType count = 256;
+    constexpr uint64_t degree = 8;
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    IndexCommonParam common;
+    common.dim_ = dim;
+    common.allocator_ = allocator;
+    common.metric_ = MetricType::METRIC_TYPE_L2SQR;
+
+    constexpr const char* param_temp = R"({{"type": "{}"}})";
+    auto quantizer_param = QuantizerParameter::GetQuantizerParameterByJson(
+        JsonType::Parse(fmt::format(param_temp, "fp32")));
+    auto io_param =
+        IOParameter::GetIOParameterByJson(JsonType::Parse(fmt::format(param_temp, "memory_io")));
+    auto flatten = std::make_shared<
+        FlattenDataCell<FP32Quantizer<MetricType::METRIC_TYPE_L2SQR>, FixedLayout<MemoryIO>>>(
+        quantizer_param, io_param, common);
+
+    std::mt19937 rng(47);
+    std::uniform_real_distribution<float> dist(-1.0F, 1.0F);
+    std::vector<float> vectors(count * dim);
+    std::generate(vectors.begin(), vectors.end(), [&]() { return dist(rng); });
+    std::vector<InnerIdType> ids(count);
+    for (InnerIdType i = 0; i < count; ++i) {
+        ids[i] = i;
+    }
+    flatten->Train(vectors.data(), count);
+    flatten->Resize(count);
+    flatten->BatchInsertVector(vectors.data(), count, ids.data());
+
+    // exact k nearest neighbors plus a ring edge keeps the graph connected
+    auto graph_param = std::make_shared<GraphDataCellParameter>();
+    graph_param->io_parameter_ = std::make_shared<MemoryIOParameter>();
+    graph_param->max_degree_ = degree + 1;
+    auto graph = GraphInterface::MakeInstance(graph_param, common);
+    graph->Resize(count);
+    for (InnerIdType i = 0; i < count; ++i) {
+        std::vector<std::pair<float, InnerIdType>> order;
+        for (InnerIdType j = 0; j < count; ++j) {
+            if (j != i) {
+                order.emplace_back(flatten->ComputePairVectors(i, j), j);
+            }
+        }
+        std::partial_sort(order.begin(), order.begin() + degree, order.end());
+        Vector<InnerIdType> neighbors(allocator.get());
+        neighbors.push_back((i + 1) % count);
+        for (uint64_t k = 0; k < degree; ++k) {
+            if (order[k].second != neighbors[0]) {
+                neighbors.push_back(order[k].second);
+            }
+        }
+        graph->InsertNeighborsById(i, neighbors);
+    }
+
+    BasicSearcher generic(common);
+    BasicSearcher specialized(common);
+    REQUIRE(specialized.BindSpecializedKernel(graph, flatten));
+    auto mock_graph =
+        std::make_shared<MockGraphDataCell>(std::vector<std::vector<InnerIdType>>{{}});
+    BasicSearcher unsupported(common);
+    REQUIRE_FALSE(unsupported.BindSpecializedKernel(mock_graph, flatten));
+
+    auto pool = std::make_shared<VisitedListPool>(1, allocator.get(), count, allocator.get());
+    auto search = [&](const BasicSearcher& searcher,
+                      const InnerSearchParam& param,
+                      const float* query,
+                      SearchStatistics& stats) {
+        QueryContext ctx;
+        ctx.stats = &stats;
+        auto vl = pool->TakeOne();
+        auto result = searcher.Search(graph, flatten, vl, query, param, LabelTablePtr{}, &ctx);
+        pool->ReturnOne(vl);
+        std::vector<std::pair<float, InnerIdType>> records;
+        while (not result->Empty()) {
+            records.emplace_back(result->Top());
+            result->Pop();
+        }
+        return records;
+    };
+
+    const auto ef = GENERATE(10UL, 64UL);
+    InnerSearchParam param;
+    param.ep = 0;
+    param.ef = ef;
+    param.topk = 10;
+    std::vector<float> query(dim);
+    for (int i = 0; i < 16; ++i) {
+        std::generate(query.begin(), query.end(), [&]() { return dist(rng); });
+        SearchStatistics generic_stats;
+        SearchStatistics specialized_stats;
+        auto expected = search(generic, param, query.data(), generic_stats);
+        auto actual = search(specialized, param, query.data(), specialized_stats);
+        REQUIRE(actual == expected);
+        REQUIRE(specialized_stats.dist_cmp.load() == generic_stats.dist_cmp.load());
+        REQUIRE(specialized_stats.hops.load() == generic_stats.hops.load());
+    }
+
+    // parameters outside the fast path fall back to the generic loop
+    auto filter =
+        std::make_shared<BlackListFilter>([](LabelType id) -> bool { return id % 2 == 0; });
+    param.is_inner_id_allowed = filter;
+    SearchStatistics generic_stats;
+    SearchStatistics specialized_stats;
+    REQUIRE(search(specialized, param, query.data(), specialized_stats) ==
+            search(generic, param, query.data(), generic_stats));
+}
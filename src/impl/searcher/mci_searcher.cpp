@@ -66,15 +66,8 @@ struct MCIEpochMarks {
 };
 
 bool
-mci_check_overtime(const InnerSearchParam& inner_search_param, QueryContext* ctx) {
-    if (inner_search_param.time_cost == nullptr or
-        not inner_search_param.time_cost->CheckOvertime()) {
-        return false;
-    }
-    if (ctx != nullptr and ctx->stats != nullptr) {
-        ctx->stats->is_timeout.store(true, std::memory_order_relaxed);
-    }
-    return true;
+mci_check_overtime(QueryContext* ctx) {
+    return ctx != nullptr and ctx->ShouldStop();
 }
 
 float
@@ -166,7 +159,7 @@ search_precise_float_csr(const CliqueDataCellBaseView& view,
     };
 
     const auto seed_target = std::min<uint64_t>(mci_param.seed_count, total);
-    const bool check_overtime = inner_search_param.time_cost != nullptr;
+    const bool check_overtime = ctx != nullptr and ctx->deadline != nullptr;
     uint64_t seeds = 0;
     bool timed_out = false;
     bool seed_list_provided = false;
@@ -175,7 +168,7 @@ search_precise_float_csr(const CliqueDataCellBaseView& view,
         const auto seed_count = mci_param.seed_inner_ids->size();
         const auto sampled_seed_count = std::min<uint64_t>(seed_target, seed_count);
         for (uint64_t i = 0; i < sampled_seed_count; ++i) {
-            if (check_overtime and mci_check_overtime(inner_search_param, ctx)) {
+            if (check_overtime and mci_check_overtime(ctx)) {
                 timed_out = true;
                 break;
             }
@@ -187,7 +180,7 @@ search_precise_float_csr(const CliqueDataCellBaseView& view,
     }
     if (not seed_list_provided) {
         for (InnerIdType seed = 0; seed < total and seeds < seed_target; ++seed) {
-            if (check_overtime and mci_check_overtime(inner_search_param, ctx)) {
+            if (check_overtime and mci_check_overtime(ctx)) {
                 timed_out = true;
                 break;
             }
@@ -199,7 +192,7 @@ search_precise_float_csr(const CliqueDataCellBaseView& view,
 
     uint32_t hops = 0;
     while (not timed_out and hops < mci_param.hops_limit) {
-        if (check_overtime and mci_check_overtime(inner_search_param, ctx)) {
+        if (check_overtime and mci_check_overtime(ctx)) {
             break;
         }
         auto* candidate = get_closest_unexpanded();
@@ -339,7 +332,7 @@ MCISearcher::Search(const CliqueDataCellPtr& cliques,
     };
 
     const auto seed_target = std::min<uint64_t>(mci_param.seed_count, total);
-    const bool check_overtime = inner_search_param.time_cost != nullptr;
+    const bool check_overtime = ctx != nullptr and ctx->deadline != nullptr;
     uint64_t seeds = 0;
     bool timed_out = false;
     bool seed_list_provided = false;
@@ -348,7 +341,7 @@ MCISearcher::Search(const CliqueDataCellPtr& cliques,
         const auto seed_count = mci_param.seed_inner_ids->size();
         const auto sampled_seed_count = std::min<uint64_t>(seed_target, seed_count);
         for (uint64_t i = 0; i < sampled_seed_count; ++i) {
-            if (check_overtime and mci_check_overtime(inner_search_param, ctx)) {
+            if (check_overtime and mci_check_overtime(ctx)) {
                 timed_out = true;
                 break;
             }
@@ -360,7 +353,7 @@ MCISearcher::Search(const CliqueDataCellPtr& cliques,
     }
     if (not seed_list_provided) {
         for (InnerIdType seed = 0; seed < total and seeds < seed_target; ++seed) {
-            if (check_overtime and mci_check_overtime(inner_search_param, ctx)) {
+            if (check_overtime and mci_check_overtime(ctx)) {
                 timed_out = true;
                 break;
             }
@@ -374,7 +367,7 @@ MCISearcher::Search(const CliqueDataCellPtr& cliques,
     Vector<InnerIdType> clique_ids(alloc);
     Vector<InnerIdType> members(alloc);
     while (not timed_out and hops < mci_param.hops_limit) {
-        if (check_overtime and mci_check_overtime(inner_search_param, ctx)) {
+        if (check_overtime and mci_check_overtime(ctx)) {
             break;
         }
         auto* candidate = get_closest_unexpanded();
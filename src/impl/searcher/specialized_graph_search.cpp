@@ -0,0 +1,215 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "specialized_graph_search.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "datacell/flatten_datacell.h"
+#include "datacell/graph_datacell.h"
+#include "impl/heap/search_candidate_queue.h"
+#include "impl/heap/standard_heap.h"
+#include "io/io_headers.h"
+#include "quantization/quantizer_headers.h"
+
+namespace vsag {
+
+template <typename FlattenTmpl, typename GraphTmpl>
+static DistHeapPtr
+specialized_graph_search(GraphInterface* graph_base,
+                         FlattenInterface* flatten_base,
+                         VisitedList* vl,
+                         const void* query,
+                         const InnerSearchParam& inner_search_param,
+                         const MutexArrayPtr& mutex_array,
+                         uint32_t prefetch_stride_visit,
+                         QueryContext* ctx,
+                         Allocator* allocator) {
+    // qualified calls below bind statically, so the compiler can inline through the data cells
+    auto* flatten = static_cast<FlattenTmpl*>(flatten_base);
+    auto* graph = static_cast<GraphTmpl*>(graph_base);
+    auto computer = flatten->FlattenTmpl::FactoryComputer(query);
+
+    const auto ep = inner_search_param.ep;
+    const auto ef = std::max<uint64_t>(inner_search_param.ef, 1);
+    const auto max_degree = graph->GraphTmpl::MaximumDegree();
+
+    SearchCandidateQueue candidates(allocator);
+    candidates.Reset(ef);
+    Vector<InnerIdType> neighbors(max_degree, allocator);
+    Vector<InnerIdType> to_be_visited_id(max_degree, allocator);
+    Vector<float> line_dists(max_degree, allocator);
+
+    float dist = 0.0F;
+    flatten->FlattenTmpl::Query(&dist, computer, &ep, 1, ctx);
+    if (not std::isfinite(dist)) {
+        return nullptr;
+    }
+    uint32_t dist_cmp = 1;
+    uint32_t hops = 0;
+    // inserted == expanded is the point where the generic candidate heap would run empty
+    uint64_t inserted = 1;
+    uint64_t expanded = 0;
+    candidates.Insert(dist, ep);
+    vl->Set(ep);
+
+    while (expanded < inserted) {
+        ++hops;
+        if (hops >= inner_search_param.hops_limit) {
+            break;
+        }
+        // every unexpanded candidate within the ef best is closer than the ef-th result, so an
+        // exhausted pool is the same stop condition as the lower bound check of the generic loop
+        auto* current = candidates.GetClosestUnexpanded();
+        if (current == nullptr) {
+            break;
+        }
+        ++expanded;
+        const auto current_id = current->inner_id;
+
+        if (mutex_array != nullptr) {
+            SharedLock lock(mutex_array, current_id);
+            graph->GraphTmpl::GetNeighbors(current_id, neighbors);
+        } else {
+            graph->GraphTmpl::GetNeighbors(current_id, neighbors);
+        }
+
+        uint32_t count_no_visited = 0;
+        const auto neighbor_count = static_cast<uint32_t>(neighbors.size());
+        for (uint32_t i = 0; i < neighbor_count; ++i) {
+            if (i + prefetch_stride_visit < neighbor_count) {
+                vl->Prefetch(neighbors[i + prefetch_stride_visit]);
+            }
+            if (not vl->Get(neighbors[i])) {
+                vl->Set(neighbors[i]);
+                to_be_visited_id[count_no_visited++] = neighbors[i];
+            }
+        }
+
+        flatten->FlattenTmpl::Query(
+            line_dists.data(), computer, to_be_visited_id.data(), count_no_visited, ctx);
+        dist_cmp += count_no_visited;
+
+        for (uint32_t i = 0; i < count_no_visited; ++i) {
+            dist = line_dists[i];
+            if (not std::isfinite(dist)) {
+                return nullptr;
+            }
+            if (candidates.CanUpdate(dist)) {
+                candidates.Insert(dist, to_be_visited_id[i]);
+                ++inserted;
+                graph->GraphTmpl::Prefetch(to_be_visited_id[i], 0);
+            }
+        }
+    }
+
+    // without a filter the candidate pool is exactly the ef best results, already sorted
+    auto top_candidates = std::make_shared<StandardHeap<true, false>>(allocator, -1);
+    const auto result_count =
+        std::min<uint64_t>(candidates.Size(), static_cast<uint64_t>(inner_search_param.topk));
+    const auto* data = candidates.Data();
+    for (uint64_t i = 0; i < result_count; ++i) {
+        top_candidates->Push(data[i].distance, data[i].inner_id);
+    }
+
+    if (ctx != nullptr and ctx->stats != nullptr) {
+        ctx->stats->dist_cmp.fetch_add(dist_cmp, std::memory_order_relaxed);
+        ctx->stats->hops.fetch_add(hops, std::memory_order_relaxed);
+    }
+    return top_candidates;
+}
+
+template <typename FlattenTmpl, typename GraphTmpl>
+static SpecializedGraphSearchKernel
+match_kernel(const GraphInterfacePtr& graph, const FlattenInterfacePtr& flatten) {
+    if (dynamic_cast<FlattenTmpl*>(flatten.get()) != nullptr and
+        dynamic_cast<GraphTmpl*>(graph.get()) != nullptr) {
+        return &specialized_graph_search<FlattenTmpl, GraphTmpl>;
+    }
+    return nullptr;
+}
+
+template <MetricType metric, typename IOTmpl>
+static SpecializedGraphSearchKernel
+resolve_by_quantizer(const GraphInterfacePtr& graph, const FlattenInterfacePtr& flatten) {
+    using GraphTmpl = GraphDataCell<IOTmpl>;
+    using LayoutTmpl = FixedLayout<IOTmpl>;
+    using FP32Flatten = FlattenDataCell<FP32Quantizer<metric>, LayoutTmpl>;
+    using FP16Flatten = FlattenDataCell<FP16Quantizer<metric>, LayoutTmpl>;
+    using BF16Flatten = FlattenDataCell<BF16Quantizer<metric>, LayoutTmpl>;
+    using SQ8Flatten = FlattenDataCell<SQ8Quantizer<metric>, LayoutTmpl>;
+    using SQ8UniformFlatten = FlattenDataCell<SQ8UniformQuantizer<metric>, LayoutTmpl>;
+    using SQ4UniformFlatten = FlattenDataCell<SQ4UniformQuantizer<metric>, LayoutTmpl>;
+
+    auto kernel = match_kernel<FP32Flatten, GraphTmpl>(graph, flatten);
+    if (kernel == nullptr) {
+        kernel = match_kernel<FP16Flatten, GraphTmpl>(graph, flatten);
+    }
+    if (kernel == nullptr) {
+        kernel = match_kernel<BF16Flatten, GraphTmpl>(graph, flatten);
+    }
+    if (kernel == nullptr) {
+        kernel = match_kernel<SQ8Flatten, GraphTmpl>(graph, flatten);
+    }
+    if (kernel == nullptr) {
+        kernel = match_kernel<SQ8UniformFlatten, GraphTmpl>(graph, flatten);
+    }
+    if (kernel == nullptr) {
+        kernel = match_kernel<SQ4UniformFlatten, GraphTmpl>(graph, flatten);
+    }
+    return kernel;
+}
+
+template <MetricType metric>
+static SpecializedGraphSearchKernel
+resolve_by_io(const GraphInterfacePtr& graph, const FlattenInterfacePtr& flatten) {
+    auto kernel = resolve_by_quantizer<metric, MemoryBlockIO>(graph, flatten);
+    if (kernel == nullptr) {
+        kernel = resolve_by_quantizer<metric, MemoryIO>(graph, flatten);
+    }
+    return kernel;
+}
+
+SpecializedGraphSearchKernel
+ResolveSpecializedGraphSearch(const GraphInterfacePtr& graph, const FlattenInterfacePtr& flatten) {
+    if (graph == nullptr or flatten == nullptr) {
+        return nullptr;
+    }
+    auto kernel = resolve_by_io<MetricType::METRIC_TYPE_L2SQR>(graph, flatten);
+    if (kernel == nullptr) {
+        kernel = resolve_by_io<MetricType::METRIC_TYPE_IP>(graph, flatten);
+    }
+    if (kernel == nullptr) {
+        kernel = resolve_by_io<MetricType::METRIC_TYPE_COSINE>(graph, flatten);
+    }
+    return kernel;
+}
+
+bool
+SupportSpecializedGraphSearch(const InnerSearchParam& inner_search_param,
+                              const ComputerInterfacePtr& preset_computer,
+                              const QueryContext* ctx) {
+    return inner_search_param.search_mode == KNN_SEARCH and
+           inner_search_param.is_inner_id_allowed == nullptr and
+           inner_search_param.executors.empty() and
+           inner_search_param.distance_batch_func == nullptr and
+           not inner_search_param.enable_rabitq_one_bit_search and
+           not inner_search_param.consider_duplicate and not inner_search_param.find_duplicate and
+           inner_search_param.early_stop_patience == 0 and preset_computer == nullptr and
+           (ctx == nullptr or (ctx->reasoning_ctx == nullptr and ctx->deadline == nullptr));
+}
+
+}  // namespace vsag
@@ -0,0 +1,68 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "datacell/flatten_interface.h"
+#include "datacell/graph_interface.h"
+#include "impl/heap/distance_heap.h"
+#include "impl/inner_search_param.h"
+#include "query_context.h"
+#include "utils/lock_strategy.h"
+#include "utils/visited_list.h"
+
+namespace vsag {
+
+/**
+ * @brief A KNN graph search loop compiled for one concrete (flatten, graph) pair.
+ *
+ * The kernel calls the concrete FlattenDataCell::Query, GraphDataCell::GetNeighbors and
+ * GraphDataCell::Prefetch directly, and keeps the candidates in a SearchCandidateQueue of
+ * capacity ef instead of two virtual heaps. It only covers the unfiltered KNN path; callers must
+ * check SupportSpecializedGraphSearch first.
+ *
+ * @return the top-k heap, or nullptr if a non-finite distance was met and the caller must rerun
+ *         the generic search (the visited list is left dirty in that case).
+ */
+using SpecializedGraphSearchKernel = DistHeapPtr (*)(GraphInterface* graph,
+                                                     FlattenInterface* flatten,
+                                                     VisitedList* vl,
+                                                     const void* query,
+                                                     const InnerSearchParam& inner_search_param,
+                                                     const MutexArrayPtr& mutex_array,
+                                                     uint32_t prefetch_stride_visit,
+                                                     QueryContext* ctx,
+                                                     Allocator* allocator);
+
+/**
+ * @brief Resolve the specialized kernel for the runtime types of graph and flatten.
+ *
+ * Kernels exist for FlattenDataCell with the fp32, fp16, bf16, sq8, sq8_uniform and sq4_uniform
+ * quantizers over FixedLayout<MemoryBlockIO|MemoryIO>, paired with a GraphDataCell on the same IO.
+ *
+ * @return the kernel, or nullptr if the pair is not covered.
+ */
+SpecializedGraphSearchKernel
+ResolveSpecializedGraphSearch(const GraphInterfacePtr& graph, const FlattenInterfacePtr& flatten);
+
+/**
+ * @brief Whether a search request can take the specialized kernel at all.
+ */
+bool
+SupportSpecializedGraphSearch(const InnerSearchParam& inner_search_param,
+                              const ComputerInterfacePtr& preset_computer,
+                              const QueryContext* ctx);
+
+}  // namespace vsag
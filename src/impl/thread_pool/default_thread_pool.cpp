@@ -15,17 +15,38 @@
 
 #include "default_thread_pool.h"
 
+#include "utils/numa.h"
 #include "vsag/options.h"
 
 namespace vsag {
 
-DefaultThreadPool::DefaultThreadPool(std::uint64_t threads) {
+DefaultThreadPool::DefaultThreadPool(std::uint64_t threads)
+    : numa_affinity_(Options::Instance().numa_thread_affinity() and NumaNodeCount() > 1) {
     pool_ = std::make_unique<progschj::ThreadPool>(threads);
 }
 
 std::future<void>
 DefaultThreadPool::Enqueue(std::function<void(void)> task) {
-    return pool_->enqueue(task);
+    if (not numa_affinity_) {
+        return pool_->enqueue(task);
+    }
+    // progschj::ThreadPool has no thread start hook, so a worker pins itself on its first task
+    return pool_->enqueue([this, task = std::move(task)]() {
+        this->pin_current_worker();
+        task();
+    });
+}
+
+void
+DefaultThreadPool::pin_current_worker() {
+    thread_local bool pinned = false;
+    if (pinned) {
+        return;
+    }
+    pinned = true;
+    const auto& nodes = NumaOnlineNodes();
+    auto index = next_numa_node_.fetch_add(1, std::memory_order_relaxed) % nodes.size();
+    NumaPinThreadToNode(nodes[index]);
 }
 
 void
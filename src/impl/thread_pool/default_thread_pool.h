@@ -17,6 +17,7 @@
 
 #include <ThreadPool.h>
 
+#include <atomic>
 #include <functional>
 #include <future>
 
@@ -41,6 +42,15 @@ public:
     SetPoolSize(std::uint64_t limit) override;
 
 private:
+    void
+    pin_current_worker();
+
+private:
+    // snapshot of Options::numa_thread_affinity() taken at construction
+    const bool numa_affinity_{false};
+
+    std::atomic<uint32_t> next_numa_node_{0};
+
     std::unique_ptr<progschj::ThreadPool> pool_;
 };
 
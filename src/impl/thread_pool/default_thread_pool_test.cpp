@@ -17,6 +17,7 @@
 #include <atomic>
 
 #include "unittest.h"
+#include "vsag/options.h"
 using namespace vsag;
 
 TEST_CASE("DefaultThreadPool Basic Test", "[ut][DefaultThreadPool]") {
@@ -65,3 +66,16 @@ TEST_CASE("DefaultThreadPool SetQueueSizeLimit Test", "[ut][DefaultThreadPool]")
     pool.WaitUntilEmpty();
     REQUIRE(counter == 50);
 }
+
+TEST_CASE("DefaultThreadPool NUMA Affinity Test", "[ut][DefaultThreadPool]") {
+    vsag::Options::Instance().set_numa_thread_affinity(true);
+    DefaultThreadPool pool(4);
+    vsag::Options::Instance().set_numa_thread_affinity(false);
+
+    std::atomic<int> counter{0};
+    for (int i = 0; i < 20; ++i) {
+        pool.Enqueue([&counter]() { counter++; });
+    }
+    pool.WaitUntilEmpty();
+    REQUIRE(counter == 20);
+}
@@ -0,0 +1,50 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <future>
+
+#include "vsag/thread_pool.h"
+
+namespace vsag {
+
+/// Runs every task on the enqueueing thread, for work that already runs on a pool worker and
+/// must not queue behind that pool or start a new one.
+class InlineThreadPool : public ThreadPool {
+public:
+    std::future<void>
+    Enqueue(std::function<void(void)> task) override {
+        std::packaged_task<void()> packaged(std::move(task));
+        auto result = packaged.get_future();
+        packaged();
+        return result;
+    }
+
+    void
+    WaitUntilEmpty() override {
+    }
+
+    void
+    SetQueueSizeLimit(std::uint64_t /*limit*/) override {
+    }
+
+    void
+    SetPoolSize(std::uint64_t /*limit*/) override {
+    }
+};
+
+}  // namespace vsag
@@ -0,0 +1,38 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "inline_thread_pool.h"
+
+#include <chrono>
+#include <thread>
+
+#include "safe_thread_pool.h"
+#include "unittest.h"
+
+TEST_CASE("InlineThreadPool runs tasks on the caller", "[ut][InlineThreadPool]") {
+    auto thread_pool = std::make_shared<vsag::SafeThreadPool>(new vsag::InlineThreadPool(), true);
+    const auto caller = std::this_thread::get_id();
+    std::thread::id runner;
+    auto future = thread_pool->GeneralEnqueue(
+        [&runner](int i) -> int {
+            runner = std::this_thread::get_id();
+            return i * i;
+        },
+        3);
+    // the task has already run when Enqueue returns
+    REQUIRE(future.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+    REQUIRE(future.get() == 9);
+    REQUIRE(runner == caller);
+}
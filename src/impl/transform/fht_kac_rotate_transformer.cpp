@@ -15,6 +15,7 @@
 
 #include "fht_kac_rotate_transformer.h"
 
+#include <algorithm>
 #include <random>
 
 #include "simd/rabitq_simd.h"
@@ -93,6 +94,64 @@ FhtKacRotator::Transform(const float* data, float* rotated_vec) const {
 
     return meta;
 }
+
+void
+FhtKacRotator::TransformBatch(const float* data,
+                              float* rotated_vecs,
+                              uint64_t count,
+                              TransformerMetaPtr* metas) const {
+    auto dim = static_cast<uint64_t>(this->input_dim_);
+    std::memcpy(rotated_vecs, data, sizeof(float) * dim * count);
+
+    // run every butterfly stage over the whole block before moving on, so that the flip
+    // pattern of the current round stays in cache instead of being reloaded per vector
+    for (uint64_t begin = 0; begin < count; begin += BATCH_BLOCK_SIZE) {
+        auto end = std::min(count, begin + BATCH_BLOCK_SIZE);
+        if (trunc_dim_ == dim) {
+            for (int flip_time = 0; flip_time < ROUND; flip_time++) {
+                const auto* flip = flip_.data() + flip_time * flip_offset_;
+                for (uint64_t i = begin; i < end; ++i) {
+                    auto* vec = rotated_vecs + i * dim;
+                    FlipSign(flip, vec, dim);
+                    FHTRotate(vec, trunc_dim_);
+                    VecRescale(vec, trunc_dim_, fac_);
+                }
+            }
+            continue;
+        }
+
+        uint64_t start = dim - trunc_dim_;
+        for (int flip_time = 0; flip_time < ROUND; flip_time += 2) {
+            const auto* flip = flip_.data() + flip_time * flip_offset_;
+            for (uint64_t i = begin; i < end; ++i) {
+                auto* vec = rotated_vecs + i * dim;
+                FlipSign(flip, vec, dim);
+                FHTRotate(vec, trunc_dim_);
+                VecRescale(vec, trunc_dim_, fac_);
+                KacsWalk(vec, dim);
+            }
+
+            flip = flip_.data() + (flip_time + 1) * flip_offset_;
+            for (uint64_t i = begin; i < end; ++i) {
+                auto* vec = rotated_vecs + i * dim;
+                FlipSign(flip, vec, dim);
+                FHTRotate(vec + start, trunc_dim_);
+                VecRescale(vec + start, trunc_dim_, fac_);
+                KacsWalk(vec, dim);
+            }
+        }
+        for (uint64_t i = begin; i < end; ++i) {
+            VecRescale(rotated_vecs + i * dim, dim, 0.25F);
+        }
+    }
+
+    if (metas != nullptr) {
+        for (uint64_t i = 0; i < count; ++i) {
+            metas[i] = std::make_shared<FHTMeta>();
+        }
+    }
+}
+
 void
 FhtKacRotator::InverseTransform(float const* data, float* rotated_vec) const {
     auto dim = static_cast<uint64_t>(this->input_dim_);
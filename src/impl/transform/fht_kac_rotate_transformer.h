@@ -31,6 +31,12 @@ public:
     TransformerMetaPtr
     Transform(const float* data, float* rotated_vec) const override;
 
+    void
+    TransformBatch(const float* data,
+                   float* rotated_vecs,
+                   uint64_t count,
+                   TransformerMetaPtr* metas) const override;
+
     void
     InverseTransform(const float* data, float* rotated_vec) const override;
 
@@ -85,6 +85,24 @@ TestTransform(FhtKacRotator& rom, uint32_t dim) {
     REQUIRE(std::fabs(original_length - inverse_length) < 1e-4);
 }
 
+void
+TestTransformBatch(FhtKacRotator& rom, uint64_t input_dim, uint64_t output_dim) {
+    uint64_t count = 100;
+    std::vector<float> vecs = fixtures::generate_vectors(count, input_dim);
+    std::vector<float> batch_output(count * output_dim, 0);
+    std::vector<TransformerMetaPtr> metas(count);
+    rom.TransformBatch(vecs.data(), batch_output.data(), count, metas.data());
+
+    std::vector<float> single_output(output_dim, 0);
+    for (uint64_t i = 0; i < count; ++i) {
+        REQUIRE(metas[i] != nullptr);
+        rom.Transform(vecs.data() + i * input_dim, single_output.data());
+        for (uint64_t d = 0; d < output_dim; ++d) {
+            REQUIRE(std::fabs(single_output[d] - batch_output[i * output_dim + d]) < 1e-3);
+        }
+    }
+}
+
 TEST_CASE("Basic Hadamard Test", "[ut][FhtKacRotator]") {
     auto allocator = SafeAllocator::FactoryDefaultAllocator();
     const auto dims = fixtures::get_common_used_dims();
@@ -95,6 +113,7 @@ TEST_CASE("Basic Hadamard Test", "[ut][FhtKacRotator]") {
         rom.Train();
         rom_alter.Train();
         TestTransform(rom, dim);
+        TestTransformBatch(rom, dim, dim);
         TestRandomness(rom, rom_alter, dim);
     }
 }
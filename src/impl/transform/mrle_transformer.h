@@ -43,6 +43,25 @@ public:
         return meta;
     }
 
+    void
+    TransformBatch(const float* original_vecs,
+                   float* transformed_vecs,
+                   uint64_t count,
+                   TransformerMetaPtr* metas) const override {
+        for (uint64_t i = 0; i < count; ++i) {
+            auto* transformed_vec = transformed_vecs + i * this->output_dim_;
+            memcpy(transformed_vec,
+                   original_vecs + i * this->input_dim_,
+                   this->output_dim_ * sizeof(float));
+            if constexpr (metric == MetricType::METRIC_TYPE_COSINE) {
+                Normalize(transformed_vec, transformed_vec, this->output_dim_);
+            }
+            if (metas != nullptr) {
+                metas[i] = std::make_shared<MRLETMeta>();
+            }
+        }
+    }
+
     void
     InverseTransform(const float* transformed_vec, float* original_vec) const override {
         throw VsagException(ErrorType::INTERNAL_ERROR, "InverseTransform not implement");
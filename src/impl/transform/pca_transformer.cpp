@@ -17,6 +17,7 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <random>
 
 #include "impl/blas/blas_function.h"
@@ -92,6 +93,46 @@ PCATransformer::Transform(const float* input_vec, float* output_vec) const {
     return meta;
 }
 
+void
+PCATransformer::TransformBatch(const float* input_vecs,
+                               float* output_vecs,
+                               uint64_t count,
+                               TransformerMetaPtr* metas) const {
+    vsag::Vector<float> centralized_data(allocator_);
+    centralized_data.resize(std::min(count, BATCH_BLOCK_SIZE) * input_dim_, 0.0F);
+
+    for (uint64_t begin = 0; begin < count; begin += BATCH_BLOCK_SIZE) {
+        auto block = std::min(BATCH_BLOCK_SIZE, count - begin);
+        const auto* block_input = input_vecs + begin * input_dim_;
+        for (uint64_t i = 0; i < block; ++i) {
+            this->CentralizeData(block_input + i * input_dim_,
+                                 centralized_data.data() + i * input_dim_);
+        }
+
+        // output[block, output_dim] = centralized[block, input_dim] * pca_matrix_^T
+        BlasFunction::Sgemm(BlasFunction::RowMajor,
+                            BlasFunction::NoTrans,
+                            BlasFunction::Trans,
+                            static_cast<int32_t>(block),
+                            static_cast<int32_t>(output_dim_),
+                            static_cast<int32_t>(input_dim_),
+                            1.0F,
+                            centralized_data.data(),
+                            static_cast<int32_t>(input_dim_),
+                            pca_matrix_.data(),
+                            static_cast<int32_t>(input_dim_),
+                            0.0F,
+                            output_vecs + begin * output_dim_,
+                            static_cast<int32_t>(output_dim_));
+    }
+
+    if (metas != nullptr) {
+        for (uint64_t i = 0; i < count; ++i) {
+            metas[i] = std::make_shared<PCAMeta>();
+        }
+    }
+}
+
 void
 PCATransformer::InverseTransform(const float* input_vec, float* output_vec) const {
     throw VsagException(ErrorType::INTERNAL_ERROR, "InverseTransform not implement");
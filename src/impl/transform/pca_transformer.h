@@ -65,6 +65,12 @@ public:
     TransformerMetaPtr
     Transform(const float* input_vec, float* output_vec) const override;
 
+    void
+    TransformBatch(const float* input_vecs,
+                   float* output_vecs,
+                   uint64_t count,
+                   TransformerMetaPtr* metas) const override;
+
     void
     InverseTransform(const float* input_vec, float* output_vec) const override;
 
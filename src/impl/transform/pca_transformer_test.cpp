@@ -183,6 +183,24 @@ TestTrainMinSampleCount() {
     REQUIRE_THROWS_AS(pca.Train(null_data, 2), VsagException);
 }
 
+void
+TestTransformBatch(PCATransformer& pca, uint64_t input_dim, uint64_t output_dim) {
+    uint64_t count = 100;
+    std::vector<float> vecs = fixtures::generate_vectors(count, input_dim);
+    std::vector<float> batch_output(count * output_dim, 0);
+    std::vector<TransformerMetaPtr> metas(count);
+    pca.TransformBatch(vecs.data(), batch_output.data(), count, metas.data());
+
+    std::vector<float> single_output(output_dim, 0);
+    for (uint64_t i = 0; i < count; ++i) {
+        REQUIRE(metas[i] != nullptr);
+        pca.Transform(vecs.data() + i * input_dim, single_output.data());
+        for (uint64_t d = 0; d < output_dim; ++d) {
+            REQUIRE(std::fabs(single_output[d] - batch_output[i * output_dim + d]) < 1e-3);
+        }
+    }
+}
+
 TEST_CASE("PCA Basic Test", "[ut][PCA]") {
     auto allocator = SafeAllocator::FactoryDefaultAllocator();
     const auto dims = fixtures::get_common_used_dims();
@@ -196,6 +214,12 @@ TEST_CASE("PCA Basic Test", "[ut][PCA]") {
     for (auto dim : dims) {
         PCATransformer pca(allocator.get(), dim, dim);
         TestCentralize(pca, dim);
+
+        uint64_t target_dim = (dim + 1) / 2;
+        PCATransformer pca_reduce(allocator.get(), dim, target_dim);
+        std::vector<float> train_vecs = fixtures::generate_vectors(1000, dim);
+        pca_reduce.Train(train_vecs.data(), 1000);
+        TestTransformBatch(pca_reduce, dim, target_dim);
     }
 }
 
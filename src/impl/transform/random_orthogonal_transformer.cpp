@@ -16,6 +16,7 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <random>
 
 #include "impl/blas/blas_function.h"
@@ -76,6 +77,38 @@ RandomOrthogonalMatrix::Transform(const float* original_vec, float* transformed_
     return meta;
 }
 
+void
+RandomOrthogonalMatrix::TransformBatch(const float* original_vecs,
+                                       float* transformed_vecs,
+                                       uint64_t count,
+                                       TransformerMetaPtr* metas) const {
+    // perform matrix-matrix multiplication: Y = X * Q^T
+    auto dim = static_cast<int32_t>(this->input_dim_);
+    for (uint64_t begin = 0; begin < count; begin += BATCH_BLOCK_SIZE) {
+        auto block = std::min(BATCH_BLOCK_SIZE, count - begin);
+        BlasFunction::Sgemm(BlasFunction::RowMajor,
+                            BlasFunction::NoTrans,
+                            BlasFunction::Trans,
+                            static_cast<int32_t>(block),
+                            dim,
+                            dim,
+                            1.0F,
+                            original_vecs + begin * dim,
+                            dim,
+                            orthogonal_matrix_.data(),
+                            dim,
+                            0.0F,
+                            transformed_vecs + begin * dim,
+                            dim);
+    }
+
+    if (metas != nullptr) {
+        for (uint64_t i = 0; i < count; ++i) {
+            metas[i] = std::make_shared<ROMMeta>();
+        }
+    }
+}
+
 void
 RandomOrthogonalMatrix::InverseTransform(const float* transformed_vec, float* original_vec) const {
     // perform matrix-vector multiplication: x = Q^T * y
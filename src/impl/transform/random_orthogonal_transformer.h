@@ -32,6 +32,12 @@ public:
     TransformerMetaPtr
     Transform(const float* original_vec, float* transformed_vec) const override;
 
+    void
+    TransformBatch(const float* original_vecs,
+                   float* transformed_vecs,
+                   uint64_t count,
+                   TransformerMetaPtr* metas) const override;
+
     void
     InverseTransform(const float* transformed_vec, float* original_vec) const override;
 
@@ -22,6 +22,20 @@ namespace vsag {
 VectorTransformer::VectorTransformer(Allocator* allocator, int64_t input_dim, int64_t output_dim)
     : allocator_(allocator), input_dim_(input_dim), output_dim_(output_dim) {
 }
+
+void
+VectorTransformer::TransformBatch(const float* input_vecs,
+                                  float* output_vecs,
+                                  uint64_t count,
+                                  TransformerMetaPtr* metas) const {
+    for (uint64_t i = 0; i < count; ++i) {
+        auto meta = this->Transform(input_vecs + i * input_dim_, output_vecs + i * output_dim_);
+        if (metas != nullptr) {
+            metas[i] = std::move(meta);
+        }
+    }
+}
+
 void
 VectorTransformer::InverseTransform(const float* input_vec, float* output_vec) const {
     throw VsagException(ErrorType::INTERNAL_ERROR, "InverseTransform not implement");
@@ -55,6 +55,20 @@ public:
         return nullptr;
     };
 
+    /**
+     * @brief Transform count row-major vectors in one call.
+     *
+     * @param input_vecs Input matrix of shape [count, input_dim].
+     * @param output_vecs Output matrix of shape [count, output_dim].
+     * @param count Number of vectors to transform.
+     * @param metas Optional output array of count metas, skipped when nullptr.
+     */
+    virtual void
+    TransformBatch(const float* input_vecs,
+                   float* output_vecs,
+                   uint64_t count,
+                   TransformerMetaPtr* metas) const;
+
     virtual void
     Serialize(StreamWriter& writer) const = 0;
 
@@ -108,6 +122,10 @@ public:
         return this->extra_code_size_;
     }
 
+public:
+    // rows transformed per matrix-level call, bounds the scratch buffers of TransformBatch
+    static constexpr uint64_t BATCH_BLOCK_SIZE = 1024;
+
 protected:
     uint32_t extra_code_size_{0};  // e.g., sizeof(float)
     int64_t input_dim_{0};
@@ -14,11 +14,13 @@
 
 #pragma once
 
+#include <fmt/format.h>
 #include <nlohmann/json.hpp>
 #include <set>
 
 #include "algorithm/inner_index_interface.h"
 #include "common.h"
+#include "impl/allocator/memory_budget.h"
 #include "index_common_param.h"
 #include "query_context.h"
 #include "utils/search_threshold.h"
@@ -78,11 +80,18 @@ public:
         return std::vector<int64_t>();      \
     }
 
+#define CHECK_MEMORY_ADMISSION(dataset)                                             \
+    if (auto admission = this->check_memory_admission((dataset)->GetNumElements()); \
+        not admission.has_value()) {                                                \
+        return tl::unexpected(admission.error());                                   \
+    }
+
 public:
     tl::expected<std::vector<int64_t>, Error>
     Add(const DatasetPtr& base) override {
         CHECK_IMMUTABLE_INDEX("add");
         CHECK_NONEMPTY_DATASET(base);
+        CHECK_MEMORY_ADMISSION(base);
         SAFE_CALL(return this->inner_index_->Add(base));
     }
 
@@ -95,6 +104,7 @@ public:
     Build(const DatasetPtr& base) override {
         CHECK_IMMUTABLE_INDEX("build");
         CHECK_NONEMPTY_DATASET(base);
+        CHECK_MEMORY_ADMISSION(base);
         SAFE_CALL(return this->inner_index_->Build(base));
     }
 
@@ -271,7 +281,18 @@ public:
 
     [[nodiscard]] std::unordered_map<std::string, uint64_t>
     GetMemoryUsageDetail() const override {
-        return this->inner_index_->GetMemoryUsageDetail();
+        auto detail = this->inner_index_->GetMemoryUsageDetail();
+        if (auto* allocator = this->budget_allocator(); allocator != nullptr) {
+            // what the allocator really handed out, next to the estimate for the same size
+            for (const auto& [name, bytes] : allocator->GetUsageDetail()) {
+                detail["accounted_" + name] = bytes;
+            }
+            try {
+                detail["estimated"] = this->inner_index_->EstimateMemory(GetNumElements());
+            } catch (const std::exception&) {
+            }
+        }
+        return detail;
     }
 
     tl::expected<std::pair<int64_t, int64_t>, Error>
@@ -318,6 +339,7 @@ public:
         if (GetNumElements() == 0 && !this->ShouldSkipEmptyCheck(parameters)) {
             return make_empty_search_result();
         }
+        ScopedMemoryCategory search_memory(MemoryCategory::SEARCH);
         SAFE_CALL(return this->inner_index_->KnnSearch(query, k, parameters, invalid));
     }
 
@@ -334,6 +356,7 @@ public:
         if (GetNumElements() == 0 && !this->ShouldSkipEmptyCheck(parameters)) {
             return make_empty_search_result();
         }
+        ScopedMemoryCategory search_memory(MemoryCategory::SEARCH);
         SAFE_CALL(return this->inner_index_->KnnSearch(query, k, parameters, filter));
     }
 
@@ -350,6 +373,7 @@ public:
         if (GetNumElements() == 0 && !this->ShouldSkipEmptyCheck(parameters)) {
             return make_empty_search_result();
         }
+        ScopedMemoryCategory search_memory(MemoryCategory::SEARCH);
         SAFE_CALL(return this->inner_index_->KnnSearch(query, k, parameters, filter));
     }
 
@@ -363,6 +387,7 @@ public:
         if (GetNumElements() == 0 && !this->ShouldSkipEmptyCheck(search_param.parameters)) {
             return make_empty_search_result();
         }
+        ScopedMemoryCategory search_memory(MemoryCategory::SEARCH);
         if (search_param.is_iter_filter) {
             SAFE_CALL(return this->inner_index_->KnnSearch(query,
                                                            k,
@@ -392,6 +417,7 @@ public:
         if (GetNumElements() == 0 && !this->ShouldSkipEmptyCheck(parameters)) {
             return make_empty_search_result();
         }
+        ScopedMemoryCategory search_memory(MemoryCategory::SEARCH);
         SAFE_CALL(return this->inner_index_->KnnSearch(
             query, k, parameters, filter, nullptr, iter_ctx, is_last_filter));
     }
@@ -431,6 +457,7 @@ public:
         if (GetNumElements() == 0 && !this->ShouldSkipEmptyCheck(parameters)) {
             return make_empty_search_result();
         }
+        ScopedMemoryCategory search_memory(MemoryCategory::SEARCH);
         SAFE_CALL(return this->inner_index_->RangeSearch(query, radius, parameters, limited_size));
     }
 
@@ -444,6 +471,7 @@ public:
         if (GetNumElements() == 0 && !this->ShouldSkipEmptyCheck(parameters)) {
             return make_empty_search_result();
         }
+        ScopedMemoryCategory search_memory(MemoryCategory::SEARCH);
         SAFE_CALL(return this->inner_index_->RangeSearch(
             query, radius, parameters, invalid, limited_size));
     }
@@ -458,6 +486,7 @@ public:
         if (GetNumElements() == 0 && !this->ShouldSkipEmptyCheck(parameters)) {
             return make_empty_search_result();
         }
+        ScopedMemoryCategory search_memory(MemoryCategory::SEARCH);
         SAFE_CALL(return this->inner_index_->RangeSearch(
             query, radius, parameters, filter, limited_size));
     }
@@ -472,6 +501,7 @@ public:
         if (GetNumElements() == 0 && !this->ShouldSkipEmptyCheck(parameters)) {
             return make_empty_search_result();
         }
+        ScopedMemoryCategory search_memory(MemoryCategory::SEARCH);
         SAFE_CALL(return this->inner_index_->RangeSearch(
             query, radius, parameters, filter, limited_size));
     }
@@ -557,6 +587,7 @@ public:
             } catch (const nlohmann::json::exception&) {
             }
         }
+        ScopedMemoryCategory search_memory(MemoryCategory::SEARCH);
         SAFE_CALL(ValidateSearchThreshold(request.threshold_);
                   if (GetNumElements() == 0 && !this->ShouldSkipEmptyCheck(request.params_str_)) {
                       return make_empty_search_result();
@@ -638,6 +669,36 @@ private:
     }
 
 private:
+    BudgetAllocator*
+    budget_allocator() const {
+        return dynamic_cast<BudgetAllocator*>(this->common_param_.allocator_.get());
+    }
+
+    tl::expected<void, Error>
+    check_memory_admission(uint64_t add_count) const {
+        auto* allocator = this->budget_allocator();
+        if (allocator == nullptr) {
+            return {};
+        }
+        uint64_t estimate = 0;
+        try {
+            estimate = this->inner_index_->EstimateMemory(GetNumElements() + add_count);
+        } catch (const std::exception&) {
+            // without an estimate the insert is only bounded by its allocations
+            return {};
+        }
+        const auto used = allocator->GetUsage();
+        if (estimate <= used or allocator->TryAdmit(estimate - used)) {
+            return {};
+        }
+        return tl::unexpected(Error(ErrorType::NO_ENOUGH_MEMORY,
+                                    fmt::format("memory budget cannot admit {} more elements: "
+                                                "{} bytes estimated, {} bytes used",
+                                                add_count,
+                                                estimate,
+                                                used)));
+    }
+
     tl::expected<void, Error>
     ValidateThresholdParameters(const std::string& parameters) const {
         try {
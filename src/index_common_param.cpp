@@ -17,6 +17,7 @@
 #include <fmt/format.h>
 
 #include "common.h"
+#include "impl/allocator/memory_budget.h"
 #include "vsag/constants.h"
 #include "vsag/resource.h"
 
@@ -170,6 +171,22 @@ IndexCommonParam::CheckAndCreate(JsonType& params, const std::shared_ptr<Resourc
         result.use_old_serial_format_ = true;
     }
 
+    uint64_t memory_limit = 0;
+    if (params.Contains(PARAMETER_MEMORY_LIMIT)) {
+        CHECK_ARGUMENT(params[PARAMETER_MEMORY_LIMIT].IsNumberInteger(),
+                       fmt::format("parameters[{}] must be integer type", PARAMETER_MEMORY_LIMIT));
+        memory_limit = params[PARAMETER_MEMORY_LIMIT].GetUint64();
+    }
+    auto memory_budget = resource->GetMemoryBudget();
+    if (memory_budget == nullptr and memory_limit > 0) {
+        // a per-index limit alone still needs a (private, unlimited) budget to charge
+        memory_budget = std::make_shared<MemoryBudget>();
+    }
+    if (memory_budget != nullptr and (memory_budget->IsEnabled() or memory_limit > 0)) {
+        result.allocator_ =
+            MemoryBudget::CreateIndexAllocator(memory_budget, result.allocator_, memory_limit);
+    }
+
     return result;
 }
 
@@ -31,6 +31,7 @@ const char* const INDEX_TYPE_PYRAMID = "pyramid";
 const char* const TYPE_KEY = "type";
 const char* const USE_REORDER_KEY = "use_reorder";
 const char* const REORDER_SOURCE_KEY = "reorder_source";
+const char* const PRECISE_HOT_CODES_SIZE_KEY = "precise_hot_codes_size";
 const char* const USE_QUANTIZATION = "use_quantization";
 const char* const EXTRA_INFO_KEY = "extra_info";
 const char* const USE_ATTRIBUTE_FILTER_KEY = "use_attribute_filter";
@@ -78,6 +79,12 @@ const char* const IO_TYPE_VALUE_BLOCK_MEMORY_IO = "block_memory_io";
 const char* const READ_CACHE_TOTAL_CACHE_SIZE_KEY = "total_cache_size";
 const char* const READ_CACHE_ENABLED_KEY = "enable_read_cache";
 const char* const BLOCK_IO_BLOCK_SIZE_KEY = "block_size";
+const char* const BLOCK_IO_NUMA_INTERLEAVE_KEY = "numa_interleave";
+const char* const BLOCK_IO_HUGE_PAGE_KEY = "huge_page";
+const char* const BLOCK_IO_HUGE_PAGE_VALUE_NONE = "none";
+const char* const BLOCK_IO_HUGE_PAGE_VALUE_TRANSPARENT = "transparent";
+const char* const BLOCK_IO_HUGE_PAGE_VALUE_2M = "2m";
+const char* const BLOCK_IO_HUGE_PAGE_VALUE_1G = "1g";
 
 // IO param for file
 const char* const IO_FILE_PATH_KEY = "file_path";
@@ -94,6 +101,8 @@ const char* const QUANTIZATION_TYPE_VALUE_SQ4_UNIFORM = "sq4_uniform";
 const char* const QUANTIZATION_TYPE_VALUE_FP32 = "fp32";
 const char* const QUANTIZATION_TYPE_VALUE_FP16 = "fp16";
 const char* const QUANTIZATION_TYPE_VALUE_BF16 = "bf16";
+const char* const QUANTIZATION_TYPE_VALUE_FP8_E4M3 = "fp8_e4m3";
+const char* const QUANTIZATION_TYPE_VALUE_FP8_E5M2 = "fp8_e5m2";
 const char* const QUANTIZATION_TYPE_VALUE_INT8 = "int8";
 const char* const QUANTIZATION_TYPE_VALUE_PQ = "pq";
 const char* const QUANTIZATION_TYPE_VALUE_PQFS = "pqfs";
@@ -135,6 +144,8 @@ const char* const SPARSE_DOC_PRUNE_RATIO = "doc_prune_ratio";
 const char* const SPARSE_TERM_PRUNE_RATIO = "term_prune_ratio";
 const char* const SPARSE_TERM_RETAIN_THRESHOLD = "term_retain_threshold";
 const char* const SPARSE_FILTER_CALLBACK_LIMIT = "filter_callback_limit";
+const char* const SPARSE_BLOCK_MAX_PRUNING = "block_max_pruning";
+const char* const SPARSE_BLOCK_MAX_PRUNING_RATIO = "block_max_pruning_ratio";
 const char* const SPARSE_TERM_ID_LIMIT = "term_id_limit";
 const char* const SPARSE_WINDOW_SIZE = "window_size";
 const char* const SPARSE_DESERIALIZE_WITHOUT_FOOTER = "deserialize_without_footer";
@@ -142,6 +153,7 @@ const char* const SPARSE_DESERIALIZE_WITHOUT_BUFFER = "deserialize_without_buffe
 const char* const SPARSE_AVG_DOC_TERM_LENGTH = "avg_doc_term_length";
 const char* const SPARSE_REMAP_TERM_IDS = "remap_term_ids";
 const char* const SPARSE_IMMUTABLE = "immutable";
+const char* const SPARSE_TERM_HOT_CACHE_SIZE = "term_hot_cache_size";
 
 // graph param value
 const char* const GRAPH_PARAM_MAX_DEGREE_KEY = "max_degree";
@@ -174,6 +186,8 @@ const char* const IVF_PARTITION_STRATEGY_TYPE_NEAREST = "ivf";
 const char* const IVF_PARTITION_STRATEGY_TYPE_GNO_IMI = "gno_imi";
 const char* const IVF_ROUTE_MAX_DEGREE_KEY = "route_max_degree";
 const char* const IVF_ROUTE_EF_CONSTRUCTION_KEY = "route_ef_construction";
+const char* const KMEANS_ALGORITHM_KEY = "kmeans_algorithm";
+const char* const KMEANS_MINI_BATCH_SIZE_KEY = "kmeans_mini_batch_size";
 
 const char* const GNO_IMI_FIRST_ORDER_BUCKETS_COUNT_KEY = "first_order_buckets_count";
 const char* const GNO_IMI_SECOND_ORDER_BUCKETS_COUNT_KEY = "second_order_buckets_count";
@@ -185,6 +199,7 @@ const char* const SPARSE_VECTOR_DATA_CELL = "sparse_vector_data_cell";
 const char* const MULTI_VECTOR_DATA_CELL = "multi_vector_data_cell";
 
 const char* const MULTI_VECTOR_CODES = "multi_vector";
+const char* const MULTI_VECTOR_RESIDUAL_CENTROIDS_KEY = "residual_centroids";
 
 // for pyramid index
 const char* const NO_BUILD_LEVELS = "no_build_levels";
@@ -217,6 +232,8 @@ const char* const SEARCH_MAX_TIME_COST_MS = "timeout_ms";
 const char* const SPARSE_N_CANDIDATE = "n_candidate";
 
 const char* const GRAPH_BUILD_THRESHOLD_KEY = "graph_build_threshold";
+const char* const REBALANCE_SPLIT_RATIO_KEY = "rebalance_split_ratio";
+const char* const REBALANCE_MERGE_RATIO_KEY = "rebalance_merge_ratio";
 const char* const IVF_SEARCH_PARAM_EF_SEARCH = "ef_search";
 
 const std::unordered_map<std::string, std::string> DEFAULT_MAP = {
@@ -244,6 +261,12 @@ const std::unordered_map<std::string, std::string> DEFAULT_MAP = {
     {"READ_CACHE_ENABLED_KEY", READ_CACHE_ENABLED_KEY},
     {"IO_PARAMS_KEY", IO_PARAMS_KEY},
     {"BLOCK_IO_BLOCK_SIZE_KEY", BLOCK_IO_BLOCK_SIZE_KEY},
+    {"BLOCK_IO_NUMA_INTERLEAVE_KEY", BLOCK_IO_NUMA_INTERLEAVE_KEY},
+    {"BLOCK_IO_HUGE_PAGE_KEY", BLOCK_IO_HUGE_PAGE_KEY},
+    {"BLOCK_IO_HUGE_PAGE_VALUE_NONE", BLOCK_IO_HUGE_PAGE_VALUE_NONE},
+    {"BLOCK_IO_HUGE_PAGE_VALUE_TRANSPARENT", BLOCK_IO_HUGE_PAGE_VALUE_TRANSPARENT},
+    {"BLOCK_IO_HUGE_PAGE_VALUE_2M", BLOCK_IO_HUGE_PAGE_VALUE_2M},
+    {"BLOCK_IO_HUGE_PAGE_VALUE_1G", BLOCK_IO_HUGE_PAGE_VALUE_1G},
     {"QUANTIZATION_TYPE_VALUE_SQ8", QUANTIZATION_TYPE_VALUE_SQ8},
     {"QUANTIZATION_TYPE_VALUE_SQ8_UNIFORM", QUANTIZATION_TYPE_VALUE_SQ8_UNIFORM},
     {"QUANTIZATION_TYPE_VALUE_SQ4", QUANTIZATION_TYPE_VALUE_SQ4},
@@ -253,9 +276,12 @@ const std::unordered_map<std::string, std::string> DEFAULT_MAP = {
     {"QUANTIZATION_TYPE_VALUE_PQFS", QUANTIZATION_TYPE_VALUE_PQFS},
     {"QUANTIZATION_TYPE_VALUE_FP16", QUANTIZATION_TYPE_VALUE_FP16},
     {"QUANTIZATION_TYPE_VALUE_BF16", QUANTIZATION_TYPE_VALUE_BF16},
+    {"QUANTIZATION_TYPE_VALUE_FP8_E4M3", QUANTIZATION_TYPE_VALUE_FP8_E4M3},
+    {"QUANTIZATION_TYPE_VALUE_FP8_E5M2", QUANTIZATION_TYPE_VALUE_FP8_E5M2},
     {"QUANTIZATION_TYPE_VALUE_RABITQ", QUANTIZATION_TYPE_VALUE_RABITQ},
     {"PRODUCT_QUANTIZATION_DIM_KEY", PRODUCT_QUANTIZATION_DIM_KEY},
     {"PRODUCT_QUANTIZATION_BITS_KEY", PRODUCT_QUANTIZATION_BITS_KEY},
+    {"MULTI_VECTOR_RESIDUAL_CENTROIDS_KEY", MULTI_VECTOR_RESIDUAL_CENTROIDS_KEY},
     {"GRAPH_TYPE_VALUE_NSW", GRAPH_TYPE_VALUE_NSW},
     {"GRAPH_TYPE_VALUE_ODESCENT", GRAPH_TYPE_VALUE_ODESCENT},
     {"GRAPH_STORAGE_TYPE_KEY", GRAPH_STORAGE_TYPE_KEY},
@@ -297,6 +323,8 @@ const std::unordered_map<std::string, std::string> DEFAULT_MAP = {
     {"IVF_PARTITION_STRATEGY_TYPE_NEAREST", IVF_PARTITION_STRATEGY_TYPE_NEAREST},
     {"IVF_ROUTE_MAX_DEGREE_KEY", IVF_ROUTE_MAX_DEGREE_KEY},
     {"IVF_ROUTE_EF_CONSTRUCTION_KEY", IVF_ROUTE_EF_CONSTRUCTION_KEY},
+    {"KMEANS_ALGORITHM_KEY", KMEANS_ALGORITHM_KEY},
+    {"KMEANS_MINI_BATCH_SIZE_KEY", KMEANS_MINI_BATCH_SIZE_KEY},
     {"IVF_TRAIN_TYPE_KMEANS", IVF_TRAIN_TYPE_KMEANS},
     {"BUILD_THREAD_COUNT_KEY", BUILD_THREAD_COUNT_KEY},
     {"LABEL_REMAP_TYPE_KEY", LABEL_REMAP_TYPE_KEY},
@@ -328,6 +356,8 @@ const std::unordered_map<std::string, std::string> DEFAULT_MAP = {
     {"GRAPH_TYPE_KEY", GRAPH_TYPE_KEY},
     {"SUPPORT_FORCE_REMOVE", SUPPORT_FORCE_REMOVE},
     {"GRAPH_BUILD_THRESHOLD_KEY", GRAPH_BUILD_THRESHOLD_KEY},
+    {"REBALANCE_SPLIT_RATIO_KEY", REBALANCE_SPLIT_RATIO_KEY},
+    {"REBALANCE_MERGE_RATIO_KEY", REBALANCE_MERGE_RATIO_KEY},
     {"RESIZE_INCREASE_COUNT_BIT", "resize_increase_count_bit"},
     {"DEFAULT_RESIZE_INCREASE_COUNT_BIT", "10"},
 };
@@ -24,6 +24,7 @@
 #include <mutex>
 #include <type_traits>
 
+#include "impl/allocator/memory_budget.h"
 #include "io/common/io_parameter.h"
 #include "io/read_cache/lru_page_cache.h"
 #include "io/read_cache/page.h"
@@ -338,6 +339,17 @@ public:
         return this->size_;
     }
 
+    /**
+     * @brief Bytes of the memory usage that are backed by huge pages.
+     */
+    inline uint64_t
+    GetHugePageMemoryUsage() const {
+        if constexpr (has_GetHugePageMemoryUsageImpl<IOTmpl>::value) {
+            return cast().GetHugePageMemoryUsageImpl();
+        }
+        return 0;
+    }
+
     [[nodiscard]] bool
     HasDeserialized() const {
         return has_deserialized_;
@@ -359,6 +371,7 @@ public:
             }
             cache_ = std::make_shared<LRUPageCache>(page_count);
             cache_page_id_base_ = 0;
+            PageCache::RegisterReclaimer(cache_, allocator_);
         }
     }
 
@@ -375,6 +388,7 @@ public:
             std::scoped_lock<std::mutex> lock(cache_mutex_);
             cache_ = cache;
             cache_page_id_base_ = page_id_base;
+            PageCache::RegisterReclaimer(cache_, allocator_);
         }
     }
 
@@ -489,7 +503,11 @@ private:
         if (page != nullptr) {
             return page;
         }
-        auto new_page = std::make_shared<Page>(allocator_);
+        PagePtr new_page;
+        {
+            ScopedMemoryCategory category(MemoryCategory::IO_CACHE);
+            new_page = std::make_shared<Page>(allocator_);
+        }
         if (new_page->Data() == nullptr) {
             return nullptr;
         }
@@ -577,5 +595,6 @@ private:
     GENERATE_HAS_MEMBER_FUNCTION(ResizeImpl, void, std::declval<uint64_t>())
     GENERATE_HAS_MEMBER_FUNCTION(ShrinkImpl, void, std::declval<uint64_t>())
     GENERATE_HAS_MEMBER_FUNCTION(GetMemoryUsageImpl, int64_t)
+    GENERATE_HAS_MEMBER_FUNCTION(GetHugePageMemoryUsageImpl, uint64_t)
 };
 }  // namespace vsag
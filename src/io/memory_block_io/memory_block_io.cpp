@@ -15,26 +15,48 @@
 
 #include "io/memory_block_io/memory_block_io.h"
 
+#include <sys/mman.h>
+
 #include <algorithm>
 #include <cstring>
+#include <mutex>
 
 #include "common.h"
+#include "impl/logger/logger.h"
 #include "index_common_param.h"
 #include "inner_string_params.h"
+#include "utils/numa.h"
 #include "utils/prefetch.h"
 
+#if defined(MAP_HUGETLB) && !defined(MAP_HUGE_SHIFT)
+#define MAP_HUGE_SHIFT 26
+#endif
+
 namespace vsag {
 
+namespace {
+constexpr uint64_t HUGE_PAGE_BIT_2M = 21;
+constexpr uint64_t HUGE_PAGE_BIT_1G = 30;
+std::once_flag hugetlb_fallback_warn_once;
+}  // namespace
+
 MemoryBlockIO::MemoryBlockIO(uint64_t block_size, Allocator* allocator)
+    : MemoryBlockIO(block_size, false, allocator) {
+}
+
+MemoryBlockIO::MemoryBlockIO(uint64_t block_size, bool numa_interleave, Allocator* allocator)
     : BasicIO<MemoryBlockIO>(allocator),
       block_size_(MemoryBlockIOParameter::NearestPowerOfTwo(block_size)),
-      blocks_(0, allocator) {
+      blocks_(0, allocator),
+      numa_interleave_(numa_interleave and NumaNodeCount() > 1),
+      block_mappings_(0, allocator) {
     this->update_by_block_size();
 }
 
 MemoryBlockIO::MemoryBlockIO(const MemoryBlockIOParamPtr& param,
                              const IndexCommonParam& common_param)
-    : MemoryBlockIO(param->block_size_, common_param.allocator_.get()) {
+    : MemoryBlockIO(param->block_size_, param->numa_interleave_, common_param.allocator_.get()) {
+    this->huge_page_mode_ = param->huge_page_mode_;
 }
 
 MemoryBlockIO::MemoryBlockIO(const IOParamPtr& param, const IndexCommonParam& common_param)
@@ -43,8 +65,8 @@ MemoryBlockIO::MemoryBlockIO(const IOParamPtr& param, const IndexCommonParam& co
 }
 
 MemoryBlockIO::~MemoryBlockIO() {
-    for (auto* block : blocks_) {
-        this->allocator_->Deallocate(block);
+    while (not this->blocks_.empty()) {
+        this->release_last_block();
     }
 }
 
@@ -129,17 +151,103 @@ MemoryBlockIO::check_and_realloc(uint64_t size) {
     const uint64_t new_block_count = (size + this->block_size_ - 1) >> block_bit_;
     auto cur_block_size = this->blocks_.size();
     this->blocks_.reserve(new_block_count);
+    this->block_mappings_.reserve(new_block_count);
     while (cur_block_size < new_block_count) {
-        auto* ptr = static_cast<uint8_t*>(this->allocator_->Allocate(block_size_));
+        BlockMapping mapping;
+        auto* ptr = this->allocate_block(mapping);
         if (ptr == nullptr) {
             throw VsagException(ErrorType::NO_ENOUGH_MEMORY, "MemoryBlockIO allocation failed");
         }
-        memset(ptr, 0, block_size_);
+        // the policy must be set before any page is faulted in; a thread that already runs
+        // under an explicit policy (e.g. while building a per-node replica) keeps it
+        if (this->numa_interleave_ and NumaThreadUsesDefaultPolicy()) {
+            NumaInterleave(ptr, block_size_);
+        }
+        // anonymous mappings are zero filled by the kernel and faulted in on first write
+        if (mapping.mapped_length == 0) {
+            memset(ptr, 0, block_size_);
+        }
+        if (mapping.huge_page) {
+            this->huge_page_bytes_ += block_size_;
+        }
         this->blocks_.emplace_back(ptr);
+        this->block_mappings_.emplace_back(mapping);
         ++cur_block_size;
     }
 }
 
+uint8_t*
+MemoryBlockIO::allocate_block(BlockMapping& mapping) {
+    mapping = BlockMapping{};
+#if defined(MAP_HUGETLB)
+    if (this->huge_page_mode_ == HugePageMode::HUGETLB_2M or
+        this->huge_page_mode_ == HugePageMode::HUGETLB_1G) {
+        const auto page_bit = this->huge_page_mode_ == HugePageMode::HUGETLB_1G
+                                  ? HUGE_PAGE_BIT_1G
+                                  : HUGE_PAGE_BIT_2M;
+        // block_size_ is a power of two, so it is either a multiple of the page or smaller
+        if (this->block_size_ >= (1ULL << page_bit)) {
+            const int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB |
+                              static_cast<int>(page_bit << MAP_HUGE_SHIFT);
+            auto* ptr = mmap(nullptr, block_size_, PROT_READ | PROT_WRITE, flags, -1, 0);
+            if (ptr != MAP_FAILED) {
+                mapping.mapped_length = block_size_;
+                mapping.huge_page = true;
+                return static_cast<uint8_t*>(ptr);
+            }
+        }
+        std::call_once(hugetlb_fallback_warn_once, [this, page_bit]() {
+            logger::warn(
+                "MemoryBlockIO cannot map {} byte blocks on {}M huge pages (block too small or "
+                "hugetlbfs pool exhausted), falling back to transparent huge pages",
+                this->block_size_,
+                (1ULL << page_bit) >> 20);
+        });
+    }
+#endif
+#if defined(MADV_HUGEPAGE)
+    constexpr uint64_t thp_size = 1ULL << HUGE_PAGE_BIT_2M;
+    if (this->huge_page_mode_ != HugePageMode::NONE and this->block_size_ >= thp_size) {
+        // THP only backs 2M aligned ranges, so over-map by one huge page and trim both ends
+        const auto length = block_size_ + thp_size;
+        auto* raw =
+            mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw != MAP_FAILED) {
+            const auto start = reinterpret_cast<uint64_t>(raw);
+            const auto aligned = (start + thp_size - 1) & ~(thp_size - 1);
+            if (aligned > start) {
+                munmap(raw, aligned - start);
+            }
+            const auto tail = start + length - (aligned + block_size_);
+            if (tail > 0) {
+                munmap(reinterpret_cast<void*>(aligned + block_size_), tail);
+            }
+            auto* ptr = reinterpret_cast<void*>(aligned);
+            mapping.mapped_length = block_size_;
+            mapping.huge_page = madvise(ptr, block_size_, MADV_HUGEPAGE) == 0;
+            return static_cast<uint8_t*>(ptr);
+        }
+    }
+#endif
+    return static_cast<uint8_t*>(this->allocator_->Allocate(block_size_));
+}
+
+void
+MemoryBlockIO::release_last_block() {
+    auto* block = this->blocks_.back();
+    const auto mapping = this->block_mappings_.back();
+    if (mapping.mapped_length > 0) {
+        munmap(block, mapping.mapped_length);
+    } else {
+        this->allocator_->Deallocate(block);
+    }
+    if (mapping.huge_page) {
+        this->huge_page_bytes_ -= block_size_;
+    }
+    this->blocks_.pop_back();
+    this->block_mappings_.pop_back();
+}
+
 void
 MemoryBlockIO::ResizeImpl(uint64_t size) {
     if (size <= this->size_) {
@@ -157,9 +265,7 @@ MemoryBlockIO::ShrinkImpl(uint64_t size) {
     }
     uint64_t new_block_count = (size + this->block_size_ - 1) >> this->block_bit_;
     while (this->blocks_.size() > new_block_count) {
-        auto* block = this->blocks_.back();
-        this->allocator_->Deallocate(block);
-        this->blocks_.pop_back();
+        this->release_last_block();
     }
     this->size_ = size;
 }
@@ -27,7 +27,9 @@ class IndexCommonParam;
  * This class manages data across multiple fixed-size memory blocks (default 128MB),
  * useful for large datasets that exceed single allocation limits. Each block is
  * independently allocated, allowing efficient memory management and avoiding
- * large contiguous allocations.
+ * large contiguous allocations. Blocks can optionally be backed by huge pages to cut dTLB misses
+ * during random graph traversal; those blocks are mapped directly instead of going through the
+ * Allocator.
  */
 class MemoryBlockIO : public BasicIO<MemoryBlockIO> {
 public:
@@ -46,6 +48,15 @@ public:
      */
     explicit MemoryBlockIO(uint64_t block_size, Allocator* allocator);
 
+    /**
+     * @brief Constructs a MemoryBlockIO whose blocks may be interleaved over NUMA nodes.
+     *
+     * @param block_size The size of each memory block (default 128MB).
+     * @param numa_interleave Whether new blocks are interleaved over all NUMA nodes.
+     * @param allocator A pointer to the Allocator for memory management.
+     */
+    explicit MemoryBlockIO(uint64_t block_size, bool numa_interleave, Allocator* allocator);
+
     /**
      * @brief Constructs a MemoryBlockIO from MemoryBlockIOParameter.
      *
@@ -73,6 +84,27 @@ public:
         return static_cast<int64_t>(this->blocks_.size() * this->block_size_);
     }
 
+    /**
+     * @brief Bytes of blocks backed by huge pages.
+     *
+     * Blocks mapped with MAP_HUGETLB are counted exactly; transparent huge page blocks are counted
+     * once madvise accepted them, the kernel may still back parts of them with 4K pages.
+     */
+    uint64_t
+    GetHugePageMemoryUsageImpl() const {
+        return this->huge_page_bytes_;
+    }
+
+    /**
+     * @brief Sets how blocks allocated from now on are backed.
+     *
+     * @param mode The huge page mode, see HugePageMode.
+     */
+    void
+    SetHugePageMode(HugePageMode mode) {
+        this->huge_page_mode_ = mode;
+    }
+
     /**
      * @brief Writes data to the blocks at a specified offset.
      *
@@ -149,12 +181,33 @@ public:
     ShrinkImpl(uint64_t size);
 
 private:
+    /// How one block was obtained, needed to release it the same way.
+    struct BlockMapping {
+        uint64_t mapped_length{0};  // mmap length, 0 if the block came from the Allocator
+        bool huge_page{false};      // whether the block is backed by huge pages
+    };
+
     /**
      * @brief Updates internal parameters after block size change.
      */
     void
     update_by_block_size();
 
+    /**
+     * @brief Allocates one block, trying the configured huge page backing first.
+     *
+     * @param mapping Set to how the block was obtained.
+     * @return Pointer to the block, nullptr if every backing failed.
+     */
+    uint8_t*
+    allocate_block(BlockMapping& mapping);
+
+    /**
+     * @brief Releases the last block.
+     */
+    void
+    release_last_block();
+
     /**
      * @brief Checks and reallocates storage by adding new blocks if needed.
      *
@@ -195,6 +248,18 @@ private:
     /// Vector of pointers to allocated memory blocks.
     Vector<uint8_t*> blocks_;
 
+    /// Whether new blocks are interleaved over all NUMA nodes before their first touch.
+    bool numa_interleave_{false};
+
+    /// Huge page backing requested for new blocks.
+    HugePageMode huge_page_mode_{HugePageMode::NONE};
+
+    /// Mapping of every block, parallel to blocks_.
+    Vector<BlockMapping> block_mappings_;
+
+    /// Total bytes of blocks backed by huge pages.
+    uint64_t huge_page_bytes_{0};
+
     /// Default block size: 128MB.
     static constexpr uint64_t DEFAULT_BLOCK_SIZE = 128 * 1024 * 1024;
 
@@ -15,6 +15,9 @@
 
 #include "io/memory_block_io/memory_block_io_parameter.h"
 
+#include <fmt/format.h>
+
+#include "common.h"
 #include "inner_string_params.h"
 #include "vsag/options.h"
 
@@ -32,12 +35,47 @@ void
 MemoryBlockIOParameter::FromJson(const JsonType& json) {
     auto block_size = Options::Instance().block_size_limit();
     this->block_size_ = NearestPowerOfTwo(block_size);
+    if (json.Contains(BLOCK_IO_NUMA_INTERLEAVE_KEY)) {
+        CHECK_ARGUMENT(json[BLOCK_IO_NUMA_INTERLEAVE_KEY].IsBool(),
+                       "numa_interleave must be a boolean");
+        this->numa_interleave_ = json[BLOCK_IO_NUMA_INTERLEAVE_KEY].GetBool();
+    }
+    if (json.Contains(BLOCK_IO_HUGE_PAGE_KEY)) {
+        CHECK_ARGUMENT(json[BLOCK_IO_HUGE_PAGE_KEY].IsString(), "huge_page must be a string");
+        auto mode = json[BLOCK_IO_HUGE_PAGE_KEY].GetString();
+        if (mode == BLOCK_IO_HUGE_PAGE_VALUE_NONE) {
+            this->huge_page_mode_ = HugePageMode::NONE;
+        } else if (mode == BLOCK_IO_HUGE_PAGE_VALUE_TRANSPARENT) {
+            this->huge_page_mode_ = HugePageMode::TRANSPARENT;
+        } else if (mode == BLOCK_IO_HUGE_PAGE_VALUE_2M) {
+            this->huge_page_mode_ = HugePageMode::HUGETLB_2M;
+        } else if (mode == BLOCK_IO_HUGE_PAGE_VALUE_1G) {
+            this->huge_page_mode_ = HugePageMode::HUGETLB_1G;
+        } else {
+            throw VsagException(ErrorType::INVALID_ARGUMENT,
+                                fmt::format("huge_page must be one of '{}', '{}', '{}' or '{}'",
+                                            BLOCK_IO_HUGE_PAGE_VALUE_NONE,
+                                            BLOCK_IO_HUGE_PAGE_VALUE_TRANSPARENT,
+                                            BLOCK_IO_HUGE_PAGE_VALUE_2M,
+                                            BLOCK_IO_HUGE_PAGE_VALUE_1G));
+        }
+    }
 }
 
 JsonType
 MemoryBlockIOParameter::ToJson() const {
     JsonType json;
     json[TYPE_KEY].SetString(IO_TYPE_VALUE_BLOCK_MEMORY_IO);
+    if (this->numa_interleave_) {
+        json[BLOCK_IO_NUMA_INTERLEAVE_KEY].SetBool(true);
+    }
+    if (this->huge_page_mode_ == HugePageMode::TRANSPARENT) {
+        json[BLOCK_IO_HUGE_PAGE_KEY].SetString(BLOCK_IO_HUGE_PAGE_VALUE_TRANSPARENT);
+    } else if (this->huge_page_mode_ == HugePageMode::HUGETLB_2M) {
+        json[BLOCK_IO_HUGE_PAGE_KEY].SetString(BLOCK_IO_HUGE_PAGE_VALUE_2M);
+    } else if (this->huge_page_mode_ == HugePageMode::HUGETLB_1G) {
+        json[BLOCK_IO_HUGE_PAGE_KEY].SetString(BLOCK_IO_HUGE_PAGE_VALUE_1G);
+    }
     AppendReadCacheConfig(json);
     return json;
 }
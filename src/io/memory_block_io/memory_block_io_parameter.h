@@ -21,6 +21,14 @@
 namespace vsag {
 DEFINE_POINTER2(MemoryBlockIOParam, MemoryBlockIOParameter);
 
+/// How MemoryBlockIO backs its blocks.
+enum class HugePageMode : uint8_t {
+    NONE = 0,         // generic Allocator, 4K pages
+    TRANSPARENT = 1,  // anonymous mmap with madvise(MADV_HUGEPAGE)
+    HUGETLB_2M = 2,   // MAP_HUGETLB with 2M pages, falls back to TRANSPARENT
+    HUGETLB_1G = 3,   // MAP_HUGETLB with 1G pages, falls back to TRANSPARENT
+};
+
 class MemoryBlockIOParameter : public IOParameter {
 public:
     MemoryBlockIOParameter();
@@ -38,5 +46,10 @@ public:
 
 public:
     uint64_t block_size_{};
+
+    /// Spread every block over all NUMA nodes page by page instead of first touch placement.
+    bool numa_interleave_{false};
+
+    HugePageMode huge_page_mode_{HugePageMode::NONE};
 };
 }  // namespace vsag
@@ -27,3 +27,27 @@ TEST_CASE("MemoryBlockIOParameter Test", "[ut][MemoryBlockIOParameter]") {
     param->FromJson(json);
     ParameterTest::TestToJson(param);
 }
+
+TEST_CASE("MemoryBlockIOParameter NUMA Interleave Test", "[ut][MemoryBlockIOParameter]") {
+    auto param = std::make_shared<MemoryBlockIOParameter>();
+    param->FromJson(JsonType::Parse(R"({"numa_interleave": true})"));
+    REQUIRE(param->numa_interleave_);
+    ParameterTest::TestToJson(param);
+
+    REQUIRE_THROWS(param->FromJson(JsonType::Parse(R"({"numa_interleave": 1})")));
+}
+
+TEST_CASE("MemoryBlockIOParameter Huge Page Test", "[ut][MemoryBlockIOParameter]") {
+    auto param = std::make_shared<MemoryBlockIOParameter>();
+    REQUIRE(param->huge_page_mode_ == HugePageMode::NONE);
+    param->FromJson(JsonType::Parse(R"({"huge_page": "transparent"})"));
+    REQUIRE(param->huge_page_mode_ == HugePageMode::TRANSPARENT);
+    param->FromJson(JsonType::Parse(R"({"huge_page": "2m"})"));
+    REQUIRE(param->huge_page_mode_ == HugePageMode::HUGETLB_2M);
+    param->FromJson(JsonType::Parse(R"({"huge_page": "1g"})"));
+    REQUIRE(param->huge_page_mode_ == HugePageMode::HUGETLB_1G);
+    ParameterTest::TestToJson(param);
+
+    REQUIRE_THROWS(param->FromJson(JsonType::Parse(R"({"huge_page": "4k"})")));
+    REQUIRE_THROWS(param->FromJson(JsonType::Parse(R"({"huge_page": true})")));
+}
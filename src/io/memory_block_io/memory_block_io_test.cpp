@@ -64,3 +64,29 @@ TEST_CASE("MemoryBlockIO Shrink Test", "[ut][MemoryBlockIO]") {
     io->Shrink(2000);
     REQUIRE(io->size_ == 1000);
 }
+
+TEST_CASE("MemoryBlockIO NUMA Interleave Test", "[ut][MemoryBlockIO]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    for (auto block_size : block_memory_io_block_sizes) {
+        auto io = std::make_unique<MemoryBlockIO>(block_size, true, allocator.get());
+        TestBasicReadWrite(*io);
+    }
+}
+
+TEST_CASE("MemoryBlockIO Huge Page Test", "[ut][MemoryBlockIO]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    auto mode = GENERATE(HugePageMode::TRANSPARENT, HugePageMode::HUGETLB_2M);
+    // 1M blocks are smaller than any huge page and must fall back to the allocator
+    for (uint64_t block_size : {1ULL << 20, 2ULL << 20, 4ULL << 20}) {
+        auto io = std::make_unique<MemoryBlockIO>(block_size, allocator.get());
+        io->SetHugePageMode(mode);
+        TestBasicReadWrite(*io);
+        auto huge_page_bytes = io->GetHugePageMemoryUsage();
+        REQUIRE(huge_page_bytes <= static_cast<uint64_t>(io->GetMemoryUsage()));
+        if (block_size < (2ULL << 20)) {
+            REQUIRE(huge_page_bytes == 0);
+        }
+        io->Shrink(0);
+        REQUIRE(io->GetHugePageMemoryUsage() == 0);
+    }
+}
@@ -16,6 +16,8 @@
 
 #include <algorithm>
 
+#include "impl/allocator/memory_budget.h"
+
 namespace vsag {
 
 PageCache::PageCache(uint64_t max_pages) : max_pages_(max_pages) {
@@ -81,4 +83,34 @@ PageCache::Size() const {
     return pages_.size();
 }
 
+uint64_t
+PageCache::Shrink(uint64_t page_count) {
+    std::scoped_lock<std::mutex> lock(mutex_);
+    uint64_t evicted = 0;
+    while (evicted < page_count and not pages_.empty()) {
+        uint64_t victim = PickVictim();
+        if (victim == UINT64_MAX or pages_.find(victim) == pages_.end()) {
+            victim = pages_.begin()->first;
+        }
+        OnRemove(victim);
+        pages_.erase(victim);
+        ++evicted;
+    }
+    return evicted;
+}
+
+void
+PageCache::RegisterReclaimer(const std::shared_ptr<PageCache>& cache, Allocator* allocator) {
+    auto* budget_allocator = dynamic_cast<BudgetAllocator*>(allocator);
+    if (cache == nullptr or budget_allocator == nullptr) {
+        return;
+    }
+    // the budget locks the owner before reclaiming, so the raw pointer is alive in the callback
+    auto* raw_cache = cache.get();
+    budget_allocator->RegisterReclaimer(cache, [raw_cache](uint64_t bytes) {
+        auto page_count = (bytes + Page::DEFAULT_PAGE_SIZE - 1) / Page::DEFAULT_PAGE_SIZE;
+        return raw_cache->Shrink(page_count) * Page::DEFAULT_PAGE_SIZE;
+    });
+}
+
 }  // namespace vsag
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <unordered_map>
 
@@ -77,6 +78,28 @@ public:
     virtual uint64_t
     Size() const;
 
+    /**
+     * @brief Evict up to page_count pages, picking victims by the eviction policy.
+     *
+     * Pages still held by readers are freed once the last reader drops them.
+     *
+     * @param page_count The number of pages to evict.
+     * @return The number of pages evicted.
+     */
+    virtual uint64_t
+    Shrink(uint64_t page_count);
+
+    /**
+     * @brief Lets a memory budget shrink the cache before it refuses an allocation.
+     *
+     * No-op unless the allocator is a BudgetAllocator.
+     *
+     * @param cache The cache, tracked weakly so registering does not extend its lifetime.
+     * @param allocator The allocator the cached pages are charged to.
+     */
+    static void
+    RegisterReclaimer(const std::shared_ptr<PageCache>& cache, Allocator* allocator);
+
 protected:
     virtual void
     OnAccess(uint64_t page_id) = 0;
@@ -170,6 +170,11 @@ public:
         return 0;
     }
 
+    [[nodiscard]] uint64_t
+    GetHugePageMemoryUsage() const {
+        return io_->GetHugePageMemoryUsage();
+    }
+
     [[nodiscard]] const uint8_t*
     TryGetContiguousData() const {
         if constexpr (std::is_same_v<IOTmpl, MemoryIO>) {
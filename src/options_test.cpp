@@ -38,4 +38,9 @@ TEST_CASE("Options Test", "[ut][option]") {
     REQUIRE(vsag::Option::Instance().direct_IO_object_align_bit() == direct_IO_object_align_bit);
 
     REQUIRE_THROWS(vsag::Option::Instance().set_direct_IO_object_align_bit(22));
+
+    REQUIRE_FALSE(vsag::Option::Instance().numa_thread_affinity());
+    vsag::Options::Instance().set_numa_thread_affinity(true);
+    REQUIRE(vsag::Option::Instance().numa_thread_affinity());
+    vsag::Options::Instance().set_numa_thread_affinity(false);
 }
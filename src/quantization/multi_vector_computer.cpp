@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <cstring>
 #include <limits>
+#include <vector>
 
 #include "simd/fp32_simd.h"
 #include "vsag_exception.h"
@@ -45,47 +46,113 @@ MultiVectorComputer::SetQuery(const float* query_tokens, uint32_t query_token_co
     std::memcpy(query_tokens_.data(), query_tokens, total_floats * sizeof(float));
 }
 
-void
-MultiVectorComputer::ComputeDist(const uint8_t* codes, uint32_t token_count, float* dist) const {
-    const auto* doc_tokens = reinterpret_cast<const float*>(codes);
-    float total = 0.0F;
+namespace {
 
-    if (metric_ == MetricType::METRIC_TYPE_IP) {
-        for (uint32_t q = 0; q < query_token_count_; ++q) {
-            const float* q_tok = query_tokens_.data() + static_cast<uint64_t>(q) * dim_;
-            float min_dist = std::numeric_limits<float>::max();
-
-            for (uint32_t d = 0; d < token_count; ++d) {
-                const float* d_tok = doc_tokens + static_cast<uint64_t>(d) * dim_;
-                float dist_val = 1.0F - FP32ComputeIP(q_tok, d_tok, dim_);
-                if (dist_val < min_dist) {
-                    min_dist = dist_val;
-                }
-            }
+// doc tokens per block, 64 tokens of 128 dims are 32KB and stay cached while every query token
+// is scored against them
+constexpr uint32_t DOC_TOKEN_BLOCK = 64;
 
-            total += min_dist;
+template <MetricType metric>
+float
+token_dist(const float* query_token, const float* doc_token, uint64_t dim) {
+    if constexpr (metric == MetricType::METRIC_TYPE_IP) {
+        return 1.0F - FP32ComputeIP(query_token, doc_token, dim);
+    } else {
+        return FP32ComputeL2Sqr(query_token, doc_token, dim);
+    }
+}
+
+template <MetricType metric>
+void
+token_dists_batch4(const float* query_token, const float* doc_tokens, uint64_t dim, float* dists) {
+    // the batch kernels accumulate into their outputs
+    std::fill_n(dists, 4, 0.0F);
+    if constexpr (metric == MetricType::METRIC_TYPE_IP) {
+        FP32ComputeIPBatch4(query_token,
+                            dim,
+                            doc_tokens,
+                            doc_tokens + dim,
+                            doc_tokens + 2 * dim,
+                            doc_tokens + 3 * dim,
+                            dists[0],
+                            dists[1],
+                            dists[2],
+                            dists[3]);
+        for (int i = 0; i < 4; ++i) {
+            dists[i] = 1.0F - dists[i];
         }
-    } else if (metric_ == MetricType::METRIC_TYPE_L2SQR) {
-        for (uint32_t q = 0; q < query_token_count_; ++q) {
-            const float* q_tok = query_tokens_.data() + static_cast<uint64_t>(q) * dim_;
-            float min_dist = std::numeric_limits<float>::max();
-
-            for (uint32_t d = 0; d < token_count; ++d) {
-                const float* d_tok = doc_tokens + static_cast<uint64_t>(d) * dim_;
-                float dist_val = FP32ComputeL2Sqr(q_tok, d_tok, dim_);
-                if (dist_val < min_dist) {
-                    min_dist = dist_val;
+    } else {
+        FP32ComputeL2SqrBatch4(query_token,
+                               dim,
+                               doc_tokens,
+                               doc_tokens + dim,
+                               doc_tokens + 2 * dim,
+                               doc_tokens + 3 * dim,
+                               dists[0],
+                               dists[1],
+                               dists[2],
+                               dists[3]);
+    }
+}
+
+/**
+ * MaxSim as a blocked query-tokens x doc-tokens product with a row-wise min reduction: each
+ * block of doc tokens is scored against all query tokens, four doc tokens per SIMD call, and
+ * only the running minimum of every query row is kept.
+ */
+template <MetricType metric>
+float
+max_sim(const float* query_tokens,
+        uint32_t query_token_count,
+        const float* doc_tokens,
+        uint32_t token_count,
+        uint64_t dim) {
+    std::vector<float> row_min(query_token_count, std::numeric_limits<float>::max());
+    float block_dists[4];
+    for (uint32_t begin = 0; begin < token_count; begin += DOC_TOKEN_BLOCK) {
+        const uint32_t end = std::min(begin + DOC_TOKEN_BLOCK, token_count);
+        for (uint32_t q = 0; q < query_token_count; ++q) {
+            const float* q_tok = query_tokens + static_cast<uint64_t>(q) * dim;
+            float best = row_min[q];
+            uint32_t d = begin;
+            for (; d + 4 <= end; d += 4) {
+                token_dists_batch4<metric>(
+                    q_tok, doc_tokens + static_cast<uint64_t>(d) * dim, dim, block_dists);
+                for (float value : block_dists) {
+                    best = std::min(best, value);
                 }
             }
-
-            total += min_dist;
+            for (; d < end; ++d) {
+                const float* d_tok = doc_tokens + static_cast<uint64_t>(d) * dim;
+                best = std::min(best, token_dist<metric>(q_tok, d_tok, dim));
+            }
+            row_min[q] = best;
         }
+    }
+
+    float total = 0.0F;
+    for (auto value : row_min) {
+        total += value;
+    }
+    return total;
+}
+
+}  // namespace
+
+void
+MultiVectorComputer::ComputeDist(const uint8_t* codes, uint32_t token_count, float* dist) const {
+    const auto* doc_tokens = reinterpret_cast<const float*>(codes);
+
+    if (metric_ == MetricType::METRIC_TYPE_IP) {
+        *dist = max_sim<MetricType::METRIC_TYPE_IP>(
+            query_tokens_.data(), query_token_count_, doc_tokens, token_count, dim_);
+    } else if (metric_ == MetricType::METRIC_TYPE_L2SQR) {
+        *dist = max_sim<MetricType::METRIC_TYPE_L2SQR>(
+            query_tokens_.data(), query_token_count_, doc_tokens, token_count, dim_);
     } else {
         throw VsagException(ErrorType::INVALID_ARGUMENT,
                             "unsupported metric type for MultiVectorComputer");
     }
-
-    *dist = total;
 }
 
 }  // namespace vsag
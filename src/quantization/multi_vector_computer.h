@@ -43,8 +43,10 @@ DEFINE_POINTER(MultiVectorComputer)
  *        caller (typically MultiVectorDataCell) is responsible for stripping any
  *        on-disk prefix before passing the pointer in.
  *
- *        First version supports FP32 token codes only (codes are reinterpreted as
- *        const float*).
+ *        Token codes are FP32 (codes are reinterpreted as const float*); quantized
+ *        storage is decoded by the datacell first. The doc is scored as a blocked
+ *        query-tokens x doc-tokens product with a row-wise min reduction, four doc
+ *        tokens per SIMD call.
  */
 class MultiVectorComputer : public ComputerInterface {
 public:
@@ -235,3 +235,35 @@ TEST_CASE("MultiVectorComputer randomized vs naive oracle (dim=8, q=4, d=6)",
         REQUIRE(std::abs(actual - expected) < 1e-4F);
     }
 }
+
+TEST_CASE("MultiVectorComputer blocked MaxSim matches naive oracle across block edges",
+          "[ut][MultiVectorComputer]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    constexpr uint32_t dim = 32;
+    constexpr uint32_t query_tok_count = 5;
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> dist_uniform(-1.0F, 1.0F);
+    std::vector<float> query(query_tok_count * dim);
+    for (auto& v : query) {
+        v = dist_uniform(rng);
+    }
+
+    // below, at and across the 64-token block, with 4-wide tails of every length
+    auto doc_tok_count = GENERATE(3U, 4U, 63U, 64U, 65U, 130U);
+    std::vector<float> doc(doc_tok_count * dim);
+    for (auto& v : doc) {
+        v = dist_uniform(rng);
+    }
+
+    for (auto metric : {MetricType::METRIC_TYPE_IP, MetricType::METRIC_TYPE_L2SQR}) {
+        MultiVectorComputer computer(dim, metric, allocator.get());
+        computer.SetQuery(query.data(), query_tok_count);
+
+        float actual = 0.0F;
+        computer.ComputeDist(reinterpret_cast<const uint8_t*>(doc.data()), doc_tok_count, &actual);
+
+        float expected = NaiveMaxSim(query, query_tok_count, doc, doc_tok_count, dim, metric);
+        REQUIRE(std::abs(actual - expected) < 1e-3F);
+    }
+}
@@ -51,6 +51,7 @@ PQFastScanQuantizer<metric>::PQFastScanQuantizer(const PQFastScanQuantizerParamP
                                                  const IndexCommonParam& common_param)
     : PQFastScanQuantizer<metric>(
           common_param.dim_, param->pq_dim_, common_param.allocator_.get()) {
+    this->kmeans_algorithm_ = param->kmeans_algorithm_;
 }
 
 template <MetricType metric>
@@ -86,6 +87,7 @@ PQFastScanQuantizer<metric>::TrainImpl(const float* data, uint64_t count) {
                    subspace_dim_ * sizeof(float));
         }
         KMeansCluster cluster(subspace_dim_, this->allocator_);
+        cluster.SetAlgorithm(this->kmeans_algorithm_);
         cluster.Run(CENTROIDS_PER_SUBSPACE, slice.data(), count);
         memcpy(this->codebooks_.data() + i * CENTROIDS_PER_SUBSPACE * subspace_dim_,
                cluster.k_centroids_,
@@ -30,6 +30,10 @@ PQFastScanQuantizerParameter::FromJson(const JsonType& json) {
         json[PRODUCT_QUANTIZATION_DIM_KEY].IsNumberInteger()) {
         this->pq_dim_ = json[PRODUCT_QUANTIZATION_DIM_KEY].GetInt();
     }
+    if (json.Contains(KMEANS_ALGORITHM_KEY)) {
+        this->kmeans_algorithm_ =
+            kmeans_algorithm_from_string(json[KMEANS_ALGORITHM_KEY].GetString());
+    }
 }
 
 JsonType
@@ -37,6 +41,7 @@ PQFastScanQuantizerParameter::ToJson() const {
     JsonType json;
     json[TYPE_KEY].SetString(QUANTIZATION_TYPE_VALUE_PQFS);
     json[PRODUCT_QUANTIZATION_DIM_KEY].SetInt(this->pq_dim_);
+    json[KMEANS_ALGORITHM_KEY].SetString(kmeans_algorithm_to_string(this->kmeans_algorithm_));
     return json;
 }
 
@@ -46,6 +46,7 @@ template <MetricType metric>
 ProductQuantizer<metric>::ProductQuantizer(const ProductQuantizerParamPtr& param,
                                            const IndexCommonParam& common_param)
     : ProductQuantizer<metric>(common_param.dim_, param->pq_dim_, common_param.allocator_.get()) {
+    this->kmeans_algorithm_ = param->kmeans_algorithm_;
 }
 
 template <MetricType metric>
@@ -81,6 +82,7 @@ ProductQuantizer<metric>::TrainImpl(const float* data, uint64_t count) {
                    subspace_dim_ * sizeof(float));
         }
         KMeansCluster cluster(subspace_dim_, this->allocator_);
+        cluster.SetAlgorithm(this->kmeans_algorithm_);
         cluster.Run(CENTROIDS_PER_SUBSPACE, slice.data(), count);
         memcpy(this->codebooks_.data() + i * CENTROIDS_PER_SUBSPACE * subspace_dim_,
                cluster.k_centroids_,
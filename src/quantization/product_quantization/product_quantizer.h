@@ -110,6 +110,7 @@ public:
 public:
     int64_t pq_dim_{1};
     int64_t subspace_dim_{1};  // equal to dim/pq_dim_;
+    KMeansAlgorithm kmeans_algorithm_{KMeansAlgorithm::LLOYD};
 
     Vector<float> codebooks_;
 
@@ -35,6 +35,10 @@ ProductQuantizerParameter::FromJson(const JsonType& json) {
         json[PRODUCT_QUANTIZATION_BITS_KEY].IsNumberInteger()) {
         this->pq_bits_ = json[PRODUCT_QUANTIZATION_BITS_KEY].GetInt();
     }
+    if (json.Contains(KMEANS_ALGORITHM_KEY)) {
+        this->kmeans_algorithm_ =
+            kmeans_algorithm_from_string(json[KMEANS_ALGORITHM_KEY].GetString());
+    }
 }
 
 JsonType
@@ -43,6 +47,7 @@ ProductQuantizerParameter::ToJson() const {
     json[TYPE_KEY].SetString(QUANTIZATION_TYPE_VALUE_PQ);
     json[PRODUCT_QUANTIZATION_DIM_KEY].SetInt(this->pq_dim_);
     json[PRODUCT_QUANTIZATION_BITS_KEY].SetInt(this->pq_bits_);
+    json[KMEANS_ALGORITHM_KEY].SetString(kmeans_algorithm_to_string(this->kmeans_algorithm_));
     return json;
 }
 
@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include "impl/cluster/kmeans_cluster.h"
 #include "quantization/quantizer_parameter.h"
 #include "utils/pointer_define.h"
 namespace vsag {
@@ -36,6 +37,8 @@ public:
 
 public:
     int64_t pq_dim_{1};
+    // codebook training only, so it takes no part in CheckCompatibility
+    KMeansAlgorithm kmeans_algorithm_{KMeansAlgorithm::LLOYD};
     int64_t pq_bits_{8};
 };
 }  // namespace vsag
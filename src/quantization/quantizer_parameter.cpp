@@ -59,6 +59,12 @@ QuantizerParameter::GetQuantizerParameterByJson(const JsonType& json) {
     } else if (type_name == QUANTIZATION_TYPE_VALUE_FP16) {
         quantizer_param = std::make_shared<FP16QuantizerParameter>();
         quantizer_param->FromJson(json);
+    } else if (type_name == QUANTIZATION_TYPE_VALUE_FP8_E4M3) {
+        quantizer_param = std::make_shared<FP8E4M3QuantizerParameter>();
+        quantizer_param->FromJson(json);
+    } else if (type_name == QUANTIZATION_TYPE_VALUE_FP8_E5M2) {
+        quantizer_param = std::make_shared<FP8E5M2QuantizerParameter>();
+        quantizer_param->FromJson(json);
     } else if (type_name == QUANTIZATION_TYPE_VALUE_RABITQ) {
         quantizer_param = std::make_shared<RaBitQuantizerParameter>();
         quantizer_param->FromJson(json);
@@ -92,6 +98,8 @@ QuantizerParameter::IsValidQuantizationType(const std::string& type_name) {
                                                                 QUANTIZATION_TYPE_VALUE_SQ4_UNIFORM,
                                                                 QUANTIZATION_TYPE_VALUE_BF16,
                                                                 QUANTIZATION_TYPE_VALUE_FP16,
+                                                                QUANTIZATION_TYPE_VALUE_FP8_E4M3,
+                                                                QUANTIZATION_TYPE_VALUE_FP8_E5M2,
                                                                 QUANTIZATION_TYPE_VALUE_RABITQ,
                                                                 QUANTIZATION_TYPE_VALUE_SPARSE,
                                                                 QUANTIZATION_TYPE_VALUE_PQFS,
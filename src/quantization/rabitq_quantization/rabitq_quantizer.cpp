@@ -226,16 +226,25 @@ RaBitQuantizer<metric>::TrainImpl(const float* data, uint64_t count) {
     for (int d = 0; d < this->dim_; d++) {
         centroid_[d] = 0;
     }
-    for (uint64_t i = 0; i < count; ++i) {
-        Vector<float> pca_data(this->original_dim_, 0, this->allocator_);
-        if (pca_dim_ != this->original_dim_) {
-            pca_->Transform(data + i * original_dim_, pca_data.data());
-        } else {
-            pca_data.assign(data + i * original_dim_, data + (i + 1) * original_dim_);
+    if (pca_dim_ != this->original_dim_) {
+        // with mrq the pca keeps every dimension, only the leading dim_ ones form the centroid
+        const auto pca_output_dim = static_cast<uint64_t>(pca_->GetOutputDim());
+        const auto block_size = std::min(count, VectorTransformer::BATCH_BLOCK_SIZE);
+        Vector<float> pca_data(block_size * pca_output_dim, 0, this->allocator_);
+        for (uint64_t begin = 0; begin < count; begin += block_size) {
+            auto block = std::min(block_size, count - begin);
+            pca_->TransformBatch(data + begin * original_dim_, pca_data.data(), block, nullptr);
+            for (uint64_t i = 0; i < block; ++i) {
+                for (uint64_t d = 0; d < this->dim_; d++) {
+                    centroid_[d] += pca_data[i * pca_output_dim + d];
+                }
+            }
         }
-
-        for (uint64_t d = 0; d < this->dim_; d++) {
-            centroid_[d] += pca_data[d];
+    } else {
+        for (uint64_t i = 0; i < count; ++i) {
+            for (uint64_t d = 0; d < this->dim_; d++) {
+                centroid_[d] += data[i * original_dim_ + d];
+            }
         }
     }
     for (uint64_t d = 0; d < this->dim_; d++) {
@@ -0,0 +1,91 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "fp8_quantizer_parameter.h"
+#include "fp8_traits.h"
+#include "index_common_param.h"
+#include "quantization/quantizer.h"
+
+namespace vsag {
+
+/**
+ * @brief 8-bit floating point quantizer template for the E4M3 and E5M2 formats.
+ *
+ * Each dimension is stored independently as one fp8 byte, so the code size is dim bytes and no
+ * training is needed: unlike sq8, the representable range does not depend on the data seen at
+ * train time. Values outside the format range saturate to the max finite value.
+ *
+ * Supported formats:
+ * - FP8E4M3Format: 4-bit exponent, 3-bit mantissa, range +-448, more precision
+ * - FP8E5M2Format: 5-bit exponent, 2-bit mantissa, range +-57344, more dynamic range
+ *
+ * For cosine metric, vectors are normalized before encoding.
+ *
+ * @tparam Format The fp8 format (FP8E4M3Format or FP8E5M2Format).
+ * @tparam metric The distance metric type (L2SQR, IP, or COSINE).
+ */
+template <typename Format, MetricType metric = MetricType::METRIC_TYPE_L2SQR>
+class FP8Quantizer : public Quantizer<FP8Quantizer<Format, metric>> {
+public:
+    explicit FP8Quantizer(int dim, Allocator* allocator);
+
+    explicit FP8Quantizer(const FP8QuantizerParameter<Format>& param,
+                          const IndexCommonParam& common_param);
+
+    explicit FP8Quantizer(const QuantizerParamPtr& param, const IndexCommonParam& common_param);
+
+    bool
+    TrainImpl(const float* data, uint64_t count);
+
+    bool
+    EncodeOneImpl(const float* data, uint8_t* codes) const;
+
+    bool
+    DecodeOneImpl(const uint8_t* codes, float* data);
+
+    float
+    ComputeImpl(const uint8_t* codes1, const uint8_t* codes2) const;
+
+    void
+    ProcessQueryImpl(const float* query, Computer<FP8Quantizer<Format, metric>>& computer) const;
+
+    void
+    ComputeDistImpl(Computer<FP8Quantizer<Format, metric>>& computer,
+                    const uint8_t* codes,
+                    float* dists) const;
+
+    void
+    SerializeImpl(StreamWriter& writer) {
+    }
+
+    void
+    DeserializeImpl(StreamReader& reader) {
+    }
+
+    [[nodiscard]] std::string
+    NameImpl() const {
+        return Format::TYPE_NAME;
+    }
+};
+
+template <MetricType metric = MetricType::METRIC_TYPE_L2SQR>
+using FP8E4M3Quantizer = FP8Quantizer<FP8E4M3Format, metric>;
+
+template <MetricType metric = MetricType::METRIC_TYPE_L2SQR>
+using FP8E5M2Quantizer = FP8Quantizer<FP8E5M2Format, metric>;
+
+}  // namespace vsag
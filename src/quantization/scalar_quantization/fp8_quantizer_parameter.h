@@ -0,0 +1,52 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <memory>
+
+#include "fp8_traits.h"
+#include "inner_string_params.h"
+#include "quantization/quantizer_parameter.h"
+
+namespace vsag {
+
+template <typename Format>
+class FP8QuantizerParameter : public QuantizerParameter {
+public:
+    FP8QuantizerParameter() : QuantizerParameter(Format::TYPE_NAME) {
+    }
+
+    ~FP8QuantizerParameter() override = default;
+
+    void
+    FromJson(const JsonType& json) override {
+    }
+
+    JsonType
+    ToJson() const override {
+        JsonType json;
+        json[TYPE_KEY].SetString(Format::TYPE_NAME);
+        return json;
+    }
+};
+
+using FP8E4M3QuantizerParameter = FP8QuantizerParameter<FP8E4M3Format>;
+using FP8E5M2QuantizerParameter = FP8QuantizerParameter<FP8E5M2Format>;
+
+using FP8E4M3QuantizerParamPtr = std::shared_ptr<FP8E4M3QuantizerParameter>;
+using FP8E5M2QuantizerParamPtr = std::shared_ptr<FP8E5M2QuantizerParameter>;
+
+}  // namespace vsag
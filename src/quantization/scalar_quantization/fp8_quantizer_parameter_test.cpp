@@ -0,0 +1,31 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "fp8_quantizer_parameter.h"
+#include "parameter_test.h"
+#include "unittest.h"
+using namespace vsag;
+
+TEST_CASE("FP8 Quantizer Parameter ToJson Test", "[ut][FP8QuantizerParameter]") {
+    std::string param_str = "{}";
+    auto e4m3_param = std::make_shared<FP8E4M3QuantizerParameter>();
+    e4m3_param->FromJson(JsonType::Parse(param_str));
+    ParameterTest::TestToJson(e4m3_param);
+    REQUIRE(e4m3_param->GetTypeName() == QUANTIZATION_TYPE_VALUE_FP8_E4M3);
+
+    auto e5m2_param = std::make_shared<FP8E5M2QuantizerParameter>();
+    e5m2_param->FromJson(JsonType::Parse(param_str));
+    ParameterTest::TestToJson(e5m2_param);
+    REQUIRE(e5m2_param->GetTypeName() == QUANTIZATION_TYPE_VALUE_FP8_E5M2);
+}
@@ -0,0 +1,96 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <vector>
+
+#include "fp8_quantizer.h"
+#include "impl/allocator/safe_allocator.h"
+#include "quantization/quantizer_test.h"
+#include "unittest.h"
+using namespace vsag;
+
+const auto dims = fixtures::get_common_used_dims(3, 225);
+const auto counts = {10, 101};
+
+template <typename Format, MetricType metric>
+void
+TestQuantizerEncodeDecodeMetricFP8(uint64_t dim, int count, float error, float same_error) {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    FP8Quantizer<Format, metric> quantizer(dim, allocator.get());
+    TestQuantizerEncodeDecode(quantizer, dim, count, error);
+    TestQuantizerEncodeDecodeSame(quantizer, dim, count, 65536, same_error);
+}
+
+TEST_CASE("FP8 Encode and Decode", "[ut][FP8Quantizer]") {
+    constexpr MetricType metrics[2] = {MetricType::METRIC_TYPE_L2SQR, MetricType::METRIC_TYPE_IP};
+    for (auto dim : dims) {
+        for (auto count : counts) {
+            // small integers are exact in e4m3, e5m2 keeps only 2 mantissa bits
+            TestQuantizerEncodeDecodeMetricFP8<FP8E4M3Format, metrics[0]>(dim, count, 2e-2F, 1e-5F);
+            TestQuantizerEncodeDecodeMetricFP8<FP8E4M3Format, metrics[1]>(dim, count, 2e-2F, 1e-5F);
+            TestQuantizerEncodeDecodeMetricFP8<FP8E5M2Format, metrics[0]>(dim, count, 4e-2F, 1.01F);
+            TestQuantizerEncodeDecodeMetricFP8<FP8E5M2Format, metrics[1]>(dim, count, 4e-2F, 1.01F);
+        }
+    }
+}
+
+template <typename Format, MetricType metric>
+void
+TestComputeMetricFP8(uint64_t dim, int count, float error) {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    FP8Quantizer<Format, metric> quantizer(dim, allocator.get());
+    TestComputeCodes<FP8Quantizer<Format, metric>, metric>(quantizer, dim, count, error);
+    TestComputer<FP8Quantizer<Format, metric>, metric>(
+        quantizer, dim, count, error, 1.0, true, 1.0, 1.0);
+}
+
+TEST_CASE("FP8 Compute", "[ut][FP8Quantizer]") {
+    constexpr MetricType metrics[3] = {
+        MetricType::METRIC_TYPE_L2SQR, MetricType::METRIC_TYPE_COSINE, MetricType::METRIC_TYPE_IP};
+    for (auto dim : dims) {
+        for (auto count : counts) {
+            TestComputeMetricFP8<FP8E4M3Format, metrics[0]>(dim, count, 5e-2F);
+            TestComputeMetricFP8<FP8E4M3Format, metrics[1]>(dim, count, 5e-2F);
+            TestComputeMetricFP8<FP8E4M3Format, metrics[2]>(dim, count, 5e-2F);
+            TestComputeMetricFP8<FP8E5M2Format, metrics[0]>(dim, count, 1e-1F);
+            TestComputeMetricFP8<FP8E5M2Format, metrics[1]>(dim, count, 1e-1F);
+            TestComputeMetricFP8<FP8E5M2Format, metrics[2]>(dim, count, 1e-1F);
+        }
+    }
+}
+
+template <typename Format, MetricType metric>
+void
+TestSerializeAndDeserializeMetricFP8(uint64_t dim, int count, float error) {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    FP8Quantizer<Format, metric> quantizer1(dim, allocator.get());
+    FP8Quantizer<Format, metric> quantizer2(dim, allocator.get());
+    TestSerializeAndDeserialize<FP8Quantizer<Format, metric>, metric>(
+        quantizer1, quantizer2, dim, count, error, 1.0, 1.0, 1.0);
+}
+
+TEST_CASE("FP8 Serialize and Deserialize", "[ut][FP8Quantizer]") {
+    constexpr MetricType metrics[3] = {
+        MetricType::METRIC_TYPE_L2SQR, MetricType::METRIC_TYPE_COSINE, MetricType::METRIC_TYPE_IP};
+    for (auto dim : dims) {
+        for (auto count : counts) {
+            TestSerializeAndDeserializeMetricFP8<FP8E4M3Format, metrics[0]>(dim, count, 2e-2F);
+            TestSerializeAndDeserializeMetricFP8<FP8E4M3Format, metrics[1]>(dim, count, 2e-2F);
+            TestSerializeAndDeserializeMetricFP8<FP8E4M3Format, metrics[2]>(dim, count, 2e-2F);
+            TestSerializeAndDeserializeMetricFP8<FP8E5M2Format, metrics[0]>(dim, count, 4e-2F);
+            TestSerializeAndDeserializeMetricFP8<FP8E5M2Format, metrics[1]>(dim, count, 4e-2F);
+            TestSerializeAndDeserializeMetricFP8<FP8E5M2Format, metrics[2]>(dim, count, 4e-2F);
+        }
+    }
+}
@@ -0,0 +1,73 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+
+#include "inner_string_params.h"
+#include "simd/fp8_simd.h"
+
+namespace vsag {
+
+struct FP8E4M3Format {
+    static constexpr const char* TYPE_NAME = "fp8_e4m3";
+
+    static uint8_t
+    FloatToFP8(float f) {
+        return generic::FloatToFP8E4M3(f);
+    }
+
+    static float
+    FP8ToFloat(uint8_t code) {
+        return generic::FP8E4M3ToFloat(code);
+    }
+
+    static float
+    ComputeIP(const uint8_t* a, const uint8_t* b, uint64_t dim) {
+        return FP8E4M3ComputeIP(a, b, dim);
+    }
+
+    static float
+    ComputeL2Sqr(const uint8_t* a, const uint8_t* b, uint64_t dim) {
+        return FP8E4M3ComputeL2Sqr(a, b, dim);
+    }
+};
+
+struct FP8E5M2Format {
+    static constexpr const char* TYPE_NAME = "fp8_e5m2";
+
+    static uint8_t
+    FloatToFP8(float f) {
+        return generic::FloatToFP8E5M2(f);
+    }
+
+    static float
+    FP8ToFloat(uint8_t code) {
+        return generic::FP8E5M2ToFloat(code);
+    }
+
+    static float
+    ComputeIP(const uint8_t* a, const uint8_t* b, uint64_t dim) {
+        return FP8E5M2ComputeIP(a, b, dim);
+    }
+
+    static float
+    ComputeL2Sqr(const uint8_t* a, const uint8_t* b, uint64_t dim) {
+        return FP8E5M2ComputeL2Sqr(a, b, dim);
+    }
+};
+
+}  // namespace vsag
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include "fp8_quantizer.h"
 #include "half_precision_quantizer.h"
 #include "scalar_quantizer.h"
 #include "sq4_uniform_quantizer.h"
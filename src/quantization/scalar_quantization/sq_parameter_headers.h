@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include "fp8_quantizer_parameter.h"
 #include "half_precision_quantizer_parameter.h"
 #include "scalar_quantizer_parameter.h"
 #include "sq4_uniform_quantizer_parameter.h"
@@ -15,8 +15,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "impl/transform/transformer_headers.h"
 #include "index_common_param.h"
@@ -122,6 +124,14 @@ public:
     void
     ExecuteChainTransform(float* prev_data, const uint32_t* meta_offsets, uint8_t* codes) const;
 
+    void
+    ExecuteChainTransformBatch(const float* data,
+                               uint64_t count,
+                               const uint32_t* meta_offsets,
+                               uint8_t* codes,
+                               uint64_t code_size,
+                               Vector<float>& output) const;
+
     float
     ExecuteChainDistanceRecovery(float quantize_dist,
                                  const uint32_t* meta_offsets_1,
@@ -245,12 +255,14 @@ TransformQuantizer<QuantTmpl, metric>::TrainImpl(const float* data, uint64_t cou
     // 2. execute transform on original data
     const uint64_t transformed_dim = this->GetTransformedDim();
     Vector<float> transformed_data(transformed_dim * count, 0, this->allocator_);
-    Vector<float> transformed_vector(this->allocator_);
-    for (uint64_t i = 0; i < count; ++i) {
-        this->TransformBaseVector(data + i * this->dim_, transformed_vector);
-        memcpy(transformed_data.data() + i * transformed_dim,
-               transformed_vector.data(),
-               transformed_dim * sizeof(float));
+    Vector<float> transformed_block(this->allocator_);
+    for (uint64_t begin = 0; begin < count; begin += VectorTransformer::BATCH_BLOCK_SIZE) {
+        auto block = std::min(VectorTransformer::BATCH_BLOCK_SIZE, count - begin);
+        this->ExecuteChainTransformBatch(
+            data + begin * this->dim_, block, nullptr, nullptr, 0, transformed_block);
+        memcpy(transformed_data.data() + begin * transformed_dim,
+               transformed_block.data(),
+               block * transformed_dim * sizeof(float));
     }
 
     // 3. train quantizer based on transformed data
@@ -276,6 +288,33 @@ TransformQuantizer<QuantTmpl, metric>::ExecuteChainTransform(float* prev_data,
     }
 }
 
+template <typename QuantTmpl, MetricType metric>
+void
+TransformQuantizer<QuantTmpl, metric>::ExecuteChainTransformBatch(const float* data,
+                                                                  uint64_t count,
+                                                                  const uint32_t* meta_offsets,
+                                                                  uint8_t* codes,
+                                                                  uint64_t code_size,
+                                                                  Vector<float>& output) const {
+    // output holds [count, transformed_dim] row-major vectors after the whole chain
+    output.assign(data, data + count * this->dim_);
+    Vector<float> next_data(count * this->dim_, 0, this->allocator_);
+    std::vector<TransformerMetaPtr> metas(codes != nullptr ? count : 0);
+
+    for (uint32_t i = 0; i < this->transform_chain_.size(); i++) {
+        const auto& vector_transformer = this->transform_chain_[i];
+        vector_transformer->TransformBatch(
+            output.data(), next_data.data(), count, codes != nullptr ? metas.data() : nullptr);
+        if (codes != nullptr) {
+            for (uint64_t j = 0; j < count; ++j) {
+                metas[j]->EncodeMeta(codes + j * code_size + meta_offsets[i]);
+            }
+        }
+        output.swap(next_data);
+    }
+    output.resize(count * this->GetTransformedDim());
+}
+
 template <typename QuantTmpl, MetricType metric>
 void
 TransformQuantizer<QuantTmpl, metric>::TransformBaseVector(const float* input,
@@ -395,8 +434,26 @@ bool
 TransformQuantizer<QuantTmpl, metric>::EncodeBatchImpl(const float* data,
                                                        uint8_t* codes,
                                                        uint64_t count) const {
-    for (uint64_t i = 0; i < count; ++i) {
-        EncodeOneImpl(data + i * this->dim_, codes + i * this->code_size_);
+    const uint64_t transformed_dim = this->GetTransformedDim();
+    Vector<float> transformed_block(this->allocator_);
+    for (uint64_t begin = 0; begin < count; begin += VectorTransformer::BATCH_BLOCK_SIZE) {
+        auto block = std::min(VectorTransformer::BATCH_BLOCK_SIZE, count - begin);
+        auto* block_codes = codes + begin * this->code_size_;
+        // 1. execute transform on the whole block
+        this->ExecuteChainTransformBatch(data + begin * this->dim_,
+                                         block,
+                                         base_meta_offsets_.data(),
+                                         block_codes,
+                                         this->code_size_,
+                                         transformed_block);
+
+        // 2. execute quantize, base-code is always at offset 0 of each code
+        for (uint64_t i = 0; i < block; ++i) {
+            if (not quantizer_->EncodeOne(transformed_block.data() + i * transformed_dim,
+                                          block_codes + i * this->code_size_)) {
+                return false;
+            }
+        }
     }
     return true;
 }
@@ -25,6 +25,7 @@
 
 #include "metric_type.h"
 #include "typing.h"
+#include "utils/search_deadline.h"
 #include "vsag/allocator.h"
 
 namespace vsag {
@@ -47,6 +48,7 @@ enum class DistanceEvaluationBackend : uint8_t {
     SPARSE_FP32,
     SPARSE_FP16,
     SPARSE_SQ8,
+    FP8,
     UNKNOWN,
 };
 
@@ -62,6 +64,12 @@ struct QueryContext {
     float rabitq_error_rate = std::numeric_limits<float>::quiet_NaN();
     DistanceEvaluationPhase distance_phase = DistanceEvaluationPhase::APPROXIMATE;
     bool track_distance_evaluations = true;
+    // timeout, deadline and cancellation of the request, nullptr when the search has none
+    const SearchDeadline* deadline = nullptr;
+
+    /// Whether the search has to stop now; records the reason and the phase reached in stats.
+    bool
+    ShouldStop();
 };
 
 class ScopedDistancePhase {
@@ -131,6 +139,8 @@ public:
             return DistanceEvaluationBackend::BF16;
         if (name.find("fp16") != std::string::npos)
             return DistanceEvaluationBackend::FP16;
+        if (name.find("fp8") != std::string::npos)
+            return DistanceEvaluationBackend::FP8;
         if (name.find("int8") != std::string::npos)
             return DistanceEvaluationBackend::INT8;
         if (name.find("binary") != std::string::npos)
@@ -157,6 +167,7 @@ public:
                                                 "sparse_fp32",
                                                 "sparse_fp16",
                                                 "sparse_sq8",
+                                                "fp8",
                                                 "unknown"};
         return names[static_cast<uint8_t>(backend)];
     }
@@ -212,10 +223,32 @@ public:
         AddDistance(phase, BackendFromName(backend), count);
     }
 
+    void
+    MarkTerminated(SearchDeadline::Reason reason, DistancePhase phase) {
+        if (reason == SearchDeadline::Reason::CANCELLED) {
+            is_cancelled.store(true, std::memory_order_relaxed);
+        } else {
+            is_timeout.store(true, std::memory_order_relaxed);
+        }
+        // the first phase that observed the stop is the one reached
+        int8_t expected = -1;
+        terminated_phase.compare_exchange_strong(
+            expected, static_cast<int8_t>(phase), std::memory_order_relaxed);
+    }
+
     [[nodiscard]] JsonType
     ToJson() const {
         JsonType j;
-        j["is_timeout"].SetBool(is_timeout.load(std::memory_order_relaxed));
+        const bool timeout = is_timeout.load(std::memory_order_relaxed);
+        const bool cancelled = is_cancelled.load(std::memory_order_relaxed);
+        const auto phase = terminated_phase.load(std::memory_order_relaxed);
+        j["is_timeout"].SetBool(timeout);
+        j["is_cancelled"].SetBool(cancelled);
+        j["is_partial"].SetBool(timeout or cancelled);
+        j["terminated_phase"].SetString(
+            phase < 0 ? "none" : PhaseName(static_cast<DistancePhase>(phase)));
+        j["early_stop_count"].SetInt(early_stop_count.load(std::memory_order_relaxed));
+        j["skipped_window_count"].SetInt(skipped_window_count.load(std::memory_order_relaxed));
         j["dist_cmp"].SetInt(dist_cmp.load(std::memory_order_relaxed));
         j["hops"].SetInt(hops.load(std::memory_order_relaxed));
         j["io_cnt"].SetInt(io_cnt.load(std::memory_order_relaxed));
@@ -223,6 +256,10 @@ public:
         j["reorder_distance_count"].SetInt(reorder_distance_count.load(std::memory_order_relaxed));
         j["reorder_lower_bound_probe_count"].SetInt(
             reorder_lower_bound_probe_count.load(std::memory_order_relaxed));
+        j["reorder_memory_fetch_count"].SetInt(
+            reorder_memory_fetch_count.load(std::memory_order_relaxed));
+        j["reorder_disk_fetch_count"].SetInt(
+            reorder_disk_fetch_count.load(std::memory_order_relaxed));
         j["rabitq_filter_count"].SetInt(rabitq_filter_count.load(std::memory_order_relaxed));
         j["rabitq_full_count"].SetInt(rabitq_full_count.load(std::memory_order_relaxed));
         j["rabitq_filter_fallback_full_count"].SetInt(
@@ -252,12 +289,22 @@ public:
 
 public:
     std::atomic<bool> is_timeout{false};
+    std::atomic<bool> is_cancelled{false};
+    // DistancePhase in which a timeout or cancellation stopped the search, -1 if none did
+    std::atomic<int8_t> terminated_phase{-1};
+    // graph searches ended by the adaptive early-termination rule
+    std::atomic<uint32_t> early_stop_count{0};
+    // sparse windows skipped by block-max pruning
+    std::atomic<uint32_t> skipped_window_count{0};
     std::atomic<uint32_t> dist_cmp{0};
     std::atomic<uint32_t> hops{0};
     std::atomic<uint32_t> io_cnt{0};
     std::atomic<uint32_t> io_time_ms{0};
     std::atomic<uint32_t> reorder_distance_count{0};
     std::atomic<uint32_t> reorder_lower_bound_probe_count{0};
+    // precise codes served by the hot in-memory tier vs read through the precise datacell
+    std::atomic<uint32_t> reorder_memory_fetch_count{0};
+    std::atomic<uint32_t> reorder_disk_fetch_count{0};
     std::atomic<uint32_t> rabitq_filter_count{0};
     std::atomic<uint32_t> rabitq_full_count{0};
     std::atomic<uint32_t> rabitq_filter_fallback_full_count{0};
@@ -265,7 +312,7 @@ public:
     std::atomic<uint32_t> rabitq_reorder_fallback_full_count{0};
     std::atomic<uint64_t> distance_evaluations{0};
     std::array<std::atomic<uint64_t>, 3> distance_evaluations_by_phase{};
-    std::array<std::atomic<uint64_t>, 16> distance_evaluations_by_backend{};
+    std::array<std::atomic<uint64_t>, 17> distance_evaluations_by_backend{};
     // Multi-vector (SIMQ) fine-grained statistics
     std::atomic<uint32_t> mv_io_time_ms{0};
     std::atomic<uint32_t> mv_compute_time_ms{0};
@@ -290,6 +337,21 @@ struct QuantizerDistanceBackend<TransformQuantizer<QuantTmpl, metric>> {
     }
 };
 
+inline bool
+QueryContext::ShouldStop() {
+    if (this->deadline == nullptr) {
+        return false;
+    }
+    const auto reason = this->deadline->Check();
+    if (reason == SearchDeadline::Reason::NONE) {
+        return false;
+    }
+    if (this->stats != nullptr) {
+        this->stats->MarkTerminated(reason, this->distance_phase);
+    }
+    return true;
+}
+
 inline Allocator*
 select_query_allocator(QueryContext* ctx, Allocator* index_allocator) {
     if (ctx != nullptr and ctx->alloc != nullptr) {
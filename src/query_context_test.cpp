@@ -78,6 +78,10 @@ TEST_CASE("SearchStatistics classifies stable backend names", "[ut][search_stati
     CHECK(vsag::SearchStatistics::BackendName(vsag::DistanceEvaluationBackend::PQ_FASTSCAN) ==
           std::string("pq_fastscan"));
     CHECK(vsag::SearchStatistics::BackendFromName("int8") == vsag::DistanceEvaluationBackend::INT8);
+    CHECK(vsag::SearchStatistics::BackendFromName("fp8_e4m3") ==
+          vsag::DistanceEvaluationBackend::FP8);
+    CHECK(vsag::SearchStatistics::BackendName(vsag::DistanceEvaluationBackend::FP8) ==
+          std::string("fp8"));
     CHECK(vsag::SearchStatistics::BackendFromName("QUANTIZATION_ADAPTER_sq8_uniform") ==
           vsag::DistanceEvaluationBackend::SQ8_UNIFORM);
     CHECK(vsag::SearchStatistics::BackendFromName("QUANTIZATION_ADAPTER_pq_fastscan") ==
@@ -256,6 +256,11 @@ FP32ReduceAdd(const float* x, uint64_t dim) {
     return sse::FP32ReduceAdd(x, dim);
 }
 
+float
+FP32GatherMax(const float* RESTRICT table, const uint32_t* RESTRICT ids, uint32_t num) {
+    return sse::FP32GatherMax(table, ids, num);
+}
+
 #if defined(ENABLE_AVX)
 __inline __m256i __attribute__((__always_inline__)) load_8_short(const uint16_t* data) {
     return _mm256_set_epi16(data[7],
@@ -346,6 +351,26 @@ FP16SparseAccumulate(float* RESTRICT dists,
 #endif
 }
 
+float
+FP8E4M3ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+    return sse::FP8E4M3ComputeIP(query, codes, dim);
+}
+
+float
+FP8E4M3ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+    return sse::FP8E4M3ComputeL2Sqr(query, codes, dim);
+}
+
+float
+FP8E5M2ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+    return sse::FP8E5M2ComputeIP(query, codes, dim);
+}
+
+float
+FP8E5M2ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+    return sse::FP8E5M2ComputeL2Sqr(query, codes, dim);
+}
+
 float
 INT8ComputeL2Sqr(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim) {
 #if defined(ENABLE_AVX)
@@ -13,8 +13,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <limits>
 
 #include "simd.h"
 #include "simd/int8_simd.h"
@@ -263,6 +265,27 @@ FP32ReduceAdd(const float* x, uint64_t dim) {
 #endif
 }
 
+float
+FP32GatherMax(const float* RESTRICT table, const uint32_t* RESTRICT ids, uint32_t num) {
+#if defined(ENABLE_AVX2)
+    __m256 max_vec = _mm256_set1_ps(std::numeric_limits<float>::lowest());
+    uint32_t i = 0;
+    for (; i + 8 <= num; i += 8) {
+        __m256i idx_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ids + i));
+        max_vec = _mm256_max_ps(max_vec, _mm256_i32gather_ps(table, idx_vec, 4));
+    }
+    alignas(32) float lanes[8];
+    _mm256_store_ps(lanes, max_vec);
+    float result = *std::max_element(lanes, lanes + 8);
+    for (; i < num; ++i) {
+        result = std::max(result, table[ids[i]]);
+    }
+    return result;
+#else
+    return avx::FP32GatherMax(table, ids, num);
+#endif
+}
+
 #if defined(ENABLE_AVX2)
 __inline __m256i __attribute__((__always_inline__)) load_8_short(const uint16_t* data) {
     __m128i bf16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
@@ -346,6 +369,46 @@ FP16SparseAccumulate(float* RESTRICT dists,
 #endif
 }
 
+float
+FP8E4M3ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+#if defined(ENABLE_AVX2)
+    return simd::FP8ComputeIPImpl<simd::FP8Traits<simd::AVX2_FP8_Tag>, true>(
+        query, codes, dim, &avx::FP8E4M3ComputeIP);
+#else
+    return avx::FP8E4M3ComputeIP(query, codes, dim);
+#endif
+}
+
+float
+FP8E4M3ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+#if defined(ENABLE_AVX2)
+    return simd::FP8ComputeL2SqrImpl<simd::FP8Traits<simd::AVX2_FP8_Tag>, true>(
+        query, codes, dim, &avx::FP8E4M3ComputeL2Sqr);
+#else
+    return avx::FP8E4M3ComputeL2Sqr(query, codes, dim);
+#endif
+}
+
+float
+FP8E5M2ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+#if defined(ENABLE_AVX2)
+    return simd::FP8ComputeIPImpl<simd::FP8Traits<simd::AVX2_FP8_Tag>, false>(
+        query, codes, dim, &avx::FP8E5M2ComputeIP);
+#else
+    return avx::FP8E5M2ComputeIP(query, codes, dim);
+#endif
+}
+
+float
+FP8E5M2ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+#if defined(ENABLE_AVX2)
+    return simd::FP8ComputeL2SqrImpl<simd::FP8Traits<simd::AVX2_FP8_Tag>, false>(
+        query, codes, dim, &avx::FP8E5M2ComputeL2Sqr);
+#else
+    return avx::FP8E5M2ComputeL2Sqr(query, codes, dim);
+#endif
+}
+
 float
 INT8ComputeL2Sqr(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim) {
 #if defined(ENABLE_AVX2)
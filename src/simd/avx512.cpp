@@ -22,6 +22,7 @@
 #endif
 
 #include <cmath>
+#include <limits>
 
 #include "simd.h"
 
@@ -270,6 +271,30 @@ FP32ReduceAdd(const float* x, uint64_t dim) {
 #endif
 }
 
+float
+FP32GatherMax(const float* RESTRICT table, const uint32_t* RESTRICT ids, uint32_t num) {
+#if defined(ENABLE_AVX512)
+    __m512 max_vec = _mm512_set1_ps(std::numeric_limits<float>::lowest());
+    uint32_t i = 0;
+    for (; i + 16 <= num; i += 16) {
+        __m512i idx_vec = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(ids + i));
+        max_vec = _mm512_max_ps(max_vec, _mm512_i32gather_ps(idx_vec, table, sizeof(float)));
+    }
+    if (i < num) {
+        __mmask16 mask = (1U << (num - i)) - 1;
+        __m512i idx_vec = _mm512_maskz_loadu_epi32(mask, ids + i);
+        max_vec = _mm512_mask_max_ps(
+            max_vec,
+            mask,
+            max_vec,
+            _mm512_mask_i32gather_ps(max_vec, mask, idx_vec, table, sizeof(float)));
+    }
+    return _mm512_reduce_max_ps(max_vec);
+#else
+    return avx2::FP32GatherMax(table, ids, num);
+#endif
+}
+
 #if defined(ENABLE_AVX512)
 __inline __m512i __attribute__((__always_inline__)) load_16_short(const uint16_t* data) {
     __m256i bf16 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
@@ -399,6 +424,46 @@ FP16SparseAccumulate(float* RESTRICT dists,
 #endif
 }
 
+float
+FP8E4M3ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+#if defined(ENABLE_AVX512)
+    return simd::FP8ComputeIPImpl<simd::FP8Traits<simd::AVX512_FP8_Tag>, true>(
+        query, codes, dim, &avx2::FP8E4M3ComputeIP);
+#else
+    return avx2::FP8E4M3ComputeIP(query, codes, dim);
+#endif
+}
+
+float
+FP8E4M3ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+#if defined(ENABLE_AVX512)
+    return simd::FP8ComputeL2SqrImpl<simd::FP8Traits<simd::AVX512_FP8_Tag>, true>(
+        query, codes, dim, &avx2::FP8E4M3ComputeL2Sqr);
+#else
+    return avx2::FP8E4M3ComputeL2Sqr(query, codes, dim);
+#endif
+}
+
+float
+FP8E5M2ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+#if defined(ENABLE_AVX512)
+    return simd::FP8ComputeIPImpl<simd::FP8Traits<simd::AVX512_FP8_Tag>, false>(
+        query, codes, dim, &avx2::FP8E5M2ComputeIP);
+#else
+    return avx2::FP8E5M2ComputeIP(query, codes, dim);
+#endif
+}
+
+float
+FP8E5M2ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+#if defined(ENABLE_AVX512)
+    return simd::FP8ComputeL2SqrImpl<simd::FP8Traits<simd::AVX512_FP8_Tag>, false>(
+        query, codes, dim, &avx2::FP8E5M2ComputeL2Sqr);
+#else
+    return avx2::FP8E5M2ComputeL2Sqr(query, codes, dim);
+#endif
+}
+
 float
 SQ8ComputeIP(const float* RESTRICT query,
              const uint8_t* RESTRICT codes,
@@ -29,5 +29,6 @@ VSAG_DEFINE_SIMD_DISPATCH(FP32Add, FP32ArithmeticType);
 VSAG_DEFINE_SIMD_DISPATCH(FP32Mul, FP32ArithmeticType);
 VSAG_DEFINE_SIMD_DISPATCH(FP32Div, FP32ArithmeticType);
 VSAG_DEFINE_SIMD_DISPATCH(FP32ReduceAdd, FP32ReduceType);
+VSAG_DEFINE_SIMD_DISPATCH(FP32GatherMax, FP32GatherReduceType);
 
 }  // namespace vsag
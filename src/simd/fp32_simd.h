@@ -64,6 +64,8 @@ namespace vsag {
     FP32Div(const float* x, const float* y, float* z, uint64_t dim);                          \
     float                                                                                     \
     FP32ReduceAdd(const float* x, uint64_t dim);                                              \
+    float                                                                                     \
+    FP32GatherMax(const float* RESTRICT table, const uint32_t* RESTRICT ids, uint32_t num);   \
     }  // namespace ns
 
 DECLARE_FP32_FUNCTIONS(generic)
@@ -109,4 +111,9 @@ extern FP32ArithmeticType FP32Div;
 
 using FP32ReduceType = float (*)(const float* x, uint64_t dim);
 extern FP32ReduceType FP32ReduceAdd;
+
+using FP32GatherReduceType = float (*)(const float* RESTRICT table,
+                                       const uint32_t* RESTRICT ids,
+                                       uint32_t num);
+extern FP32GatherReduceType FP32GatherMax;
 }  // namespace vsag
@@ -245,6 +245,34 @@ TEST_CASE("FP32 SIMD Compute", "[ut][simd]") {
     }
 }
 
+TEST_CASE("FP32 SIMD Gather Max", "[ut][simd]") {
+    constexpr uint32_t table_size = 97;
+    auto table = fixtures::generate_vectors(1, table_size);
+    for (uint32_t num : {0U, 1U, 7U, 8U, 15U, 16U, 17U, 63U}) {
+        std::vector<uint32_t> ids(num);
+        float expected = std::numeric_limits<float>::lowest();
+        for (uint32_t i = 0; i < num; ++i) {
+            ids[i] = (i * 31 + 5) % table_size;
+            expected = std::max(expected, table[ids[i]]);
+        }
+
+        auto check = [&](bool supported, FP32GatherReduceType func) {
+            if (not supported) {
+                return;
+            }
+            REQUIRE(func(table.data(), ids.data(), num) == expected);
+        };
+        check(true, generic::FP32GatherMax);
+        check(SimdStatus::SupportSSE(), sse::FP32GatherMax);
+        check(SimdStatus::SupportAVX(), avx::FP32GatherMax);
+        check(SimdStatus::SupportAVX2(), avx2::FP32GatherMax);
+        check(SimdStatus::SupportAVX512(), avx512::FP32GatherMax);
+        check(SimdStatus::SupportNEON(), neon::FP32GatherMax);
+        check(SimdStatus::SupportSVE(), sve::FP32GatherMax);
+        check(true, FP32GatherMax);
+    }
+}
+
 #define BENCHMARK_SIMD_COMPUTE(Simd, Comp)                                 \
     BENCHMARK_ADVANCED(#Simd #Comp) {                                      \
         for (int i = 0; i < count; ++i) {                                  \
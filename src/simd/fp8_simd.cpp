@@ -0,0 +1,25 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "fp8_simd.h"
+
+#include "simd_dispatch.h"
+
+namespace vsag {
+
+VSAG_DEFINE_SIMD_DISPATCH(FP8E4M3ComputeIP, FP8ComputeType);
+VSAG_DEFINE_SIMD_DISPATCH(FP8E4M3ComputeL2Sqr, FP8ComputeType);
+VSAG_DEFINE_SIMD_DISPATCH(FP8E5M2ComputeIP, FP8ComputeType);
+VSAG_DEFINE_SIMD_DISPATCH(FP8E5M2ComputeL2Sqr, FP8ComputeType);
+}  // namespace vsag
@@ -0,0 +1,71 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "simd_marco.h"
+namespace vsag {
+
+#define DECLARE_FP8_FUNCTIONS(ns)                                                                 \
+    namespace ns {                                                                                \
+    float                                                                                         \
+    FP8E4M3ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim); \
+    float                                                                                         \
+    FP8E4M3ComputeL2Sqr(const uint8_t* RESTRICT query,                                            \
+                        const uint8_t* RESTRICT codes,                                            \
+                        uint64_t dim);                                                            \
+    float                                                                                         \
+    FP8E5M2ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim); \
+    float                                                                                         \
+    FP8E5M2ComputeL2Sqr(const uint8_t* RESTRICT query,                                            \
+                        const uint8_t* RESTRICT codes,                                            \
+                        uint64_t dim);                                                            \
+    }  // namespace ns
+
+namespace generic {
+// E4M3: 1 sign, 4 exponent (bias 7), 3 mantissa bits, max finite 448, no infinities.
+// E5M2: 1 sign, 5 exponent (bias 15), 2 mantissa bits, max finite 57344.
+// Encoding rounds to nearest even and saturates to the max finite value.
+float
+FP8E4M3ToFloat(const uint8_t fp8_value);
+uint8_t
+FloatToFP8E4M3(const float fp32_value);
+float
+FP8E5M2ToFloat(const uint8_t fp8_value);
+uint8_t
+FloatToFP8E5M2(const float fp32_value);
+}  // namespace generic
+
+DECLARE_FP8_FUNCTIONS(generic)
+DECLARE_FP8_FUNCTIONS(sse)
+DECLARE_FP8_FUNCTIONS(avx)
+DECLARE_FP8_FUNCTIONS(avx2)
+DECLARE_FP8_FUNCTIONS(avx512)
+DECLARE_FP8_FUNCTIONS(neon)
+DECLARE_FP8_FUNCTIONS(sve)
+
+#undef DECLARE_FP8_FUNCTIONS
+
+using FP8ComputeType = float (*)(const uint8_t* RESTRICT query,
+                                 const uint8_t* RESTRICT codes,
+                                 uint64_t dim);
+extern FP8ComputeType FP8E4M3ComputeIP;
+extern FP8ComputeType FP8E4M3ComputeL2Sqr;
+extern FP8ComputeType FP8E5M2ComputeIP;
+extern FP8ComputeType FP8E5M2ComputeL2Sqr;
+
+}  // namespace vsag
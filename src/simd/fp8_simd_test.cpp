@@ -0,0 +1,160 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fp8_simd.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_all.hpp>
+
+#include "simd_status.h"
+#include "unittest.h"
+
+using namespace vsag;
+
+std::vector<uint8_t>
+encode_fp8(const std::vector<float>& data, const int64_t count, bool is_e4m3) {
+    std::vector<uint8_t> result(count);
+    for (int64_t i = 0; i < count; ++i) {
+        result[i] = is_e4m3 ? generic::FloatToFP8E4M3(data[i]) : generic::FloatToFP8E5M2(data[i]);
+    }
+    return result;
+}
+
+TEST_CASE("Encode & Decode FP8", "[ut][simd]") {
+    auto vec_fp32 = fixtures::generate_vectors(10, 100);
+    for (float item : vec_fp32) {
+        // relative error is bounded by half an ulp of the mantissa, plus the subnormal step
+        float e4m3 = generic::FP8E4M3ToFloat(generic::FloatToFP8E4M3(item));
+        REQUIRE(std::abs(e4m3 - item) <= std::abs(item) / 16 + 1e-3);
+        float e5m2 = generic::FP8E5M2ToFloat(generic::FloatToFP8E5M2(item));
+        REQUIRE(std::abs(e5m2 - item) <= std::abs(item) / 8 + 1e-5);
+    }
+    for (uint32_t code = 0; code < 256; ++code) {
+        auto fp8 = static_cast<uint8_t>(code);
+        if ((code & 0x7F) != 0x7F && code != 0x80) {
+            REQUIRE(generic::FloatToFP8E4M3(generic::FP8E4M3ToFloat(fp8)) == fp8);
+        }
+        if ((code & 0x7F) < 0x7C && code != 0x80) {
+            REQUIRE(generic::FloatToFP8E5M2(generic::FP8E5M2ToFloat(fp8)) == fp8);
+        }
+    }
+    REQUIRE(generic::FP8E4M3ToFloat(generic::FloatToFP8E4M3(1e6F)) == 448.0F);
+    REQUIRE(generic::FP8E4M3ToFloat(generic::FloatToFP8E4M3(-1e6F)) == -448.0F);
+    REQUIRE(generic::FP8E5M2ToFloat(generic::FloatToFP8E5M2(1e6F)) == 57344.0F);
+}
+
+#define TEST_ACCURACY(Func)                                                           \
+    {                                                                                 \
+        float gt, sse, avx, avx2, avx512, neon, sve;                                  \
+        gt = generic::Func(vec1.data() + i * dim, vec2.data() + i * dim, dim);        \
+        if (SimdStatus::SupportSSE()) {                                               \
+            sse = sse::Func(vec1.data() + i * dim, vec2.data() + i * dim, dim);       \
+            REQUIRE(fixtures::dist_t(gt) == fixtures::dist_t(sse));                   \
+        }                                                                             \
+        if (SimdStatus::SupportAVX()) {                                               \
+            avx = avx::Func(vec1.data() + i * dim, vec2.data() + i * dim, dim);       \
+            REQUIRE(fixtures::dist_t(gt) == fixtures::dist_t(avx));                   \
+        }                                                                             \
+        if (SimdStatus::SupportAVX2()) {                                              \
+            avx2 = avx2::Func(vec1.data() + i * dim, vec2.data() + i * dim, dim);     \
+            REQUIRE(fixtures::dist_t(gt) == fixtures::dist_t(avx2));                  \
+        }                                                                             \
+        if (SimdStatus::SupportAVX512()) {                                            \
+            avx512 = avx512::Func(vec1.data() + i * dim, vec2.data() + i * dim, dim); \
+            REQUIRE(fixtures::dist_t(gt) == fixtures::dist_t(avx512));                \
+        }                                                                             \
+        if (SimdStatus::SupportNEON()) {                                              \
+            neon = neon::Func(vec1.data() + i * dim, vec2.data() + i * dim, dim);     \
+            REQUIRE(fixtures::dist_t(gt) == fixtures::dist_t(neon));                  \
+        }                                                                             \
+        if (SimdStatus::SupportSVE()) {                                               \
+            sve = sve::Func(vec1.data() + i * dim, vec2.data() + i * dim, dim);       \
+            REQUIRE(fixtures::dist_t(gt) == fixtures::dist_t(sve));                   \
+        }                                                                             \
+    };
+
+TEST_CASE("FP8 SIMD Compute", "[ut][simd]") {
+    int64_t dim = GENERATE(1, 8, 15, 16, 32, 33, 256);
+    int64_t count = 100;
+
+    auto vec1_fp32 = fixtures::generate_vectors(count, dim, false, 39);
+    auto vec2_fp32 = fixtures::generate_vectors(count, dim, false, 87);
+    {
+        auto vec1 = encode_fp8(vec1_fp32, count * dim, true);
+        auto vec2 = encode_fp8(vec2_fp32, count * dim, true);
+        for (uint64_t i = 0; i < count; ++i) {
+            TEST_ACCURACY(FP8E4M3ComputeIP);
+            TEST_ACCURACY(FP8E4M3ComputeL2Sqr);
+        }
+    }
+    {
+        auto vec1 = encode_fp8(vec1_fp32, count * dim, false);
+        auto vec2 = encode_fp8(vec2_fp32, count * dim, false);
+        for (uint64_t i = 0; i < count; ++i) {
+            TEST_ACCURACY(FP8E5M2ComputeIP);
+            TEST_ACCURACY(FP8E5M2ComputeL2Sqr);
+        }
+    }
+}
+
+#define BENCHMARK_SIMD_COMPUTE(Simd, Comp)                                 \
+    BENCHMARK_ADVANCED(#Simd #Comp) {                                      \
+        for (int i = 0; i < count; ++i) {                                  \
+            Simd::Comp(vec1.data() + i * dim, vec2.data() + i * dim, dim); \
+        }                                                                  \
+        return;                                                            \
+    }
+
+TEST_CASE("FP8 Benchmark", "[ut][simd][!benchmark]") {
+    int64_t count = 500;
+    int64_t dim = 128;
+    auto vec1_fp32 = fixtures::generate_vectors(count, dim, false, 37);
+    auto vec1 = encode_fp8(vec1_fp32, count * dim, true);
+    auto vec2_fp32 = fixtures::generate_vectors(count, dim, false, 86);
+    auto vec2 = encode_fp8(vec2_fp32, count * dim, true);
+    BENCHMARK_SIMD_COMPUTE(generic, FP8E4M3ComputeIP);
+    if (SimdStatus::SupportSSE()) {
+        BENCHMARK_SIMD_COMPUTE(sse, FP8E4M3ComputeIP);
+    }
+    if (SimdStatus::SupportAVX2()) {
+        BENCHMARK_SIMD_COMPUTE(avx2, FP8E4M3ComputeIP);
+    }
+    if (SimdStatus::SupportAVX512()) {
+        BENCHMARK_SIMD_COMPUTE(avx512, FP8E4M3ComputeIP);
+    }
+    if (SimdStatus::SupportNEON()) {
+        BENCHMARK_SIMD_COMPUTE(neon, FP8E4M3ComputeIP);
+    }
+    if (SimdStatus::SupportSVE()) {
+        BENCHMARK_SIMD_COMPUTE(sve, FP8E4M3ComputeIP);
+    }
+
+    BENCHMARK_SIMD_COMPUTE(generic, FP8E4M3ComputeL2Sqr);
+    if (SimdStatus::SupportSSE()) {
+        BENCHMARK_SIMD_COMPUTE(sse, FP8E4M3ComputeL2Sqr);
+    }
+    if (SimdStatus::SupportAVX2()) {
+        BENCHMARK_SIMD_COMPUTE(avx2, FP8E4M3ComputeL2Sqr);
+    }
+    if (SimdStatus::SupportAVX512()) {
+        BENCHMARK_SIMD_COMPUTE(avx512, FP8E4M3ComputeL2Sqr);
+    }
+    if (SimdStatus::SupportNEON()) {
+        BENCHMARK_SIMD_COMPUTE(neon, FP8E4M3ComputeL2Sqr);
+    }
+    if (SimdStatus::SupportSVE()) {
+        BENCHMARK_SIMD_COMPUTE(sve, FP8E4M3ComputeL2Sqr);
+    }
+}
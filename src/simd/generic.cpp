@@ -13,6 +13,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include "simd.h"
 #include "simd/int8_simd.h"
 #include "simd/kernels/kernels.h"
@@ -172,6 +176,15 @@ FP32ReduceAdd(const float* x, uint64_t dim) {
     return simd::ReduceAddImpl<simd::SimdTraits<simd::Generic_Tag>>(x, dim);
 }
 
+float
+FP32GatherMax(const float* RESTRICT table, const uint32_t* RESTRICT ids, uint32_t num) {
+    float result = std::numeric_limits<float>::lowest();
+    for (uint32_t i = 0; i < num; ++i) {
+        result = std::max(result, table[ids[i]]);
+    }
+    return result;
+}
+
 union FP32Struct {
     uint32_t int_value;
     float float_value;
@@ -227,6 +240,63 @@ FloatToFP16(const float fp32_value) {
     return (sign << 15) | ((exp + 15) << 10) | (mantissa >> 13);
 }
 
+float
+FP8E4M3ToFloat(const uint8_t fp8_value) {
+    return simd::FP8Traits<simd::Generic_FP8_Tag>::load_e4m3(&fp8_value);
+}
+
+uint8_t
+FloatToFP8E4M3(const float fp32_value) {
+    if (std::isnan(fp32_value)) {
+        return 0;
+    }
+    uint8_t sign = std::signbit(fp32_value) ? 0x80 : 0x00;
+    float abs_value = std::fabs(fp32_value);
+    if (abs_value >= 448.0F) {
+        return sign | 0x7E;
+    }
+    uint32_t code;
+    if (abs_value < 0.015625F) {
+        // subnormal range, step 2^-9; rounding up to 8 lands on the smallest normal
+        code = static_cast<uint32_t>(std::nearbyint(abs_value * 512.0F));
+    } else {
+        int exp = 0;
+        float fraction = std::frexp(abs_value, &exp);
+        auto mantissa = static_cast<uint32_t>(std::nearbyint((fraction * 2.0F - 1.0F) * 8.0F));
+        // a rounded-up mantissa of 8 carries into the exponent field
+        code = (static_cast<uint32_t>(exp - 1 + 7) << 3) + mantissa;
+    }
+    return sign | static_cast<uint8_t>(std::min(code, 0x7EU));
+}
+
+float
+FP8E5M2ToFloat(const uint8_t fp8_value) {
+    return simd::FP8Traits<simd::Generic_FP8_Tag>::load_e5m2(&fp8_value);
+}
+
+uint8_t
+FloatToFP8E5M2(const float fp32_value) {
+    if (std::isnan(fp32_value)) {
+        return 0;
+    }
+    uint8_t sign = std::signbit(fp32_value) ? 0x80 : 0x00;
+    float abs_value = std::fabs(fp32_value);
+    if (abs_value >= 57344.0F) {
+        return sign | 0x7B;
+    }
+    uint32_t code;
+    if (abs_value < 6.103515625e-05F) {
+        // subnormal range, step 2^-16
+        code = static_cast<uint32_t>(std::nearbyint(abs_value * 65536.0F));
+    } else {
+        int exp = 0;
+        float fraction = std::frexp(abs_value, &exp);
+        auto mantissa = static_cast<uint32_t>(std::nearbyint((fraction * 2.0F - 1.0F) * 4.0F));
+        code = (static_cast<uint32_t>(exp - 1 + 15) << 2) + mantissa;
+    }
+    return sign | static_cast<uint8_t>(std::min(code, 0x7BU));
+}
+
 float
 BF16ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
     return simd::HalfComputeIPImpl<simd::BF16Traits<simd::Generic_BF16_Tag>>(
@@ -262,6 +332,30 @@ FP16SparseAccumulate(float* RESTRICT dists,
     }
 }
 
+float
+FP8E4M3ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+    return simd::FP8ComputeIPImpl<simd::FP8Traits<simd::Generic_FP8_Tag>, true>(
+        query, codes, dim, nullptr);
+}
+
+float
+FP8E4M3ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+    return simd::FP8ComputeL2SqrImpl<simd::FP8Traits<simd::Generic_FP8_Tag>, true>(
+        query, codes, dim, nullptr);
+}
+
+float
+FP8E5M2ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+    return simd::FP8ComputeIPImpl<simd::FP8Traits<simd::Generic_FP8_Tag>, false>(
+        query, codes, dim, nullptr);
+}
+
+float
+FP8E5M2ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+    return simd::FP8ComputeL2SqrImpl<simd::FP8Traits<simd::Generic_FP8_Tag>, false>(
+        query, codes, dim, nullptr);
+}
+
 float
 SQ8ComputeIP(const float* RESTRICT query,
              const uint8_t* RESTRICT codes,
@@ -0,0 +1,102 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+// FP8 (E4M3 / E5M2) distance kernels.
+//
+// FP8ComputeIP:     sum += fp8_to_fp32(query[i]) * fp8_to_fp32(codes[i])
+// FP8ComputeL2Sqr:  sum += (fp8_to_fp32(query[i]) - fp8_to_fp32(codes[i]))^2
+//
+// Parameterized on FP8Traits<ISA> and the code format, the traits must expose:
+//   FloatVec, Width, zero/fmadd/sub/reduce_add  (inherited from SimdTraits)
+//   load_e4m3(const uint8_t* p) -> FloatVec
+//   load_e5m2(const uint8_t* p) -> FloatVec
+//     Load Width fp8 values from p, convert to fp32.
+
+namespace vsag::simd {
+
+template <typename T, bool IsE4M3>
+inline __attribute__((always_inline)) typename T::FloatVec
+FP8Load(const uint8_t* p) {
+    if constexpr (IsE4M3) {
+        return T::load_e4m3(p);
+    } else {
+        return T::load_e5m2(p);
+    }
+}
+
+template <typename T, bool IsE4M3>
+inline float
+FP8ComputeIPImpl(const uint8_t* query,
+                 const uint8_t* codes,
+                 uint64_t dim,
+                 float (*fallback)(const uint8_t*, const uint8_t*, uint64_t) = nullptr) {
+    using V = typename T::FloatVec;
+    constexpr int W = T::Width;
+
+    if constexpr (W > 1) {
+        if (dim < static_cast<uint64_t>(W)) {
+            return fallback ? fallback(query, codes, dim) : 0.0f;
+        }
+    }
+
+    V sum = T::zero();
+    uint64_t i = 0;
+    for (; i + W <= dim; i += W) {
+        V qv = FP8Load<T, IsE4M3>(query + i);
+        V cv = FP8Load<T, IsE4M3>(codes + i);
+        sum = T::fmadd(qv, cv, sum);
+    }
+    float result = T::reduce_add(sum);
+    if (i < dim && fallback) {
+        result += fallback(query + i, codes + i, dim - i);
+    }
+    return result;
+}
+
+template <typename T, bool IsE4M3>
+inline float
+FP8ComputeL2SqrImpl(const uint8_t* query,
+                    const uint8_t* codes,
+                    uint64_t dim,
+                    float (*fallback)(const uint8_t*, const uint8_t*, uint64_t) = nullptr) {
+    using V = typename T::FloatVec;
+    constexpr int W = T::Width;
+
+    if constexpr (W > 1) {
+        if (dim < static_cast<uint64_t>(W)) {
+            return fallback ? fallback(query, codes, dim) : 0.0f;
+        }
+    }
+
+    V sum = T::zero();
+    uint64_t i = 0;
+    for (; i + W <= dim; i += W) {
+        V qv = FP8Load<T, IsE4M3>(query + i);
+        V cv = FP8Load<T, IsE4M3>(codes + i);
+        V d = T::sub(qv, cv);
+        sum = T::fmadd(d, d, sum);
+    }
+    float result = T::reduce_add(sum);
+    if (i < dim && fallback) {
+        result += fallback(query + i, codes + i, dim - i);
+    }
+    return result;
+}
+
+}  // namespace vsag::simd
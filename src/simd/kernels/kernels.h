@@ -21,6 +21,7 @@
 #include "compute_batch4.h"
 #include "compute_ip.h"
 #include "compute_l2.h"
+#include "fp8_compute.h"
 #include "half_compute.h"
 #include "int8_compute.h"
 #include "normalize.h"
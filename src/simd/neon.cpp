@@ -256,6 +256,11 @@ FP32ReduceAdd(const float* x, uint64_t dim) {
 #endif
 }
 
+float
+FP32GatherMax(const float* RESTRICT table, const uint32_t* RESTRICT ids, uint32_t num) {
+    return generic::FP32GatherMax(table, ids, num);
+}
+
 #if defined(ENABLE_NEON)
 __inline uint16x8_t __attribute__((__always_inline__)) load_4_short(const uint16_t* data) {
     uint16_t tmp[] = {data[3], 0, data[2], 0, data[1], 0, data[0], 0};
@@ -312,6 +317,46 @@ FP16SparseAccumulate(float* RESTRICT dists,
     return generic::FP16SparseAccumulate(dists, ids, vals, query_val, num);
 }
 
+float
+FP8E4M3ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+#if defined(ENABLE_NEON)
+    return simd::FP8ComputeIPImpl<simd::FP8Traits<simd::NEON_FP8_Tag>, true>(
+        query, codes, dim, &generic::FP8E4M3ComputeIP);
+#else
+    return generic::FP8E4M3ComputeIP(query, codes, dim);
+#endif
+}
+
+float
+FP8E4M3ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+#if defined(ENABLE_NEON)
+    return simd::FP8ComputeL2SqrImpl<simd::FP8Traits<simd::NEON_FP8_Tag>, true>(
+        query, codes, dim, &generic::FP8E4M3ComputeL2Sqr);
+#else
+    return generic::FP8E4M3ComputeL2Sqr(query, codes, dim);
+#endif
+}
+
+float
+FP8E5M2ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+#if defined(ENABLE_NEON)
+    return simd::FP8ComputeIPImpl<simd::FP8Traits<simd::NEON_FP8_Tag>, false>(
+        query, codes, dim, &generic::FP8E5M2ComputeIP);
+#else
+    return generic::FP8E5M2ComputeIP(query, codes, dim);
+#endif
+}
+
+float
+FP8E5M2ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+#if defined(ENABLE_NEON)
+    return simd::FP8ComputeL2SqrImpl<simd::FP8Traits<simd::NEON_FP8_Tag>, false>(
+        query, codes, dim, &generic::FP8E5M2ComputeL2Sqr);
+#else
+    return generic::FP8E5M2ComputeL2Sqr(query, codes, dim);
+#endif
+}
+
 #if defined(ENABLE_NEON)
 __inline float32x4_t __attribute__((__always_inline__)) load_4_uint8_to_float(const uint8_t* data) {
     uint32x4_t code_values = {data[0], data[1], data[2], data[3]};
@@ -24,6 +24,7 @@
 #include "bit_simd.h"
 #include "fp16_simd.h"
 #include "fp32_simd.h"
+#include "fp8_simd.h"
 #include "int8_simd.h"
 #include "normalize.h"
 #include "pqfs_simd.h"
@@ -251,6 +251,11 @@ FP32ReduceAdd(const float* x, uint64_t dim) {
 #endif
 }
 
+float
+FP32GatherMax(const float* RESTRICT table, const uint32_t* RESTRICT ids, uint32_t num) {
+    return generic::FP32GatherMax(table, ids, num);
+}
+
 float
 BF16ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
 #if defined(ENABLE_SSE)
@@ -290,6 +295,26 @@ FP16SparseAccumulate(float* RESTRICT dists,
     return generic::FP16SparseAccumulate(dists, ids, vals, query_val, num);
 }
 
+float
+FP8E4M3ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+    return generic::FP8E4M3ComputeIP(query, codes, dim);
+}
+
+float
+FP8E4M3ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+    return generic::FP8E4M3ComputeL2Sqr(query, codes, dim);
+}
+
+float
+FP8E5M2ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+    return generic::FP8E5M2ComputeIP(query, codes, dim);
+}
+
+float
+FP8E5M2ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+    return generic::FP8E5M2ComputeL2Sqr(query, codes, dim);
+}
+
 float
 INT8ComputeL2Sqr(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim) {
 #if defined(ENABLE_SSE)
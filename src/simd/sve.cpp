@@ -21,6 +21,7 @@
 #include <cmath>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
 
 #include "simd.h"
@@ -416,6 +417,26 @@ FP32ReduceAdd(const float* x, uint64_t dim) {
 #endif
 }
 
+float
+FP32GatherMax(const float* RESTRICT table, const uint32_t* RESTRICT ids, uint32_t num) {
+#if defined(ENABLE_SVE)
+    svfloat32_t max_vec = svdup_f32(std::numeric_limits<float>::lowest());
+    uint64_t i = 0;
+    const uint64_t step = svcntw();
+    svbool_t predicate = svwhilelt_b32(i, static_cast<uint64_t>(num));
+    while (svptest_first(svptrue_b32(), predicate)) {
+        svuint32_t idx_vec = svld1_u32(predicate, ids + i);
+        svfloat32_t values = svld1_gather_u32index_f32(predicate, table, idx_vec);
+        max_vec = svmax_f32_m(predicate, max_vec, values);
+        i += step;
+        predicate = svwhilelt_b32(i, static_cast<uint64_t>(num));
+    }
+    return svmaxv_f32(svptrue_b32(), max_vec);
+#else
+    return neon::FP32GatherMax(table, ids, num);
+#endif
+}
+
 float
 BF16ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
 #if defined(ENABLE_SVE)
@@ -566,6 +587,26 @@ FP16SparseAccumulate(float* RESTRICT dists,
     return neon::FP16SparseAccumulate(dists, ids, vals, query_val, num);
 }
 
+float
+FP8E4M3ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+    return neon::FP8E4M3ComputeIP(query, codes, dim);
+}
+
+float
+FP8E4M3ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+    return neon::FP8E4M3ComputeL2Sqr(query, codes, dim);
+}
+
+float
+FP8E5M2ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+    return neon::FP8E5M2ComputeIP(query, codes, dim);
+}
+
+float
+FP8E5M2ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+    return neon::FP8E5M2ComputeL2Sqr(query, codes, dim);
+}
+
 float
 SQ8ComputeIP(const float* RESTRICT query,
              const uint8_t* RESTRICT codes,
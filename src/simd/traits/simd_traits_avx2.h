@@ -163,6 +163,27 @@ struct FP16Traits<AVX2_FP16_Tag> : SimdTraits<AVX2_Tag> {
     }
 };
 
+// --- FP8Traits for AVX2 ---
+// E5M2 is the high byte of an IEEE fp16, E4M3 maps onto fp16 by shifting the magnitude
+// into place and rescaling by 2^(15 - 7); both then go through F16C.
+struct AVX2_FP8_Tag {};
+template <>
+struct FP8Traits<AVX2_FP8_Tag> : SimdTraits<AVX2_Tag> {
+    static inline __attribute__((always_inline)) FloatVec
+    load_e4m3(const uint8_t* p) {
+        __m128i fp8 = _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+        __m128i sign = _mm_slli_epi16(_mm_and_si128(fp8, _mm_set1_epi16(0x80)), 8);
+        __m128i magnitude = _mm_slli_epi16(_mm_and_si128(fp8, _mm_set1_epi16(0x7F)), 7);
+        __m256 value = _mm256_cvtph_ps(_mm_or_si128(sign, magnitude));
+        return _mm256_mul_ps(value, _mm256_set1_ps(256.0f));
+    }
+    static inline __attribute__((always_inline)) FloatVec
+    load_e5m2(const uint8_t* p) {
+        __m128i fp8 = _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+        return _mm256_cvtph_ps(_mm_slli_epi16(fp8, 8));
+    }
+};
+
 // --- UniformCodeTraits for AVX2 (32-byte integer vectors) ---
 struct AVX2_Uniform_Tag {};
 template <>
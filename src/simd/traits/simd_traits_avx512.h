@@ -208,6 +208,27 @@ struct FP16Traits<AVX512_FP16_Tag> : SimdTraits<AVX512_Tag> {
     }
 };
 
+// --- FP8Traits for AVX512 ---
+struct AVX512_FP8_Tag {};
+template <>
+struct FP8Traits<AVX512_FP8_Tag> : SimdTraits<AVX512_Tag> {
+    static inline __attribute__((always_inline)) FloatVec
+    load_e4m3(const uint8_t* p) {
+        __m256i fp8 =
+            _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+        __m256i sign = _mm256_slli_epi16(_mm256_and_si256(fp8, _mm256_set1_epi16(0x80)), 8);
+        __m256i magnitude = _mm256_slli_epi16(_mm256_and_si256(fp8, _mm256_set1_epi16(0x7F)), 7);
+        __m512 value = _mm512_cvtph_ps(_mm256_or_si256(sign, magnitude));
+        return _mm512_mul_ps(value, _mm512_set1_ps(256.0f));
+    }
+    static inline __attribute__((always_inline)) FloatVec
+    load_e5m2(const uint8_t* p) {
+        __m256i fp8 =
+            _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+        return _mm512_cvtph_ps(_mm256_slli_epi16(fp8, 8));
+    }
+};
+
 // --- UniformCodeTraits for AVX512 (64-byte integer vectors) ---
 struct AVX512_Uniform_Tag {};
 template <>
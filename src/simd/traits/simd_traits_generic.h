@@ -262,4 +262,55 @@ struct FP16Traits<Generic_FP16_Tag> : SimdTraits<Generic_Tag> {
     }
 };
 
+// --- FP8Traits primary template ---
+// Exposes load_e4m3 / load_e5m2: load Width fp8 codes from p, convert to fp32.
+template <typename Tag>
+struct FP8Traits;
+
+struct Generic_FP8_Tag {};
+template <>
+struct FP8Traits<Generic_FP8_Tag> : SimdTraits<Generic_Tag> {
+    static inline __attribute__((always_inline)) FloatVec
+    load_e4m3(const uint8_t* p) {
+        uint32_t b = *p;
+        uint32_t sign = (b & 0x80u) << 24;
+        uint32_t exp = (b >> 3) & 0x0Fu;
+        uint32_t mant = b & 0x07u;
+        uint32_t f;
+        if (exp == 0) {
+            // subnormal: mant * 2^-9
+            float value = static_cast<float>(mant) * 0.001953125f;
+            __builtin_memcpy(&f, &value, sizeof(f));
+            f |= sign;
+        } else {
+            f = sign | ((exp + 127 - 7) << 23) | (mant << 20);
+        }
+        float result;
+        __builtin_memcpy(&result, &f, sizeof(result));
+        return result;
+    }
+
+    static inline __attribute__((always_inline)) FloatVec
+    load_e5m2(const uint8_t* p) {
+        uint32_t b = *p;
+        uint32_t sign = (b & 0x80u) << 24;
+        uint32_t exp = (b >> 2) & 0x1Fu;
+        uint32_t mant = b & 0x03u;
+        uint32_t f;
+        if (exp == 0) {
+            // subnormal: mant * 2^-16
+            float value = static_cast<float>(mant) * 0.0000152587890625f;
+            __builtin_memcpy(&f, &value, sizeof(f));
+            f |= sign;
+        } else if (exp == 31) {
+            f = sign | 0x7F800000u | (mant << 21);
+        } else {
+            f = sign | ((exp + 127 - 15) << 23) | (mant << 21);
+        }
+        float result;
+        __builtin_memcpy(&result, &f, sizeof(result));
+        return result;
+    }
+};
+
 }  // namespace vsag::simd
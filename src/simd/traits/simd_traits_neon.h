@@ -216,4 +216,28 @@ struct FP16Traits<NEON_FP16_Tag> : SimdTraits<NEON_Tag> {
     }
 };
 
+// --- FP8Traits for NEON ---
+struct NEON_FP8_Tag {};
+template <>
+struct FP8Traits<NEON_FP8_Tag> : SimdTraits<NEON_Tag> {
+    static inline __attribute__((always_inline)) uint16x4_t
+    load_u8x4(const uint8_t* p) {
+        uint32_t bytes;
+        __builtin_memcpy(&bytes, p, sizeof(bytes));
+        return vget_low_u16(vmovl_u8(vcreate_u8(bytes)));
+    }
+    static inline __attribute__((always_inline)) FloatVec
+    load_e4m3(const uint8_t* p) {
+        uint16x4_t fp8 = load_u8x4(p);
+        uint16x4_t sign = vshl_n_u16(vand_u16(fp8, vdup_n_u16(0x80)), 8);
+        uint16x4_t magnitude = vshl_n_u16(vand_u16(fp8, vdup_n_u16(0x7F)), 7);
+        float32x4_t value = vcvt_f32_f16(vreinterpret_f16_u16(vorr_u16(sign, magnitude)));
+        return vmulq_n_f32(value, 256.0f);
+    }
+    static inline __attribute__((always_inline)) FloatVec
+    load_e5m2(const uint8_t* p) {
+        return vcvt_f32_f16(vreinterpret_f16_u16(vshl_n_u16(load_u8x4(p), 8)));
+    }
+};
+
 }  // namespace vsag::simd
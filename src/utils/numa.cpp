@@ -0,0 +1,247 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "numa.h"
+
+#include <cstdlib>
+#include <fstream>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_set_mempolicy) && \
+    defined(SYS_get_mempolicy)
+#define VSAG_NUMA_SYSCALLS 1
+#else
+#define VSAG_NUMA_SYSCALLS 0
+#endif
+
+namespace vsag {
+
+namespace {
+
+// values from linux/mempolicy.h, repeated here to avoid the numaif.h dependency
+[[maybe_unused]] constexpr int NUMA_MPOL_DEFAULT = 0;
+[[maybe_unused]] constexpr int NUMA_MPOL_PREFERRED = 1;
+[[maybe_unused]] constexpr int NUMA_MPOL_INTERLEAVE = 3;
+[[maybe_unused]] constexpr int NUMA_MPOL_F_NODE = 1;
+[[maybe_unused]] constexpr int NUMA_MPOL_F_ADDR = 2;
+
+constexpr uint64_t NUMA_MAX_NODES = 1024;
+constexpr uint64_t NUMA_MASK_BITS = sizeof(unsigned long) * 8;
+
+struct NodeMask {
+    unsigned long bits[NUMA_MAX_NODES / NUMA_MASK_BITS]{};
+
+    void
+    Set(int32_t node) {
+        if (node >= 0 and static_cast<uint64_t>(node) < NUMA_MAX_NODES) {
+            bits[node / NUMA_MASK_BITS] |= 1UL << (node % NUMA_MASK_BITS);
+        }
+    }
+};
+
+std::string
+read_first_line(const std::string& path) {
+    std::ifstream in(path);
+    std::string line;
+    std::getline(in, line);
+    return line;
+}
+
+}  // namespace
+
+std::vector<int32_t>
+ParseNumaList(const std::string& list) {
+    std::vector<int32_t> result;
+    uint64_t begin = 0;
+    while (begin < list.size()) {
+        auto end = list.find(',', begin);
+        if (end == std::string::npos) {
+            end = list.size();
+        }
+        auto token = list.substr(begin, end - begin);
+        begin = end + 1;
+
+        char* cursor = nullptr;
+        auto first = std::strtol(token.c_str(), &cursor, 10);
+        if (cursor == token.c_str() or first < 0) {
+            continue;
+        }
+        auto last = first;
+        if (*cursor == '-') {
+            const char* range_begin = cursor + 1;
+            last = std::strtol(range_begin, &cursor, 10);
+            if (cursor == range_begin or last < first) {
+                continue;
+            }
+        }
+        for (auto value = first; value <= last; ++value) {
+            result.emplace_back(static_cast<int32_t>(value));
+        }
+    }
+    return result;
+}
+
+const std::vector<int32_t>&
+NumaOnlineNodes() {
+    static const std::vector<int32_t> nodes = []() {
+        auto parsed = ParseNumaList(read_first_line("/sys/devices/system/node/online"));
+        if (parsed.empty()) {
+            parsed.emplace_back(0);
+        }
+        return parsed;
+    }();
+    return nodes;
+}
+
+int32_t
+NumaNodeCount() {
+    return static_cast<int32_t>(NumaOnlineNodes().size());
+}
+
+int32_t
+NumaCurrentNode() {
+#if defined(__linux__)
+    // sched_getcpu is served from the vdso, the cpu to node table is read from sysfs once
+    static const std::vector<int32_t> cpu_nodes = []() {
+        std::vector<int32_t> table;
+        for (auto node : NumaOnlineNodes()) {
+            for (auto cpu : NumaNodeCpus(node)) {
+                if (static_cast<uint64_t>(cpu) >= table.size()) {
+                    table.resize(cpu + 1, 0);
+                }
+                table[cpu] = node;
+            }
+        }
+        return table;
+    }();
+    auto cpu = sched_getcpu();
+    if (cpu >= 0 and static_cast<uint64_t>(cpu) < cpu_nodes.size()) {
+        return cpu_nodes[cpu];
+    }
+#endif
+    return 0;
+}
+
+int32_t
+NumaNodeOfAddress(const void* addr) {
+#if VSAG_NUMA_SYSCALLS
+    if (addr == nullptr) {
+        return -1;
+    }
+    int node = -1;
+    if (syscall(SYS_get_mempolicy,
+                &node,
+                nullptr,
+                0,
+                const_cast<void*>(addr),
+                NUMA_MPOL_F_NODE | NUMA_MPOL_F_ADDR) == 0) {
+        return node;
+    }
+#endif
+    return -1;
+}
+
+std::vector<int32_t>
+NumaNodeCpus(int32_t node) {
+    return ParseNumaList(
+        read_first_line("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"));
+}
+
+bool
+NumaThreadUsesDefaultPolicy() {
+#if VSAG_NUMA_SYSCALLS
+    int mode = NUMA_MPOL_DEFAULT;
+    if (syscall(SYS_get_mempolicy, &mode, nullptr, 0, nullptr, 0) == 0) {
+        return mode == NUMA_MPOL_DEFAULT;
+    }
+#endif
+    return true;
+}
+
+bool
+NumaInterleave(void* addr, uint64_t size) {
+#if VSAG_NUMA_SYSCALLS
+    if (addr == nullptr or NumaNodeCount() <= 1) {
+        return false;
+    }
+    const auto page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    const auto start = reinterpret_cast<uint64_t>(addr);
+    const auto begin = (start + page_size - 1) / page_size * page_size;
+    const auto end = (start + size) / page_size * page_size;
+    if (end <= begin) {
+        return false;
+    }
+    NodeMask mask;
+    for (auto node : NumaOnlineNodes()) {
+        mask.Set(node);
+    }
+    return syscall(SYS_mbind,
+                   reinterpret_cast<void*>(begin),
+                   end - begin,
+                   NUMA_MPOL_INTERLEAVE,
+                   mask.bits,
+                   NUMA_MAX_NODES + 1,
+                   0) == 0;
+#else
+    return false;
+#endif
+}
+
+bool
+NumaPinThreadToNode(int32_t node) {
+#if defined(__linux__)
+    auto cpus = NumaNodeCpus(node);
+    if (cpus.empty()) {
+        return false;
+    }
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (auto cpu : cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &cpu_set);
+        }
+    }
+    return sched_setaffinity(0, sizeof(cpu_set), &cpu_set) == 0;
+#else
+    return false;
+#endif
+}
+
+ScopedNumaPreferredNode::ScopedNumaPreferredNode(int32_t node) {
+#if VSAG_NUMA_SYSCALLS
+    if (NumaNodeCount() <= 1 or node < 0) {
+        return;
+    }
+    NodeMask mask;
+    mask.Set(node);
+    applied_ =
+        syscall(SYS_set_mempolicy, NUMA_MPOL_PREFERRED, mask.bits, NUMA_MAX_NODES + 1) == 0;
+#endif
+}
+
+ScopedNumaPreferredNode::~ScopedNumaPreferredNode() {
+#if VSAG_NUMA_SYSCALLS
+    if (applied_) {
+        syscall(SYS_set_mempolicy, NUMA_MPOL_DEFAULT, nullptr, 0);
+    }
+#endif
+}
+
+}  // namespace vsag
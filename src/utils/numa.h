@@ -0,0 +1,91 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vsag {
+
+/*
+ * Minimal NUMA helpers built on the raw mbind/set_mempolicy/get_mempolicy syscalls, so that
+ * vsag does not depend on libnuma. Every function degrades to a no-op on hosts (or builds)
+ * without NUMA support: a single node is reported and policy changes return false.
+ */
+
+/// Parses a sysfs cpu/node list such as "0-3,8,10-11".
+std::vector<int32_t>
+ParseNumaList(const std::string& list);
+
+/// Ids of the online NUMA nodes, {0} if unknown.
+const std::vector<int32_t>&
+NumaOnlineNodes();
+
+/// Number of online NUMA nodes, 1 if unknown.
+int32_t
+NumaNodeCount();
+
+/// Node of the cpu the calling thread currently runs on, 0 if unknown.
+int32_t
+NumaCurrentNode();
+
+/// Node holding the page that contains addr, -1 if unknown or not yet touched.
+int32_t
+NumaNodeOfAddress(const void* addr);
+
+/// Cpus that belong to the node, empty if unknown.
+std::vector<int32_t>
+NumaNodeCpus(int32_t node);
+
+/// Whether the calling thread runs with the default (first touch) memory policy.
+bool
+NumaThreadUsesDefaultPolicy();
+
+/**
+ * @brief Interleaves the pages of [addr, addr + size) over all online nodes.
+ *
+ * Must be called before the range is first touched; only whole pages inside the range are
+ * affected.
+ */
+bool
+NumaInterleave(void* addr, uint64_t size);
+
+/// Restricts the calling thread to the cpus of the node.
+bool
+NumaPinThreadToNode(int32_t node);
+
+/**
+ * @brief Makes the calling thread prefer allocating on one node for the lifetime of the guard.
+ *
+ * The default policy is restored on destruction, so the guard must not be nested with other
+ * memory policy changes on the same thread.
+ */
+class ScopedNumaPreferredNode {
+public:
+    explicit ScopedNumaPreferredNode(int32_t node);
+
+    ~ScopedNumaPreferredNode();
+
+    ScopedNumaPreferredNode(const ScopedNumaPreferredNode&) = delete;
+    ScopedNumaPreferredNode&
+    operator=(const ScopedNumaPreferredNode&) = delete;
+
+private:
+    bool applied_{false};
+};
+
+}  // namespace vsag
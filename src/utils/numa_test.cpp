@@ -0,0 +1,59 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "numa.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "unittest.h"
+
+TEST_CASE("Numa List Parse Test", "[ut][Numa]") {
+    REQUIRE(vsag::ParseNumaList("0").size() == 1);
+    REQUIRE(vsag::ParseNumaList("").empty());
+    REQUIRE(vsag::ParseNumaList("0-3,8,10-11\n") ==
+            std::vector<int32_t>{0, 1, 2, 3, 8, 10, 11});
+    REQUIRE(vsag::ParseNumaList("x,2,5-4") == std::vector<int32_t>{2});
+}
+
+TEST_CASE("Numa Topology Test", "[ut][Numa]") {
+    auto node_count = vsag::NumaNodeCount();
+    REQUIRE(node_count >= 1);
+    REQUIRE(vsag::NumaOnlineNodes().size() == static_cast<uint64_t>(node_count));
+    REQUIRE(vsag::NumaCurrentNode() >= 0);
+    REQUIRE(vsag::NumaThreadUsesDefaultPolicy());
+
+    {
+        // the preferred policy is only scoped, the thread must be back on first touch afterwards
+        vsag::ScopedNumaPreferredNode preferred(0);
+        auto* data = static_cast<char*>(std::malloc(1 << 20));
+        data[0] = 1;
+        std::free(data);
+    }
+    REQUIRE(vsag::NumaThreadUsesDefaultPolicy());
+
+    // a touched stack page is resident on one of the online nodes, when the host can tell
+    int32_t local = 0;
+    auto home = vsag::NumaNodeOfAddress(&local);
+    if (home != -1) {
+        const auto& nodes = vsag::NumaOnlineNodes();
+        REQUIRE(std::find(nodes.begin(), nodes.end(), home) != nodes.end());
+    }
+    REQUIRE(vsag::NumaNodeOfAddress(nullptr) == -1);
+
+    // interleaving needs at least one whole page and more than one node
+    char small[16];
+    REQUIRE_FALSE(vsag::NumaInterleave(small, sizeof(small)));
+}
@@ -0,0 +1,73 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "search_deadline.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "vsag/search_request.h"
+
+namespace vsag {
+
+SearchDeadline::SearchDeadline(double timeout_ms,
+                               std::optional<Clock::time_point> deadline,
+                               CancellationTokenPtr cancellation_token)
+    : cancellation_token_(std::move(cancellation_token)) {
+    if (timeout_ms != std::numeric_limits<double>::max()) {
+        const auto now = Clock::now();
+        // a budget past the end of the clock range means no budget
+        const std::chrono::duration<double, std::milli> budget(std::max(timeout_ms, 0.0));
+        const std::chrono::duration<double, std::milli> remaining(Clock::time_point::max() - now);
+        if (budget < remaining) {
+            this->deadline_ = now + std::chrono::duration_cast<Clock::duration>(budget);
+        }
+    }
+    if (deadline.has_value()) {
+        this->deadline_ = std::min(this->deadline_, deadline.value());
+    }
+}
+
+SearchDeadlinePtr
+SearchDeadline::Make(double timeout_ms, const SearchRequest* request) {
+    const bool has_request_deadline = request != nullptr and request->deadline_.has_value();
+    const bool has_token = request != nullptr and request->cancellation_token_ != nullptr;
+    if (timeout_ms == std::numeric_limits<double>::max() and not has_request_deadline and
+        not has_token) {
+        return nullptr;
+    }
+    return std::make_shared<SearchDeadline>(
+        timeout_ms,
+        has_request_deadline ? request->deadline_ : std::nullopt,
+        has_token ? request->cancellation_token_ : nullptr);
+}
+
+SearchDeadline::Reason
+SearchDeadline::Check() const {
+    auto reason = this->reason_.load(std::memory_order_relaxed);
+    if (reason != Reason::NONE) {
+        return reason;
+    }
+    if (this->cancellation_token_ != nullptr and this->cancellation_token_->IsCancelled()) {
+        reason = Reason::CANCELLED;
+    } else if (this->deadline_ != Clock::time_point::max() and Clock::now() >= this->deadline_) {
+        reason = Reason::TIMEOUT;
+    } else {
+        return Reason::NONE;
+    }
+    this->reason_.store(reason, std::memory_order_relaxed);
+    return reason;
+}
+
+}  // namespace vsag
@@ -0,0 +1,70 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+#include "vsag/cancellation_token.h"
+
+namespace vsag {
+
+class SearchRequest;
+class SearchDeadline;
+using SearchDeadlinePtr = std::shared_ptr<SearchDeadline>;
+
+/**
+ * @brief Combines the timeout_ms search parameter, the absolute deadline and the cancellation
+ * token of a request into one cooperative stop check.
+ *
+ * Searchers, scanners and reorder loops reach it through QueryContext::deadline and call
+ * QueryContext::ShouldStop(). Once a reason is observed it stays, so every later check and
+ * every thread of a parallel search agree on it.
+ */
+class SearchDeadline {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class Reason : uint8_t { NONE = 0, TIMEOUT = 1, CANCELLED = 2 };
+
+    SearchDeadline(double timeout_ms,
+                   std::optional<Clock::time_point> deadline,
+                   CancellationTokenPtr cancellation_token);
+
+    /**
+     * @brief Builds the check for a search, or nullptr when the search has nothing to check.
+     *
+     * @param timeout_ms relative budget from now, std::numeric_limits<double>::max() for none.
+     * @param request the request carrying the deadline and the token, may be nullptr.
+     */
+    static SearchDeadlinePtr
+    Make(double timeout_ms, const SearchRequest* request = nullptr);
+
+    /// Why the search has to stop now, Reason::NONE to continue.
+    Reason
+    Check() const;
+
+private:
+    Clock::time_point deadline_{Clock::time_point::max()};
+
+    const CancellationTokenPtr cancellation_token_{nullptr};
+
+    mutable std::atomic<Reason> reason_{Reason::NONE};
+};
+
+}  // namespace vsag
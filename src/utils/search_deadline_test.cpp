@@ -0,0 +1,88 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "search_deadline.h"
+
+#include <limits>
+
+#include "query_context.h"
+#include "unittest.h"
+#include "vsag/search_request.h"
+
+using namespace vsag;
+
+TEST_CASE("SearchDeadline Make", "[ut][SearchDeadline]") {
+    constexpr double no_timeout = std::numeric_limits<double>::max();
+    REQUIRE(SearchDeadline::Make(no_timeout) == nullptr);
+
+    SearchRequest request;
+    REQUIRE(SearchDeadline::Make(no_timeout, &request) == nullptr);
+
+    auto deadline = SearchDeadline::Make(60000.0);
+    REQUIRE(deadline != nullptr);
+    REQUIRE(deadline->Check() == SearchDeadline::Reason::NONE);
+
+    request.cancellation_token_ = std::make_shared<CancellationToken>();
+    deadline = SearchDeadline::Make(no_timeout, &request);
+    REQUIRE(deadline != nullptr);
+    REQUIRE(deadline->Check() == SearchDeadline::Reason::NONE);
+}
+
+TEST_CASE("SearchDeadline Check", "[ut][SearchDeadline]") {
+    constexpr double no_timeout = std::numeric_limits<double>::max();
+
+    SECTION("zero timeout expires immediately") {
+        auto deadline = SearchDeadline::Make(0.0);
+        REQUIRE(deadline->Check() == SearchDeadline::Reason::TIMEOUT);
+    }
+
+    SECTION("the earlier of timeout and request deadline applies") {
+        SearchRequest request;
+        request.deadline_ = SearchDeadline::Clock::now() - std::chrono::milliseconds(1);
+        auto deadline = SearchDeadline::Make(60000.0, &request);
+        REQUIRE(deadline->Check() == SearchDeadline::Reason::TIMEOUT);
+    }
+
+    SECTION("cancellation is latched") {
+        SearchRequest request;
+        auto token = std::make_shared<CancellationToken>();
+        request.cancellation_token_ = token;
+        request.deadline_ = SearchDeadline::Clock::now() + std::chrono::hours(1);
+        auto deadline = SearchDeadline::Make(no_timeout, &request);
+        REQUIRE(deadline->Check() == SearchDeadline::Reason::NONE);
+        token->Cancel();
+        REQUIRE(token->IsCancelled());
+        REQUIRE(deadline->Check() == SearchDeadline::Reason::CANCELLED);
+        REQUIRE(deadline->Check() == SearchDeadline::Reason::CANCELLED);
+    }
+
+    SECTION("query context records the reason and phase") {
+        SearchRequest request;
+        request.cancellation_token_ = std::make_shared<CancellationToken>();
+        auto deadline = SearchDeadline::Make(no_timeout, &request);
+        SearchStatistics stats;
+        QueryContext ctx{.stats = &stats,
+                         .distance_phase = DistanceEvaluationPhase::RERANK,
+                         .deadline = deadline.get()};
+        REQUIRE_FALSE(ctx.ShouldStop());
+        request.cancellation_token_->Cancel();
+        REQUIRE(ctx.ShouldStop());
+        REQUIRE(stats.is_cancelled.load());
+        REQUIRE_FALSE(stats.is_timeout.load());
+
+        auto json = JsonType::Parse(stats.Dump());
+        REQUIRE(json["is_partial"].GetBool());
+        REQUIRE(json["terminated_phase"].GetString() == "rerank");
+    }
+}
@@ -18,6 +18,8 @@
 #include <cstring>
 #include <limits>
 
+#include "impl/allocator/memory_budget.h"
+
 namespace vsag {
 VisitedList::VisitedList(InnerIdType max_size, Allocator* allocator)
     : allocator_(allocator),
@@ -27,6 +29,7 @@ VisitedList::VisitedList(InnerIdType max_size, Allocator* allocator)
     }
     const auto words_bytes = word_count_ * sizeof(WordType);
     const auto tags_bytes = word_count_ * sizeof(TagType);
+    ScopedMemoryCategory category(MemoryCategory::VISITED_LIST);
     auto* buffer = static_cast<uint8_t*>(allocator_->Allocate(words_bytes + tags_bytes));
     this->words_ = reinterpret_cast<WordType*>(buffer);
     this->tags_ = reinterpret_cast<TagType*>(buffer + words_bytes);
@@ -13,18 +13,23 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <vsag/bitset.h>
+#include <vsag/engine.h>
 #include <vsag/factory.h>
 #include <vsag/index.h>
 #include <vsag/vsag_c_api.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <fstream>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <stdexcept>
 #include <streambuf>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
@@ -39,6 +44,14 @@ public:
     std::shared_ptr<vsag::Index> index_;
 };
 
+class VsagBitset {
+public:
+    VsagBitset() : bitset_(vsag::Bitset::Make()) {
+    }
+
+    vsag::BitsetPtr bitset_;
+};
+
 static Error_t
 make_error(const vsag::Error& error) {
     Error_t err;
@@ -180,6 +193,186 @@ private:
     bool consumed_{false};
 };
 
+namespace {
+// everything a batch search needs once the C call has returned
+struct BatchSearch {
+    std::shared_ptr<vsag::Index> index;
+    const float* queries{nullptr};
+    uint64_t dim{0};
+    int64_t k{0};
+    float radius{0.0F};
+    bool is_range{false};
+    std::string parameters;
+    vsag::BitsetPtr invalid{nullptr};
+    int64_t* ids{nullptr};
+    float* dists{nullptr};
+    int64_t* counts{nullptr};
+};
+
+Error_t
+make_invalid_argument(const char* message) {
+    Error_t err;
+    err.code = VSAG_INVALID_ARGUMENT;
+    snprintf(err.message, sizeof(err.message), "%s", message);
+    return err;
+}
+
+Error_t
+prepare_batch_search(vsag_index_t index,
+                     const float* queries,
+                     uint64_t dim,
+                     uint64_t query_count,
+                     int64_t k,
+                     const char* parameters,
+                     const vsag_bitset_t invalid,
+                     int64_t* ids,
+                     float* dists,
+                     int64_t* counts,
+                     BatchSearch& batch) {
+    auto* vsag_index = static_cast<VsagIndex*>(index);
+    if (vsag_index == nullptr) {
+        return make_error("index is NULL");
+    }
+    if (k <= 0) {
+        return make_invalid_argument("batch search requires k >= 1");
+    }
+    if (query_count > 0 and (queries == nullptr or ids == nullptr or dists == nullptr or
+                             counts == nullptr)) {
+        return make_invalid_argument("batch search requires queries, ids, dists and counts");
+    }
+    batch.index = vsag_index->index_;
+    batch.queries = queries;
+    batch.dim = dim;
+    batch.k = k;
+    batch.parameters = parameters == nullptr ? "" : parameters;
+    if (invalid != nullptr) {
+        batch.invalid = static_cast<VsagBitset*>(invalid)->bitset_;
+    }
+    batch.ids = ids;
+    batch.dists = dists;
+    batch.counts = counts;
+    return success;
+}
+
+Error_t
+search_one(const BatchSearch& batch, uint64_t query_idx) {
+    auto query_dataset = vsag::Dataset::Make();
+    query_dataset->Owner(false)
+        ->Dim(static_cast<int64_t>(batch.dim))
+        ->NumElements(static_cast<int64_t>(1))
+        ->Float32Vectors(batch.queries + query_idx * batch.dim);
+    auto result =
+        batch.is_range
+            ? batch.index->RangeSearch(
+                  query_dataset, batch.radius, batch.parameters, batch.invalid, batch.k)
+            : batch.index->KnnSearch(query_dataset, batch.k, batch.parameters, batch.invalid);
+    auto* ids = batch.ids + query_idx * batch.k;
+    auto* dists = batch.dists + query_idx * batch.k;
+    int64_t to_write = 0;
+    if (result.has_value()) {
+        const auto* ids_view = result.value()->GetIds();
+        const auto* dists_view = result.value()->GetDistances();
+        to_write = std::min<int64_t>(result.value()->GetDim(), batch.k);
+        std::copy(ids_view, ids_view + to_write, ids);
+        std::copy(dists_view, dists_view + to_write, dists);
+    }
+    std::fill(ids + to_write, ids + batch.k, -1);
+    std::fill(dists + to_write, dists + batch.k, std::numeric_limits<float>::infinity());
+    batch.counts[query_idx] = to_write;
+    return result.has_value() ? success : make_error(result.error());
+}
+
+Error_t
+search_range(const BatchSearch& batch, uint64_t begin, uint64_t end) {
+    Error_t first_error = success;
+    for (uint64_t i = begin; i < end; ++i) {
+        auto err = search_one(batch, i);
+        if (err.code != VSAG_SUCCESS and first_error.code == VSAG_SUCCESS) {
+            first_error = err;
+        }
+    }
+    return first_error;
+}
+
+struct SearchPool {
+    std::shared_ptr<vsag::ThreadPool> pool;
+    uint64_t size{1};
+};
+
+// shared by every index, so that hundreds of handles do not each own a set of threads
+const SearchPool&
+async_search_pool() {
+    static const SearchPool search_pool = []() {
+        SearchPool result;
+        result.size = std::clamp<uint64_t>(std::thread::hardware_concurrency(), 1, 512);
+        result.pool = vsag::Engine::CreateThreadPool(result.size).value();
+        return result;
+    }();
+    return search_pool;
+}
+
+struct AsyncBatchState {
+    BatchSearch batch;
+    std::atomic<uint64_t> pending{0};
+    std::mutex error_mutex;
+    Error_t first_error = success;
+    SearchCallback_t callback{nullptr};
+    void* user_data{nullptr};
+
+    void
+    Finish(const Error_t& err) {
+        if (err.code != VSAG_SUCCESS) {
+            std::lock_guard lock(error_mutex);
+            if (first_error.code == VSAG_SUCCESS) {
+                first_error = err;
+            }
+        }
+        if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            callback(first_error, user_data);
+        }
+    }
+};
+
+Error_t
+schedule_batch_search(BatchSearch batch,
+                      uint64_t query_count,
+                      SearchCallback_t callback,
+                      void* user_data) {
+    if (callback == nullptr) {
+        return make_invalid_argument("async batch search requires a callback");
+    }
+    const auto& search_pool = async_search_pool();
+    auto state = std::make_shared<AsyncBatchState>();
+    state->batch = std::move(batch);
+    state->callback = callback;
+    state->user_data = user_data;
+
+    const auto chunk_count = std::max<uint64_t>(1, std::min(query_count, search_pool.size));
+    const auto chunk_size = (query_count + chunk_count - 1) / std::max<uint64_t>(chunk_count, 1);
+    state->pending.store(chunk_count, std::memory_order_relaxed);
+    for (uint64_t chunk = 0; chunk < chunk_count; ++chunk) {
+        const auto begin = std::min(chunk * chunk_size, query_count);
+        const auto end = std::min(begin + chunk_size, query_count);
+        auto task = [state, begin, end]() {
+            Error_t err;
+            try {
+                err = search_range(state->batch, begin, end);
+            } catch (const std::exception& e) {
+                err = make_error(e);
+            }
+            state->Finish(err);
+        };
+        try {
+            search_pool.pool->Enqueue(task);
+        } catch (const std::exception&) {
+            // a full queue must not lose the callback, run the chunk on the caller instead
+            task();
+        }
+    }
+    return success;
+}
+}  // namespace
+
 #define VSAG_CHECK_RESULT(expr)                    \
     do {                                           \
         auto _vsag_result = (expr);                \
@@ -501,6 +694,152 @@ vsag_index_range_search_with_filter(vsag_index_t index,
     }
 }
 
+vsag_bitset_t
+vsag_bitset_create() {
+    try {
+        return new VsagBitset();
+    } catch (const std::exception& e) {
+        return nullptr;
+    }
+}
+
+Error_t
+vsag_bitset_destroy(vsag_bitset_t bitset) {
+    delete static_cast<VsagBitset*>(bitset);
+    return success;
+}
+
+Error_t
+vsag_bitset_set(vsag_bitset_t bitset, const int64_t* ids, uint64_t count, bool value) {
+    try {
+        auto* vsag_bitset = static_cast<VsagBitset*>(bitset);
+        if (vsag_bitset == nullptr) {
+            return make_error("bitset is NULL");
+        }
+        if (count > 0 and ids == nullptr) {
+            return make_invalid_argument("bitset set requires ids");
+        }
+        for (uint64_t i = 0; i < count; ++i) {
+            vsag_bitset->bitset_->Set(ids[i], value);
+        }
+        return success;
+    } catch (const std::exception& e) {
+        return make_error(e);
+    }
+}
+
+bool
+vsag_bitset_test(const vsag_bitset_t bitset, int64_t id) {
+    const auto* vsag_bitset = static_cast<const VsagBitset*>(bitset);
+    return vsag_bitset != nullptr and vsag_bitset->bitset_->Test(id);
+}
+
+Error_t
+vsag_index_knn_search_batch(vsag_index_t index,
+                            const float* queries,
+                            uint64_t dim,
+                            uint64_t query_count,
+                            int64_t k,
+                            const char* parameters,
+                            const vsag_bitset_t invalid,
+                            int64_t* ids,
+                            float* dists,
+                            int64_t* counts) {
+    try {
+        BatchSearch batch;
+        auto err = prepare_batch_search(
+            index, queries, dim, query_count, k, parameters, invalid, ids, dists, counts, batch);
+        if (err.code != VSAG_SUCCESS) {
+            return err;
+        }
+        return search_range(batch, 0, query_count);
+    } catch (const std::exception& e) {
+        return make_error(e);
+    }
+}
+
+Error_t
+vsag_index_range_search_batch(vsag_index_t index,
+                              const float* queries,
+                              uint64_t dim,
+                              uint64_t query_count,
+                              float radius,
+                              int64_t k,
+                              const char* parameters,
+                              const vsag_bitset_t invalid,
+                              int64_t* ids,
+                              float* dists,
+                              int64_t* counts) {
+    try {
+        BatchSearch batch;
+        auto err = prepare_batch_search(
+            index, queries, dim, query_count, k, parameters, invalid, ids, dists, counts, batch);
+        if (err.code != VSAG_SUCCESS) {
+            return err;
+        }
+        batch.is_range = true;
+        batch.radius = radius;
+        return search_range(batch, 0, query_count);
+    } catch (const std::exception& e) {
+        return make_error(e);
+    }
+}
+
+Error_t
+vsag_index_knn_search_batch_async(vsag_index_t index,
+                                  const float* queries,
+                                  uint64_t dim,
+                                  uint64_t query_count,
+                                  int64_t k,
+                                  const char* parameters,
+                                  const vsag_bitset_t invalid,
+                                  int64_t* ids,
+                                  float* dists,
+                                  int64_t* counts,
+                                  SearchCallback_t callback,
+                                  void* user_data) {
+    try {
+        BatchSearch batch;
+        auto err = prepare_batch_search(
+            index, queries, dim, query_count, k, parameters, invalid, ids, dists, counts, batch);
+        if (err.code != VSAG_SUCCESS) {
+            return err;
+        }
+        return schedule_batch_search(std::move(batch), query_count, callback, user_data);
+    } catch (const std::exception& e) {
+        return make_error(e);
+    }
+}
+
+Error_t
+vsag_index_range_search_batch_async(vsag_index_t index,
+                                    const float* queries,
+                                    uint64_t dim,
+                                    uint64_t query_count,
+                                    float radius,
+                                    int64_t k,
+                                    const char* parameters,
+                                    const vsag_bitset_t invalid,
+                                    int64_t* ids,
+                                    float* dists,
+                                    int64_t* counts,
+                                    SearchCallback_t callback,
+                                    void* user_data) {
+    try {
+        BatchSearch batch;
+        auto err = prepare_batch_search(
+            index, queries, dim, query_count, k, parameters, invalid, ids, dists, counts, batch);
+        if (err.code != VSAG_SUCCESS) {
+            return err;
+        }
+        batch.is_range = true;
+        batch.radius = radius;
+        return schedule_batch_search(std::move(batch), query_count, callback, user_data);
+    } catch (const std::exception& e) {
+        return make_error(e);
+    }
+}
+
 Error_t
 vsag_index_clone(const vsag_index_t index, vsag_index_t* clone_index) {
     try {
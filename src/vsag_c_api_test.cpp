@@ -16,7 +16,10 @@
 #include <sys/stat.h>
 #include <vsag/vsag_c_api.h>
 
+#include <atomic>
+#include <cmath>
 #include <fstream>
+#include <future>
 #include <random>
 
 #include "simd/fp32_simd.h"
@@ -327,6 +330,193 @@ TEST_CASE("vsag_c_api range search", "[vsag_c_api][ut]") {
     vsag_index_destroy(index);
 }
 
+TEST_CASE("vsag_c_api batch search with bitset", "[vsag_c_api][ut]") {
+    auto index = vsag_index_factory(index_name, index_param);
+    REQUIRE(index != nullptr);
+
+    VsagTestCase test_case;
+    Error_t ret =
+        vsag_index_build(index, test_case.datas.data(), test_case.ids.data(), dim, num_vectors);
+    REQUIRE(ret.code == VSAG_SUCCESS);
+
+    constexpr uint64_t query_count = 20;
+    int64_t topk = 10;
+    std::vector<int64_t> ids(query_count * topk);
+    std::vector<float> dists(query_count * topk);
+    std::vector<int64_t> counts(query_count);
+
+    // the batch matches query-by-query search
+    ret = vsag_index_knn_search_batch(index,
+                                      test_case.datas.data(),
+                                      dim,
+                                      query_count,
+                                      topk,
+                                      hgraph_search_parameters,
+                                      nullptr,
+                                      ids.data(),
+                                      dists.data(),
+                                      counts.data());
+    REQUIRE(ret.code == VSAG_SUCCESS);
+    std::vector<int64_t> single_ids(topk);
+    std::vector<float> single_dists(topk);
+    SearchResult_t result;
+    result.ids = single_ids.data();
+    result.dists = single_dists.data();
+    for (uint64_t i = 0; i < query_count; ++i) {
+        ret = vsag_index_knn_search(index,
+                                    test_case.datas.data() + i * dim,
+                                    dim,
+                                    topk,
+                                    hgraph_search_parameters,
+                                    &result);
+        REQUIRE(ret.code == VSAG_SUCCESS);
+        REQUIRE(counts[i] == result.count);
+        for (int64_t j = 0; j < result.count; ++j) {
+            REQUIRE(ids[i * topk + j] == single_ids[j]);
+        }
+    }
+
+    // set bits exclude ids, unfilled slots are padded
+    auto bitset = vsag_bitset_create();
+    REQUIRE(bitset != nullptr);
+    std::vector<int64_t> excluded;
+    for (int64_t id = 0; id < num_vectors; id += 2) {
+        excluded.push_back(id);
+    }
+    ret = vsag_bitset_set(bitset, excluded.data(), excluded.size(), true);
+    REQUIRE(ret.code == VSAG_SUCCESS);
+    REQUIRE(vsag_bitset_test(bitset, 0));
+    REQUIRE_FALSE(vsag_bitset_test(bitset, 1));
+    ret = vsag_index_knn_search_batch(index,
+                                      test_case.datas.data(),
+                                      dim,
+                                      query_count,
+                                      topk,
+                                      hgraph_search_parameters,
+                                      bitset,
+                                      ids.data(),
+                                      dists.data(),
+                                      counts.data());
+    REQUIRE(ret.code == VSAG_SUCCESS);
+    for (uint64_t i = 0; i < query_count; ++i) {
+        REQUIRE(counts[i] > 0);
+        for (int64_t j = 0; j < topk; ++j) {
+            if (j < counts[i]) {
+                REQUIRE(ids[i * topk + j] % 2 == 1);
+            } else {
+                REQUIRE(ids[i * topk + j] == -1);
+                REQUIRE(std::isinf(dists[i * topk + j]));
+            }
+        }
+    }
+
+    // range search honours the per-query limit
+    ret = vsag_index_range_search_batch(index,
+                                        test_case.datas.data(),
+                                        dim,
+                                        query_count,
+                                        10.0F,
+                                        topk,
+                                        hgraph_search_parameters,
+                                        bitset,
+                                        ids.data(),
+                                        dists.data(),
+                                        counts.data());
+    REQUIRE(ret.code == VSAG_SUCCESS);
+    for (uint64_t i = 0; i < query_count; ++i) {
+        REQUIRE(counts[i] <= topk);
+        for (int64_t j = 0; j < counts[i]; ++j) {
+            REQUIRE(ids[i * topk + j] % 2 == 1);
+        }
+    }
+
+    ret = vsag_index_knn_search_batch(index,
+                                      test_case.datas.data(),
+                                      dim,
+                                      query_count,
+                                      0,
+                                      hgraph_search_parameters,
+                                      nullptr,
+                                      ids.data(),
+                                      dists.data(),
+                                      counts.data());
+    REQUIRE(ret.code == VSAG_INVALID_ARGUMENT);
+
+    vsag_bitset_destroy(bitset);
+    vsag_index_destroy(index);
+}
+
+TEST_CASE("vsag_c_api async batch search", "[vsag_c_api][ut]") {
+    auto index = vsag_index_factory(index_name, index_param);
+    REQUIRE(index != nullptr);
+
+    VsagTestCase test_case;
+    Error_t ret =
+        vsag_index_build(index, test_case.datas.data(), test_case.ids.data(), dim, num_vectors);
+    REQUIRE(ret.code == VSAG_SUCCESS);
+
+    constexpr uint64_t query_count = 50;
+    int64_t topk = 10;
+    std::vector<int64_t> ids(query_count * topk);
+    std::vector<float> dists(query_count * topk);
+    std::vector<int64_t> counts(query_count);
+
+    auto bitset = vsag_bitset_create();
+    int64_t excluded = 0;
+    vsag_bitset_set(bitset, &excluded, 1, true);
+
+    struct Completion {
+        std::promise<Error_t> done;
+        std::atomic<int> calls{0};
+    } completion;
+    auto callback = [](Error_t error, void* user_data) {
+        auto* completion = static_cast<Completion*>(user_data);
+        completion->calls.fetch_add(1);
+        completion->done.set_value(error);
+    };
+    ret = vsag_index_knn_search_batch_async(index,
+                                            test_case.datas.data(),
+                                            dim,
+                                            query_count,
+                                            topk,
+                                            hgraph_search_parameters,
+                                            bitset,
+                                            ids.data(),
+                                            dists.data(),
+                                            counts.data(),
+                                            callback,
+                                            &completion);
+    REQUIRE(ret.code == VSAG_SUCCESS);
+    // the search keeps its own references to the index and the bitset
+    vsag_bitset_destroy(bitset);
+    vsag_index_destroy(index);
+
+    auto error = completion.done.get_future().get();
+    REQUIRE(error.code == VSAG_SUCCESS);
+    REQUIRE(completion.calls.load() == 1);
+    for (uint64_t i = 1; i < query_count; ++i) {
+        REQUIRE(counts[i] > 0);
+        REQUIRE(ids[i * topk] == static_cast<int64_t>(i));
+        for (int64_t j = 0; j < counts[i]; ++j) {
+            REQUIRE(ids[i * topk + j] != 0);
+        }
+    }
+
+    ret = vsag_index_knn_search_batch_async(nullptr,
+                                            test_case.datas.data(),
+                                            dim,
+                                            query_count,
+                                            topk,
+                                            hgraph_search_parameters,
+                                            nullptr,
+                                            ids.data(),
+                                            dists.data(),
+                                            counts.data(),
+                                            callback,
+                                            &completion);
+    REQUIRE(ret.code != VSAG_SUCCESS);
+}
+
 TEST_CASE("vsag_c_api clone and export model", "[vsag_c_api][ut]") {
     auto index = vsag_index_factory(index_name, index_param);
     REQUIRE(index != nullptr);
@@ -14,6 +14,7 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include "functest.h"
 #include "vsag/vsag.h"
 
 TEST_CASE("Engine uses the supported index registry", "[ft][engine]") {
@@ -80,3 +81,97 @@ TEST_CASE("Engine uses the supported index registry", "[ft][engine]") {
 
     engine.Shutdown();
 }
+
+TEST_CASE("Engine enforces the resource memory budget", "[ft][engine]") {
+    constexpr int64_t dim = 64;
+    // the default 128MB blocks would dwarf the small budgets below
+    const auto origin_block_size = vsag::Options::Instance().block_size_limit();
+    vsag::Options::Instance().set_block_size_limit(128ULL * 1024);
+    const auto* hgraph_param = R"(
+    {
+        "dtype": "float32",
+        "metric_type": "l2",
+        "dim": 64,
+        "index_param": {
+            "base_quantization_type": "fp32",
+            "max_degree": 16,
+            "ef_construction": 50
+        }
+    }
+    )";
+    auto make_base = [](int64_t count, std::vector<int64_t>& ids, std::vector<float>& vectors) {
+        std::tie(ids, vectors) = fixtures::generate_ids_and_vectors(count, dim);
+        return vsag::Dataset::Make()
+            ->NumElements(count)
+            ->Dim(dim)
+            ->Ids(ids.data())
+            ->Float32Vectors(vectors.data())
+            ->Owner(false);
+    };
+
+    SECTION("usage is accounted per category") {
+        vsag::Resource resource(vsag::Engine::CreateDefaultAllocator(), nullptr);
+        resource.SetMemoryLimit(0);
+        vsag::Engine engine(&resource);
+        auto index = engine.CreateIndex("hgraph", hgraph_param).value();
+        std::vector<int64_t> ids;
+        std::vector<float> vectors;
+        REQUIRE(index->Build(make_base(500, ids, vectors)).has_value());
+
+        auto usage = resource.GetMemoryUsageDetail();
+        REQUIRE(usage["index_count"] == 1);
+        REQUIRE(usage["index"] > 0);
+        REQUIRE(usage["visited_list"] > 0);
+        REQUIRE(usage["total"] >= usage["index"] + usage["visited_list"]);
+
+        auto detail = index->GetMemoryUsageDetail();
+        REQUIRE(detail["accounted_total"] == usage["total"]);
+        REQUIRE(detail["estimated"] > 0);
+
+        auto query = vsag::Dataset::Make()
+                         ->NumElements(1)
+                         ->Dim(dim)
+                         ->Float32Vectors(vectors.data())
+                         ->Owner(false);
+        REQUIRE(index->KnnSearch(query, 10, R"({"hgraph": {"ef_search": 50}})").has_value());
+
+        index = nullptr;
+        REQUIRE(resource.GetMemoryUsageDetail()["total"] == 0);
+        engine.Shutdown();
+    }
+
+    SECTION("build beyond the budget fails gracefully") {
+        vsag::Resource resource(vsag::Engine::CreateDefaultAllocator(), nullptr);
+        resource.SetMemoryLimit(2ULL * 1024 * 1024);
+        vsag::Engine engine(&resource);
+        auto index = engine.CreateIndex("hgraph", hgraph_param).value();
+        std::vector<int64_t> ids;
+        std::vector<float> vectors;
+        auto result = index->Build(make_base(20000, ids, vectors));
+        REQUIRE_FALSE(result.has_value());
+        REQUIRE(result.error().type == vsag::ErrorType::NO_ENOUGH_MEMORY);
+        REQUIRE(resource.GetMemoryUsageDetail()["total"] <= resource.GetMemoryLimit());
+
+        // the index is still usable within the budget
+        REQUIRE(index->Build(make_base(200, ids, vectors)).has_value());
+        index = nullptr;
+        engine.Shutdown();
+    }
+
+    SECTION("per index limit") {
+        vsag::Resource resource(vsag::Engine::CreateDefaultAllocator(), nullptr);
+        vsag::Engine engine(&resource);
+        auto limited_param = std::string(hgraph_param);
+        limited_param.insert(limited_param.find('{') + 1, R"("memory_limit": 1048576,)");
+        auto index = engine.CreateIndex("hgraph", limited_param).value();
+        std::vector<int64_t> ids;
+        std::vector<float> vectors;
+        auto result = index->Build(make_base(20000, ids, vectors));
+        REQUIRE_FALSE(result.has_value());
+        REQUIRE(result.error().type == vsag::ErrorType::NO_ENOUGH_MEMORY);
+        index = nullptr;
+        engine.Shutdown();
+    }
+
+    vsag::Options::Instance().set_block_size_limit(origin_block_size);
+}
@@ -141,6 +141,8 @@ const std::vector<std::pair<std::string, float>> HGraphTestIndex::all_test_cases
     {"sq8_uniform,fp32", 0.98},
     {"sq8_uniform,fp16", 0.98},
     {"sq8_uniform,bf16", 0.98},
+    {"fp8_e4m3", 0.85},
+    {"sq4_uniform,fp8_e4m3", 0.85},
 };
 
 constexpr static const char* search_param_tmp = R"(
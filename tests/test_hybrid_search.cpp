@@ -0,0 +1,346 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <catch2/catch_test_macros.hpp>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include "json_types.h"
+#include "vsag/vsag.h"
+
+using namespace vsag;
+
+namespace {
+
+// answers every query with the same distance table, enough to check the fusion arithmetic
+class TableIndex : public Index {
+public:
+    explicit TableIndex(std::map<int64_t, float> distances) : distances_(std::move(distances)) {
+    }
+
+    tl::expected<DatasetPtr, Error>
+    SearchWithRequest(const SearchRequest& request) const override {
+        searched_on_ = std::this_thread::get_id();
+        std::vector<std::pair<float, int64_t>> ranked;
+        for (const auto& [label, distance] : distances_) {
+            ranked.emplace_back(distance, label);
+        }
+        std::sort(ranked.begin(), ranked.end());
+        auto count = std::min<int64_t>(request.topk_, static_cast<int64_t>(ranked.size()));
+        auto* ids = new int64_t[count];
+        auto* dists = new float[count];
+        for (int64_t i = 0; i < count; ++i) {
+            ids[i] = ranked[i].second;
+            dists[i] = ranked[i].first;
+        }
+        return Dataset::Make()
+            ->NumElements(1)
+            ->Dim(count)
+            ->Ids(ids)
+            ->Distances(dists)
+            ->Statistics(R"({"dist_cmp": 1})")
+            ->Owner(true);
+    }
+
+    tl::expected<DatasetPtr, Error>
+    CalDistanceById(const DatasetPtr& query,
+                    const int64_t* ids,
+                    int64_t count,
+                    bool calculate_precise_distance = true,
+                    int64_t topk = -1) const override {
+        auto* dists = new float[count];
+        for (int64_t i = 0; i < count; ++i) {
+            auto iter = distances_.find(ids[i]);
+            dists[i] = iter == distances_.end() ? -1.0F : iter->second;
+        }
+        return Dataset::Make()->NumElements(1)->Dim(count)->Distances(dists)->Owner(true);
+    }
+
+    bool
+    CheckIdExist(int64_t id) const override {
+        return distances_.count(id) > 0;
+    }
+
+    tl::expected<std::vector<int64_t>, Error>
+    Build(const DatasetPtr& base) override {
+        return {};
+    }
+
+    tl::expected<DatasetPtr, Error>
+    KnnSearch(const DatasetPtr& query,
+              int64_t k,
+              const std::string& parameters,
+              BitsetPtr invalid = nullptr) const override {
+        return {};
+    }
+
+    tl::expected<DatasetPtr, Error>
+    KnnSearch(const DatasetPtr& query,
+              int64_t k,
+              const std::string& parameters,
+              const std::function<bool(int64_t)>& filter) const override {
+        return {};
+    }
+
+    tl::expected<DatasetPtr, Error>
+    RangeSearch(const DatasetPtr& query,
+                float radius,
+                const std::string& parameters,
+                int64_t limited_size = -1) const override {
+        return {};
+    }
+
+    tl::expected<DatasetPtr, Error>
+    RangeSearch(const DatasetPtr& query,
+                float radius,
+                const std::string& parameters,
+                BitsetPtr invalid,
+                int64_t limited_size = -1) const override {
+        return {};
+    }
+
+    tl::expected<DatasetPtr, Error>
+    RangeSearch(const DatasetPtr& query,
+                float radius,
+                const std::string& parameters,
+                const std::function<bool(int64_t)>& filter,
+                int64_t limited_size = -1) const override {
+        return {};
+    }
+
+    tl::expected<BinarySet, Error>
+    Serialize() const override {
+        return {};
+    }
+
+    tl::expected<void, Error>
+    Deserialize(const BinarySet& binary_set) override {
+        return {};
+    }
+
+    tl::expected<void, Error>
+    Deserialize(const ReaderSet& reader_set) override {
+        return {};
+    }
+
+    int64_t
+    GetNumElements() const override {
+        return static_cast<int64_t>(distances_.size());
+    }
+
+    uint64_t
+    GetMemoryUsage() const override {
+        return 0;
+    }
+
+    std::map<int64_t, float> distances_;
+    mutable std::thread::id searched_on_;
+};
+
+class InlineThreadPool : public ThreadPool {
+public:
+    void
+    WaitUntilEmpty() override {
+    }
+
+    void
+    SetQueueSizeLimit(uint64_t) override {
+    }
+
+    void
+    SetPoolSize(uint64_t) override {
+    }
+
+    std::future<void>
+    Enqueue(std::function<void(void)> task) override {
+        ++enqueued_;
+        // the task finishes on its own thread before the caller moves on to the dense side
+        auto future = std::async(std::launch::async, std::move(task));
+        future.wait();
+        return future;
+    }
+
+    int enqueued_{0};
+};
+
+// stands in for a saturated pool, or a size-1 pool whose only worker is the caller
+class StalledThreadPool : public ThreadPool {
+public:
+    void
+    WaitUntilEmpty() override {
+        for (auto& task : tasks_) {
+            task();
+        }
+        tasks_.clear();
+    }
+
+    void
+    SetQueueSizeLimit(uint64_t) override {
+    }
+
+    void
+    SetPoolSize(uint64_t) override {
+    }
+
+    std::future<void>
+    Enqueue(std::function<void(void)> task) override {
+        tasks_.push_back(std::move(task));
+        return {};
+    }
+
+    std::vector<std::function<void(void)>> tasks_;
+};
+
+HybridSearchRequest
+make_request(int64_t side_topk, int64_t topk) {
+    static float dense_query[2] = {0.0F, 0.0F};
+    static uint32_t sparse_ids[1] = {0};
+    static float sparse_vals[1] = {1.0F};
+    static SparseVector sparse_query{1, sparse_ids, sparse_vals};
+
+    HybridSearchRequest request;
+    request.dense_request_.query_ =
+        Dataset::Make()->NumElements(1)->Dim(2)->Float32Vectors(dense_query)->Owner(false);
+    request.dense_request_.topk_ = side_topk;
+    request.sparse_request_.query_ =
+        Dataset::Make()->NumElements(1)->SparseVectors(&sparse_query)->Owner(false);
+    request.sparse_request_.topk_ = side_topk;
+    request.topk_ = topk;
+    return request;
+}
+
+std::vector<int64_t>
+result_ids(const DatasetPtr& result) {
+    return {result->GetIds(), result->GetIds() + result->GetDim()};
+}
+
+}  // namespace
+
+TEST_CASE("Hybrid search fuses dense and sparse results", "[ft][hybrid_search]") {
+    // label 3 is only known to the dense side, label 4 only to the sparse side
+    auto dense = std::make_shared<TableIndex>(
+        std::map<int64_t, float>{{1, 1.0F}, {2, 2.0F}, {3, 3.0F}, {5, 9.0F}});
+    auto sparse = std::make_shared<TableIndex>(
+        std::map<int64_t, float>{{1, -0.5F}, {2, -3.0F}, {4, -2.0F}, {5, -0.25F}});
+    IndexPtr dense_index = dense;
+    IndexPtr sparse_index = sparse;
+
+    SECTION("weighted sum without rerank") {
+        auto request = make_request(3, 4);
+        request.enable_rerank_ = false;
+        auto result = HybridSearch(dense_index, sparse_index, request);
+        REQUIRE(result.has_value());
+        // dense normalized: 1 -> 1, 2 -> 0.5, 3 -> 0; sparse: 2 -> 1, 4 -> 0.6, 1 -> 0
+        REQUIRE(result_ids(result.value()) == std::vector<int64_t>{2, 1, 4, 3});
+        REQUIRE(result.value()->GetDistances()[0] == -0.75F);
+        REQUIRE(result.value()->GetDistances()[1] == -0.5F);
+
+        auto statistics = JsonType::Parse(result.value()->GetStatistics());
+        REQUIRE(statistics["fused_candidate_count"].GetUint64() == 4);
+        REQUIRE(statistics["dense"]["dist_cmp"].GetUint64() == 1);
+        REQUIRE(statistics["sparse"]["dist_cmp"].GetUint64() == 1);
+    }
+
+    SECTION("reciprocal rank fusion without rerank") {
+        auto request = make_request(3, 2);
+        request.enable_rerank_ = false;
+        request.fusion_type_ = HybridFusionType::RRF;
+        request.rrf_k_ = 1;
+        request.sparse_weight_ = 1.0F;
+        auto result = HybridSearch(dense_index, sparse_index, request);
+        REQUIRE(result.has_value());
+        // label 2: 0.5 / 3 + 1 / 2 beats label 1: 0.5 / 2 + 1 / 4 and label 4: 1 / 3
+        REQUIRE(result_ids(result.value()) == std::vector<int64_t>{2, 1});
+    }
+
+    SECTION("rerank with exact distances drops labels missing on one side") {
+        auto request = make_request(3, 10);
+        request.dense_weight_ = 1.0F;
+        request.sparse_weight_ = 2.0F;
+        auto result = HybridSearch(dense_index, sparse_index, request);
+        REQUIRE(result.has_value());
+        // labels 3 and 4 exist on one side only; normalized over {1, 2}:
+        // 2: 1 * 0 + 2 * 1 = 2, 1: 1 * 1 + 2 * 0 = 1
+        REQUIRE(result_ids(result.value()) == std::vector<int64_t>{2, 1});
+        REQUIRE(result.value()->GetDistances()[0] == -2.0F);
+        REQUIRE(result.value()->GetDistances()[1] == -1.0F);
+    }
+
+    SECTION("the sparse side runs on the thread pool") {
+        InlineThreadPool pool;
+        auto request = make_request(3, 2);
+        request.sparse_weight_ = 1.0F;
+        request.thread_pool_ = &pool;
+        auto result = HybridSearch(dense_index, sparse_index, request);
+        REQUIRE(result.has_value());
+        REQUIRE(pool.enqueued_ == 1);
+        REQUIRE(dense->searched_on_ == std::this_thread::get_id());
+        REQUIRE(sparse->searched_on_ != std::this_thread::get_id());
+        REQUIRE(result_ids(result.value()) == std::vector<int64_t>{2, 1});
+    }
+
+    SECTION("the caller runs the sparse side when the pool does not start it") {
+        StalledThreadPool pool;
+        auto request = make_request(3, 2);
+        request.sparse_weight_ = 1.0F;
+        request.thread_pool_ = &pool;
+        auto result = HybridSearch(dense_index, sparse_index, request);
+        REQUIRE(result.has_value());
+        REQUIRE(pool.tasks_.size() == 1);
+        REQUIRE(sparse->searched_on_ == std::this_thread::get_id());
+        REQUIRE(result_ids(result.value()) == std::vector<int64_t>{2, 1});
+        // the late task finds the work claimed and leaves the finished search alone
+        pool.WaitUntilEmpty();
+    }
+
+    SECTION("a -1 distance is not mistaken for a missing label") {
+        IndexPtr inner_product = std::make_shared<TableIndex>(
+            std::map<int64_t, float>{{1, -1.0F}, {2, -0.5F}, {3, -0.25F}});
+        auto request = make_request(3, 10);
+        auto result = HybridSearch(dense_index, inner_product, request);
+        REQUIRE(result.has_value());
+        REQUIRE(result_ids(result.value()) == std::vector<int64_t>{1, 2, 3});
+    }
+
+    SECTION("invalid requests") {
+        auto request = make_request(3, 0);
+        REQUIRE_FALSE(HybridSearch(dense_index, sparse_index, request).has_value());
+        request.topk_ = 2;
+        request.dense_weight_ = -1.0F;
+        REQUIRE_FALSE(HybridSearch(dense_index, sparse_index, request).has_value());
+        request.dense_weight_ = 0.5F;
+        REQUIRE_FALSE(HybridSearch(dense_index, nullptr, request).has_value());
+        request.sparse_request_.mode_ = SearchMode::RANGE_SEARCH;
+        REQUIRE_FALSE(HybridSearch(dense_index, sparse_index, request).has_value());
+    }
+}
+
+TEST_CASE("Hybrid rerank normalizes metrics of different scales", "[ft][hybrid_search]") {
+    // L2 distances in the tens of thousands next to inner products around 0.01
+    IndexPtr dense_index = std::make_shared<TableIndex>(
+        std::map<int64_t, float>{{1, 10000.0F}, {2, 20000.0F}, {3, 30000.0F}});
+    IndexPtr sparse_index = std::make_shared<TableIndex>(
+        std::map<int64_t, float>{{1, -0.03F}, {2, -0.01F}, {3, -0.02F}});
+
+    auto request = make_request(3, 3);
+    request.dense_weight_ = 0.4F;
+    request.sparse_weight_ = 0.6F;
+    auto result = HybridSearch(dense_index, sparse_index, request);
+    REQUIRE(result.has_value());
+    // raw sums would follow the dense order 1, 2, 3; normalized,
+    // 1: 0.4 + 0.6 = 1, 3: 0 + 0.6 * 0.5 = 0.3, 2: 0.4 * 0.5 + 0 = 0.2
+    REQUIRE(result_ids(result.value()) == std::vector<int64_t>{1, 3, 2});
+}
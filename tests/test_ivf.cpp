@@ -19,6 +19,7 @@
 #include <filesystem>
 #include <limits>
 #include <nlohmann/json.hpp>
+#include <numeric>
 #include <sstream>
 #include <stdexcept>
 
@@ -99,6 +100,7 @@ const std::vector<std::pair<std::string, float>> IVFTestIndex::all_test_cases =
     {"sq8_uniform,fp32", 0.89},
     {"pq,fp32", 0.82},
     {"pqfs,fp16", 0.82},
+    {"fp8_e4m3", 0.80},
 };
 
 IVFResourcePtr
@@ -3339,3 +3341,84 @@ TEST_CASE("IVF Batch Search Parallel", "[ft][ivf][pr]") {
         REQUIRE(serial_dists[i] == parallel_dists[i]);
     }
 }
+
+TEST_CASE("IVF Rebalances Skewed Buckets After Add", "[ft][ivf][pr]") {
+    constexpr int64_t dim = 16;
+    constexpr int64_t base_count = 1000;
+    constexpr int64_t add_batch = 500;
+    constexpr int64_t add_batches = 4;
+    constexpr int64_t buckets_count = 10;
+
+    auto param = fmt::format(R"({{
+        "dtype": "float32",
+        "metric_type": "l2",
+        "dim": {},
+        "index_param": {{
+            "buckets_count": {},
+            "base_quantization_type": "fp32",
+            "rebalance_split_ratio": 2.0,
+            "rebalance_merge_ratio": 0.5,
+            "thread_count": 4
+        }}
+    }})",
+                             dim,
+                             buckets_count);
+    auto index = vsag::Factory::CreateIndex("ivf", param);
+    REQUIRE(index.has_value());
+
+    auto base_vectors = fixtures::generate_vectors(base_count, dim);
+    std::vector<int64_t> base_ids(base_count);
+    std::iota(base_ids.begin(), base_ids.end(), 0);
+    auto base = vsag::Dataset::Make();
+    base->Dim(dim)
+        ->NumElements(base_count)
+        ->Ids(base_ids.data())
+        ->Float32Vectors(base_vectors.data())
+        ->Owner(false);
+    REQUIRE(index.value()->Build(base).has_value());
+
+    // every added vector lies close to base vector 0, so its bucket outgrows all others
+    constexpr int64_t add_count = add_batch * add_batches;
+    auto add_vectors = fixtures::generate_vectors(add_count, dim, false, 7);
+    for (int64_t i = 0; i < add_count; ++i) {
+        for (int64_t d = 0; d < dim; ++d) {
+            add_vectors[i * dim + d] = base_vectors[d] + 0.05F * (add_vectors[i * dim + d] - 0.5F);
+        }
+    }
+    std::vector<int64_t> add_ids(add_count);
+    std::iota(add_ids.begin(), add_ids.end(), base_count);
+    for (int64_t batch = 0; batch < add_batches; ++batch) {
+        auto added = vsag::Dataset::Make();
+        added->Dim(dim)
+            ->NumElements(add_batch)
+            ->Ids(add_ids.data() + batch * add_batch)
+            ->Float32Vectors(add_vectors.data() + batch * add_batch * dim)
+            ->Owner(false);
+        REQUIRE(index.value()->Add(added).has_value());
+    }
+    REQUIRE(index.value()->GetNumElements() == base_count + add_count);
+
+    auto stats = vsag::JsonType::Parse(index.value()->GetStats());
+    INFO(stats.Dump());
+    REQUIRE(stats["rebalance_split_count"].GetUint64() > 0);
+    REQUIRE(stats["rebalance_merge_count"].GetUint64() > 0);
+    auto histogram = stats["bucket_size_histogram"].GetVector();
+    REQUIRE(std::accumulate(histogram.begin(), histogram.end(), 0) == buckets_count);
+
+    auto search_param = R"({"ivf": {"scan_buckets_count": 3}})";
+    int64_t found = 0;
+    for (int64_t i = 0; i < add_count; i += 7) {
+        auto query = vsag::Dataset::Make();
+        query->Dim(dim)->NumElements(1)->Float32Vectors(add_vectors.data() + i * dim)->Owner(false);
+        auto result = index.value()->KnnSearch(query, 1, search_param);
+        REQUIRE(result.has_value());
+        found += static_cast<int64_t>(result.value()->GetIds()[0] == add_ids[i]);
+    }
+    REQUIRE(found * 7 >= add_count * 9 / 10);
+
+    auto query = vsag::Dataset::Make();
+    query->Dim(dim)->NumElements(1)->Float32Vectors(base_vectors.data() + dim)->Owner(false);
+    auto result = index.value()->KnnSearch(query, 1, R"({"ivf": {"scan_buckets_count": 10}})");
+    REQUIRE(result.has_value());
+    REQUIRE(result.value()->GetIds()[0] == base_ids[1]);
+}
@@ -1838,7 +1838,156 @@ TEST_CASE("Multi-Hierarchy: Search without hierarchies param in multi-mode error
     REQUIRE_FALSE(result.has_value());
 }
 
-TEST_CASE("Multi-Hierarchy: Multi-hierarchy union/intersection rejected",
+TEST_CASE("Multi-Hierarchy: Union and intersection across hierarchies",
+          "[ft][pyramid][multi_hierarchy]") {
+    MultiHierarchyFixture f;
+    auto graph_type = GENERATE("nsw", "odescent");
+    auto index = vsag::Factory::CreateIndex("pyramid", f.build_param(graph_type));
+    REQUIRE(index.has_value());
+    REQUIRE(index.value()->Build(f.make_base()).has_value());
+
+    auto search_ids = [&](const std::string& op) {
+        auto* qv = new float[4]{1.0f, 0.0f, 0.0f, 0.0f};
+        auto* qp_s = new std::string[1]{"www/news"};
+        auto* qp_c = new std::string[1]{"tech"};
+        auto query = vsag::Dataset::Make();
+        query->NumElements(1)
+            ->Dim(4)
+            ->Float32Vectors(qv)
+            ->Paths("site", qp_s)
+            ->Paths("cat", qp_c)
+            ->Owner(true);
+        std::string sp = R"({"pyramid": {"ef_search": 100, "hierarchies": ["site", "cat"], )"
+                         R"("hierarchy_op": ")" +
+                         op + R"("}})";
+        auto result = index.value()->KnnSearch(query, 4, sp);
+        REQUIRE(result.has_value());
+        auto* rids = result.value()->GetIds();
+        auto cnt = result.value()->GetDim();
+        auto range_result = index.value()->RangeSearch(query, 10.0f, sp);
+        REQUIRE(range_result.has_value());
+        REQUIRE(range_result.value()->GetDim() == cnt);
+        return std::vector<int64_t>(rids, rids + cnt);
+    };
+
+    // site "www/news" -> {100, 102}, cat "tech" -> {100, 101}
+    auto union_ids = search_ids("union");
+    REQUIRE(union_ids.size() == 3);
+    REQUIRE(std::set<int64_t>(union_ids.begin(), union_ids.end()) ==
+            std::set<int64_t>{100, 101, 102});
+    REQUIRE(union_ids[0] == 100);
+
+    auto intersection_ids = search_ids("intersection");
+    REQUIRE(intersection_ids == std::vector<int64_t>{100});
+
+    // a union range search keeps every hit within the radius even when the merged hits outnumber
+    // ef_search
+    auto* qv = new float[4]{1.0f, 0.0f, 0.0f, 0.0f};
+    auto* qp_s = new std::string[1]{"www/news"};
+    auto* qp_c = new std::string[1]{"tech"};
+    auto query = vsag::Dataset::Make();
+    query->NumElements(1)
+        ->Dim(4)
+        ->Float32Vectors(qv)
+        ->Paths("site", qp_s)
+        ->Paths("cat", qp_c)
+        ->Owner(true);
+    std::string small_ef =
+        R"({"pyramid": {"ef_search": 2, "hierarchies": ["site", "cat"], "hierarchy_op": "union"}})";
+    auto range_result = index.value()->RangeSearch(query, 10.0f, small_ef);
+    REQUIRE(range_result.has_value());
+    REQUIRE(range_result.value()->GetDim() == 3);
+}
+
+TEST_CASE("Multi-Hierarchy: Intersection across graph nodes", "[ft][pyramid][multi_hierarchy]") {
+    // every leaf path holds far more than index_min_size vectors, so its node is promoted to a
+    // graph and no longer keeps a flat id list
+    constexpr int64_t num = 400;
+    constexpr int64_t dim = 4;
+    constexpr int64_t topk = 10;
+    auto graph_type = GENERATE("nsw", "odescent");
+    auto param = fmt::format(R"({{
+        "dtype": "float32", "metric_type": "l2", "dim": {},
+        "index_param": {{
+            "max_degree": 16, "alpha": 1.2, "graph_type": "{}",
+            "graph_iter_turn": 15, "neighbor_sample_rate": 0.2,
+            "base_quantization_type": "fp32", "use_reorder": false,
+            "index_min_size": 16, "support_duplicate": false,
+            "hierarchies": [
+                {{"name": "site", "no_build_levels": [0]}},
+                {{"name": "cat", "no_build_levels": [0, 1]}}
+            ]
+        }}
+    }})",
+                             dim,
+                             graph_type);
+    auto index = vsag::Factory::CreateIndex("pyramid", param);
+    REQUIRE(index.has_value());
+
+    auto vectors = fixtures::generate_vectors(num, dim, false, 17);
+    auto* rv = new float[num * dim];
+    auto* ri = new int64_t[num];
+    auto* rs = new std::string[num];
+    auto* rc = new std::string[num];
+    std::copy(vectors.begin(), vectors.end(), rv);
+    for (int64_t i = 0; i < num; ++i) {
+        ri[i] = i;
+        rs[i] = i % 2 == 0 ? "www/news" : "www/sports";
+        rc[i] = (i / 2) % 2 == 0 ? "tech/ai" : "science/bio";
+    }
+    auto base = vsag::Dataset::Make();
+    base->NumElements(num)
+        ->Dim(dim)
+        ->Float32Vectors(rv)
+        ->Ids(ri)
+        ->Paths("site", rs)
+        ->Paths("cat", rc)
+        ->Owner(true);
+    REQUIRE(index.value()->Build(base).has_value());
+
+    // site "www/news" and cat "tech" share exactly the ids divisible by 4
+    const auto* query_vector = vectors.data() + 3 * dim;
+    std::vector<std::pair<float, int64_t>> expected;
+    for (int64_t i = 0; i < num; i += 4) {
+        float dist = 0.0F;
+        for (int64_t d = 0; d < dim; ++d) {
+            auto diff = vectors[i * dim + d] - query_vector[d];
+            dist += diff * diff;
+        }
+        expected.emplace_back(dist, i);
+    }
+    std::sort(expected.begin(), expected.end());
+    std::set<int64_t> expected_ids;
+    for (int64_t i = 0; i < topk; ++i) {
+        expected_ids.insert(expected[i].second);
+    }
+
+    auto* qv = new float[dim];
+    std::copy(query_vector, query_vector + dim, qv);
+    auto* qp_s = new std::string[1]{"www/news"};
+    auto* qp_c = new std::string[1]{"tech"};
+    auto query = vsag::Dataset::Make();
+    query->NumElements(1)
+        ->Dim(dim)
+        ->Float32Vectors(qv)
+        ->Paths("site", qp_s)
+        ->Paths("cat", qp_c)
+        ->Owner(true);
+    std::string sp =
+        R"({"pyramid": {"ef_search": 200, "hierarchies": ["site", "cat"], "hierarchy_op": "intersection"}})";
+    auto result = index.value()->KnnSearch(query, topk, sp);
+    REQUIRE(result.has_value());
+    REQUIRE(result.value()->GetDim() == topk);
+    int64_t hits = 0;
+    for (int64_t i = 0; i < topk; ++i) {
+        auto id = result.value()->GetIds()[i];
+        REQUIRE(id % 4 == 0);
+        hits += static_cast<int64_t>(expected_ids.count(id));
+    }
+    REQUIRE(hits >= topk * 8 / 10);
+}
+
+TEST_CASE("Multi-Hierarchy: Intersection requires a path for unbuilt hierarchy roots",
           "[ft][pyramid][multi_hierarchy]") {
     MultiHierarchyFixture f;
     auto index = vsag::Factory::CreateIndex("pyramid", f.build_param("nsw"));
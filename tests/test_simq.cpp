@@ -37,6 +37,8 @@
  *   1. Build + KNN search + recall@10
  *   2. Serialize / Deserialize (binary set) + recall preserved
  *   3. Parameter sweep: coarse_k in {5, 10, 20}
+ *   4. Centroid interaction pruning ahead of a small rerank_k
+ *   5. A cancelled SearchWithRequest stops before the rerank
  */
 
 #include <fmt/format.h>
@@ -562,6 +564,45 @@ TEST_CASE("SIMQ: range search", "[simq][range_search]") {
     }
 }
 
+TEST_CASE("SIMQ: cancelled search request stops before the rerank", "[simq][cancellation]") {
+    auto mode = GENERATE(vsag::SearchMode::KNN_SEARCH, vsag::SearchMode::RANGE_SEARCH);
+    auto ds = generate_dataset();
+    TempFile tmp;
+
+    auto r = vsag::Factory::CreateIndex("simq", make_build_param(tmp.path));
+    REQUIRE(r.has_value());
+    auto index = r.value();
+    REQUIRE(index->Build(ds.base_dataset).has_value());
+
+    vsag::DatasetPtr one_query = vsag::Dataset::Make();
+    one_query->NumElements(1)
+        ->Dim(SIMQ_DIM)
+        ->MultiVectors(&ds.query_mvs[0])
+        ->MultiVectorDim(SIMQ_DIM)
+        ->Owner(false);
+
+    vsag::SearchRequest request;
+    request.query_ = one_query;
+    request.topk_ = TOP_K;
+    request.radius_ = std::numeric_limits<float>::max();
+    request.params_str_ = make_search_param();
+    request.cancellation_token_ = std::make_shared<vsag::CancellationToken>();
+
+    auto result = index->SearchWithRequest(request);
+    REQUIRE(result.has_value());
+    REQUIRE(result.value()->GetDim() == TOP_K);
+    require_simq_search_stats(result.value());
+
+    request.cancellation_token_->Cancel();
+    request.mode_ = mode;
+    result = index->SearchWithRequest(request);
+    REQUIRE(result.has_value());
+    REQUIRE(result.value()->GetDim() == 0);
+    auto statistics = JsonType::Parse(result.value()->GetStatistics());
+    REQUIRE(statistics["is_cancelled"].GetBool());
+    REQUIRE(statistics["is_partial"].GetBool());
+}
+
 TEST_CASE("SIMQ: parameter sweep on coarse_k and rerank_k", "[simq][sweep]") {
     auto ds = generate_dataset();
     TempFile tmp;
@@ -611,6 +652,81 @@ TEST_CASE("SIMQ: parameter sweep on coarse_k and rerank_k", "[simq][sweep]") {
     }
 }
 
+TEST_CASE("SIMQ: centroid interaction prunes rerank candidates", "[simq][interaction]") {
+    auto ds = generate_dataset();
+    TempFile tmp_build, tmp_deser;
+
+    auto r = vsag::Factory::CreateIndex("simq", make_build_param(tmp_build.path));
+    REQUIRE(r.has_value());
+    auto index = r.value();
+    REQUIRE(index->Build(ds.base_dataset).has_value());
+
+    // The deserialized index rebuilds the per-doc token ranges used by the interaction stage
+    auto serial = index->Serialize();
+    REQUIRE(serial.has_value());
+    auto r2 = vsag::Factory::CreateIndex("simq", make_build_param(tmp_deser.path));
+    REQUIRE(r2.has_value());
+    auto index2 = r2.value();
+    REQUIRE(index2->Deserialize(serial.value()).has_value());
+
+    constexpr int64_t rerank_k = 30;
+    constexpr int64_t interaction_k = 1000;
+    auto coarse_only_param = make_search_param(10, rerank_k);
+    auto interaction_param = fmt::format(
+        R"({{"simq": {{"coarse_k": 10, "rerank_k": {}, "centroid_interaction_k": {}}}}})",
+        rerank_k,
+        interaction_k);
+
+    float recall_coarse_only = 0.0f;
+    float recall_interaction = 0.0f;
+    for (uint64_t q = 0; q < QUERY_DOCS; ++q) {
+        vsag::DatasetPtr one_query = vsag::Dataset::Make();
+        one_query->NumElements(1)
+            ->Dim(SIMQ_DIM)
+            ->MultiVectors(&ds.query_mvs[q])
+            ->MultiVectorDim(SIMQ_DIM)
+            ->Owner(false);
+
+        auto coarse_only = index->KnnSearch(one_query, TOP_K, coarse_only_param);
+        REQUIRE(coarse_only.has_value());
+        auto coarse_only_stats = JsonType::Parse(coarse_only.value()->GetStatistics());
+        REQUIRE(coarse_only_stats["simq_interaction_candidate_count"].GetUint64() == 0);
+
+        auto interaction = index->KnnSearch(one_query, TOP_K, interaction_param);
+        REQUIRE(interaction.has_value());
+        require_simq_search_stats(interaction.value());
+        auto stats = get_simq_search_stats(interaction.value());
+        auto statistics = JsonType::Parse(interaction.value()->GetStatistics());
+        auto interaction_count = statistics["simq_interaction_candidate_count"].GetUint64();
+        if (stats.coarse_candidate_count > static_cast<uint64_t>(rerank_k)) {
+            REQUIRE(interaction_count ==
+                    std::min<uint64_t>(stats.coarse_candidate_count, interaction_k));
+        }
+        REQUIRE(stats.rerank_candidate_count <= static_cast<uint64_t>(rerank_k));
+
+        auto deserialized = index2->KnnSearch(one_query, TOP_K, interaction_param);
+        REQUIRE(deserialized.has_value());
+        REQUIRE(deserialized.value()->GetDim() == interaction.value()->GetDim());
+        for (int64_t i = 0; i < interaction.value()->GetDim(); ++i) {
+            REQUIRE(deserialized.value()->GetIds()[i] == interaction.value()->GetIds()[i]);
+        }
+
+        recall_coarse_only +=
+            recall_at_k(coarse_only.value()->GetIds(), TOP_K, ds.gt_ids[q].data(), TOP_K);
+        recall_interaction +=
+            recall_at_k(interaction.value()->GetIds(), TOP_K, ds.gt_ids[q].data(), TOP_K);
+    }
+    recall_coarse_only /= static_cast<float>(QUERY_DOCS);
+    recall_interaction /= static_cast<float>(QUERY_DOCS);
+
+    std::cout << "\n[SIMQ Interaction] rerank_k=" << rerank_k
+              << "  coarse-only recall=" << recall_coarse_only
+              << "  centroid-interaction recall=" << recall_interaction << "\n";
+
+    // Pruning by centroid MaxSim should keep better candidates than the summed coarse scores
+    REQUIRE(recall_interaction >= recall_coarse_only - 0.05f);
+}
+
 TEST_CASE("SIMQ: incremental Add triggers split and preserves recall", "[simq][add]") {
     // Build with a very small max_cluster_size so Add() triggers splits.
     // Use only half the base docs for Build, then Add the rest.
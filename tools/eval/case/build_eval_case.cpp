@@ -22,6 +22,7 @@
 
 #include "../monitor/duration_monitor.h"
 #include "../monitor/memory_peak_monitor.h"
+#include "../monitor/perf_counter_monitor.h"
 #include "vsag_exception.h"
 
 namespace vsag::eval {
@@ -44,6 +45,12 @@ BuildEvalCase::init_monitors() {
     }
     auto duration_monitor = std::make_shared<DurationMonitor>();
     this->monitors_.emplace_back(std::move(duration_monitor));
+    if (config_.enable_perf_counters) {
+        auto perf_counter_monitor = std::make_shared<PerfCounterMonitor>("build");
+        perf_counter_monitor->SetOperationCount(
+            static_cast<uint64_t>(this->dataset_ptr_->GetNumberOfBase()));
+        this->monitors_.emplace_back(std::move(perf_counter_monitor));
+    }
 }
 
 JsonType
@@ -20,6 +20,7 @@
 
 #include "./build_eval_case.h"
 #include "./build_search_eval_case.h"
+#include "./mixed_eval_case.h"
 #include "./search_eval_case.h"
 #include "vsag/factory.h"
 #include "vsag/options.h"
@@ -67,6 +68,10 @@ EvalCase::MakeInstance(const EvalConfig& config, std::string type, const EvalDat
         return std::make_shared<BuildSearchEvalCase>(
             dataset_path, index_path, index.value(), config, dataset);
     }
+    if (type == "mixed") {
+        return std::make_shared<MixedEvalCase>(
+            dataset_path, index_path, index.value(), config, dataset);
+    }
     return nullptr;
 }
 }  // namespace vsag::eval
@@ -0,0 +1,418 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./mixed_eval_case.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "../monitor/latency_monitor.h"
+#include "search_timing.h"
+#include "typing.h"
+
+namespace vsag::eval {
+
+namespace {
+
+constexpr const char* kOpNames[] = {"insert", "delete", "update", "search"};
+
+Monitor::JsonType
+latency_result(std::vector<double> latency_ms, uint64_t failed_count, double wall_time_s) {
+    LatencyMonitor monitor;
+    monitor.SetMetrics("qps");
+    monitor.SetMetrics("avg_latency");
+    monitor.SetMetrics("percent_latency");
+    monitor.SetMetrics("latency_histogram");
+    monitor.Start();
+    auto success_count = static_cast<uint64_t>(latency_ms.size());
+    monitor.SetTimingBatch(LatencyTimingBatch{std::move(latency_ms), success_count, wall_time_s});
+    monitor.Stop();
+    auto result = monitor.GetResult();
+    result.erase("measurement_method");
+    result["failed_count"] = failed_count;
+    return result;
+}
+
+}  // namespace
+
+void
+MixedEvalCase::OpRecorder::Record(double latency, bool success) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (success) {
+        latency_ms.push_back(latency);
+    } else {
+        ++failed_count;
+    }
+}
+
+std::pair<std::vector<double>, uint64_t>
+MixedEvalCase::OpRecorder::Drain() {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto drained = std::make_pair(std::move(latency_ms), failed_count);
+    latency_ms.clear();
+    failed_count = 0;
+    return drained;
+}
+
+MixedEvalCase::MixedEvalCase(const std::string& dataset_path,
+                             const std::string& index_path,
+                             vsag::IndexPtr index,
+                             EvalConfig config,
+                             EvalDatasetPtr dataset)
+    : EvalCase(dataset_path, index_path, std::move(index), std::move(dataset)),
+      config_(std::move(config)),
+      workload_(config_.mixed_workload),
+      write_pacer_({workload_.insert_rate, workload_.delete_rate, workload_.update_rate}),
+      search_pacer_({workload_.search_qps}) {
+    if (this->dataset_ptr_->GetVectorType() != DENSE_VECTORS) {
+        throw std::invalid_argument("mixed workload supports dense vectors only");
+    }
+    if (not(workload_.initial_ratio > 0.0 and workload_.initial_ratio <= 1.0)) {
+        throw std::invalid_argument("mixed_workload.initial_ratio must be in (0, 1]");
+    }
+    if (not(workload_.duration_s > 0.0 and workload_.report_interval_s > 0.0)) {
+        throw std::invalid_argument(
+            "mixed_workload.duration_s and report_interval_s must be positive");
+    }
+    if (workload_.remove_mode == "mark") {
+        remove_mode_ = vsag::RemoveMode::MARK_REMOVE;
+    } else if (workload_.remove_mode == "force") {
+        remove_mode_ = vsag::RemoveMode::FORCE_REMOVE;
+    } else {
+        throw std::invalid_argument("mixed_workload.remove_mode must be mark or force");
+    }
+    auto base_count = this->dataset_ptr_->GetNumberOfBase();
+    initial_count_ = std::max<int64_t>(
+        1, static_cast<int64_t>(workload_.initial_ratio * static_cast<double>(base_count)));
+    if (config_.enable_memory) {
+        memory_monitor_ = std::make_shared<MemoryPeakMonitor>("mixed");
+    }
+}
+
+vsag::DatasetPtr
+MixedEvalCase::make_base(const int64_t* id, int64_t row) const {
+    auto base = vsag::Dataset::Make();
+    base->NumElements(1)->Dim(this->dataset_ptr_->GetDim())->Ids(id)->Owner(false);
+    const void* vector = this->dataset_ptr_->GetOneTrain(row);
+    if (this->dataset_ptr_->GetTrainDataType() == vsag::DATATYPE_FLOAT32) {
+        base->Float32Vectors((const float*)vector);
+    } else if (this->dataset_ptr_->GetTrainDataType() == vsag::DATATYPE_INT8) {
+        base->Int8Vectors((const int8_t*)vector);
+    }
+    return base;
+}
+
+vsag::DatasetPtr
+MixedEvalCase::make_query(int64_t query_id) const {
+    auto query = vsag::Dataset::Make();
+    query->NumElements(1)->Dim(this->dataset_ptr_->GetDim())->Owner(false);
+    const void* vector = this->dataset_ptr_->GetOneTest(query_id);
+    if (this->dataset_ptr_->GetTestDataType() == vsag::DATATYPE_FLOAT32) {
+        query->Float32Vectors((const float*)vector);
+    } else if (this->dataset_ptr_->GetTestDataType() == vsag::DATATYPE_INT8) {
+        query->Int8Vectors((const int8_t*)vector);
+    }
+    return query;
+}
+
+void
+MixedEvalCase::build_initial() {
+    std::vector<int64_t> ids(static_cast<uint64_t>(initial_count_));
+    for (int64_t i = 0; i < initial_count_; ++i) {
+        ids[i] = i;
+    }
+    auto base = vsag::Dataset::Make();
+    base->NumElements(initial_count_)
+        ->Dim(this->dataset_ptr_->GetDim())
+        ->Ids(ids.data())
+        ->Owner(false);
+    if (this->dataset_ptr_->GetTrainDataType() == vsag::DATATYPE_FLOAT32) {
+        base->Float32Vectors((const float*)this->dataset_ptr_->GetTrain());
+    } else if (this->dataset_ptr_->GetTrainDataType() == vsag::DATATYPE_INT8) {
+        base->Int8Vectors((const int8_t*)this->dataset_ptr_->GetTrain());
+    }
+    auto build_result = this->index_->Build(base);
+    if (not build_result.has_value()) {
+        throw std::runtime_error(build_result.error().message);
+    }
+    for (int64_t i = 0; i < initial_count_; ++i) {
+        live_ids_.Put(i, i);
+    }
+}
+
+bool
+MixedEvalCase::wait_until_due(double due_s) const {
+    if (due_s >= workload_.duration_s) {
+        return false;
+    }
+    auto due = start_time_ + std::chrono::duration_cast<Clock::duration>(
+                                 std::chrono::duration<double>(due_s));
+    std::this_thread::sleep_until(due);
+    return not stop_.load(std::memory_order_acquire);
+}
+
+void
+MixedEvalCase::do_insert() {
+    // ids keep growing so a re-inserted row never collides with a removed id
+    auto sequence = static_cast<int64_t>(next_insert_.fetch_add(1, std::memory_order_relaxed));
+    int64_t id = initial_count_ + sequence;
+    int64_t row = id % this->dataset_ptr_->GetNumberOfBase();
+    auto base = make_base(&id, row);
+    auto [result, latency_ms] = MeasureSearch([&]() { return this->index_->Add(base); });
+    bool success = result.has_value() and result.value().empty();
+    if (success) {
+        live_ids_.Put(id, row);
+    }
+    recorders_[INSERT].Record(latency_ms, success);
+}
+
+void
+MixedEvalCase::do_delete(uint64_t random_value) {
+    auto entry = live_ids_.Take(random_value);
+    if (not entry.has_value()) {
+        return;
+    }
+    auto [result, latency_ms] =
+        MeasureSearch([&]() { return this->index_->Remove(entry->id, remove_mode_); });
+    bool success = result.has_value() and result.value() == 1;
+    if (not success) {
+        live_ids_.Put(entry->id, entry->row);
+    }
+    recorders_[DELETE].Record(latency_ms, success);
+}
+
+void
+MixedEvalCase::do_update(uint64_t random_value, uint64_t new_row) {
+    auto entry = live_ids_.Take(random_value);
+    if (not entry.has_value()) {
+        return;
+    }
+    auto row = static_cast<int64_t>(new_row % this->dataset_ptr_->GetNumberOfBase());
+    auto base = make_base(&entry->id, row);
+    auto [result, latency_ms] =
+        MeasureSearch([&]() { return this->index_->UpdateVector(entry->id, base); });
+    bool success = result.has_value() and result.value();
+    live_ids_.Put(entry->id, success ? row : entry->row);
+    recorders_[UPDATE].Record(latency_ms, success);
+}
+
+void
+MixedEvalCase::writer_loop(uint64_t seed) {
+    std::mt19937_64 random_engine(seed);
+    while (not stop_.load(std::memory_order_acquire)) {
+        auto next = write_pacer_.Next();
+        if (not next.has_value() or not wait_until_due(next->second)) {
+            return;
+        }
+        std::shared_lock<std::shared_mutex> gate(write_gate_);
+        switch (next->first) {
+            case INSERT:
+                do_insert();
+                break;
+            case DELETE:
+                do_delete(random_engine());
+                break;
+            case UPDATE:
+                do_update(random_engine(), random_engine());
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+void
+MixedEvalCase::reader_loop() {
+    auto query_count = static_cast<uint64_t>(this->dataset_ptr_->GetNumberOfQuery());
+    bool paced = workload_.search_qps > 0.0;
+    while (not stop_.load(std::memory_order_acquire)) {
+        if (paced) {
+            auto next = search_pacer_.Next();
+            if (not next.has_value() or not wait_until_due(next->second)) {
+                return;
+            }
+        }
+        auto query_id = next_query_.fetch_add(1, std::memory_order_relaxed) % query_count;
+        auto query = make_query(static_cast<int64_t>(query_id));
+        auto [result, latency_ms] = MeasureSearch(
+            [&]() { return this->index_->KnnSearch(query, config_.top_k, config_.search_param); });
+        recorders_[SEARCH].Record(latency_ms, result.has_value());
+    }
+}
+
+JsonType
+MixedEvalCase::probe_recall() {
+    JsonType probe;
+    auto probe_count =
+        std::min<uint64_t>(workload_.recall_probe_count,
+                           static_cast<uint64_t>(this->dataset_ptr_->GetNumberOfQuery()));
+    std::vector<LiveIdSet::Entry> snapshot;
+    std::vector<std::vector<int64_t>> results(probe_count);
+    {
+        std::unique_lock<std::shared_mutex> gate(write_gate_);
+        snapshot = live_ids_.Snapshot();
+        for (uint64_t i = 0; i < probe_count; ++i) {
+            auto query = make_query(static_cast<int64_t>(i));
+            auto result = this->index_->KnnSearch(query, config_.top_k, config_.search_param);
+            if (not result.has_value()) {
+                throw std::runtime_error("query error: " + result.error().message);
+            }
+            const auto* ids = result.value()->GetIds();
+            results[i].assign(ids, ids + result.value()->GetDim());
+        }
+        probe["index_memory(B)"] = this->index_->GetMemoryUsage();
+    }
+    probe["live_count"] = snapshot.size();
+
+    // the exact top-k over the snapshot runs after the writers are released
+    auto top_k = std::min<uint64_t>(config_.top_k, snapshot.size());
+    if (probe_count == 0 or top_k == 0) {
+        return probe;
+    }
+    uint64_t dim = this->dataset_ptr_->GetDim();
+    auto distance_func = this->dataset_ptr_->GetDistanceFunc();
+    std::vector<std::pair<float, int64_t>> distances(snapshot.size());
+    uint64_t hit_count = 0;
+    for (uint64_t i = 0; i < probe_count; ++i) {
+        const void* query_vector = this->dataset_ptr_->GetOneTest(static_cast<int64_t>(i));
+        for (uint64_t j = 0; j < snapshot.size(); ++j) {
+            const void* base_vector = this->dataset_ptr_->GetOneTrain(snapshot[j].row);
+            distances[j] = {distance_func(query_vector, base_vector, &dim), snapshot[j].id};
+        }
+        std::partial_sort(distances.begin(), distances.begin() + top_k, distances.end());
+        std::vector<int64_t> ground_truth(top_k);
+        for (uint64_t j = 0; j < top_k; ++j) {
+            ground_truth[j] = distances[j].second;
+        }
+        std::sort(ground_truth.begin(), ground_truth.end());
+        for (auto id : results[i]) {
+            hit_count += std::binary_search(ground_truth.begin(), ground_truth.end(), id) ? 1 : 0;
+        }
+    }
+    probe["recall_avg"] =
+        static_cast<double>(hit_count) / static_cast<double>(probe_count * top_k);
+    return probe;
+}
+
+JsonType
+MixedEvalCase::report_interval(double begin_s, double end_s) {
+    JsonType interval;
+    interval["begin(s)"] = begin_s;
+    interval["end(s)"] = end_s;
+    for (uint64_t op = 0; op < OP_TYPE_COUNT; ++op) {
+        auto [latency_ms, failed_count] = recorders_[op].Drain();
+        auto& total = total_latency_ms_[op];
+        total.insert(total.end(), latency_ms.begin(), latency_ms.end());
+        total_failed_count_[op] += failed_count;
+        interval[kOpNames[op]] =
+            latency_result(std::move(latency_ms), failed_count, end_s - begin_s);
+    }
+    EvalCase::MergeJsonType(this->probe_recall(), interval);
+    if (memory_monitor_ != nullptr) {
+        memory_monitor_->Record(nullptr);
+        EvalCase::MergeJsonType(memory_monitor_->GetResult(), interval);
+    }
+    return interval;
+}
+
+JsonType
+MixedEvalCase::Run() {
+    this->build_initial();
+    auto initial_memory = this->index_->GetMemoryUsage();
+    if (memory_monitor_ != nullptr) {
+        memory_monitor_->Start();
+    }
+
+    start_time_ = Clock::now();
+    std::vector<std::thread> workers;
+    for (int32_t i = 0; i < workload_.writer_threads; ++i) {
+        workers.emplace_back([this, i]() { this->writer_loop(static_cast<uint64_t>(i) + 1); });
+    }
+    for (int32_t i = 0; i < config_.num_threads_searching; ++i) {
+        workers.emplace_back([this]() { this->reader_loop(); });
+    }
+
+    JsonType timeline = JsonType::array();
+    double begin_s = 0.0;
+    while (begin_s < workload_.duration_s) {
+        auto end_s = std::min(begin_s + workload_.report_interval_s, workload_.duration_s);
+        std::this_thread::sleep_until(start_time_ + std::chrono::duration_cast<Clock::duration>(
+                                                        std::chrono::duration<double>(end_s)));
+        if (end_s >= workload_.duration_s) {
+            stop_.store(true, std::memory_order_release);
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+        timeline.push_back(this->report_interval(begin_s, end_s));
+        EvalCase::UpdateMonitorProgress(static_cast<float>(100.0 * end_s / workload_.duration_s));
+        EvalCase::UpdateMonitorMetrics(timeline.back());
+        begin_s = end_s;
+    }
+    auto elapsed_s = std::chrono::duration<double>(Clock::now() - start_time_).count();
+    if (memory_monitor_ != nullptr) {
+        memory_monitor_->Stop();
+    }
+
+    auto result = this->process_result(timeline, std::min(elapsed_s, workload_.duration_s));
+    result["index_memory_initial(B)"] = initial_memory;
+    result["index_memory_growth(B)"] = static_cast<int64_t>(this->index_->GetMemoryUsage()) -
+                                       static_cast<int64_t>(initial_memory);
+    return result;
+}
+
+JsonType
+MixedEvalCase::process_result(const JsonType& timeline, double elapsed_s) {
+    JsonType result;
+    for (uint64_t op = 0; op < OP_TYPE_COUNT; ++op) {
+        result["summary"][kOpNames[op]] = latency_result(
+            std::move(total_latency_ms_[op]), total_failed_count_[op], elapsed_s);
+    }
+    const auto& search_summary = result["summary"]["search"];
+    result["qps"] = search_summary["qps"];
+    result["latency_avg(ms)"] = search_summary["latency_avg(ms)"];
+    result["latency_detail(ms)"] = search_summary["latency_detail(ms)"];
+    if (not timeline.empty() and timeline.front().contains("recall_avg")) {
+        auto first = timeline.front()["recall_avg"].get<double>();
+        auto last = timeline.back()["recall_avg"].get<double>();
+        result["recall_avg"] = last;
+        result["recall_drift"] = last - first;
+    }
+    if (memory_monitor_ != nullptr) {
+        EvalCase::MergeJsonType(memory_monitor_->GetResult(), result);
+    }
+    EvalCase::MergeJsonType(this->basic_info_, result);
+    result["action"] = "mixed";
+    result["index"] = config_.index_name;
+    result["index_info"] =
+        config_.build_param.empty() ? JsonType::object() : JsonType::parse(config_.build_param);
+    result["search_param"] = config_.search_param;
+    result["index_memory(B)"] = this->index_->GetMemoryUsage();
+    result["mixed_workload"] = {{"duration(s)", workload_.duration_s},
+                                {"initial_count", initial_count_},
+                                {"insert_rate", workload_.insert_rate},
+                                {"delete_rate", workload_.delete_rate},
+                                {"update_rate", workload_.update_rate},
+                                {"search_qps", workload_.search_qps},
+                                {"writer_threads", workload_.writer_threads},
+                                {"reader_threads", config_.num_threads_searching},
+                                {"remove_mode", workload_.remove_mode}};
+    result["timeline"] = timeline;
+    return result;
+}
+
+}  // namespace vsag::eval
@@ -0,0 +1,147 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <vector>
+
+#include "../monitor/memory_peak_monitor.h"
+#include "./eval_case.h"
+#include "./mixed_workload.h"
+
+namespace vsag::eval {
+
+/**
+ * Replays concurrent writes (Add, Remove, UpdateVector) and searches against one index.
+ * The index is built from the first `initial_ratio` of the base rows; the remaining rows
+ * feed the inserts. Every `report_interval_s` the case records per-operation latency,
+ * recall of probe queries against an exact ground truth over the live ids, and memory.
+ */
+class MixedEvalCase : public EvalCase {
+public:
+    MixedEvalCase(const std::string& dataset_path,
+                  const std::string& index_path,
+                  vsag::IndexPtr index,
+                  EvalConfig config,
+                  EvalDatasetPtr dataset = nullptr);
+
+    ~MixedEvalCase() override = default;
+
+    JsonType
+    Run() override;
+
+private:
+    enum OpType : uint64_t {
+        INSERT = 0,
+        DELETE = 1,
+        UPDATE = 2,
+        SEARCH = 3,
+        OP_TYPE_COUNT = 4,
+    };
+
+    struct OpRecorder {
+        std::mutex mutex;
+        std::vector<double> latency_ms;
+        uint64_t failed_count{0};
+
+        void
+        Record(double latency, bool success);
+
+        std::pair<std::vector<double>, uint64_t>
+        Drain();
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+    void
+    build_initial();
+
+    vsag::DatasetPtr
+    make_base(const int64_t* id, int64_t row) const;
+
+    vsag::DatasetPtr
+    make_query(int64_t query_id) const;
+
+    void
+    writer_loop(uint64_t seed);
+
+    void
+    reader_loop();
+
+    void
+    do_insert();
+
+    void
+    do_delete(uint64_t random_value);
+
+    void
+    do_update(uint64_t random_value, uint64_t new_row);
+
+    bool
+    wait_until_due(double due_s) const;
+
+    JsonType
+    report_interval(double begin_s, double end_s);
+
+    JsonType
+    probe_recall();
+
+    JsonType
+    process_result(const JsonType& timeline, double elapsed_s);
+
+private:
+    EvalConfig config_;
+
+    const MixedWorkloadConfig& workload_;
+
+    vsag::RemoveMode remove_mode_{vsag::RemoveMode::MARK_REMOVE};
+
+    int64_t initial_count_{0};
+
+    std::shared_ptr<MemoryPeakMonitor> memory_monitor_{nullptr};
+
+    LiveIdSet live_ids_;
+
+    OpPacer write_pacer_;
+
+    OpPacer search_pacer_;
+
+    // writers hold it shared for each operation; the recall probe holds it exclusively so the
+    // probe searches and the live id snapshot see the same index state
+    std::shared_mutex write_gate_;
+
+    std::array<OpRecorder, OP_TYPE_COUNT> recorders_;
+
+    std::array<std::vector<double>, OP_TYPE_COUNT> total_latency_ms_;
+
+    std::array<uint64_t, OP_TYPE_COUNT> total_failed_count_{};
+
+    std::atomic<uint64_t> next_insert_{0};
+
+    std::atomic<uint64_t> next_query_{0};
+
+    std::atomic<bool> stop_{false};
+
+    Clock::time_point start_time_;
+};
+
+}  // namespace vsag::eval
@@ -0,0 +1,83 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "mixed_workload.h"
+
+#include <limits>
+#include <stdexcept>
+
+namespace vsag::eval {
+
+OpPacer::OpPacer(std::vector<double> rates) : rates_(std::move(rates)), issued_(rates_.size(), 0) {
+    for (auto rate : rates_) {
+        if (not(rate >= 0.0)) {
+            throw std::invalid_argument("operation rate must not be negative");
+        }
+    }
+}
+
+std::optional<std::pair<uint64_t, double>>
+OpPacer::Next() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::optional<std::pair<uint64_t, double>> next;
+    double earliest = std::numeric_limits<double>::infinity();
+    for (uint64_t i = 0; i < rates_.size(); ++i) {
+        if (rates_[i] <= 0.0) {
+            continue;
+        }
+        auto due = static_cast<double>(issued_[i]) / rates_[i];
+        if (due < earliest) {
+            earliest = due;
+            next = std::make_pair(i, due);
+        }
+    }
+    if (next.has_value()) {
+        ++issued_[next->first];
+    }
+    return next;
+}
+
+void
+LiveIdSet::Put(int64_t id, int64_t row) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.push_back({id, row});
+}
+
+std::optional<LiveIdSet::Entry>
+LiveIdSet::Take(uint64_t random_value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (entries_.empty()) {
+        return std::nullopt;
+    }
+    auto pos = random_value % entries_.size();
+    auto entry = entries_[pos];
+    entries_[pos] = entries_.back();
+    entries_.pop_back();
+    return entry;
+}
+
+uint64_t
+LiveIdSet::Size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+std::vector<LiveIdSet::Entry>
+LiveIdSet::Snapshot() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_;
+}
+
+}  // namespace vsag::eval
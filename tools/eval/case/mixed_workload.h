@@ -0,0 +1,99 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vsag::eval {
+
+/**
+ * Settings of a `mixed` eval case: writers replay inserts, deletes and updates at fixed rates
+ * while readers search, and the case reports per-interval latency, recall and memory.
+ * A rate of 0 disables that operation; search_qps of 0 lets readers search back to back.
+ */
+struct MixedWorkloadConfig {
+    double duration_s{60.0};
+    double initial_ratio{0.5};
+    double insert_rate{0.0};
+    double delete_rate{0.0};
+    double update_rate{0.0};
+    double search_qps{0.0};
+    int32_t writer_threads{1};
+    double report_interval_s{5.0};
+    std::string remove_mode{"mark"};
+    uint64_t recall_probe_count{100};
+};
+
+/**
+ * Open-loop schedule for several operation streams with fixed rates. The k-th operation of a
+ * stream with rate r is due at k / r seconds; Next() hands out the earliest due operation
+ * across all streams, so concurrent workers share one schedule without coordinating otherwise.
+ */
+class OpPacer {
+public:
+    explicit OpPacer(std::vector<double> rates);
+
+    /**
+     * Returns the stream index and due time in seconds of the next operation, or nullopt when
+     * every rate is 0.
+     */
+    std::optional<std::pair<uint64_t, double>>
+    Next();
+
+private:
+    std::mutex mutex_;
+    std::vector<double> rates_;
+    std::vector<uint64_t> issued_;
+};
+
+/**
+ * Ids currently present in the index, each with the base row holding its current vector.
+ * Take() removes an entry so that a delete or update owns the id until it puts it back.
+ */
+class LiveIdSet {
+public:
+    struct Entry {
+        int64_t id;
+        int64_t row;
+    };
+
+    void
+    Put(int64_t id, int64_t row);
+
+    /**
+     * Removes and returns the entry at position `random_value` modulo the size, or nullopt when
+     * the set is empty.
+     */
+    std::optional<Entry>
+    Take(uint64_t random_value);
+
+    uint64_t
+    Size();
+
+    std::vector<Entry>
+    Snapshot();
+
+private:
+    std::mutex mutex_;
+    std::vector<Entry> entries_;
+};
+
+}  // namespace vsag::eval
@@ -0,0 +1,68 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "mixed_workload.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+namespace vsag::eval {
+
+TEST_CASE("OpPacer interleaves streams by due time", "[ut][eval][mixed_workload]") {
+    OpPacer pacer({2.0, 0.0, 1.0});
+    std::vector<uint64_t> streams;
+    std::vector<double> due_times;
+    for (int i = 0; i < 6; ++i) {
+        auto next = pacer.Next();
+        REQUIRE(next.has_value());
+        streams.push_back(next->first);
+        due_times.push_back(next->second);
+    }
+    // stream 0 is due at 0, 0.5, 1.0, 1.5 and stream 2 at 0, 1.0; ties go to the lower stream
+    REQUIRE(streams == std::vector<uint64_t>{0, 2, 0, 0, 2, 0});
+    REQUIRE(due_times == std::vector<double>{0.0, 0.0, 0.5, 1.0, 1.0, 1.5});
+
+    OpPacer idle({0.0});
+    REQUIRE_FALSE(idle.Next().has_value());
+    REQUIRE_THROWS_AS(OpPacer({-1.0}), std::invalid_argument);
+}
+
+TEST_CASE("LiveIdSet hands out each id once", "[ut][eval][mixed_workload]") {
+    LiveIdSet live_ids;
+    for (int64_t i = 0; i < 10; ++i) {
+        live_ids.Put(i, i + 100);
+    }
+    REQUIRE(live_ids.Size() == 10);
+
+    std::set<int64_t> taken;
+    for (uint64_t i = 0; i < 10; ++i) {
+        auto entry = live_ids.Take(i * 7919);
+        REQUIRE(entry.has_value());
+        REQUIRE(entry->row == entry->id + 100);
+        REQUIRE(taken.insert(entry->id).second);
+    }
+    REQUIRE(live_ids.Size() == 0);
+    REQUIRE_FALSE(live_ids.Take(0).has_value());
+
+    live_ids.Put(3, 42);
+    auto snapshot = live_ids.Snapshot();
+    REQUIRE(snapshot.size() == 1);
+    REQUIRE(snapshot[0].id == 3);
+    REQUIRE(snapshot[0].row == 42);
+}
+
+}  // namespace vsag::eval
@@ -26,10 +26,13 @@
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "../monitor/latency_monitor.h"
 #include "../monitor/memory_peak_monitor.h"
+#include "../monitor/perf_counter_monitor.h"
 #include "../monitor/recall_monitor.h"
+#include "search_sweep.h"
 #include "search_timing.h"
 #include "typing.h"
 #include "vsag/filter.h"
@@ -119,6 +122,7 @@ SearchEvalCase::init_monitor() {
     this->init_latency_monitor();
     this->init_recall_monitor();
     this->init_memory_monitor();
+    this->init_perf_counter_monitor();
 }
 
 void
@@ -161,11 +165,19 @@ SearchEvalCase::init_memory_monitor() {
     }
 }
 
+void
+SearchEvalCase::init_perf_counter_monitor() {
+    if (config_.enable_perf_counters) {
+        this->perf_counter_monitor_ = std::make_shared<PerfCounterMonitor>("search");
+        this->monitors_.emplace_back(this->perf_counter_monitor_);
+    }
+}
+
 JsonType
 SearchEvalCase::Run() {
     std::ifstream infile(this->index_path_, std::ios::binary);
     this->deserialize(infile);
-    auto result = this->RunInMemory();
+    auto result = config_.search_sweep.empty() ? this->RunInMemory() : this->run_sweep();
     if (config_.delete_index_after_search) {
         std::remove(this->index_path_.c_str());
     }
@@ -196,6 +208,48 @@ SearchEvalCase::deserialize(std::ifstream& infile) {
     this->index_->Deserialize(infile);
 }
 
+std::pair<vsag::DatasetPtr, const void*>
+SearchEvalCase::prepare_query(uint64_t query_id) const {
+    auto query = vsag::Dataset::Make();
+    query->NumElements(1)->Dim(this->dataset_ptr_->GetDim())->Owner(false);
+    const void* query_vector = this->dataset_ptr_->GetOneTest(query_id);
+    if (this->dataset_ptr_->GetVectorType() == DENSE_VECTORS) {
+        if (this->dataset_ptr_->GetTestDataType() == vsag::DATATYPE_FLOAT32) {
+            query->Float32Vectors((const float*)query_vector);
+        } else if (this->dataset_ptr_->GetTestDataType() == vsag::DATATYPE_INT8) {
+            query->Int8Vectors((const int8_t*)query_vector);
+        }
+    } else {
+        query->SparseVectors((const SparseVector*)query_vector);
+    }
+    if (this->dataset_ptr_->GetTestPaths() != nullptr) {
+        query->Paths(this->dataset_ptr_->GetTestPaths() + query_id);
+    }
+    return std::make_pair(std::move(query), query_vector);
+}
+
+void
+SearchEvalCase::warmup(uint64_t warmup_query_count) {
+    // untimed knn searches with the case's search_params, so the measured passes do not pay for
+    // cold caches, lazily allocated search buffers or thread pool start-up
+    uint64_t topk = config_.top_k;
+    auto query_count = this->dataset_ptr_->GetNumberOfQuery();
+    omp_set_num_threads(config_.num_threads_searching);
+    SearchFailure search_failure;
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t id = 0; id < static_cast<int64_t>(warmup_query_count); ++id) {
+        if (search_failure.Failed()) {
+            continue;
+        }
+        auto query_and_vector = prepare_query(static_cast<uint64_t>(id) % query_count);
+        auto result = this->index_->KnnSearch(query_and_vector.first, topk, config_.search_param);
+        if (not result.has_value()) {
+            search_failure.Record(result.error().message);
+        }
+    }
+    search_failure.ThrowIfFailed();
+}
+
 void
 SearchEvalCase::do_knn_search() {
     uint64_t topk = config_.top_k;
@@ -203,25 +257,6 @@ SearchEvalCase::do_knn_search() {
     this->logger_->Debug("query count is " + std::to_string(query_count));
     auto min_query = std::max(static_cast<uint64_t>(query_count), config_.search_query_count);
 
-    auto prepare_query = [this](uint64_t query_id) {
-        auto query = vsag::Dataset::Make();
-        query->NumElements(1)->Dim(this->dataset_ptr_->GetDim())->Owner(false);
-        const void* query_vector = this->dataset_ptr_->GetOneTest(query_id);
-        if (this->dataset_ptr_->GetVectorType() == DENSE_VECTORS) {
-            if (this->dataset_ptr_->GetTestDataType() == vsag::DATATYPE_FLOAT32) {
-                query->Float32Vectors((const float*)query_vector);
-            } else if (this->dataset_ptr_->GetTestDataType() == vsag::DATATYPE_INT8) {
-                query->Int8Vectors((const int8_t*)query_vector);
-            }
-        } else {
-            query->SparseVectors((const SparseVector*)query_vector);
-        }
-        if (this->dataset_ptr_->GetTestPaths() != nullptr) {
-            query->Paths(this->dataset_ptr_->GetTestPaths() + query_id);
-        }
-        return std::make_pair(std::move(query), query_vector);
-    };
-
     bool statistics_collected = false;
     for (auto& monitor : this->monitors_) {
         const bool is_latency_monitor =
@@ -434,6 +469,72 @@ SearchEvalCase::process_result() {
     result["statistics_query_count"] = this->statistics_query_count_.load();
     result["statistics_total"] = this->statistics_total_json();
     result["statistics_avg_per_query"] = this->statistics_avg_json();
+    if (this->perf_counter_monitor_ != nullptr) {
+        // hardware counters per query next to the distance counts, e.g. cycles per dist_cmp
+        auto& avg = result["statistics_avg_per_query"];
+        auto dist_cmp = avg.value("dist_cmp", 0.0);
+        for (const auto& [name, value] : this->perf_counter_monitor_->GetPerOperation().items()) {
+            avg[name] = value;
+            if (dist_cmp > 0) {
+                avg[name + "_per_dist_cmp"] = value.get<double>() / dist_cmp;
+            }
+        }
+    }
+    return result;
+}
+
+JsonType
+SearchEvalCase::run_sweep() {
+    auto search_params = ExpandSweepGrid(config_.search_param, config_.search_sweep);
+    JsonType points = JsonType::array();
+    std::vector<SweepPoint> measured;
+    for (uint64_t i = 0; i < search_params.size(); ++i) {
+        auto point_config = config_;
+        point_config.search_param = search_params[i];
+        point_config.search_sweep.clear();
+        SearchEvalCase point_case(
+            this->dataset_path_, this->index_path_, this->index_, point_config, this->dataset_ptr_);
+        point_case.warmup(config_.sweep_warmup_query_count);
+        auto point_result = point_case.RunInMemory();
+
+        JsonType point;
+        point["search_param"] = search_params[i];
+        point["recall_avg"] = point_result.value("recall_avg", 0.0);
+        point["qps"] = point_result.value("qps", 0.0);
+        point["latency_avg(ms)"] = point_result.value("latency_avg(ms)", 0.0);
+        const auto& latency_detail = point_result.value("latency_detail(ms)", JsonType::object());
+        point["latency_p50(ms)"] = latency_detail.value("p50", 0.0);
+        point["latency_p99(ms)"] = latency_detail.value("p99", 0.0);
+        const auto& stats_avg = point_result["statistics_avg_per_query"];
+        point["dist_cmp_avg"] = stats_avg.value("dist_cmp", 0.0);
+        point["distance_evaluations_avg"] = stats_avg.value("distance_evaluations", 0.0);
+        point["pareto"] = false;
+        measured.push_back({point["recall_avg"].get<double>(), point["qps"].get<double>()});
+        points.push_back(std::move(point));
+
+        EvalCase::UpdateMonitorProgress(100.0F * static_cast<float>(i + 1) /
+                                        static_cast<float>(search_params.size()));
+        EvalCase::UpdateMonitorMetrics(points.back());
+    }
+
+    JsonType frontier = JsonType::array();
+    for (auto idx : ParetoFrontier(measured)) {
+        points[idx]["pareto"] = true;
+        frontier.push_back(points[idx]);
+    }
+
+    JsonType result;
+    result["action"] = "search_sweep";
+    result["search_mode"] = config_.search_mode;
+    result["index_info"] =
+        config_.build_param.empty() ? JsonType::object() : JsonType::parse(config_.build_param);
+    result["search_param"] = config_.search_param;
+    result["index"] = config_.index_name;
+    result["index_memory(B)"] = this->index_->GetMemoryUsage();
+    EvalCase::MergeJsonType(this->basic_info_, result);
+    result["sweep_warmup_query_count"] = config_.sweep_warmup_query_count;
+    result["sweep_points"] = std::move(points);
+    result["pareto_frontier"] = std::move(frontier);
     return result;
 }
 
@@ -473,6 +574,7 @@ SearchEvalCase::record_statistics(const vsag::DatasetPtr& result) {
     constexpr const char* kRabitqFilterFallbackFullCount = "rabitq_filter_fallback_full_count";
     constexpr const char* kRabitqReorderHintFullCount = "rabitq_reorder_hint_full_count";
     constexpr const char* kRabitqReorderFallbackFullCount = "rabitq_reorder_fallback_full_count";
+    constexpr const char* kDistanceEvaluations = "distance_evaluations";
 
     const auto values = result->GetStatistics({kDistCmp,
                                                kHops,
@@ -484,7 +586,8 @@ SearchEvalCase::record_statistics(const vsag::DatasetPtr& result) {
                                                kRabitqFullCount,
                                                kRabitqFilterFallbackFullCount,
                                                kRabitqReorderHintFullCount,
-                                               kRabitqReorderFallbackFullCount});
+                                               kRabitqReorderFallbackFullCount,
+                                               kDistanceEvaluations});
     this->statistics_dist_cmp_.fetch_add(parse_stat_value(values[0]), std::memory_order_relaxed);
     this->statistics_hops_.fetch_add(parse_stat_value(values[1]), std::memory_order_relaxed);
     this->statistics_io_cnt_.fetch_add(parse_stat_value(values[2]), std::memory_order_relaxed);
@@ -503,6 +606,8 @@ SearchEvalCase::record_statistics(const vsag::DatasetPtr& result) {
                                                                std::memory_order_relaxed);
     this->statistics_rabitq_reorder_fallback_full_count_.fetch_add(parse_stat_value(values[10]),
                                                                    std::memory_order_relaxed);
+    this->statistics_distance_evaluations_.fetch_add(parse_stat_value(values[11]),
+                                                     std::memory_order_relaxed);
     this->statistics_query_count_.fetch_add(1, std::memory_order_relaxed);
 }
 
@@ -510,6 +615,7 @@ JsonType
 SearchEvalCase::statistics_total_json() const {
     JsonType json;
     set_stat_value(json, "dist_cmp", this->statistics_dist_cmp_.load());
+    set_stat_value(json, "distance_evaluations", this->statistics_distance_evaluations_.load());
     set_stat_value(json, "hops", this->statistics_hops_.load());
     set_stat_value(json, "io_cnt", this->statistics_io_cnt_.load());
     set_stat_value(json, "io_time_ms", this->statistics_io_time_ms_.load());
@@ -536,6 +642,8 @@ SearchEvalCase::statistics_avg_json() const {
     JsonType json;
     const auto count = this->statistics_query_count_.load();
     set_avg_stat_value(json, "dist_cmp", this->statistics_dist_cmp_.load(), count);
+    set_avg_stat_value(
+        json, "distance_evaluations", this->statistics_distance_evaluations_.load(), count);
     set_avg_stat_value(json, "hops", this->statistics_hops_.load(), count);
     set_avg_stat_value(json, "io_cnt", this->statistics_io_cnt_.load(), count);
     set_avg_stat_value(json, "io_time_ms", this->statistics_io_time_ms_.load(), count);
@@ -17,6 +17,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <utility>
 
 #include "../monitor/monitor.h"
 #include "./eval_case.h"
@@ -24,6 +25,7 @@
 namespace vsag::eval {
 
 class LatencyMonitor;
+class PerfCounterMonitor;
 
 class SearchEvalCase : public EvalCase {
 public:
@@ -58,12 +60,24 @@ private:
     void
     init_recall_monitor();
 
+    void
+    init_perf_counter_monitor();
+
     void
     init_memory_monitor();
 
     void
     deserialize(std::ifstream& infile);
 
+    std::pair<vsag::DatasetPtr, const void*>
+    prepare_query(uint64_t query_id) const;
+
+    void
+    warmup(uint64_t warmup_query_count);
+
+    JsonType
+    run_sweep();
+
     void
     do_knn_search();
 
@@ -93,12 +107,15 @@ private:
 
     std::shared_ptr<LatencyMonitor> latency_monitor_{nullptr};
 
+    std::shared_ptr<PerfCounterMonitor> perf_counter_monitor_{nullptr};
+
     SearchType search_type_{SearchType::KNN};
 
     EvalConfig config_;
 
     std::atomic<uint64_t> statistics_query_count_{0};
     std::atomic<uint64_t> statistics_dist_cmp_{0};
+    std::atomic<uint64_t> statistics_distance_evaluations_{0};
     std::atomic<uint64_t> statistics_hops_{0};
     std::atomic<uint64_t> statistics_io_cnt_{0};
     std::atomic<uint64_t> statistics_io_time_ms_{0};
@@ -0,0 +1,123 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "search_sweep.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+namespace vsag::eval {
+
+namespace {
+
+void
+set_by_path(nlohmann::json& root, const std::string& path, const nlohmann::json& value) {
+    auto* node = &root;
+    uint64_t begin = 0;
+    while (true) {
+        auto end = path.find('.', begin);
+        auto key = path.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+        if (key.empty()) {
+            throw std::invalid_argument("invalid sweep path: " + path);
+        }
+        if (end == std::string::npos) {
+            (*node)[key] = value;
+            return;
+        }
+        node = &(*node)[key];
+        begin = end + 1;
+    }
+}
+
+bool
+is_integral(double value) {
+    return std::floor(value) == value;
+}
+
+}  // namespace
+
+SweepAxis
+MakeRangeAxis(const std::string& path, double start, double stop, double step) {
+    if (step <= 0.0) {
+        throw std::invalid_argument("sweep range step must be positive: " + path);
+    }
+    if (stop < start) {
+        throw std::invalid_argument("sweep range stop must not be less than start: " + path);
+    }
+    SweepAxis axis{path, {}};
+    bool integral = is_integral(start) and is_integral(step);
+    auto count = static_cast<uint64_t>(std::floor((stop - start) / step + 1e-9)) + 1;
+    for (uint64_t i = 0; i < count; ++i) {
+        double value = start + static_cast<double>(i) * step;
+        if (integral) {
+            axis.values.emplace_back(static_cast<int64_t>(value));
+        } else {
+            axis.values.emplace_back(value);
+        }
+    }
+    return axis;
+}
+
+std::vector<std::string>
+ExpandSweepGrid(const std::string& base_search_param, const std::vector<SweepAxis>& axes) {
+    auto base = base_search_param.empty() ? nlohmann::json::object()
+                                          : nlohmann::json::parse(base_search_param);
+    uint64_t total = 1;
+    for (const auto& axis : axes) {
+        if (axis.values.empty()) {
+            throw std::invalid_argument("sweep axis has no values: " + axis.path);
+        }
+        total *= axis.values.size();
+    }
+
+    std::vector<std::string> points;
+    points.reserve(total);
+    for (uint64_t i = 0; i < total; ++i) {
+        auto point = base;
+        auto remain = i;
+        for (auto axis = axes.rbegin(); axis != axes.rend(); ++axis) {
+            auto size = axis->values.size();
+            set_by_path(point, axis->path, axis->values[remain % size]);
+            remain /= size;
+        }
+        points.emplace_back(point.dump());
+    }
+    return points;
+}
+
+std::vector<uint64_t>
+ParetoFrontier(const std::vector<SweepPoint>& points) {
+    std::vector<uint64_t> order(points.size());
+    std::iota(order.begin(), order.end(), 0);
+    // scan by descending qps (ties by descending recall) and keep every point that raises the
+    // best recall seen so far; the kept points come out in ascending recall order
+    std::sort(order.begin(), order.end(), [&points](uint64_t a, uint64_t b) {
+        if (points[a].qps != points[b].qps) {
+            return points[a].qps > points[b].qps;
+        }
+        return points[a].recall > points[b].recall;
+    });
+    std::vector<uint64_t> frontier;
+    double best_recall = -1.0;
+    for (auto idx : order) {
+        if (points[idx].recall > best_recall) {
+            frontier.emplace_back(idx);
+            best_recall = points[idx].recall;
+        }
+    }
+    return frontier;
+}
+
+}  // namespace vsag::eval
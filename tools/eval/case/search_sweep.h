@@ -0,0 +1,66 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+namespace vsag::eval {
+
+/**
+ * One dimension of a search parameter sweep. `path` addresses a field inside the search_params
+ * JSON with '.' separated keys (e.g. "hgraph.ef_search"), and `values` are the candidates that
+ * are substituted at that field, in order.
+ */
+struct SweepAxis {
+    std::string path;
+    std::vector<nlohmann::json> values;
+};
+
+/**
+ * Measured outcome of one sweep point; only the fields needed to rank the point.
+ */
+struct SweepPoint {
+    double recall{0.0};
+    double qps{0.0};
+};
+
+/**
+ * Expands a numeric range [start, stop] with the given step into an axis. Integral inputs
+ * produce integral values so they can be fed to integer search parameters.
+ */
+SweepAxis
+MakeRangeAxis(const std::string& path, double start, double stop, double step);
+
+/**
+ * Returns the cartesian product of all axes applied to `base_search_param`, in row-major order
+ * (the last axis varies fastest). Each element is a serialized search_params string.
+ */
+std::vector<std::string>
+ExpandSweepGrid(const std::string& base_search_param, const std::vector<SweepAxis>& axes);
+
+/**
+ * Returns the indexes of the points that are not dominated in (recall, qps), sorted by
+ * ascending recall. A point is dominated when another point is at least as good in both
+ * dimensions and strictly better in one.
+ */
+std::vector<uint64_t>
+ParetoFrontier(const std::vector<SweepPoint>& points);
+
+}  // namespace vsag::eval
@@ -0,0 +1,78 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "search_sweep.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace vsag::eval {
+
+TEST_CASE("Sweep Range Axis", "[ut][SearchSweep]") {
+    auto axis = MakeRangeAxis("hgraph.ef_search", 10, 40, 10);
+    REQUIRE(axis.path == "hgraph.ef_search");
+    REQUIRE(axis.values.size() == 4);
+    REQUIRE(axis.values[0].is_number_integer());
+    REQUIRE(axis.values[3].get<int64_t>() == 40);
+
+    auto ratio = MakeRangeAxis("ivf.scan_buckets_ratio", 0.1, 0.3, 0.1);
+    REQUIRE(ratio.values.size() == 3);
+    REQUIRE(ratio.values[0].is_number_float());
+
+    REQUIRE_THROWS_AS(MakeRangeAxis("x", 1, 2, 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(MakeRangeAxis("x", 2, 1, 1), std::invalid_argument);
+}
+
+TEST_CASE("Sweep Grid Expansion", "[ut][SearchSweep]") {
+    std::vector<SweepAxis> axes;
+    axes.push_back({"hgraph.ef_search", {10, 20}});
+    axes.push_back({"hgraph.use_extra_info_filter", {false, true, false}});
+    auto grid = ExpandSweepGrid(R"({"hgraph": {"ef_search": 1, "skip_ratio": 0.5}})", axes);
+    REQUIRE(grid.size() == 6);
+
+    auto first = nlohmann::json::parse(grid[0]);
+    REQUIRE(first["hgraph"]["ef_search"] == 10);
+    REQUIRE(first["hgraph"]["use_extra_info_filter"] == false);
+    REQUIRE(first["hgraph"]["skip_ratio"] == 0.5);
+
+    auto second = nlohmann::json::parse(grid[1]);
+    REQUIRE(second["hgraph"]["ef_search"] == 10);
+    REQUIRE(second["hgraph"]["use_extra_info_filter"] == true);
+
+    auto last = nlohmann::json::parse(grid[5]);
+    REQUIRE(last["hgraph"]["ef_search"] == 20);
+
+    REQUIRE(ExpandSweepGrid("", {}).size() == 1);
+    REQUIRE_THROWS_AS(ExpandSweepGrid("{}", {SweepAxis{"a..b", {1}}}), std::invalid_argument);
+    REQUIRE_THROWS_AS(ExpandSweepGrid("{}", {SweepAxis{"a", {}}}), std::invalid_argument);
+}
+
+TEST_CASE("Sweep Pareto Frontier", "[ut][SearchSweep]") {
+    std::vector<SweepPoint> points = {
+        {0.90, 1000.0},  // frontier
+        {0.85, 900.0},   // dominated by 0
+        {0.95, 800.0},   // frontier
+        {0.99, 300.0},   // frontier
+        {0.95, 500.0},   // dominated by 2
+        {0.80, 1200.0},  // frontier
+    };
+    auto frontier = ParetoFrontier(points);
+    REQUIRE(frontier == std::vector<uint64_t>{5, 0, 2, 3});
+    REQUIRE(ParetoFrontier({}).empty());
+}
+
+}  // namespace vsag::eval
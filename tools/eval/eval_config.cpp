@@ -15,6 +15,9 @@
 
 #include "./eval_config.h"
 
+#include <stdexcept>
+#include <vector>
+
 #include "./common.h"
 
 namespace vsag::eval {
@@ -27,6 +30,76 @@ check_and_get_value(const YAML::Node& node, const std::string& key, T& value) {
     }
 };
 
+nlohmann::json
+yaml_scalar_to_json(const YAML::Node& node) {
+    int64_t int_value = 0;
+    if (YAML::convert<int64_t>::decode(node, int_value)) {
+        return int_value;
+    }
+    double double_value = 0.0;
+    if (YAML::convert<double>::decode(node, double_value)) {
+        return double_value;
+    }
+    bool bool_value = false;
+    if (YAML::convert<bool>::decode(node, bool_value)) {
+        return bool_value;
+    }
+    return node.as<std::string>();
+}
+
+std::vector<SweepAxis>
+load_search_sweep(const YAML::Node& node) {
+    std::vector<SweepAxis> axes;
+    if (not node.IsDefined()) {
+        return axes;
+    }
+    if (not node.IsMap()) {
+        throw std::invalid_argument("search_sweep must be a map of parameter path to values");
+    }
+    for (auto it = node.begin(); it != node.end(); ++it) {
+        auto path = it->first.as<std::string>();
+        const auto& values = it->second;
+        if (values.IsSequence()) {
+            SweepAxis axis{path, {}};
+            for (const auto& value : values) {
+                axis.values.emplace_back(yaml_scalar_to_json(value));
+            }
+            axes.emplace_back(std::move(axis));
+        } else if (values.IsMap()) {
+            axes.emplace_back(MakeRangeAxis(path,
+                                            check_exist_and_get_value<double>(values, "start"),
+                                            check_exist_and_get_value<double>(values, "stop"),
+                                            check_exist_and_get_value<double>(values, "step")));
+        } else {
+            throw std::invalid_argument("search_sweep." + path +
+                                        " must be a list or a {start, stop, step} range");
+        }
+    }
+    return axes;
+}
+
+MixedWorkloadConfig
+load_mixed_workload(const YAML::Node& node) {
+    MixedWorkloadConfig workload;
+    if (not node.IsDefined()) {
+        return workload;
+    }
+    if (not node.IsMap()) {
+        throw std::invalid_argument("mixed_workload must be a map");
+    }
+    check_and_get_value<double>(node, "duration_s", workload.duration_s);
+    check_and_get_value<double>(node, "initial_ratio", workload.initial_ratio);
+    check_and_get_value<double>(node, "insert_rate", workload.insert_rate);
+    check_and_get_value<double>(node, "delete_rate", workload.delete_rate);
+    check_and_get_value<double>(node, "update_rate", workload.update_rate);
+    check_and_get_value<double>(node, "search_qps", workload.search_qps);
+    check_and_get_value<int32_t>(node, "writer_threads", workload.writer_threads);
+    check_and_get_value<double>(node, "report_interval_s", workload.report_interval_s);
+    check_and_get_value<>(node, "remove_mode", workload.remove_mode);
+    check_and_get_value<uint64_t>(node, "recall_probe_count", workload.recall_probe_count);
+    return workload;
+}
+
 EvalConfig
 EvalConfig::Load(argparse::ArgumentParser& parser) {
     EvalConfig config;
@@ -66,6 +139,7 @@ EvalConfig::Load(argparse::ArgumentParser& parser) {
     if (parser.get<bool>("--disable_percent_latency")) {
         config.enable_percent_latency = false;
     }
+    config.enable_perf_counters = parser.get<bool>("--enable_perf_counters");
 
     return config;
 }
@@ -98,6 +172,11 @@ EvalConfig::Load(YAML::Node& yaml_node, const eval_job& global_options) {
     check_and_get_value<bool>(
         yaml_node, "delete_index_after_search", config.delete_index_after_search);
 
+    config.search_sweep = load_search_sweep(yaml_node["search_sweep"]);
+    check_and_get_value<uint64_t>(
+        yaml_node, "sweep_warmup_query_count", config.sweep_warmup_query_count);
+    config.mixed_workload = load_mixed_workload(yaml_node["mixed_workload"]);
+
     check_and_get_value<int>(yaml_node, "num_threads_building", config.num_threads_building);
     check_and_get_value<int>(yaml_node, "num_threads_searching", config.num_threads_searching);
 
@@ -142,6 +221,7 @@ EvalConfig::Load(YAML::Node& yaml_node, const eval_job& global_options) {
         config.enable_percent_latency = false;
         disable = false;
     }
+    check_and_get_value<bool>(yaml_node, "enable_perf_counters", config.enable_perf_counters);
 
     return config;
 }
@@ -166,6 +246,10 @@ EvalConfig::CheckKeyAndType(YAML::Node& yaml_node) {
     check_and_get_value<bool>(yaml_node, "disable_memory");
     check_and_get_value<bool>(yaml_node, "disable_latency");
     check_and_get_value<bool>(yaml_node, "disable_percent_latency");
+    check_and_get_value<bool>(yaml_node, "enable_perf_counters");
+    check_and_get_value<uint64_t>(yaml_node, "sweep_warmup_query_count");
+    load_search_sweep(yaml_node["search_sweep"]);
+    load_mixed_workload(yaml_node["mixed_workload"]);
 }
 
 }  // namespace vsag::eval
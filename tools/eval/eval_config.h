@@ -16,6 +16,8 @@
 #pragma once
 
 #include "argparse/argparse.hpp"
+#include "case/mixed_workload.h"
+#include "case/search_sweep.h"
 #include "eval_job.h"
 #include "yaml-cpp/yaml.h"
 
@@ -46,6 +48,13 @@ public:
     uint64_t search_query_count{100'000L};
     bool delete_index_after_search{false};
 
+    // sweep mode: every point of the grid runs as one search with the monitors below
+    std::vector<SweepAxis> search_sweep;
+    uint64_t sweep_warmup_query_count{1000};
+
+    // `mixed` cases: concurrent insert/delete/update/search replay
+    MixedWorkloadConfig mixed_workload;
+
     int32_t num_threads_building{1};
     int32_t num_threads_searching{1};
 
@@ -56,6 +65,7 @@ public:
     bool enable_memory{true};
     bool enable_latency{true};
     bool enable_percent_latency{true};
+    bool enable_perf_counters{false};
     bool use_id_based_recall{false};
 
     EvalConfig() = default;
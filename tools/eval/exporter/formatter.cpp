@@ -19,6 +19,7 @@
 #include <string>
 
 #include "../common.h"
+#include "formatter_csv.h"
 #include "formatter_json.h"
 #include "formatter_lineproto.h"
 #include "formatter_table.h"
@@ -33,6 +34,9 @@ Formatter::Create(const std::string& format) {
     if (format == "text" or format == "table") {
         return std::make_shared<TableFormatter>();
     }
+    if (format == "csv") {
+        return std::make_shared<CsvFormatter>();
+    }
     if (format == "line_protocol") {
         return std::make_shared<LineProtocolFormatter>();
     }
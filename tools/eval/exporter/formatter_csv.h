@@ -0,0 +1,98 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <sstream>
+#include <string>
+
+#include "./formatter.h"
+
+namespace vsag::eval {
+
+/**
+ * One row per search measurement: every point of a search sweep, or the top-level
+ * metrics of an ordinary search case. Cases without search metrics are skipped.
+ */
+class CsvFormatter : public Formatter {
+public:
+    std::string
+    Format(vsag::eval::JsonType& results) override {
+        std::stringstream ss;
+        ss << "name,index,search_param,recall_avg,qps,latency_avg(ms),latency_p50(ms),"
+              "latency_p99(ms),dist_cmp_avg,distance_evaluations_avg,pareto\n";
+        for (const auto& [key, value] : results.items()) {
+            JSON_GET(index_name, value["index"], "");
+            if (value.contains("sweep_points")) {
+                for (const auto& point : value["sweep_points"]) {
+                    JSON_GET(p50, number(point["latency_p50(ms)"]), "");
+                    JSON_GET(p99, number(point["latency_p99(ms)"]), "");
+                    JSON_GET(dist_cmp, number(point["dist_cmp_avg"]), "");
+                    JSON_GET(evals, number(point["distance_evaluations_avg"]), "");
+                    ss << quote(key) << "," << quote(index_name) << ","
+                       << quote(point.value("search_param", "")) << ","
+                       << number(point["recall_avg"]) << "," << number(point["qps"]) << ","
+                       << number(point["latency_avg(ms)"]) << "," << p50 << "," << p99 << ","
+                       << dist_cmp << "," << evals << ","
+                       << (point.value("pareto", false) ? "true" : "false") << "\n";
+                }
+                continue;
+            }
+            if (not value.contains("qps")) {
+                continue;
+            }
+            JSON_GET(search_param, value["search_param"], "");
+            JSON_GET(recall_avg, number(value["recall_avg"]), "");
+            JSON_GET(latency_avg, number(value["latency_avg(ms)"]), "");
+            JSON_GET(p50, number(value["latency_detail(ms)"]["p50"]), "");
+            JSON_GET(p99, number(value["latency_detail(ms)"]["p99"]), "");
+            JSON_GET(dist_cmp, number(value["statistics_avg_per_query"]["dist_cmp"]), "");
+            JSON_GET(evals,
+                     number(value["statistics_avg_per_query"]["distance_evaluations"]),
+                     "");
+            ss << quote(key) << "," << quote(index_name) << "," << quote(search_param) << ","
+               << recall_avg << "," << number(value["qps"]) << "," << latency_avg << "," << p50
+               << "," << p99 << "," << dist_cmp << "," << evals << ",\n";
+        }
+        return ss.str();
+    }
+
+private:
+    static std::string
+    number(const vsag::eval::JsonType& value) {
+        if (not value.is_number()) {
+            return "";
+        }
+        return value.dump();
+    }
+
+    static std::string
+    quote(const std::string& field) {
+        if (field.find_first_of(",\"\n") == std::string::npos) {
+            return field;
+        }
+        std::string quoted = "\"";
+        for (auto c : field) {
+            if (c == '"') {
+                quoted += '"';
+            }
+            quoted += c;
+        }
+        quoted += '"';
+        return quoted;
+    }
+};
+
+}  // namespace vsag::eval
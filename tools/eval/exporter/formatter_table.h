@@ -78,7 +78,40 @@ public:
         }
 
         table.column(6).format().width(40);
-        return table.str();
+        auto output = table.str();
+        for (const auto& [key, value] : results.items()) {
+            if (value.contains("pareto_frontier")) {
+                output += "\n" + format_pareto_frontier(key, value["pareto_frontier"]);
+            }
+        }
+        return output;
+    }
+
+private:
+    static std::string
+    format_pareto_frontier(const std::string& name, const vsag::eval::JsonType& frontier) {
+        using namespace tabulate;
+        Table table;
+        table.add_row({"Name",
+                       "SearchParam",
+                       "RecallAvg",
+                       "QPS",
+                       "LatencyP50(ms)",
+                       "LatencyP99(ms)",
+                       "DistanceEvaluations"});
+        for (const auto& point : frontier) {
+            JSON_GET(search_param, point["search_param"], "N/A");
+            JSON_GET(recall_avg, std::to_string(point["recall_avg"].get<float>()), "N/A");
+            JSON_GET(qps, std::to_string(point["qps"].get<float>()), "N/A");
+            JSON_GET(p50, std::to_string(point["latency_p50(ms)"].get<float>()), "N/A");
+            JSON_GET(p99, std::to_string(point["latency_p99(ms)"].get<float>()), "N/A");
+            JSON_GET(evals,
+                     std::to_string(point["distance_evaluations_avg"].get<float>()),
+                     "N/A");
+            table.add_row({name, search_param, recall_avg, qps, p50, p99, evals});
+        }
+        table.column(1).format().width(40);
+        return "Pareto frontier (recall vs qps):\n" + table.str();
     }
 };
 
@@ -105,6 +105,9 @@ parse_args(argparse::ArgumentParser& parser, int argc, char** argv) {
     parser.add_argument("--disable_percent_latency")
         .default_value(false)
         .help("Disable percent latency eval, include p50, p80, p90, p95, p99");
+    parser.add_argument("--enable_perf_counters")
+        .default_value(false)
+        .help("Sample hardware performance counters (perf_event_open) during build and search");
 
     try {
         parser.parse_args(argc, argv);
@@ -83,6 +83,8 @@ LatencyMonitor::cal_and_set_result(const std::string& metric, Monitor::JsonType&
             auto val = this->cal_latency_rate(percent * 0.01);
             result["latency_detail(ms)"]["p" + std::to_string(int(percent))] = val;
         }
+    } else if (metric == "latency_histogram") {
+        result["latency_histogram(ms)"] = this->cal_latency_histogram();
     }
 }
 
@@ -113,4 +115,28 @@ LatencyMonitor::cal_latency_rate(double rate) {
     auto pos = static_cast<uint64_t>(rate * static_cast<double>(this->latency_records_.size() - 1));
     return latency_records_[pos];
 }
+
+Monitor::JsonType
+LatencyMonitor::cal_latency_histogram() const {
+    // power-of-two buckets from 1/16 ms to 1024 ms, keyed by their inclusive upper bound
+    constexpr double kFirstBound = 0.0625;
+    constexpr uint64_t kBucketCount = 15;
+    std::vector<uint64_t> counts(kBucketCount + 1, 0);
+    for (auto latency : this->latency_records_) {
+        uint64_t bucket = 0;
+        double bound = kFirstBound;
+        while (bucket < kBucketCount and latency > bound) {
+            bound *= 2;
+            ++bucket;
+        }
+        ++counts[bucket];
+    }
+    JsonType histogram = JsonType::array();
+    double bound = kFirstBound;
+    for (uint64_t i = 0; i < kBucketCount; ++i, bound *= 2) {
+        histogram.push_back({{"le", bound}, {"count", counts[i]}});
+    }
+    histogram.push_back({{"le", "inf"}, {"count", counts[kBucketCount]}});
+    return histogram;
+}
 }  // namespace vsag::eval
@@ -61,6 +61,9 @@ private:
     double
     cal_latency_rate(double rate);
 
+    JsonType
+    cal_latency_histogram() const;
+
 private:
     std::vector<double> latency_records_;
 
@@ -161,4 +161,23 @@ TEST_CASE("LatencyMonitor handles an empty timing batch", "[ut][eval][latency_mo
     RequireNear(result["measurement_duration(s)"].get<double>(), 0.0);
 }
 
+TEST_CASE("LatencyMonitor buckets latencies into a histogram", "[ut][eval][latency_monitor]") {
+    LatencyMonitor monitor;
+    monitor.SetMetrics("latency_histogram");
+    monitor.Start();
+    monitor.SetTimingBatch(LatencyTimingBatch{{0.01, 0.0625, 0.07, 3.0, 5000.0}, 5, 1.0});
+    monitor.Stop();
+
+    const auto histogram = monitor.GetResult()["latency_histogram(ms)"];
+    REQUIRE(histogram.size() == 16);
+    RequireNear(histogram[0]["le"].get<double>(), 0.0625);
+    REQUIRE(histogram[0]["count"].get<uint64_t>() == 2);
+    REQUIRE(histogram[1]["count"].get<uint64_t>() == 1);
+    // 3.0 ms falls into (2, 4]
+    RequireNear(histogram[6]["le"].get<double>(), 4.0);
+    REQUIRE(histogram[6]["count"].get<uint64_t>() == 1);
+    REQUIRE(histogram[15]["le"].get<std::string>() == "inf");
+    REQUIRE(histogram[15]["count"].get<uint64_t>() == 1);
+}
+
 }  // namespace vsag::eval
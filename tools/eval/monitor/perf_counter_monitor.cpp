@@ -0,0 +1,220 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "perf_counter_monitor.h"
+
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <filesystem>
+#endif
+
+namespace vsag::eval {
+
+namespace {
+
+#if defined(__linux__)
+constexpr uint64_t
+cache_miss_config(uint64_t cache) {
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+int
+open_counter(uint32_t type, uint64_t config, pid_t tid) {
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.inherit = 1;
+    // user space only, so the counters open under perf_event_paranoid=2
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, tid, -1, -1, 0));
+}
+
+std::vector<pid_t>
+process_threads() {
+    std::vector<pid_t> tids;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator("/proc/self/task", ec)) {
+        tids.emplace_back(static_cast<pid_t>(std::stol(entry.path().filename().string())));
+    }
+    if (tids.empty()) {
+        tids.emplace_back(0);
+    }
+    return tids;
+}
+#endif
+
+}  // namespace
+
+PerfCounterMonitor::PerfCounterMonitor(std::string phase)
+    : Monitor("perf_counter_monitor"), phase_(std::move(phase)) {
+#if defined(__linux__)
+    counters_ = {
+        {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {"llc_misses", PERF_TYPE_HW_CACHE, cache_miss_config(PERF_COUNT_HW_CACHE_LL)},
+        {"dtlb_misses", PERF_TYPE_HW_CACHE, cache_miss_config(PERF_COUNT_HW_CACHE_DTLB)},
+        {"branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    };
+#else
+    unavailable_reason_ = "perf_event_open is only supported on Linux";
+#endif
+}
+
+PerfCounterMonitor::~PerfCounterMonitor() {
+    this->close_counters();
+}
+
+void
+PerfCounterMonitor::Start() {
+    this->close_counters();
+    recorded_count_.store(0, std::memory_order_relaxed);
+#if defined(__linux__)
+    // a counter per existing thread (the OpenMP pool is usually alive already) plus inherit for
+    // threads spawned during the phase
+    unavailable_reason_.clear();
+    auto tids = process_threads();
+    for (auto& counter : counters_) {
+        counter.value = 0.0;
+        int open_errno = 0;
+        for (auto tid : tids) {
+            int fd = open_counter(counter.type, counter.config, tid);
+            if (fd >= 0) {
+                counter.fds.emplace_back(fd);
+            } else {
+                open_errno = errno;
+            }
+        }
+        counter.available = not counter.fds.empty();
+        if (not counter.available and unavailable_reason_.empty()) {
+            unavailable_reason_ = counter.name + ": " + std::strerror(open_errno);
+        }
+    }
+    for (auto& counter : counters_) {
+        for (auto fd : counter.fds) {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+}
+
+void
+PerfCounterMonitor::Stop() {
+#if defined(__linux__)
+    for (auto& counter : counters_) {
+        for (auto fd : counter.fds) {
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+    for (auto& counter : counters_) {
+        for (auto fd : counter.fds) {
+            uint64_t values[3] = {0, 0, 0};  // value, time enabled, time running
+            if (read(fd, values, sizeof(values)) != static_cast<ssize_t>(sizeof(values)) or
+                values[2] == 0) {
+                continue;
+            }
+            // scale up when the kernel multiplexed the counter with other events
+            counter.value += static_cast<double>(values[0]) * static_cast<double>(values[1]) /
+                             static_cast<double>(values[2]);
+        }
+    }
+#endif
+    this->close_counters();
+}
+
+Monitor::JsonType
+PerfCounterMonitor::GetResult() {
+    JsonType perf;
+    bool available = false;
+    for (const auto& counter : counters_) {
+        if (counter.available) {
+            perf["total"][counter.name] = counter.value;
+            available = true;
+        }
+    }
+    perf["available"] = available;
+    if (not unavailable_reason_.empty()) {
+        perf["unavailable_reason"] = unavailable_reason_;
+    }
+    if (available) {
+        perf["operation_count"] = this->operation_count();
+        perf["per_operation"] = this->GetPerOperation();
+        const auto& total = perf["total"];
+        if (total.contains("cycles") and total.contains("instructions") and
+            total["cycles"].get<double>() > 0) {
+            perf["ipc"] = total["instructions"].get<double>() / total["cycles"].get<double>();
+        }
+    }
+    JsonType result;
+    result["perf_counters(" + phase_ + ")"] = perf;
+    return result;
+}
+
+void
+PerfCounterMonitor::Record(void* input) {
+    recorded_count_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void
+PerfCounterMonitor::SetOperationCount(uint64_t operation_count) {
+    fixed_operation_count_ = operation_count;
+}
+
+Monitor::JsonType
+PerfCounterMonitor::GetPerOperation() const {
+    JsonType per_operation = JsonType::object();
+    auto count = this->operation_count();
+    if (count == 0) {
+        return per_operation;
+    }
+    for (const auto& counter : counters_) {
+        if (counter.available) {
+            per_operation[counter.name] = counter.value / static_cast<double>(count);
+        }
+    }
+    return per_operation;
+}
+
+void
+PerfCounterMonitor::close_counters() {
+#if defined(__linux__)
+    for (auto& counter : counters_) {
+        for (auto fd : counter.fds) {
+            close(fd);
+        }
+        counter.fds.clear();
+    }
+#endif
+}
+
+uint64_t
+PerfCounterMonitor::operation_count() const {
+    return fixed_operation_count_ > 0 ? fixed_operation_count_
+                                      : recorded_count_.load(std::memory_order_relaxed);
+}
+
+}  // namespace vsag::eval
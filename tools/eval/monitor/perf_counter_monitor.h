@@ -0,0 +1,89 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "monitor.h"
+
+namespace vsag::eval {
+
+/**
+ * Counts hardware events (cycles, instructions, LLC, dTLB and branch misses) of every thread of
+ * this process between Start() and Stop() through Linux perf_event_open. Each Record() call
+ * counts one operation (a query in search passes) unless SetOperationCount() fixes the count.
+ * Counters that cannot be opened (no PMU access in containers, perf_event_paranoid, non-Linux)
+ * are reported as unavailable instead of failing the case.
+ */
+class PerfCounterMonitor : public Monitor {
+public:
+    explicit PerfCounterMonitor(std::string phase);
+
+    ~PerfCounterMonitor() override;
+
+    void
+    Start() override;
+
+    void
+    Stop() override;
+
+    JsonType
+    GetResult() override;
+
+    void
+    Record(void* input) override;
+
+    void
+    SetOperationCount(uint64_t operation_count);
+
+    /**
+     * Returns the per-operation average of every available counter, keyed by counter name.
+     */
+    JsonType
+    GetPerOperation() const;
+
+private:
+    struct Counter {
+        std::string name;
+        uint32_t type{0};
+        uint64_t config{0};
+        std::vector<int> fds;
+        double value{0.0};
+        bool available{false};
+    };
+
+    void
+    close_counters();
+
+    uint64_t
+    operation_count() const;
+
+private:
+    std::string phase_;
+
+    std::vector<Counter> counters_;
+
+    std::string unavailable_reason_;
+
+    std::atomic<uint64_t> recorded_count_{0};
+
+    uint64_t fixed_operation_count_{0};
+};
+
+}  // namespace vsag::eval
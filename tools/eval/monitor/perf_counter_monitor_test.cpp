@@ -0,0 +1,66 @@
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "perf_counter_monitor.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <string>
+
+namespace vsag::eval {
+
+TEST_CASE("PerfCounterMonitor reports counters or why they are unavailable",
+          "[ut][eval][perf_counter_monitor]") {
+    PerfCounterMonitor monitor("search");
+    monitor.Start();
+    volatile uint64_t sink = 0;
+    for (uint64_t i = 0; i < 1000000; ++i) {
+        sink = sink + i * i;
+    }
+    for (int i = 0; i < 4; ++i) {
+        monitor.Record(nullptr);
+    }
+    monitor.Stop();
+
+    const auto result = monitor.GetResult();
+    REQUIRE(result.contains("perf_counters(search)"));
+    const auto& perf = result["perf_counters(search)"];
+    if (not perf["available"].get<bool>()) {
+        REQUIRE(perf.contains("unavailable_reason"));
+        REQUIRE(monitor.GetPerOperation().empty());
+        return;
+    }
+    REQUIRE(perf["operation_count"].get<uint64_t>() == 4);
+    if (perf["total"].contains("instructions")) {
+        REQUIRE(perf["total"]["instructions"].get<double>() > 0);
+        REQUIRE(perf["per_operation"]["instructions"].get<double>() ==
+                perf["total"]["instructions"].get<double>() / 4);
+    }
+}
+
+TEST_CASE("PerfCounterMonitor uses a fixed operation count", "[ut][eval][perf_counter_monitor]") {
+    PerfCounterMonitor monitor("build");
+    monitor.SetOperationCount(10);
+    monitor.Start();
+    monitor.Record(nullptr);
+    monitor.Stop();
+
+    const auto result = monitor.GetResult();
+    const auto& perf = result["perf_counters(build)"];
+    if (perf["available"].get<bool>()) {
+        REQUIRE(perf["operation_count"].get<uint64_t>() == 10);
+    }
+}
+
+}  // namespace vsag::eval